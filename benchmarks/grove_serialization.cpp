@@ -81,6 +81,148 @@ static void BM_deserialization(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations() * num_intervals);
 }
 
+// ----------------------------
+// Benchmark: Parallel deserialization time
+// ----------------------------
+static void BM_deserialization_parallel(benchmark::State& state) {
+    const auto num_intervals = state.range(0);
+    const auto k = static_cast<int>(state.range(1));
+    const auto threads = static_cast<std::size_t>(state.range(2));
+
+    std::string filename = std::filesystem::current_path() / "data" /
+        (std::to_string(num_intervals) + "_intervals_sorted.txt");
+    const auto& intervals = load_intervals(filename);
+
+    std::string serialized;
+    {
+        gst::grove<gdt::interval, int> grove(k);
+        for (const auto& interval_data : intervals) {
+            grove.insert_data("chr1", interval_data.intvl, interval_data.data, gst::sorted);
+        }
+        std::ostringstream oss;
+        grove.serialize(oss);
+        serialized = oss.str();
+    }
+
+    for (auto _ : state) {
+        std::istringstream iss(serialized);
+        auto grove = gst::grove<gdt::interval, int>::deserialize(iss, threads);
+        benchmark::DoNotOptimize(grove);
+    }
+
+    state.counters["serialized_bytes"] = static_cast<double>(serialized.size());
+    state.counters["threads"] = static_cast<double>(threads);
+    state.SetItemsProcessed(state.iterations() * num_intervals);
+}
+
+// ----------------------------
+// Benchmark: Parallel serialization time
+// ----------------------------
+static void BM_serialization_parallel(benchmark::State& state) {
+    const auto num_intervals = state.range(0);
+    const auto k = static_cast<int>(state.range(1));
+    const auto threads = static_cast<std::size_t>(state.range(2));
+
+    std::string filename = std::filesystem::current_path() / "data" /
+        (std::to_string(num_intervals) + "_intervals_sorted.txt");
+    const auto& intervals = load_intervals(filename);
+
+    gst::grove<gdt::interval, int> grove(k);
+    for (const auto& interval_data : intervals) {
+        grove.insert_data("chr1", interval_data.intvl, interval_data.data, gst::sorted);
+    }
+
+    size_t serialized_bytes = 0;
+    for (auto _ : state) {
+        std::ostringstream oss;
+        grove.serialize(oss, threads);
+        serialized_bytes = oss.str().size();
+        benchmark::DoNotOptimize(serialized_bytes);
+    }
+
+    state.counters["serialized_bytes"] = static_cast<double>(serialized_bytes);
+    state.counters["threads"] = static_cast<double>(threads);
+    state.SetItemsProcessed(state.iterations() * num_intervals);
+}
+
+// ----------------------------
+// Benchmark: Block codecs — size, encode and decode throughput
+// ----------------------------
+// range(2) selects the codec (stored, zlib, zstd, lz4, zstd + dictionary).
+static gst::serialize_options codec_options(int64_t which) {
+    gst::serialize_options opts;
+    opts.codec = which == 4 ? gst::block_codec::zstd : static_cast<gst::block_codec>(which);
+    opts.dictionary_size = which == 4 ? 16 * 1024 : 0;
+    return opts;
+}
+
+static void BM_codec_encode(benchmark::State& state) {
+    const auto num_intervals = state.range(0);
+    const auto k = static_cast<int>(state.range(1));
+    const auto opts = codec_options(state.range(2));
+    if (!gst::block_codec_available(opts.codec)) {
+        state.SkipWithError("codec not available in this build");
+        return;
+    }
+
+    std::string filename = std::filesystem::current_path() / "data" /
+        (std::to_string(num_intervals) + "_intervals_sorted.txt");
+    const auto& intervals = load_intervals(filename);
+
+    gst::grove<gdt::interval, int> grove(k);
+    for (const auto& interval_data : intervals) {
+        grove.insert_data("chr1", interval_data.intvl, interval_data.data, gst::sorted);
+    }
+
+    size_t serialized_bytes = 0;
+    for (auto _ : state) {
+        std::ostringstream oss;
+        grove.serialize(oss, opts);
+        serialized_bytes = oss.str().size();
+        benchmark::DoNotOptimize(serialized_bytes);
+    }
+
+    state.counters["serialized_bytes"] = static_cast<double>(serialized_bytes);
+    state.counters["bytes_per_interval"] = static_cast<double>(serialized_bytes) / num_intervals;
+    state.SetLabel(std::string(gst::to_string(opts.codec)) + (opts.dictionary_size ? "+dict" : ""));
+    state.SetItemsProcessed(state.iterations() * num_intervals);
+}
+
+static void BM_codec_decode(benchmark::State& state) {
+    const auto num_intervals = state.range(0);
+    const auto k = static_cast<int>(state.range(1));
+    const auto opts = codec_options(state.range(2));
+    if (!gst::block_codec_available(opts.codec)) {
+        state.SkipWithError("codec not available in this build");
+        return;
+    }
+
+    std::string filename = std::filesystem::current_path() / "data" /
+        (std::to_string(num_intervals) + "_intervals_sorted.txt");
+    const auto& intervals = load_intervals(filename);
+
+    std::string serialized;
+    {
+        gst::grove<gdt::interval, int> grove(k);
+        for (const auto& interval_data : intervals) {
+            grove.insert_data("chr1", interval_data.intvl, interval_data.data, gst::sorted);
+        }
+        std::ostringstream oss;
+        grove.serialize(oss, opts);
+        serialized = oss.str();
+    }
+
+    for (auto _ : state) {
+        std::istringstream iss(serialized);
+        auto grove = gst::grove<gdt::interval, int>::deserialize(iss);
+        benchmark::DoNotOptimize(grove);
+    }
+
+    state.counters["serialized_bytes"] = static_cast<double>(serialized.size());
+    state.SetLabel(std::string(gst::to_string(opts.codec)) + (opts.dictionary_size ? "+dict" : ""));
+    state.SetItemsProcessed(state.iterations() * num_intervals);
+}
+
 // ----------------------------
 // Apply argument combinations
 // ----------------------------
@@ -95,6 +237,22 @@ static void ApplyArgs(benchmark::internal::Benchmark* b) {
     }
 }
 
+static void ApplyParallelArgs(benchmark::internal::Benchmark* b) {
+    for (int k : {3, 10, 50}) {
+        for (int threads : {1, 2, 4, 8}) {
+            b->Args({5000, k, threads});
+        }
+    }
+}
+
+static void ApplyCodecArgs(benchmark::internal::Benchmark* b) {
+    for (int k : {3, 10, 50}) {
+        for (int codec = 0; codec <= 4; ++codec) {
+            b->Args({5000, k, codec});
+        }
+    }
+}
+
 // ----------------------------
 // Register benchmarks
 // ----------------------------
@@ -104,4 +262,22 @@ BENCHMARK(BM_serialization_size)
 
 BENCHMARK(BM_deserialization)
     ->Apply(ApplyArgs)
-    ->Unit(benchmark::kMicrosecond);
\ No newline at end of file
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_serialization_parallel)
+    ->Apply(ApplyParallelArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_deserialization_parallel)
+    ->Apply(ApplyParallelArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_codec_encode)
+    ->Apply(ApplyCodecArgs)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_codec_decode)
+    ->Apply(ApplyCodecArgs)
+    ->Unit(benchmark::kMicrosecond);
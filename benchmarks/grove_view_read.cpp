@@ -10,6 +10,8 @@
 // The view path trades a whole-file inflate for a cheap index scan + a handful
 // of block loads, so it wins on read+query latency for a large index — and
 // touches a tiny fraction of the blocks (reported as a counter).
+// BM_read_view_range_scan measures a wide scan over leaves packed several to a
+// frame (serialize_options::blocks_per_frame), counting the frames decoded.
 
 // genogrove
 #include <genogrove/structure/grove/grove.hpp>
@@ -31,7 +33,8 @@ namespace {
 
 // Build the grove from the sorted dataset and serialize it to a temp .gg.
 // grove_view needs a seekable file, so the payload goes to disk (not a stream).
-fs::path prepare_gg(int num_intervals, int order, const char* tag) {
+fs::path prepare_gg(int num_intervals, int order, const char* tag,
+                    const gst::serialize_options& opts = {}) {
     std::string filename = fs::current_path() / "data" /
         (std::to_string(num_intervals) + "_intervals_sorted.txt");
     const auto& intervals = load_intervals(filename);
@@ -44,7 +47,7 @@ fs::path prepare_gg(int num_intervals, int order, const char* tag) {
         ("gg_view_bench_" + std::string(tag) + "_" + std::to_string(num_intervals) +
          "_" + std::to_string(order) + ".gg");
     std::ofstream ofs(path, std::ios::binary);
-    grove.serialize(ofs);
+    grove.serialize(ofs, opts);
     return path;
 }
 
@@ -56,6 +59,16 @@ gdt::interval mid_query(int num_intervals) {
     return intervals[intervals.size() / 2].intvl;
 }
 
+// A query spanning the middle tenth of the (sorted) dataset.
+gdt::interval range_query(int num_intervals) {
+    std::string filename = fs::current_path() / "data" /
+        (std::to_string(num_intervals) + "_intervals_sorted.txt");
+    const auto& intervals = load_intervals(filename);
+    const std::size_t first = intervals.size() * 9 / 20;
+    const std::size_t last = intervals.size() * 11 / 20;
+    return gdt::interval{intervals[first].intvl.get_start(), intervals[last].intvl.get_end()};
+}
+
 } // namespace
 
 // ----------------------------
@@ -105,6 +118,33 @@ static void BM_read_view(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
+// ----------------------------
+// Lazy range scan: open + a wide query walking many adjacent leaves
+// ----------------------------
+static void BM_read_view_range_scan(benchmark::State& state) {
+    const auto num_intervals = static_cast<int>(state.range(0));
+    const auto order = static_cast<int>(state.range(1));
+    gst::serialize_options opts;
+    opts.blocks_per_frame = static_cast<std::size_t>(state.range(2));
+    fs::path path = prepare_gg(num_intervals, order, "range", opts);
+    const gdt::interval query = range_query(num_intervals);
+
+    std::size_t blocks_loaded = 0;
+    std::size_t frames_loaded = 0;
+    for (auto _ : state) {
+        auto view = gst::grove_view<gdt::interval, int>::open(path.string());
+        auto hits = view.intersect(query, "chr1").get_keys().size();
+        benchmark::DoNotOptimize(hits);
+        blocks_loaded = view.blocks_loaded();
+        frames_loaded = view.frames_loaded();
+    }
+
+    fs::remove(path);
+    state.counters["blocks_loaded"] = static_cast<double>(blocks_loaded);
+    state.counters["frames_loaded"] = static_cast<double>(frames_loaded);
+    state.SetItemsProcessed(state.iterations());
+}
+
 // ----------------------------
 // Argument combinations: dataset size x tree order
 // ----------------------------
@@ -116,5 +156,17 @@ static void ApplyReadArgs(benchmark::internal::Benchmark* b) {
     }
 }
 
+// dataset size x tree order x blocks per frame
+static void ApplyRangeScanArgs(benchmark::internal::Benchmark* b) {
+    for (int n : {1000, 10000}) {
+        for (int k : {3, 32}) {
+            for (int per_frame : {1, 8, 64}) {
+                b->Args({n, k, per_frame});
+            }
+        }
+    }
+}
+
 BENCHMARK(BM_read_eager)->Apply(ApplyReadArgs)->Unit(benchmark::kMicrosecond);
-BENCHMARK(BM_read_view)->Apply(ApplyReadArgs)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
+BENCHMARK(BM_read_view)->Apply(ApplyReadArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_read_view_range_scan)->Apply(ApplyRangeScanArgs)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
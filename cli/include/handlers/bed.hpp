@@ -11,6 +11,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <genogrove/data_type/interval.hpp>
+#include <genogrove/data_type/interval32.hpp>
 #include <genogrove/data_type/key.hpp>
 #include <genogrove/io/bed_reader.hpp>
 #include <genogrove/structure/grove/grove.hpp>
@@ -35,22 +36,29 @@ using name_to_key_map = handlers::name_to_key_map<gio::bed_entry>;
 // name are silently omitted from the map (no link can reference them). A
 // duplicate name across two records throws `std::runtime_error`, since
 // `--links` requires every reachable name to resolve to exactly one interval.
+//
+// Instantiated for `gdt::interval` and `gdt::interval32`; with the latter a
+// record beyond 32-bit coordinates throws std::invalid_argument.
+template <typename key_t>
 void grove_insert(
-    ggs::grove<gdt::interval, gio::bed_entry, std::string>& grove,
+    ggs::grove<key_t, gio::bed_entry, std::string>& grove,
     const std::string& filepath,
     bool sorted = false,
-    name_to_key_map* name_map = nullptr
+    handlers::name_to_key_map<gio::bed_entry, key_t>* name_map = nullptr
 );
 
-// Iterate a BED query file, invoking cb(interval, chrom) for each record. The
-// interval is in the CLI's canonical 0-based-inclusive space (BED is natively
-// 0-based half-open, hence end-1). Split from result printing so a BED query
-// can run against a target of any payload type (see run_intersect).
+// Iterate a BED query file, invoking cb(interval, chrom, chrom_id) for each
+// record. The interval is in the CLI's canonical 0-based-inclusive space (BED
+// is natively 0-based half-open, hence end-1); chrom_id is the reader's dense
+// chromosome id, for resolving index handles once per chromosome. Split from
+// result printing so a BED query can run against a target of any payload type
+// (see run_intersect).
 template <typename F>
 void for_each_bed_query(const std::string& queryfile, F&& cb) {
     gio::bed_reader reader(queryfile);
     for (const auto& query_entry : reader) {
-        cb(gdt::interval(query_entry.start, query_entry.end - 1), query_entry.chrom);
+        cb(gdt::interval(query_entry.start, query_entry.end - 1), query_entry.chrom,
+           query_entry.chrom_id);
     }
 }
 
@@ -11,6 +11,8 @@
 #include <ostream>
 #include <genogrove/structure/grove/grove.hpp>
 #include <genogrove/data_type/interval.hpp>
+#include <genogrove/data_type/interval32.hpp>
+#include <genogrove/io/compact_gff_entry.hpp>
 #include <genogrove/io/gff_reader.hpp>
 #include <handlers/name_map.hpp>
 
@@ -22,27 +24,36 @@ namespace ggs = genogrove::structure;
 namespace gio = genogrove::io;
 
 // GFF/GTF links match on a chosen attribute value. See handlers/name_map.hpp.
-using name_to_key_map = handlers::name_to_key_map<gio::gff_entry>;
+using name_to_key_map = handlers::name_to_key_map<gio::compact_gff_entry>;
 
 // Insert GFF/GTF file entries into a grove. When sorted is true, entries are
 // inserted via the sorted-append fast path — the caller asserts the file is
 // already ordered.
 //
+// Records are stored as `compact_gff_entry`: seqid, source, type and attribute
+// keys are interned in `gio::gff_field_registry`, so a GTF grove holds each
+// repeated string once. Whoever serializes the grove must write that registry
+// with it (see gg_payload_type::GFF_COMPACT).
+//
 // When name_map is non-null, each entry's `name_tag` attribute value is
 // recorded alongside the key pointer returned by `insert_data()`, for
 // `idx --links` resolution. Unlike BED's optional column-4 name, the attribute
 // is mandatory here: a record missing `name_tag` throws (the user picked that
 // tag as the identifier), as does a duplicate value across two records —
 // `--links` requires every name to resolve to exactly one interval.
+//
+// Instantiated for `gdt::interval` and `gdt::interval32`, as for BED.
+template <typename key_t>
 void grove_insert(
-    ggs::grove<gdt::interval, gio::gff_entry, std::string>& grove,
+    ggs::grove<key_t, gio::compact_gff_entry, std::string>& grove,
     const std::string& filepath,
     bool sorted = false,
-    name_to_key_map* name_map = nullptr,
+    handlers::name_to_key_map<gio::compact_gff_entry, key_t>* name_map = nullptr,
     std::string_view name_tag = {}
 );
 
-// Iterate a GFF/GTF query file, invoking cb(interval, seqid) for each record.
+// Iterate a GFF/GTF query file, invoking cb(interval, seqid, -1) for each
+// record (gff_reader assigns no contig ids, so handles resolve by name).
 // The interval is converted to the CLI's canonical 0-based-inclusive space:
 // GFF is 1-based inclusive, so [start, end] -> interval(start-1, end-1). This
 // matches the BED conversion, so a GFF query and a BED query over the same
@@ -52,7 +63,7 @@ template <typename F>
 void for_each_gff_query(const std::string& queryfile, F&& cb) {
     gio::gff_reader reader(queryfile);
     for (const auto& query_entry : reader) {
-        cb(gdt::interval(query_entry.start - 1, query_entry.end - 1), query_entry.seqid);
+        cb(gdt::interval(query_entry.start - 1, query_entry.end - 1), query_entry.seqid, -1);
     }
 }
 
@@ -62,6 +73,11 @@ inline void print_gff_result(std::ostream& output, const gio::gff_entry& payload
     output << payload.seqid << "\t" << payload.start << "\t" << payload.end << "\n";
 }
 
+// Same row for a compact GFF payload (seqid resolved through the registry).
+inline void print_compact_gff_result(std::ostream& output, const gio::compact_gff_entry& payload) {
+    output << payload.get_seqid() << "\t" << payload.start << "\t" << payload.end << "\n";
+}
+
 } // namespace gff
 } // namespace handlers
 
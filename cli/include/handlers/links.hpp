@@ -6,6 +6,7 @@
 #ifndef GENOGROVE_CLI_HANDLERS_LINKS_HPP
 #define GENOGROVE_CLI_HANDLERS_LINKS_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <fstream>
 #include <istream>
@@ -15,11 +16,13 @@
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <genogrove/data_type/interval.hpp>
 #include <genogrove/data_type/key.hpp>
 #include <genogrove/structure/grove/grove.hpp>
+#include <genogrove/utility/parallel.hpp>
 #include <handlers/name_map.hpp>
 
 namespace handlers {
@@ -55,20 +58,28 @@ struct link_row {
 // metadata is kept as two parallel edges. Returns the number of distinct edges
 // added.
 //
+// Name lookups are spread over `num_threads` workers (0 = one per core); the
+// map is only read, so they need no locking. The distinct edges are then
+// handed to grove.add_edges as one batch, in file order. Nothing is added
+// unless every name resolves.
+//
 // The grove's edge_data_type is std::string (the CLI attaches metadata as a
 // raw string). Templated on the payload so it serves both BED (`bed_entry`) and
-// GFF/GTF (`gff_entry`) groves — only the name-map key differs.
+// GFF/GTF (`compact_gff_entry`) groves — only the name-map key differs — and on the
+// interval key type (`interval` or `interval32`).
 //
 // Throws std::runtime_error on:
 //   - file open failure
 //   - parser errors (delegated to parse_links_tsv)
-//   - a name that is not present in name_map — the message names the
-//     missing name so the user can fix the input
-template <typename payload_t>
+//   - a name that is not present in name_map — the message names the first
+//     missing name in file order, whatever the thread count, so the user can
+//     fix the input
+template <typename key_t, typename payload_t>
 std::size_t apply_to_grove(
-    ggs::grove<gdt::interval, payload_t, std::string>& grove,
+    ggs::grove<key_t, payload_t, std::string>& grove,
     const std::string& links_path,
-    const handlers::name_to_key_map<payload_t>& name_map
+    const handlers::name_to_key_map<payload_t, key_t>& name_map,
+    std::size_t num_threads = 1
 ) {
     std::ifstream in(links_path);
     if (!in) {
@@ -76,37 +87,45 @@ std::size_t apply_to_grove(
     }
     const auto rows = parse_links_tsv(in);
 
+    // Resolve in fixed-size chunks so small files stay on one thread. A name
+    // that is not in the map leaves its slot null.
+    using key_ptr = gdt::key<key_t, payload_t>*;
+    constexpr std::size_t chunk_rows = 4096;
+    std::vector<std::pair<key_ptr, key_ptr>> resolved(rows.size(), {nullptr, nullptr});
+    auto lookup = [&name_map](const std::string& name) -> key_ptr {
+        const auto it = name_map.find(std::string_view(name));
+        return it == name_map.end() ? nullptr : it->second;
+    };
+    genogrove::utility::parallel_for(
+        (rows.size() + chunk_rows - 1) / chunk_rows, num_threads, [&](std::size_t chunk) {
+            const std::size_t end = std::min(rows.size(), (chunk + 1) * chunk_rows);
+            for (std::size_t i = chunk * chunk_rows; i < end; ++i) {
+                resolved[i] = {lookup(rows[i].source), lookup(rows[i].target)};
+            }
+        });
+
     // Collapse identical rows so each distinct edge is added at most once.
     // Names are still resolved on every row, so a typo on a duplicate line is
     // still reported. The metadata is part of the key: the same pair with two
-    // different metadata values is two distinct edges, not a duplicate.
-    using key_ptr = gdt::key<gdt::interval, payload_t>*;
+    // different metadata values is two distinct edges, not a duplicate. A
+    // 2-column row gets the empty string, exactly what add_edge(source, target)
+    // would attach (the parser never yields empty metadata).
     std::set<std::tuple<key_ptr, key_ptr, std::optional<std::string>>> seen;
-
-    std::size_t edges_added = 0;
-    for (const auto& row : rows) {
-        const auto it_a = name_map.find(std::string_view(row.source));
-        if (it_a == name_map.end()) {
+    std::vector<std::tuple<key_ptr, key_ptr, std::string>> edges;
+    edges.reserve(rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const auto& row = rows[i];
+        const auto [source, target] = resolved[i];
+        if (!source || !target) {
             throw std::runtime_error(
-                "Error: links file references name '" + row.source +
+                "Error: links file references name '" + (source ? row.target : row.source) +
                 "' which is not present as an indexed record name");
         }
-        const auto it_b = name_map.find(std::string_view(row.target));
-        if (it_b == name_map.end()) {
-            throw std::runtime_error(
-                "Error: links file references name '" + row.target +
-                "' which is not present as an indexed record name");
-        }
-        if (seen.emplace(it_a->second, it_b->second, row.metadata).second) {
-            if (row.metadata) {
-                grove.add_edge(it_a->second, it_b->second, *row.metadata);
-            } else {
-                grove.add_edge(it_a->second, it_b->second);
-            }
-            ++edges_added;
+        if (seen.emplace(source, target, row.metadata).second) {
+            edges.emplace_back(source, target, row.metadata.value_or(std::string{}));
         }
     }
-    return edges_added;
+    return grove.add_edges(edges);
 }
 
 } // namespace links
@@ -6,6 +6,8 @@
 #ifndef GENOGROVE_CLI_HANDLERS_QUERYABLE_HPP
 #define GENOGROVE_CLI_HANDLERS_QUERYABLE_HPP
 
+#include <algorithm>
+#include <optional>
 #include <string_view>
 
 #include <genogrove/data_type/interval.hpp>
@@ -14,15 +16,32 @@ namespace handlers {
 
 namespace gdt = genogrove::data_type;
 
-// A grove-like type the intersect runner can query: it exposes
-// intersect(interval, index). Satisfied by both the in-memory grove<> and the
-// partial-read grove_view<>, so run_intersect is written once over either and
-// a non-grove argument fails at the boundary instead of deep in the body.
-template <typename G>
-concept interval_queryable = requires(G& g, const gdt::interval& q, std::string_view idx) {
-    g.intersect(q, idx);
+// A grove-like type the intersect runner can query: it resolves index names
+// to handles and exposes intersect(key_t, handle) for its interval key type.
+// Satisfied by both the in-memory grove<> and the partial-read grove_view<>,
+// so run_intersect is written once over either and a non-grove argument fails
+// at the boundary instead of deep in the body.
+template <typename G, typename key_t = gdt::interval>
+concept interval_queryable = requires(G& g, const key_t& q, std::string_view idx) {
+    g.intersect(q, g.resolve_index(idx));
 };
 
+// Convert a query interval (readers emit gdt::interval) to the index's key
+// type. A compact key cannot hold positions past its max_position, and no
+// indexed interval lies there, so the query is clipped to that range — or
+// dropped (std::nullopt) when it starts beyond it.
+template <typename key_t>
+std::optional<key_t> to_query_key(const gdt::interval& query) {
+    if constexpr (requires { key_t::max_position; }) {
+        if (query.get_start() > key_t::max_position) {
+            return std::nullopt;
+        }
+        return key_t(query.get_start(), std::min(query.get_end(), key_t::max_position));
+    } else {
+        return key_t(query.get_start(), query.get_end());
+    }
+}
+
 } // namespace handlers
 
 #endif // GENOGROVE_CLI_HANDLERS_QUERYABLE_HPP
\ No newline at end of file
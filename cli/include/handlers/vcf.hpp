@@ -16,7 +16,8 @@ namespace vcf {
 namespace gdt = genogrove::data_type;
 namespace gio = genogrove::io;
 
-// Iterate a VCF/BCF query file, invoking cb(interval, chrom) for each record.
+// Iterate a VCF/BCF query file, invoking cb(interval, chrom, contig_id) for
+// each record (contig_id is htslib's rid, for resolving index handles).
 // vcf_entry is 0-based half-open (end = pos + len(REF)), so [start, end) ->
 // interval(start, end - 1), matching the BED conversion — a VCF query and a BED
 // query over the same physical region produce the same interval. len(REF) >= 1
@@ -26,7 +27,8 @@ template <typename F>
 void for_each_vcf_query(const std::string& queryfile, F&& cb) {
     gio::vcf_reader reader(queryfile);
     for (const auto& query_entry : reader) {
-        cb(gdt::interval(query_entry.start, query_entry.end - 1), query_entry.chrom);
+        cb(gdt::interval(query_entry.start, query_entry.end - 1), query_entry.chrom,
+           query_entry.contig_id);
     }
 }
 
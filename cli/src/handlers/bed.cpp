@@ -8,19 +8,22 @@
 namespace handlers {
 namespace bed {
 
+template <typename key_t>
 void grove_insert(
-    ggs::grove<gdt::interval, gio::bed_entry, std::string>& grove,
+    ggs::grove<key_t, gio::bed_entry, std::string>& grove,
     const std::string& filepath,
     bool sorted,
-    name_to_key_map* name_map
+    handlers::name_to_key_map<gio::bed_entry, key_t>* name_map
 ) {
     gio::bed_reader reader(filepath);
+    ggs::index_handle_map handles;
 
     for (const auto& entry : reader) {
-        gdt::interval iv(entry.start, entry.end - 1);
-        gdt::key<gdt::interval, gio::bed_entry>* key_ptr = sorted
-            ? grove.insert_data(entry.chrom, iv, entry, ggs::sorted)
-            : grove.insert_data(entry.chrom, iv, entry);
+        key_t iv(entry.start, entry.end - 1);
+        const auto index = handles.get(grove, entry.chrom_id, entry.chrom);
+        gdt::key<key_t, gio::bed_entry>* key_ptr = sorted
+            ? grove.insert_data(index, iv, entry, ggs::sorted)
+            : grove.insert_data(index, iv, entry);
 
         if (name_map && key_ptr->get_data().name.has_value()) {
             const auto& name_str = *key_ptr->get_data().name;
@@ -35,5 +38,12 @@ void grove_insert(
     }
 }
 
+template void grove_insert<gdt::interval>(
+    ggs::grove<gdt::interval, gio::bed_entry, std::string>&, const std::string&, bool,
+    handlers::name_to_key_map<gio::bed_entry, gdt::interval>*);
+template void grove_insert<gdt::interval32>(
+    ggs::grove<gdt::interval32, gio::bed_entry, std::string>&, const std::string&, bool,
+    handlers::name_to_key_map<gio::bed_entry, gdt::interval32>*);
+
 } // namespace bed
 } // namespace handlers
\ No newline at end of file
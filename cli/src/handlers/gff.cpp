@@ -7,15 +7,17 @@
 
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace handlers {
 namespace gff {
 
+template <typename key_t>
 void grove_insert(
-    ggs::grove<gdt::interval, gio::gff_entry, std::string>& grove,
+    ggs::grove<key_t, gio::compact_gff_entry, std::string>& grove,
     const std::string& filepath,
     bool sorted,
-    name_to_key_map* name_map,
+    handlers::name_to_key_map<gio::compact_gff_entry, key_t>* name_map,
     std::string_view name_tag
 ) {
     gio::gff_reader reader(filepath);
@@ -25,28 +27,27 @@ void grove_insert(
         // [start, end] -> [start-1, end-1]. Matches the BED conversion so
         // cross-type queries (BED query vs GFF index, and vice versa) overlap
         // in a common coordinate space. Output still prints raw entry coords.
-        gdt::interval iv(entry.start - 1, entry.end - 1);
-        gdt::key<gdt::interval, gio::gff_entry>* key_ptr = sorted
-            ? grove.insert_data(entry.seqid, iv, entry, ggs::sorted)
-            : grove.insert_data(entry.seqid, iv, entry);
+        key_t iv(entry.start - 1, entry.end - 1);
+        gio::compact_gff_entry compact(entry);
+        gdt::key<key_t, gio::compact_gff_entry>* key_ptr = sorted
+            ? grove.insert_data(entry.seqid, iv, std::move(compact), ggs::sorted)
+            : grove.insert_data(entry.seqid, iv, std::move(compact));
 
         if (!name_map) {
             continue;
         }
         // Resolve the chosen attribute from the stored entry so the map's
         // string_view points into the grove's stable key_storage, not the
-        // reader's per-record buffer. Heterogeneous find (std::less<>) lets a
-        // string_view probe the std::string-keyed attribute map without a copy.
-        const auto& attrs = key_ptr->get_data().attributes;
-        const auto attr_it = attrs.find(name_tag);
-        if (attr_it == attrs.end()) {
+        // reader's per-record buffer.
+        const std::string* attr = key_ptr->get_data().find_attribute(name_tag);
+        if (attr == nullptr) {
             throw std::runtime_error(
                 "Error: GFF/GTF record '" + entry.seqid + ":" +
                 std::to_string(entry.start) + "-" + std::to_string(entry.end) +
                 "' has no '" + std::string(name_tag) +
                 "' attribute (required by --gff-name-tag for --links)");
         }
-        const std::string& value = attr_it->second;
+        const std::string& value = *attr;
         std::string_view value_view(value.data(), value.size());
         auto [it, inserted] = name_map->emplace(value_view, key_ptr);
         if (!inserted) {
@@ -58,5 +59,12 @@ void grove_insert(
     }
 }
 
+template void grove_insert<gdt::interval>(
+    ggs::grove<gdt::interval, gio::compact_gff_entry, std::string>&, const std::string&, bool,
+    handlers::name_to_key_map<gio::compact_gff_entry, gdt::interval>*, std::string_view);
+template void grove_insert<gdt::interval32>(
+    ggs::grove<gdt::interval32, gio::compact_gff_entry, std::string>&, const std::string&, bool,
+    handlers::name_to_key_map<gio::compact_gff_entry, gdt::interval32>*, std::string_view);
+
 } // namespace gff
 } // namespace handlers
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <handlers/gff.hpp>
 #include <handlers/links.hpp>
 
+#include <genogrove/data_type/interval32.hpp>
+#include <genogrove/io/compact_gff_entry.hpp>
 #include <genogrove/io/filetype_detector.hpp>
 #include <genogrove/io/gg_format.hpp>
 
@@ -16,6 +18,7 @@
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace subcalls {
 
@@ -27,25 +30,90 @@ constexpr std::string_view DEFAULT_TREE_ORDER = "3";
 
 namespace {
 
-// Open outputfile, write the format header for `payload_type`, then serialise
-// the grove. The grove is built before this call, so a parse error never
-// reaches here and an existing .gg at outputfile is never truncated (see
-// execute()). Shared by the BED and GFF branches so the open/header/serialize/
-// post-write-check sequence is written once.
+// Open outputfile, write the format header for `payload_type` (followed, for
+// GFF_COMPACT, by the field registry the payloads refer to), then serialise
+// the grove with `opts` (worker count, block codec, frame packing). The grove is built
+// before this call, so a parse error never reaches here and an existing .gg
+// at outputfile is never truncated (see execute()). Shared by the BED and GFF
+// branches so the open/header/serialize/post-write-check sequence is written
+// once.
 template<typename grove_t>
 void write_index(grove_t& grove, const std::string& outputfile,
-                 gio::gg_payload_type payload_type) {
+                 gio::gg_payload_type payload_type, gio::gg_key_type key_type,
+                 const ggs::serialize_options& opts) {
     std::ofstream output(outputfile, std::ios::binary);
     if(!output) {
         throw std::runtime_error("Error: could not open output file: " + outputfile);
     }
-    gio::gg_header::current(payload_type).write(output);
-    grove.serialize(output);
+    gio::gg_header::current(payload_type, key_type).write(output);
+    if(payload_type == gio::gg_payload_type::GFF_COMPACT) {
+        gio::gff_field_registry::instance().serialize(output);
+    }
+    grove.serialize(output, opts);
     if(!output) {
         throw std::runtime_error("Error: failed to write index to: " + outputfile);
     }
 }
 
+// Parse --key-type. "interval32" stores 32-bit positions: half the key
+// bytes in memory and on disk, for any input whose coordinates fit.
+gio::gg_key_type parse_key_type(const std::string& name) {
+    if(name == "interval") return gio::gg_key_type::INTERVAL;
+    if(name == "interval32") return gio::gg_key_type::INTERVAL32;
+    throw std::runtime_error("Error: key-type must be interval or interval32");
+}
+
+// Header tag for each supported interval key type.
+template<typename key_t>
+constexpr gio::gg_key_type key_type_tag = std::is_same_v<key_t, gdt::interval32>
+    ? gio::gg_key_type::INTERVAL32 : gio::gg_key_type::INTERVAL;
+
+// Build the grove for a validated BED/GFF/GTF input with interval key type
+// `key_t`, attach --links, and write it. Shared by both --key-type choices.
+template<typename key_t>
+void build_index(gio::filetype filetype, const std::string& inputfile,
+                 const std::string& outputfile, int order, bool sorted,
+                 const cxxopts::ParseResult& args, const ggs::serialize_options& write_opts) {
+    const bool has_links = args.count("links") != 0;
+    const bool has_name_tag = args.count("gff-name-tag") != 0;
+
+    if(filetype == gio::filetype::BED) {
+        ggs::grove<key_t, gio::bed_entry, std::string> grove(order);
+
+        // Only build the name->key map when --links was requested. Without
+        // --links the map is null and grove_insert pays no extra cost.
+        handlers::name_to_key_map<gio::bed_entry, key_t> name_map;
+        handlers::bed::grove_insert(
+            grove, inputfile, sorted, has_links ? &name_map : nullptr);
+
+        if(has_links) {
+            handlers::links::apply_to_grove(
+                grove, args["links"].as<std::string>(), name_map, write_opts.num_threads);
+        }
+
+        write_index(grove, outputfile, gio::gg_payload_type::BED, key_type_tag<key_t>, write_opts);
+    } else {  // GFF or GTF (validated above)
+        ggs::grove<key_t, gio::compact_gff_entry, std::string> grove(order);
+
+        // Only build the name->key map when --links was requested; without it
+        // the map is null and grove_insert pays no extra cost (and reads no tag).
+        handlers::name_to_key_map<gio::compact_gff_entry, key_t> name_map;
+        const std::string name_tag = has_name_tag
+            ? args["gff-name-tag"].as<std::string>()
+            : std::string();
+        handlers::gff::grove_insert(
+            grove, inputfile, sorted, has_links ? &name_map : nullptr, name_tag);
+
+        if(has_links) {
+            handlers::links::apply_to_grove(
+                grove, args["links"].as<std::string>(), name_map, write_opts.num_threads);
+        }
+
+        write_index(grove, outputfile, gio::gg_payload_type::GFF_COMPACT, key_type_tag<key_t>,
+                    write_opts);
+    }
+}
+
 } // namespace
 
 cxxopts::Options index::build_options() {
@@ -71,6 +139,24 @@ cxxopts::Options index::build_options() {
                              "unique across the file. Ignored for BED input (which matches "
                              "on column 4).",
                     cxxopts::value<std::string>())
+            ("threads", "Worker threads compressing index blocks and resolving --links names "
+                        "(0 = one per core). "
+                        "The written index is identical for every thread count.",
+                    cxxopts::value<int>()->default_value("1"))
+            ("codec", "Block compression: zlib (default), zstd, lz4 (fastest decode), "
+                      "or stored (uncompressed). zstd and lz4 need a build with those libraries.",
+                    cxxopts::value<std::string>()->default_value("zlib"))
+            ("zstd-dict-size", "With --codec zstd: train a dictionary of up to this many bytes "
+                               "on the index's own blocks and store it in the index (0 = none)",
+                    cxxopts::value<int>()->default_value("0"))
+            ("blocks-per-frame", "Consecutive index blocks compressed and read together (1 = each "
+                                 "on its own). Larger values make range queries over a partially "
+                                 "loaded index read fewer, bigger chunks.",
+                    cxxopts::value<int>()->default_value("1"))
+            ("key-type", "Interval key stored in the index: interval (64-bit positions, "
+                         "default) or interval32 (32-bit positions — half the key memory "
+                         "and index size; fails on coordinates of 2^32 or more)",
+                    cxxopts::value<std::string>()->default_value("interval"))
             ("h,help", "Print help")
             ;
     options.parse_positional({"inputfile"});
@@ -95,6 +181,45 @@ void index::validate(const cxxopts::ParseResult& args) {
         }
     }
 
+    if(args.count("threads") && args["threads"].as<int>() < 0) {
+        throw std::runtime_error("Error: threads must be 0 (one per core) or positive");
+    }
+
+    if(args.count("codec")) {
+        const auto name = args["codec"].as<std::string>();
+        ggs::block_codec codec;
+        try {
+            codec = ggs::parse_block_codec(name);
+        } catch(const std::invalid_argument& e) {
+            throw std::runtime_error(std::string("Error: ") + e.what());
+        }
+        if(!ggs::block_codec_available(codec)) {
+            throw std::runtime_error("Error: this build of genogrove has no " + name + " support");
+        }
+    }
+
+    if(args.count("zstd-dict-size")) {
+        const int dict_size = args["zstd-dict-size"].as<int>();
+        if(dict_size < 0) {
+            throw std::runtime_error("Error: zstd-dict-size must be 0 (none) or positive");
+        }
+        if(dict_size > 0 && args["codec"].as<std::string>() != "zstd") {
+            throw std::runtime_error("Error: --zstd-dict-size requires --codec zstd");
+        }
+    }
+
+    if(args.count("blocks-per-frame")) {
+        const int per_frame = args["blocks-per-frame"].as<int>();
+        if(per_frame < 1 || static_cast<unsigned>(per_frame) > ggs::detail::max_blocks_per_frame) {
+            throw std::runtime_error("Error: blocks-per-frame must be between 1 and " +
+                                     std::to_string(ggs::detail::max_blocks_per_frame));
+        }
+    }
+
+    if(args.count("key-type")) {
+        (void)parse_key_type(args["key-type"].as<std::string>());
+    }
+
     if(args.count("outputfile")) {
         std::filesystem::path outputfile_path(args["outputfile"].as<std::string>());
         auto parent = outputfile_path.parent_path();
@@ -116,6 +241,12 @@ void index::execute(const cxxopts::ParseResult& args) {
     const int order = args["k"].as<int>();
     const bool sorted = args["sorted"].as<bool>();
     const bool timed = args["timed"].as<bool>();
+    ggs::serialize_options write_opts;
+    write_opts.num_threads = static_cast<std::size_t>(args["threads"].as<int>());
+    write_opts.codec = ggs::parse_block_codec(args["codec"].as<std::string>());
+    write_opts.dictionary_size = static_cast<std::size_t>(args["zstd-dict-size"].as<int>());
+    write_opts.blocks_per_frame = static_cast<std::size_t>(args["blocks-per-frame"].as<int>());
+    const auto key_type = parse_key_type(args["key-type"].as<std::string>());
 
     // Default the output path to <inputfile>.gg next to the source file.
     const std::string outputfile = args.count("outputfile")
@@ -133,12 +264,10 @@ void index::execute(const cxxopts::ParseResult& args) {
             "Error: unsupported input format (only BED, GFF, and GTF are supported)");
     }
 
-    const bool has_links = args.count("links") != 0;
-    const bool has_name_tag = args.count("gff-name-tag") != 0;
     // GFF/GTF links need an explicit identifying attribute — there is no
     // canonical name column. (--gff-name-tag on BED input is simply ignored;
     // BED links always match on column 4.)
-    if(has_links && filetype != gio::filetype::BED && !has_name_tag) {
+    if(args.count("links") && filetype != gio::filetype::BED && !args.count("gff-name-tag")) {
         throw std::runtime_error(
             "Error: --links on GFF/GTF input requires --gff-name-tag <ATTR> "
             "to select the identifying attribute (e.g. ID, gene_id, transcript_id)");
@@ -150,39 +279,10 @@ void index::execute(const cxxopts::ParseResult& args) {
     // the header + serialised payload. This way a parse error or malformed
     // input row aborts before the output is opened, leaving any pre-existing
     // .gg at outputfile intact.
-    if(filetype == gio::filetype::BED) {
-        ggs::grove<gdt::interval, gio::bed_entry, std::string> grove(order);
-
-        // Only build the name->key map when --links was requested. Without
-        // --links the map is null and grove_insert pays no extra cost.
-        handlers::bed::name_to_key_map name_map;
-        handlers::bed::grove_insert(
-            grove, inputfile, sorted, has_links ? &name_map : nullptr);
-
-        if(has_links) {
-            handlers::links::apply_to_grove(
-                grove, args["links"].as<std::string>(), name_map);
-        }
-
-        write_index(grove, outputfile, gio::gg_payload_type::BED);
-    } else {  // GFF or GTF (validated above)
-        ggs::grove<gdt::interval, gio::gff_entry, std::string> grove(order);
-
-        // Only build the name->key map when --links was requested; without it
-        // the map is null and grove_insert pays no extra cost (and reads no tag).
-        handlers::gff::name_to_key_map name_map;
-        const std::string name_tag = has_name_tag
-            ? args["gff-name-tag"].as<std::string>()
-            : std::string();
-        handlers::gff::grove_insert(
-            grove, inputfile, sorted, has_links ? &name_map : nullptr, name_tag);
-
-        if(has_links) {
-            handlers::links::apply_to_grove(
-                grove, args["links"].as<std::string>(), name_map);
-        }
-
-        write_index(grove, outputfile, gio::gg_payload_type::GFF);
+    if(key_type == gio::gg_key_type::INTERVAL32) {
+        build_index<gdt::interval32>(filetype, inputfile, outputfile, order, sorted, args, write_opts);
+    } else {
+        build_index<gdt::interval>(filetype, inputfile, outputfile, order, sorted, args, write_opts);
     }
 
     if(timed) {
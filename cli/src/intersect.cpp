@@ -8,9 +8,12 @@
 #include <handlers/gff.hpp>
 #include <handlers/vcf.hpp>
 
+#include <genogrove/data_type/interval32.hpp>
+#include <genogrove/io/compact_gff_entry.hpp>
 #include <genogrove/io/filetype_detector.hpp>
 #include <genogrove/io/gg_format.hpp>
 #include <genogrove/structure/grove/grove_view.hpp>
+#include <genogrove/structure/grove/index_handle.hpp>
 #include <handlers/queryable.hpp>
 
 #include <fstream>
@@ -35,15 +38,23 @@ bool is_gff_or_gtf(gio::filetype t) {
 // the target's payload type. Decoupling the two is what makes cross-type
 // queries (e.g. a BED query against a GFF index) work — grove::intersect only
 // consumes (interval, index), and both readers emit intervals in the same
-// canonical 0-based-inclusive space (see for_each_*_query).
-template <handlers::interval_queryable grove_t, typename print_fn>
+// canonical 0-based-inclusive space (see for_each_*_query). `key_t` is the
+// target's interval key type; queries are converted to it per record. Index
+// names are resolved to handles once per reader contig id.
+template <typename key_t = gdt::interval, typename grove_t, typename print_fn>
+    requires handlers::interval_queryable<grove_t, key_t>
 void run_intersect(grove_t& grove, const std::string& queryfile,
                    gio::filetype query_type, std::ostream& out, print_fn print) {
-    auto handle = [&](gdt::interval iv, const std::string& index) {
+    ggs::index_handle_map handles;
+    auto handle = [&](gdt::interval iv, const std::string& index, int32_t contig_id) {
+        const auto query = handlers::to_query_key<key_t>(iv);
+        if (!query) {
+            return;  // beyond every position the index can hold
+        }
         // Bind the query_result to a local: get_keys() returns a reference into
         // it, so iterating grove.intersect(...).get_keys() directly would dangle
         // once the temporary is destroyed at the end of the range expression.
-        auto results = grove.intersect(iv, index);
+        auto results = grove.intersect(*query, handles.get(grove, contig_id, index));
         for (auto* result : results.get_keys()) {
             print(out, result->get_data());
         }
@@ -57,21 +68,37 @@ void run_intersect(grove_t& grove, const std::string& queryfile,
     }
 }
 
-// Query a prebuilt .gg index of payload type `payload_t`, choosing between an
-// in-place grove_view (read only the blocks each query touches) and a fully
-// deserialized in-memory grove. Written once here so the eager/in-place split
-// is not duplicated per payload type at the call site.
-template <typename payload_t, typename print_fn>
+// Query a prebuilt .gg index with key type `key_t` and payload type
+// `payload_t`, choosing between an in-place grove_view (read only the blocks
+// each query touches) and a fully deserialized in-memory grove. Written once
+// here so the eager/in-place split is not duplicated per payload and key type
+// at the call site.
+template <typename key_t, typename payload_t, typename print_fn>
 void query_index(const std::string& index_path, std::ifstream& in, bool in_place,
                  std::streamoff data_offset, const std::string& queryfile,
                  gio::filetype query_filetype, std::ostream& out, print_fn print) {
     if(in_place) {
-        auto grove = ggs::grove_view<gdt::interval, payload_t, std::string>::open(
+        auto grove = ggs::grove_view<key_t, payload_t, std::string>::open(
             index_path, data_offset);
-        run_intersect(grove, queryfile, query_filetype, out, print);
+        run_intersect<key_t>(grove, queryfile, query_filetype, out, print);
     } else {
-        auto grove = ggs::grove<gdt::interval, payload_t, std::string>::deserialize(in);
-        run_intersect(grove, queryfile, query_filetype, out, print);
+        auto grove = ggs::grove<key_t, payload_t, std::string>::deserialize(in);
+        run_intersect<key_t>(grove, queryfile, query_filetype, out, print);
+    }
+}
+
+// Dispatch on the key type recorded in the .gg header.
+template <typename payload_t, typename print_fn>
+void query_index(const gio::gg_header& header, const std::string& index_path,
+                 std::ifstream& in, bool in_place, std::streamoff data_offset,
+                 const std::string& queryfile, gio::filetype query_filetype,
+                 std::ostream& out, print_fn print) {
+    if(header.key_type == gio::gg_key_type::INTERVAL32) {
+        query_index<gdt::interval32, payload_t>(index_path, in, in_place, data_offset,
+                                                queryfile, query_filetype, out, print);
+    } else {  // INTERVAL — gg_header::read() rejects any other value
+        query_index<gdt::interval, payload_t>(index_path, in, in_place, data_offset,
+                                              queryfile, query_filetype, out, print);
     }
 }
 
@@ -197,17 +224,27 @@ void intersect::execute(const cxxopts::ParseResult& args) {
             throw std::runtime_error("Error: could not open index file: " + index_path);
         }
         const auto header = gio::gg_header::read(in);
+        // A compact GFF index carries the field registry its payloads refer
+        // to between the header and the grove; load it first.
+        if(header.payload_type == gio::gg_payload_type::GFF_COMPACT) {
+            (void)gio::gff_field_registry::deserialize(in);
+        }
         // --in-place queries the file on disk via grove_view instead of loading
-        // it all; the grove stream begins right after the gg_header.
+        // it all; the grove stream begins right after the header (and
+        // dictionary, if any).
         const bool in_place = args.count("in-place") != 0;
-        const auto data_offset = static_cast<std::streamoff>(gio::gg_header::SIZE);
+        const auto data_offset = static_cast<std::streamoff>(in.tellg());
 
         if(header.payload_type == gio::gg_payload_type::BED) {
-            query_index<gio::bed_entry>(index_path, in, in_place, data_offset,
+            query_index<gio::bed_entry>(header, index_path, in, in_place, data_offset,
                                         queryfile, query_filetype, *outputStream,
                                         handlers::bed::print_bed_result);
+        } else if(header.payload_type == gio::gg_payload_type::GFF_COMPACT) {
+            query_index<gio::compact_gff_entry>(header, index_path, in, in_place, data_offset,
+                                                queryfile, query_filetype, *outputStream,
+                                                handlers::gff::print_compact_gff_result);
         } else {  // GFF — gg_header::read() rejects any other value
-            query_index<gio::gff_entry>(index_path, in, in_place, data_offset,
+            query_index<gio::gff_entry>(header, index_path, in, in_place, data_offset,
                                         queryfile, query_filetype, *outputStream,
                                         handlers::gff::print_gff_result);
         }
@@ -222,10 +259,10 @@ void intersect::execute(const cxxopts::ParseResult& args) {
             run_intersect(grove, queryfile, query_filetype, *outputStream,
                           handlers::bed::print_bed_result);
         } else if(is_gff_or_gtf(target_filetype)) {
-            ggs::grove<gdt::interval, gio::gff_entry, std::string> grove(k);
+            ggs::grove<gdt::interval, gio::compact_gff_entry, std::string> grove(k);
             handlers::gff::grove_insert(grove, targetfile);
             run_intersect(grove, queryfile, query_filetype, *outputStream,
-                          handlers::gff::print_gff_result);
+                          handlers::gff::print_compact_gff_result);
         } else {
             throw std::runtime_error(
                 "Error: unsupported target format (only BED, GFF, and GTF are supported)");
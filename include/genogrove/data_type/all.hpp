@@ -7,12 +7,17 @@
 #define GENOGROVE_DATA_TYPE_ALL_HPP
 
 #include <genogrove/data_type/genomic_coordinate.hpp>
+#include <genogrove/data_type/genomic_coordinate32.hpp>
 #include <genogrove/data_type/registry.hpp>
 #include <genogrove/data_type/interval.hpp>
+#include <genogrove/data_type/interval32.hpp>
 #include <genogrove/data_type/key.hpp>
 #include <genogrove/data_type/key_type_base.hpp>
+#include <genogrove/data_type/expansion_result.hpp>
 #include <genogrove/data_type/flanking_query_result.hpp>
 #include <genogrove/data_type/kmer.hpp>
+#include <genogrove/data_type/kmer_extractor.hpp>
+#include <genogrove/data_type/kmer_minimizer.hpp>
 #include <genogrove/data_type/numeric.hpp>
 #include <genogrove/data_type/query_result.hpp>
 
@@ -26,12 +31,15 @@
  * ## Key Types (satisfying key_type_base concept)
  * - **interval**: Basic genomic intervals with start/end positions (0-based closed)
  * - **genomic_coordinate**: Stranded genomic intervals with coordinate-first sorting
+ * - **interval32 / genomic_coordinate32**: 8-byte variants with 32-bit positions
+ *   (31-bit for genomic_coordinate32, whose strand sits in the spare bits)
  * - **numeric**: Point-based integer type for non-genomic B+ tree operations
  * - **kmer**: K-mer sequences with 2-bit encoding for sequence-based indexing
  *
  * ## Type Wrappers and Containers
  * - **key**: Template wrapper combining key_type with optional associated data
  * - **query_result**: Container for intersection query results with matching keys
+ * - **expansion_result**: Overlap seeds plus the keys reached from them along graph edges
  *
  * ## Type System Infrastructure
  * - **key_type_base**: C++20 concept defining requirements for key types
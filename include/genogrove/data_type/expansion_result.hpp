@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_DATA_TYPE_EXPANSION_RESULT_HPP
+#define GENOGROVE_DATA_TYPE_EXPANSION_RESULT_HPP
+
+// Standard
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// genogrove
+#include <genogrove/data_type/key.hpp>
+#include <genogrove/data_type/key_type_base.hpp>
+
+namespace genogrove::data_type {
+    /**
+     * @brief Result of an interval-constrained graph query: the keys overlapping
+     *        a query plus every key reached from them along graph edges.
+     *
+     * Returned by grove::intersect_expand and grove_view::intersect_expand.
+     * Keys are stored in breadth-first order together with their hop distance
+     * from the nearest seed: the seeds (keys overlapping the query, depth 0)
+     * come first, then every key first reached at depth 1, and so on. Each key
+     * appears once.
+     *
+     * Like query_result, the keys are non-owning pointers into the grove (or
+     * grove_view) that produced the result.
+     *
+     * @tparam key_t Type satisfying key_type_base concept
+     * @tparam data_t Optional type for associated data (default: void)
+     */
+    template<key_type_base key_t, typename data_t = void>
+    class expansion_result {
+        public:
+            /**
+             * @brief Construct an empty result for the given query.
+             * @param query The overlap query (stored by value)
+             */
+            explicit expansion_result(key_t query) : query(std::move(query)) {}
+
+            /// The overlap query that selected the seeds.
+            [[nodiscard]] const key_t& get_query() const noexcept { return this->query; }
+
+            /**
+             * @brief Every key in the result, seeds first, in breadth-first order.
+             * @return Const reference to the key pointers (parallel to get_depths())
+             */
+            [[nodiscard]] const std::vector<key<key_t, data_t>*>& get_keys() const noexcept {
+                return this->keys;
+            }
+
+            /**
+             * @brief Hop distance of each key from the nearest seed (0 for seeds).
+             * @return Const reference to the depths, non-decreasing
+             */
+            [[nodiscard]] const std::vector<std::size_t>& get_depths() const noexcept {
+                return this->depths;
+            }
+
+            /// Number of seeds — the first get_seed_count() keys overlap the query.
+            [[nodiscard]] std::size_t get_seed_count() const noexcept { return this->seed_count; }
+
+            /// Number of keys in the result, seeds included.
+            [[nodiscard]] std::size_t size() const noexcept { return this->keys.size(); }
+
+            /// True if no key overlapped the query.
+            [[nodiscard]] bool empty() const noexcept { return this->keys.empty(); }
+
+            /**
+             * @brief Append a key reached at `depth` hops.
+             *
+             * Called internally by the expansion engine, which appends in
+             * breadth-first order.
+             *
+             * @param key Pointer to the key (must not be nullptr)
+             * @param depth Hop distance from the nearest seed
+             * @throws std::invalid_argument if key is nullptr, or if depth is
+             *         smaller than the previous key's depth
+             */
+            void add_key(key<key_t, data_t>* key, std::size_t depth) {
+                if (key == nullptr) {
+                    throw std::invalid_argument("expansion_result::add_key: key must not be nullptr");
+                }
+                if (!this->depths.empty() && depth < this->depths.back()) {
+                    throw std::invalid_argument("expansion_result::add_key: depths must not decrease");
+                }
+                this->keys.push_back(key);
+                this->depths.push_back(depth);
+                if (depth == 0) {
+                    ++this->seed_count;
+                }
+            }
+
+        private:
+            key_t query;                                ///< The overlap query (stored by value)
+            std::vector<key<key_t, data_t>*> keys;      ///< Seeds, then reached keys (not owned)
+            std::vector<std::size_t> depths;            ///< Hop distance per key
+            std::size_t seed_count = 0;                 ///< Keys at depth 0
+    };
+}
+
+#endif //GENOGROVE_DATA_TYPE_EXPANSION_RESULT_HPP
@@ -0,0 +1,256 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef DATATYPE_GENOMICCOORDINATE32_HPP
+#define DATATYPE_GENOMICCOORDINATE32_HPP
+
+// Standard
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace genogrove::data_type {
+    /**
+     * @brief Compact stranded genomic interval: 31-bit positions, strand in the spare bits.
+     *
+     * Same semantics as genomic_coordinate — coordinate-first ordering with
+     * strand order `* < . < + < -`, overlap requiring strand compatibility
+     * ('*' matches any strand), aggregate to the bounding coordinate with
+     * strand '*' when strands differ — in 8 bytes instead of 24.
+     *
+     * ## Layout
+     * Two uint32_t words hold start and end in their low 31 bits; the top bit
+     * of each word holds one bit of the 2-bit strand code. The code follows
+     * the sort order (`*` = 0, `.` = 1, `+` = 2, `-` = 3), so comparisons work
+     * on the decoded fields without a lookup table.
+     *
+     * Positions are limited to max_position (2^31 - 1); the largest sequenced
+     * chromosomes are well below that. Use genomic_coordinate beyond it.
+     *
+     * @note Satisfies the key_type_base concept requirements (operators, overlap, aggregate, to_string)
+     * @note Serializes to 9 bytes (strand character, then 32-bit start and end)
+     * @see genomic_coordinate for the full-width key
+     * @see interval32 for the unstranded compact key
+     */
+    class genomic_coordinate32 {
+        public:
+            /// Largest representable position.
+            static constexpr std::size_t max_position = 0x7FFFFFFFu;
+
+            /**
+             * @brief Default constructor creating an invalid coordinate (strand='.', start=0, end=0).
+             */
+            constexpr genomic_coordinate32() : start_bits(0), end_bits(0) {
+                set_strand_code(strand_code('.'));
+            }
+
+            /**
+             * @brief Construct a genomic coordinate with specified strand and position.
+             *
+             * @param strand Strand indicator ('+', '-', '.', or '*')
+             * @param start Starting position (0-based, inclusive)
+             * @param end Ending position (0-based, inclusive)
+             * @throws std::invalid_argument if strand is not one of '+', '-', '.', '*'
+             * @throws std::invalid_argument if start > end or end exceeds max_position
+             */
+            constexpr genomic_coordinate32(char strand, std::size_t start, std::size_t end)
+                : start_bits(0), end_bits(0) {
+                if (strand != '+' && strand != '-' && strand != '.' && strand != '*') {
+                    throw std::invalid_argument("genomic_coordinate32: strand must be one of '+', '-', '.', '*'");
+                }
+                if (start > end) {
+                    throw std::invalid_argument("genomic_coordinate32: start must be <= end");
+                }
+                if (end > max_position) {
+                    throw std::invalid_argument("genomic_coordinate32: position exceeds 31 bits");
+                }
+                start_bits = static_cast<std::uint32_t>(start);
+                end_bits = static_cast<std::uint32_t>(end);
+                set_strand_code(strand_code(strand));
+            }
+
+            ~genomic_coordinate32() = default;
+
+            /**
+             * @brief Less-than comparison using coordinate-first sorting.
+             *
+             * Comparison order: start → end → strand (with strand order: * < . < + < -)
+             *
+             * @param other Coordinate to compare against
+             * @return true if this coordinate is less than other
+             */
+            constexpr bool operator<(const genomic_coordinate32& other) const {
+                if (get_start() != other.get_start()) return get_start() < other.get_start();
+                if (get_end() != other.get_end()) return get_end() < other.get_end();
+                return get_strand_code() < other.get_strand_code();
+            }
+
+            /**
+             * @brief Greater-than comparison using coordinate-first sorting.
+             *
+             * @param other Coordinate to compare against
+             * @return true if this coordinate is greater than other
+             */
+            constexpr bool operator>(const genomic_coordinate32& other) const {
+                return other < *this;
+            }
+
+            /**
+             * @brief Equality comparison (strand, start, and end must all match).
+             *
+             * @param other Coordinate to compare against
+             * @return true if strand, start, and end are all equal
+             */
+            constexpr bool operator==(const genomic_coordinate32& other) const {
+                return start_bits == other.start_bits && end_bits == other.end_bits;
+            }
+
+            /**
+             * @brief Indicates this is an interval type (enables interval-aware operations).
+             */
+            static constexpr bool is_interval = true;
+
+            /**
+             * @brief Determine if two genomic coordinates overlap.
+             *
+             * Coordinates must overlap spatially and strands must match exactly,
+             * except that wildcard '*' matches any strand.
+             *
+             * @param a First coordinate
+             * @param b Second coordinate
+             * @return true if coordinates overlap spatially and strands are compatible
+             *
+             * @note Required by key_type_base concept
+             */
+            [[nodiscard]] static constexpr bool overlaps(const genomic_coordinate32& a,
+                                                         const genomic_coordinate32& b) {
+                if (a.get_start() > b.get_end() || b.get_start() > a.get_end()) return false;
+                if (a.get_strand_code() == 0 || b.get_strand_code() == 0) return true;
+                return a.get_strand_code() == b.get_strand_code();
+            }
+
+            /**
+             * @brief Aggregate two coordinates into a bounding coordinate.
+             *
+             * Min start, max end; strand '*' if the strands differ, otherwise the common strand.
+             *
+             * @param a First coordinate
+             * @param b Second coordinate
+             * @return Bounding coordinate
+             *
+             * @note Required by key_type_base concept for internal node construction
+             */
+            [[nodiscard]] static constexpr genomic_coordinate32 aggregate(
+                    const genomic_coordinate32& a, const genomic_coordinate32& b) {
+                const char s = (a.get_strand_code() == b.get_strand_code()) ? a.get_strand() : '*';
+                return genomic_coordinate32{s, std::min(a.get_start(), b.get_start()),
+                                            std::max(a.get_end(), b.get_end())};
+            }
+
+            /**
+             * @brief Convert coordinate to string representation.
+             *
+             * Format: "strand:start-end" (e.g., "+:100-200"), as for genomic_coordinate
+             *
+             * @return String representation of the coordinate
+             */
+            std::string to_string() const;
+
+            /**
+             * @brief Get the strand indicator.
+             *
+             * @return Strand character ('+', '-', '.', or '*')
+             */
+            constexpr char get_strand() const noexcept { return strand_from_code(get_strand_code()); }
+
+            /**
+             * @brief Get the start position (0-based, inclusive).
+             *
+             * @return Start position
+             */
+            constexpr std::size_t get_start() const noexcept { return start_bits & position_mask; }
+
+            /**
+             * @brief Get the end position (0-based, inclusive).
+             *
+             * @return End position
+             */
+            constexpr std::size_t get_end() const noexcept { return end_bits & position_mask; }
+
+            /**
+             * @brief Set the strand indicator.
+             *
+             * @param strand Strand character ('+', '-', '.', or '*')
+             * @throws std::invalid_argument if strand is not one of '+', '-', '.', '*'
+             */
+            constexpr void set_strand(char strand) {
+                *this = genomic_coordinate32(strand, get_start(), get_end());
+            }
+
+            /**
+             * @brief Set both start and end positions atomically.
+             *
+             * @param start Start position (0-based, inclusive)
+             * @param end End position (0-based, inclusive)
+             * @throws std::invalid_argument if start > end or end exceeds max_position
+             */
+            constexpr void set_range(std::size_t start, std::size_t end) {
+                *this = genomic_coordinate32(get_strand(), start, end);
+            }
+
+            /**
+             * @brief Serialize the genomic coordinate to an output stream (9 bytes).
+             *
+             * @param os Output stream to write to
+             */
+            void serialize(std::ostream& os) const;
+
+            /**
+             * @brief Deserialize a genomic coordinate from an input stream.
+             *
+             * @param is Input stream to read from
+             * @return Deserialized genomic coordinate
+             * @throws std::runtime_error on stream error or an invalid strand or range
+             */
+            [[nodiscard]] static genomic_coordinate32 deserialize(std::istream& is);
+
+            /// 2-bit strand code in sort order: '*' = 0, '.' = 1, '+' = 2, '-' = 3.
+            static constexpr std::uint32_t strand_code(char strand) noexcept {
+                switch (strand) {
+                    case '*': return 0;
+                    case '.': return 1;
+                    case '+': return 2;
+                    default:  return 3;  // '-' — callers validate the strand first
+                }
+            }
+
+            /// Inverse of strand_code().
+            static constexpr char strand_from_code(std::uint32_t code) noexcept {
+                constexpr char strands[4] = {'*', '.', '+', '-'};
+                return strands[code & 3u];
+            }
+
+            /// The strand as its 2-bit code.
+            constexpr std::uint32_t get_strand_code() const noexcept {
+                return (start_bits >> 31) | ((end_bits >> 31) << 1);
+            }
+
+        private:
+            static constexpr std::uint32_t position_mask = 0x7FFFFFFFu;
+
+            constexpr void set_strand_code(std::uint32_t code) noexcept {
+                start_bits = (start_bits & position_mask) | ((code & 1u) << 31);
+                end_bits = (end_bits & position_mask) | ((code >> 1) << 31);
+            }
+
+            std::uint32_t start_bits;   ///< Start position (low 31 bits) and strand code bit 0
+            std::uint32_t end_bits;     ///< End position (low 31 bits) and strand code bit 1
+    };
+}
+
+#endif //DATATYPE_GENOMICCOORDINATE32_HPP
@@ -0,0 +1,191 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef DATATYPE_INTERVAL32_HPP
+#define DATATYPE_INTERVAL32_HPP
+
+// Standard
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace genogrove::data_type {
+    /**
+     * @brief Compact genomic interval with 32-bit positions.
+     *
+     * Same semantics as interval — 0-based closed coordinates, ordering by
+     * start then end, overlap on any shared position, aggregate to the
+     * bounding interval — but stores both positions as uint32_t, so the value
+     * is 8 bytes instead of 16. No chromosome exceeds 2^32 bases; halving the
+     * key halves the memory a leaf scan touches and shrinks serialized groves.
+     *
+     * The accessors and constructor take and return std::size_t, so code
+     * written against interval compiles unchanged; out-of-range positions are
+     * rejected rather than truncated.
+     *
+     * @note Satisfies the key_type_base concept requirements (operators, overlap, aggregate, to_string)
+     * @note Serializes to 8 bytes
+     * @see interval for positions beyond 2^32
+     * @see genomic_coordinate32 for the stranded compact key
+     */
+    class interval32 {
+        public:
+            static constexpr std::uint32_t INVALID_POSITION = std::numeric_limits<std::uint32_t>::max();
+
+            /// Largest representable position. One below INVALID_POSITION, so a
+            /// real coordinate can never be mistaken for the unset sentinel.
+            static constexpr std::size_t max_position = INVALID_POSITION - 1u;
+
+            /**
+             * @brief Default constructor creating an uninitialized interval.
+             */
+            constexpr interval32() : start(INVALID_POSITION), end(INVALID_POSITION) {}
+
+            /**
+             * @brief Construct an interval with specified start and end positions.
+             *
+             * @param start Starting position (0-based, inclusive)
+             * @param end Ending position (0-based, inclusive)
+             * @throws std::invalid_argument if start > end or end exceeds max_position
+             */
+            constexpr interval32(std::size_t start, std::size_t end)
+                : start(static_cast<std::uint32_t>(start)), end(static_cast<std::uint32_t>(end)) {
+                if (start > end) {
+                    throw std::invalid_argument("interval32: start must be <= end");
+                }
+                if (end > max_position) {
+                    throw std::invalid_argument("interval32: position exceeds max_position");
+                }
+            }
+
+            ~interval32() = default;
+
+            /**
+             * @brief Less-than comparison based on start position, then end position.
+             *
+             * @param other Interval to compare against
+             * @return true if this interval is less than other
+             */
+            constexpr bool operator<(const interval32& other) const {
+                if (start == other.start) {
+                    return end < other.end;
+                }
+                return start < other.start;
+            }
+
+            /**
+             * @brief Greater-than comparison based on start position, then end position.
+             *
+             * @param other Interval to compare against
+             * @return true if this interval is greater than other
+             */
+            constexpr bool operator>(const interval32& other) const {
+                return other < *this;
+            }
+
+            /**
+             * @brief Equality comparison (both start and end must match).
+             *
+             * @param other Interval to compare against
+             * @return true if start and end positions are both equal
+             */
+            constexpr bool operator==(const interval32& other) const {
+                return start == other.start && end == other.end;
+            }
+
+            /**
+             * @brief Indicates this is an interval type (enables interval-aware operations).
+             */
+            static constexpr bool is_interval = true;
+
+            /**
+             * @brief Determine if two intervals overlap (share any position).
+             *
+             * @param a First interval
+             * @param b Second interval
+             * @return true if max(a.start, b.start) <= min(a.end, b.end)
+             *
+             * @note Required by key_type_base concept
+             */
+            [[nodiscard]] static constexpr bool overlaps(const interval32& a, const interval32& b) {
+                return std::max(a.start, b.start) <= std::min(a.end, b.end);
+            }
+
+            /**
+             * @brief Aggregate two intervals into a bounding interval.
+             *
+             * @param a First interval
+             * @param b Second interval
+             * @return Bounding interval with min start and max end
+             *
+             * @note Required by key_type_base concept for internal node construction
+             */
+            [[nodiscard]] static constexpr interval32 aggregate(const interval32& a, const interval32& b) {
+                return interval32{std::min(a.start, b.start), std::max(a.end, b.end)};
+            }
+
+            /**
+             * @brief Convert interval to string representation.
+             *
+             * Format: "[start,end]" (e.g., "[100,200]"), as for interval
+             *
+             * @return String representation of the interval
+             */
+            [[nodiscard]] std::string to_string() const;
+
+            /**
+             * @brief Get the start position (0-based, inclusive).
+             *
+             * @return Start position
+             */
+            constexpr std::size_t get_start() const noexcept { return start; }
+
+            /**
+             * @brief Get the end position (0-based, inclusive).
+             *
+             * @return End position
+             */
+            constexpr std::size_t get_end() const noexcept { return end; }
+
+            /**
+             * @brief Set both start and end positions atomically.
+             *
+             * @param start Start position (0-based, inclusive)
+             * @param end End position (0-based, inclusive)
+             * @throws std::invalid_argument if start > end or end exceeds max_position
+             */
+            constexpr void set_range(std::size_t start, std::size_t end) {
+                *this = interval32(start, end);
+            }
+
+            /**
+             * @brief Serialize the interval to an output stream (8 bytes).
+             *
+             * @param os Output stream to write to
+             */
+            void serialize(std::ostream& os) const;
+
+            /**
+             * @brief Deserialize an interval from an input stream.
+             *
+             * @param is Input stream to read from
+             * @return Deserialized interval
+             * @throws std::runtime_error on a stream error, start > end, or a
+             *         position beyond max_position (other than the sentinel
+             *         pair a default-constructed interval32 writes)
+             */
+            [[nodiscard]] static interval32 deserialize(std::istream& is);
+
+        private:
+            std::uint32_t start;   ///< Start position (0-based, inclusive)
+            std::uint32_t end;     ///< End position (0-based, inclusive)
+    };
+}
+
+#endif //DATATYPE_INTERVAL32_HPP
@@ -7,6 +7,7 @@
 #define GENOGROVE_DATA_TYPE_KEY_HPP
 
 // standard
+#include <cstdint>
 #include <vector>
 #include <istream>
 #include <type_traits>
@@ -20,6 +21,9 @@ namespace genogrove::data_type {
     template<typename T>
     struct serialization_traits;
 
+    /// Id of a key no grove has numbered (see key::get_id).
+    inline constexpr std::uint32_t no_key_id = 0xFFFFFFFFu;
+
     /**
      * @brief Wrapper class combining a key value with optional associated data.
      *
@@ -61,6 +65,16 @@ namespace genogrove::data_type {
      * - When data_t is non-void: stores the actual data_t
      * - Ensures zero overhead when data is not needed
      *
+     * The dense id (see get_id) is a 4-byte member. When the payload leaves
+     * tail padding it costs nothing: key<interval, int> and
+     * key<genomic_coordinate, int> keep their size (24 and 32 bytes). Without
+     * such padding it adds one alignment step, e.g. key<interval> grows from
+     * 16 to 24 bytes and key<interval32> from 8 to 12. It is kept in the key
+     * because the hot consumers only hold a key pointer. Frozen graph lookups,
+     * serialize()'s edge endpoints and make_key_array() side data read it
+     * directly, whereas a grove-owned side table would put a pointer hash
+     * back on each of those paths.
+     *
      * ## Serialization
      * Supports binary serialization/deserialization for persistence:
      * - Serializes key_t value
@@ -239,6 +253,30 @@ namespace genogrove::data_type {
                 return !std::is_void_v<data_t>;
             }
 
+            /**
+             * @brief Dense id assigned by the grove that owns this key.
+             *
+             * A grove numbers its data keys (indexed and external) 0, 1, 2, ...
+             * as they are created, so per-key side data can live in a flat
+             * array indexed by id (see grove::id_of). The id is bookkeeping,
+             * not part of the key: it is neither serialized nor compared.
+             *
+             * @return The id, or no_key_id for a key no grove has numbered
+             *         (a standalone key, a separator, a grove_view key)
+             */
+            [[nodiscard]] std::uint32_t get_id() const noexcept {
+                return id;
+            }
+
+            /**
+             * @brief Set the dense id. Called by the owning grove only.
+             *
+             * @param new_id The id, or no_key_id to clear it
+             */
+            void set_id(std::uint32_t new_id) noexcept {
+                id = new_id;
+            }
+
             /**
              * @brief Convert key to string representation.
              *
@@ -344,6 +382,8 @@ namespace genogrove::data_type {
                 std::monostate,
                 data_t
             > data;
+
+            std::uint32_t id = no_key_id;  ///< Dense id within the owning grove (see get_id)
     };
 
 }
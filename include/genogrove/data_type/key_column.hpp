@@ -0,0 +1,410 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_DATA_TYPE_KEY_COLUMN_HPP
+#define GENOGROVE_DATA_TYPE_KEY_COLUMN_HPP
+
+// Standard
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Genogrove
+#include "genogrove/data_type/genomic_coordinate.hpp"
+#include "genogrove/data_type/genomic_coordinate32.hpp"
+#include "genogrove/data_type/interval.hpp"
+#include "genogrove/data_type/interval32.hpp"
+#include "genogrove/data_type/numeric.hpp"
+#include "genogrove/data_type/serialization_traits.hpp"
+
+namespace genogrove::data_type {
+
+/**
+ * @file key_column.hpp
+ * @brief Column-wise serialization of the keys packed into one grove block
+ *
+ * A serialized grove block holds a run of sorted keys (a node's keys, or a
+ * chunk of external keys). key_column<T> writes that run as a whole rather than
+ * one value at a time, so a key type can exploit the ordering:
+ *
+ * - **Primary template**: row-wise, each value via serializer<T> — works for
+ *   any key type, including user-defined ones.
+ * - **interval / genomic_coordinate** (and their 32-bit variants): starts as
+ *   zig-zag varint deltas from the previous key, lengths (end - start) as
+ *   varints, and — for the stranded types — strands as a 2-bit-per-key
+ *   packed column.
+ * - **numeric**: values as zig-zag varint deltas.
+ *
+ * Encoded columns sit behind a uint32 byte length, so a reader pulls a block's
+ * column with one read and decodes it from contiguous memory. Specialize
+ * key_column<T> to give a custom key type a compact encoding.
+ */
+
+namespace detail {
+
+/// Most bytes a 64-bit varint can occupy.
+inline constexpr std::size_t max_varint_bytes = 10;
+
+/// Append `value` as a little-endian base-128 varint.
+inline void append_varint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief Decode one varint at `pos`, advancing it past the value
+ * @throws std::runtime_error if the varint runs past `end` or overflows 64 bits
+ */
+inline std::uint64_t read_varint(const char*& pos, const char* end) {
+    std::uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (pos == end) {
+            throw std::runtime_error("Failed to deserialize key column: truncated varint");
+        }
+        const auto byte = static_cast<std::uint8_t>(*pos++);
+        if (shift == 63 && byte > 1) {
+            break;
+        }
+        value |= std::uint64_t{byte & 0x7Fu} << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw std::runtime_error("Failed to deserialize key column: varint overflows 64 bits");
+}
+
+/// Map a (wrapping) difference onto small unsigned values: 0, -1, 1, -2, ...
+/// become 0, 1, 2, 3, ...
+inline constexpr std::uint64_t zigzag_encode(std::uint64_t delta) {
+    return (delta << 1) ^ (0 - (delta >> 63));
+}
+
+/// Inverse of zigzag_encode.
+inline constexpr std::uint64_t zigzag_decode(std::uint64_t value) {
+    return (value >> 1) ^ (0 - (value & 1));
+}
+
+/// Write an encoded column behind its uint32 byte length.
+inline void write_column_bytes(std::ostream& os, const std::string& column) {
+    const auto length = static_cast<std::uint32_t>(column.size());
+    os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    os.write(column.data(), static_cast<std::streamsize>(column.size()));
+    if (!os) {
+        throw std::runtime_error("Failed to serialize key column: stream error");
+    }
+}
+
+/**
+ * @brief Read a column written by write_column_bytes into `column`
+ * @param max_bytes Largest byte length `count` keys of the type can encode to;
+ *        the length is file-controlled, so anything larger is rejected before
+ *        allocating
+ * @throws std::runtime_error on stream error or an implausible length
+ */
+inline void read_column_bytes(std::istream& is, std::size_t max_bytes, std::string& column) {
+    std::uint32_t length;
+    is.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (!is) {
+        throw std::runtime_error("Failed to deserialize key column: stream error reading length");
+    }
+    if (length > max_bytes) {
+        throw std::runtime_error("Failed to deserialize key column: length exceeds key count");
+    }
+    column.resize(length);
+    is.read(column.data(), static_cast<std::streamsize>(length));
+    if (!is) {
+        throw std::runtime_error("Failed to deserialize key column: stream error reading content");
+    }
+}
+
+/// Append the start-delta column, then the length column, of `count` range keys.
+template<typename value_at>
+void append_range_columns(std::string& out, std::size_t count, value_at& value) {
+    std::uint64_t prev = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint64_t start = value(i).get_start();
+        append_varint(out, zigzag_encode(start - prev));
+        prev = start;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& v = value(i);
+        append_varint(out, v.get_end() - v.get_start());
+    }
+}
+
+/**
+ * @brief Decode the columns written by append_range_columns
+ *
+ * Calls `emit(i, start, end)` per key in order; `starts` is scratch space.
+ * @throws std::runtime_error if a varint is malformed or an end overflows
+ */
+template<typename emit_fn>
+void decode_range_columns(const char*& pos, const char* end, std::size_t count,
+                          std::vector<std::uint64_t>& starts, emit_fn&& emit) {
+    starts.resize(count);
+    std::uint64_t prev = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        prev += zigzag_decode(read_varint(pos, end));
+        starts[i] = prev;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint64_t length = read_varint(pos, end);
+        if (length > std::numeric_limits<std::size_t>::max() - starts[i]) {
+            throw std::runtime_error("Failed to deserialize key column: interval end overflows");
+        }
+        emit(i, static_cast<std::size_t>(starts[i]), static_cast<std::size_t>(starts[i] + length));
+    }
+}
+
+/// Reject a decoded end position beyond what a 32-bit key type can hold.
+inline void require_position_fits(std::size_t end, std::size_t max_position) {
+    if (end > max_position) {
+        throw std::runtime_error("Failed to deserialize key column: position exceeds key width");
+    }
+}
+
+/// Reject bytes left over after a column's last value.
+inline void require_column_consumed(const char* pos, const char* end) {
+    if (pos != end) {
+        throw std::runtime_error("Failed to deserialize key column: trailing bytes");
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Column codec for a run of keys; the primary template writes them row-wise
+ * @tparam T The key type
+ *
+ * `write(os, count, value)` serializes `value(0) .. value(count - 1)` (each a
+ * `const T&`); `read(is, count, out)` replaces `out` with the `count` values.
+ * read throws std::runtime_error on a malformed or truncated stream.
+ */
+template<typename T>
+struct key_column {
+    template<typename value_at>
+    static void write(std::ostream& os, std::size_t count, value_at&& value) {
+        for (std::size_t i = 0; i < count; ++i) {
+            serializer<T>::write(os, value(i));
+        }
+    }
+
+    static void read(std::istream& is, std::size_t count, std::vector<T>& out) {
+        out.clear();
+        out.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            out.push_back(serializer<T>::read(is));
+            if (!is) {
+                throw std::runtime_error("Failed to deserialize key column: stream error");
+            }
+        }
+    }
+};
+
+/// interval: [uint32 bytes][start deltas][lengths].
+template<>
+struct key_column<interval> {
+    static constexpr std::size_t max_bytes_per_key = 2 * detail::max_varint_bytes;
+
+    template<typename value_at>
+    static void write(std::ostream& os, std::size_t count, value_at&& value) {
+        std::string column;
+        column.reserve(count * 4);
+        detail::append_range_columns(column, count, value);
+        detail::write_column_bytes(os, column);
+    }
+
+    static void read(std::istream& is, std::size_t count, std::vector<interval>& out) {
+        std::string column;
+        detail::read_column_bytes(is, count * max_bytes_per_key, column);
+        const char* pos = column.data();
+        const char* end = pos + column.size();
+        std::vector<std::uint64_t> starts;
+        out.clear();
+        out.reserve(count);
+        detail::decode_range_columns(pos, end, count, starts,
+            [&](std::size_t, std::size_t start, std::size_t stop) {
+                out.emplace_back(start, stop);
+            });
+        detail::require_column_consumed(pos, end);
+    }
+};
+
+/// genomic_coordinate: [uint32 bytes][2-bit strand codes][start deltas][lengths].
+/// Strands take four values ('+', '-', '.', '*'), hence two bits rather than one.
+template<>
+struct key_column<genomic_coordinate> {
+    static constexpr std::size_t max_bytes_per_key = 2 * detail::max_varint_bytes + 1;
+
+    static constexpr std::uint8_t strand_code(char strand) noexcept {
+        switch (strand) {
+            case '+': return 0;
+            case '-': return 1;
+            case '.': return 2;
+            default:  return 3;  // '*' — the constructor admits nothing else
+        }
+    }
+
+    static constexpr char strand_from_code(unsigned code) noexcept {
+        constexpr char strands[4] = {'+', '-', '.', '*'};
+        return strands[code & 3u];
+    }
+
+    template<typename value_at>
+    static void write(std::ostream& os, std::size_t count, value_at&& value) {
+        std::string column((count + 3) / 4, '\0');
+        for (std::size_t i = 0; i < count; ++i) {
+            column[i / 4] = static_cast<char>(static_cast<std::uint8_t>(column[i / 4]) |
+                                              (strand_code(value(i).get_strand()) << (2 * (i % 4))));
+        }
+        column.reserve(column.size() + count * 4);
+        detail::append_range_columns(column, count, value);
+        detail::write_column_bytes(os, column);
+    }
+
+    static void read(std::istream& is, std::size_t count, std::vector<genomic_coordinate>& out) {
+        std::string column;
+        detail::read_column_bytes(is, count * max_bytes_per_key, column);
+        const std::size_t strand_bytes = (count + 3) / 4;
+        if (column.size() < strand_bytes) {
+            throw std::runtime_error("Failed to deserialize key column: truncated strand column");
+        }
+        const char* strands = column.data();
+        const char* pos = strands + strand_bytes;
+        const char* end = column.data() + column.size();
+        std::vector<std::uint64_t> starts;
+        out.clear();
+        out.reserve(count);
+        detail::decode_range_columns(pos, end, count, starts,
+            [&](std::size_t i, std::size_t start, std::size_t stop) {
+                const auto bits = static_cast<std::uint8_t>(strands[i / 4]) >> (2 * (i % 4));
+                out.emplace_back(strand_from_code(bits), start, stop);
+            });
+        detail::require_column_consumed(pos, end);
+    }
+};
+
+/// interval32: the interval layout; decoded positions must fit 32 bits.
+template<>
+struct key_column<interval32> {
+    static constexpr std::size_t max_bytes_per_key = 2 * detail::max_varint_bytes;
+
+    template<typename value_at>
+    static void write(std::ostream& os, std::size_t count, value_at&& value) {
+        std::string column;
+        column.reserve(count * 4);
+        detail::append_range_columns(column, count, value);
+        detail::write_column_bytes(os, column);
+    }
+
+    static void read(std::istream& is, std::size_t count, std::vector<interval32>& out) {
+        std::string column;
+        detail::read_column_bytes(is, count * max_bytes_per_key, column);
+        const char* pos = column.data();
+        const char* end = pos + column.size();
+        std::vector<std::uint64_t> starts;
+        out.clear();
+        out.reserve(count);
+        detail::decode_range_columns(pos, end, count, starts,
+            [&](std::size_t, std::size_t start, std::size_t stop) {
+                detail::require_position_fits(stop, interval32::max_position);
+                out.emplace_back(start, stop);
+            });
+        detail::require_column_consumed(pos, end);
+    }
+};
+
+/// genomic_coordinate32: the genomic_coordinate layout, with the key's own
+/// 2-bit strand codes; decoded positions must fit 31 bits.
+template<>
+struct key_column<genomic_coordinate32> {
+    static constexpr std::size_t max_bytes_per_key = 2 * detail::max_varint_bytes + 1;
+
+    template<typename value_at>
+    static void write(std::ostream& os, std::size_t count, value_at&& value) {
+        std::string column((count + 3) / 4, '\0');
+        for (std::size_t i = 0; i < count; ++i) {
+            column[i / 4] = static_cast<char>(static_cast<std::uint8_t>(column[i / 4]) |
+                                              (value(i).get_strand_code() << (2 * (i % 4))));
+        }
+        column.reserve(column.size() + count * 4);
+        detail::append_range_columns(column, count, value);
+        detail::write_column_bytes(os, column);
+    }
+
+    static void read(std::istream& is, std::size_t count, std::vector<genomic_coordinate32>& out) {
+        std::string column;
+        detail::read_column_bytes(is, count * max_bytes_per_key, column);
+        const std::size_t strand_bytes = (count + 3) / 4;
+        if (column.size() < strand_bytes) {
+            throw std::runtime_error("Failed to deserialize key column: truncated strand column");
+        }
+        const char* strands = column.data();
+        const char* pos = strands + strand_bytes;
+        const char* end = column.data() + column.size();
+        std::vector<std::uint64_t> starts;
+        out.clear();
+        out.reserve(count);
+        detail::decode_range_columns(pos, end, count, starts,
+            [&](std::size_t i, std::size_t start, std::size_t stop) {
+                detail::require_position_fits(stop, genomic_coordinate32::max_position);
+                const auto bits = static_cast<std::uint8_t>(strands[i / 4]) >> (2 * (i % 4));
+                out.emplace_back(genomic_coordinate32::strand_from_code(bits), start, stop);
+            });
+        detail::require_column_consumed(pos, end);
+    }
+};
+
+/// numeric: [uint32 bytes][value deltas].
+template<>
+struct key_column<numeric> {
+    static constexpr std::size_t max_bytes_per_key = detail::max_varint_bytes;
+
+    template<typename value_at>
+    static void write(std::ostream& os, std::size_t count, value_at&& value) {
+        std::string column;
+        column.reserve(count * 2);
+        std::int64_t prev = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::int64_t v = value(i).get_value();
+            detail::append_varint(column, detail::zigzag_encode(static_cast<std::uint64_t>(v - prev)));
+            prev = v;
+        }
+        detail::write_column_bytes(os, column);
+    }
+
+    static void read(std::istream& is, std::size_t count, std::vector<numeric>& out) {
+        std::string column;
+        detail::read_column_bytes(is, count * max_bytes_per_key, column);
+        const char* pos = column.data();
+        const char* end = pos + column.size();
+        out.clear();
+        out.reserve(count);
+        std::int64_t prev = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto delta = static_cast<std::int64_t>(
+                detail::zigzag_decode(detail::read_varint(pos, end)));
+            if (delta > std::numeric_limits<int>::max() - prev ||
+                delta < std::numeric_limits<int>::min() - prev) {
+                throw std::runtime_error("Failed to deserialize key column: numeric value out of range");
+            }
+            prev += delta;
+            out.emplace_back(static_cast<int>(prev));
+        }
+        detail::require_column_consumed(pos, end);
+    }
+};
+
+} // namespace genogrove::data_type
+
+#endif // GENOGROVE_DATA_TYPE_KEY_COLUMN_HPP
@@ -206,6 +206,41 @@ namespace genogrove::data_type {
              */
             constexpr uint8_t get_k() const noexcept { return k; }
 
+            /**
+             * @brief Get the reverse complement of the k-mer.
+             *
+             * Complementing a base flips both of its bits (A<->T, C<->G), so the
+             * reverse complement is the complemented encoding with its 2-bit
+             * groups in reverse order — a handful of word operations, no
+             * per-base loop.
+             *
+             * @return The reverse complement, with the same k
+             */
+            [[nodiscard]] constexpr kmer reverse_complement() const {
+                if (k == 0) return *this;
+                uint64_t x = ~encoding;
+                x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+                x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+                x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+                x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+                x = (x >> 32) | (x << 32);
+                return kmer(x >> (2 * (max_k - k)), k);
+            }
+
+            /**
+             * @brief Get the canonical form of the k-mer.
+             *
+             * The canonical k-mer is the smaller (by encoding) of the k-mer and
+             * its reverse complement, so both strands of a sequence map to the
+             * same key.
+             *
+             * @return The canonical k-mer
+             */
+            [[nodiscard]] constexpr kmer canonical() const {
+                const kmer rc = reverse_complement();
+                return rc.encoding < encoding ? rc : *this;
+            }
+
             /**
              * @brief Serialize the k-mer to an output stream.
              *
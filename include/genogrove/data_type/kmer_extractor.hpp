@@ -0,0 +1,220 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_DATA_TYPE_KMER_EXTRACTOR_HPP
+#define GENOGROVE_DATA_TYPE_KMER_EXTRACTOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <genogrove/data_type/kmer.hpp>
+
+namespace genogrove::data_type {
+
+    namespace detail {
+        /// 2-bit code of every byte; 4 marks a byte that is not A, C, G or T.
+        inline constexpr std::array<uint8_t, 256> base_codes = [] {
+            std::array<uint8_t, 256> codes{};
+            codes.fill(4);
+            codes['A'] = codes['a'] = 0;
+            codes['C'] = codes['c'] = 1;
+            codes['G'] = codes['g'] = 2;
+            codes['T'] = codes['t'] = 3;
+            return codes;
+        }();
+    }
+
+    /**
+     * @brief Options for kmer_extractor.
+     */
+    struct kmer_extractor_options {
+        bool canonical = false;  ///< Emit the smaller of each k-mer and its reverse complement
+
+        [[nodiscard]] static kmer_extractor_options defaults() { return {}; }
+    };
+
+    /**
+     * @brief One k-mer of a sequence and where it starts.
+     */
+    struct kmer_hit {
+        std::size_t position;  ///< 0-based offset of the k-mer's first base in the sequence
+        kmer value;            ///< The k-mer (canonical if requested)
+    };
+
+    /**
+     * @brief A k-mer of a read found in an index (see grove::lookup_kmers).
+     *
+     * @tparam key_ptr Pointer to the matching key; its data is the payload
+     */
+    template<typename key_ptr>
+    struct kmer_match {
+        std::size_t position;  ///< 0-based offset of the k-mer in the read
+        key_ptr key;           ///< The matching key in the index
+    };
+
+    /**
+     * @brief Rolling extractor over every k-mer of a sequence.
+     *
+     * Each step shifts one base into the forward encoding (and, for canonical
+     * k-mers, into the reverse-complement encoding from the other end), so
+     * extracting all k-mers of a sequence of length L costs O(L) rather than
+     * O(L·k) for building a kmer from every window.
+     *
+     * Windows containing a base other than A, C, G or T (e.g. N) are skipped:
+     * the extractor restarts after the offending base.
+     *
+     * ## Usage
+     *
+     * ```cpp
+     * fasta_reader reader(path);
+     * for (const auto& entry : reader) {
+     *     for (const auto& hit : kmer_extractor(entry.sequence, 31, {.canonical = true})) {
+     *         // hit.position, hit.value
+     *     }
+     * }
+     *
+     * // Or a region of an indexed FASTA:
+     * std::string region = fasta.fetch("chr1", 1000, 2000);
+     * for (const auto& hit : kmer_extractor(region, 21)) { ... }
+     * ```
+     *
+     * @note Non-owning: the sequence must outlive the extractor and its iterators.
+     */
+    class kmer_extractor {
+        public:
+            /**
+             * @brief Create an extractor over `sequence`.
+             *
+             * @param sequence DNA sequence (case-insensitive)
+             * @param k K-mer length (1-32)
+             * @param options Extraction options
+             * @throws std::invalid_argument if k is 0 or exceeds kmer::max_k
+             */
+            kmer_extractor(std::string_view sequence, uint8_t k,
+                           kmer_extractor_options options = kmer_extractor_options::defaults())
+                : sequence(sequence), k(k), options(options) {
+                if (k == 0 || k > kmer::max_k) {
+                    throw std::invalid_argument("kmer_extractor: k must be in [1, 32]");
+                }
+            }
+
+            /**
+             * @brief Single-pass input iterator over the k-mers of the sequence.
+             */
+            class iterator {
+                public:
+                    using iterator_category = std::input_iterator_tag;
+                    using value_type = kmer_hit;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const kmer_hit*;
+                    using reference = const kmer_hit&;
+
+                    iterator() = default;
+
+                    explicit iterator(const kmer_extractor* owner)
+                        : owner(owner),
+                          mask(owner->k == kmer::max_k ? ~0ULL : (1ULL << (2 * owner->k)) - 1),
+                          rc_shift(2 * (owner->k - 1)) {
+                        advance();
+                    }
+
+                    reference operator*() const { return current; }
+                    pointer operator->() const { return &current; }
+
+                    iterator& operator++() {
+                        advance();
+                        return *this;
+                    }
+
+                    void operator++(int) { advance(); }
+
+                    bool operator==(const iterator& other) const {
+                        return owner == other.owner && (owner == nullptr || pos == other.pos);
+                    }
+
+                private:
+                    // Shift bases in until a full valid window is available, or
+                    // mark the iterator as end.
+                    void advance() {
+                        const auto seq = owner->sequence;
+                        while (pos < seq.size()) {
+                            const uint8_t code = detail::base_codes[static_cast<unsigned char>(seq[pos++])];
+                            if (code > 3) {
+                                filled = 0;
+                                continue;
+                            }
+                            forward = ((forward << 2) | code) & mask;
+                            reverse = (reverse >> 2) | (static_cast<uint64_t>(3 - code) << rc_shift);
+                            if (filled < owner->k) ++filled;
+                            if (filled == owner->k) {
+                                const uint64_t enc = owner->options.canonical && reverse < forward
+                                    ? reverse : forward;
+                                current = {pos - owner->k, kmer(enc, owner->k)};
+                                return;
+                            }
+                        }
+                        owner = nullptr;  // end
+                    }
+
+                    const kmer_extractor* owner = nullptr;
+                    uint64_t mask = 0;
+                    unsigned rc_shift = 0;
+                    std::size_t pos = 0;       ///< Next base to shift in
+                    std::size_t filled = 0;    ///< Valid bases in the current window (capped at k)
+                    uint64_t forward = 0;
+                    uint64_t reverse = 0;
+                    kmer_hit current{0, kmer()};
+            };
+
+            [[nodiscard]] iterator begin() const { return iterator(this); }
+            [[nodiscard]] iterator end() const { return iterator(); }
+
+        private:
+            std::string_view sequence;
+            uint8_t k;
+            kmer_extractor_options options;
+    };
+
+    /**
+     * @brief Append the encodings of every k-mer of every sequence to `out`.
+     *
+     * Accepts any range whose elements are either convertible to
+     * std::string_view or have a `sequence` member (io::fasta_entry), so a
+     * fasta_reader can be passed directly. The result is unsorted and keeps
+     * duplicates — grove::insert_kmers() sorts and deduplicates it.
+     *
+     * @param sequences Range of sequences or FASTA/FASTQ records
+     * @param k K-mer length (1-32)
+     * @param out Destination for the 2-bit encodings
+     * @param options Extraction options
+     * @throws std::invalid_argument if k is 0 or exceeds kmer::max_k
+     */
+    template<typename Sequences>
+    void collect_kmer_encodings(Sequences&& sequences, uint8_t k, std::vector<uint64_t>& out,
+                                kmer_extractor_options options = kmer_extractor_options::defaults()) {
+        if (k == 0 || k > kmer::max_k) {
+            throw std::invalid_argument("collect_kmer_encodings: k must be in [1, 32]");
+        }
+        for (const auto& entry : sequences) {
+            std::string_view seq;
+            if constexpr (requires { entry.sequence; }) {
+                seq = entry.sequence;
+            } else {
+                seq = entry;
+            }
+            for (const auto& hit : kmer_extractor(seq, k, options)) {
+                out.push_back(hit.value.get_encoding());
+            }
+        }
+    }
+
+}
+
+#endif // GENOGROVE_DATA_TYPE_KMER_EXTRACTOR_HPP
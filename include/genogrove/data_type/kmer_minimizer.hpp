@@ -0,0 +1,124 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_DATA_TYPE_KMER_MINIMIZER_HPP
+#define GENOGROVE_DATA_TYPE_KMER_MINIMIZER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <genogrove/data_type/kmer.hpp>
+
+namespace genogrove::data_type {
+
+    /**
+     * @brief Scramble an m-mer encoding for minimizer ordering.
+     *
+     * Ordering m-mers by raw encoding makes poly-A runs the minimizer of
+     * almost everything; ordering by a mixed value spreads minimizers (and so
+     * buckets) evenly. splitmix64 finalizer — a bijection on 64 bits.
+     */
+    [[nodiscard]] constexpr uint64_t minimizer_hash(uint64_t encoding) noexcept {
+        encoding ^= encoding >> 30;
+        encoding *= 0xbf58476d1ce4e5b9ULL;
+        encoding ^= encoding >> 27;
+        encoding *= 0x94d049bb133111ebULL;
+        encoding ^= encoding >> 31;
+        return encoding;
+    }
+
+    /**
+     * @brief Minimizer of a k-mer: the m-mer with the smallest minimizer_hash().
+     *
+     * With `canonical` set each m-mer is first replaced by the smaller of
+     * itself and its reverse complement, so a k-mer and its reverse
+     * complement have the same minimizer. O(k - m) word operations.
+     *
+     * @param value The k-mer
+     * @param m Minimizer length (1 <= m <= k)
+     * @param canonical Use canonical m-mers
+     * @return The minimizer's hash (not its encoding) — the quantity to bucket on
+     * @throws std::invalid_argument if m is 0 or exceeds the k-mer's length
+     */
+    [[nodiscard]] constexpr uint64_t kmer_minimizer(const kmer& value, uint8_t m, bool canonical) {
+        const uint8_t k = value.get_k();
+        if (m == 0 || m > k) {
+            throw std::invalid_argument("kmer_minimizer: m must be in [1, k]");
+        }
+        const uint64_t mmask = m == kmer::max_k ? ~0ULL : (1ULL << (2 * m)) - 1;
+        const uint64_t fwd = value.get_encoding();
+        const uint64_t rc = canonical ? value.reverse_complement().get_encoding() : 0;
+        uint64_t best = ~0ULL;
+        for (unsigned i = 0; i + m <= k; ++i) {
+            // m-mer starting at base i; its reverse complement sits at base i
+            // from the right end of the reverse-complemented k-mer.
+            uint64_t mmer = (fwd >> (2 * (k - m - i))) & mmask;
+            if (canonical) {
+                const uint64_t mmer_rc = (rc >> (2 * i)) & mmask;
+                if (mmer_rc < mmer) mmer = mmer_rc;
+            }
+            const uint64_t h = minimizer_hash(mmer);
+            if (h < best) best = h;
+        }
+        return best;
+    }
+
+    /**
+     * @brief How a bucketed k-mer grove spreads k-mers over indices.
+     *
+     * Every k-mer goes to bucket `kmer_minimizer(kmer, m, canonical) % buckets`,
+     * stored in the grove under the index `prefix + "#" + bucket`. K-mers that
+     * overlap in a sequence mostly share a minimizer, so the k-mers of a read
+     * fall into a handful of buckets and neighbouring k-mers share leaves.
+     * grove::insert_kmers(prefix, encodings, bucketing) builds such a grove;
+     * index_for() routes a query.
+     */
+    struct kmer_bucketing {
+        uint8_t k = 31;          ///< K-mer length
+        uint8_t m = 15;          ///< Minimizer length (<= k)
+        uint32_t buckets = 256;  ///< Number of buckets (>= 1)
+        bool canonical = false;  ///< Bucket by canonical m-mers (use with canonical k-mers)
+
+        /**
+         * @brief Check the parameters
+         * @throws std::invalid_argument if k or m is out of range or buckets is 0
+         */
+        void validate() const {
+            if (k == 0 || k > kmer::max_k) {
+                throw std::invalid_argument("kmer_bucketing: k must be in [1, 32]");
+            }
+            if (m == 0 || m > k) {
+                throw std::invalid_argument("kmer_bucketing: m must be in [1, k]");
+            }
+            if (buckets == 0) {
+                throw std::invalid_argument("kmer_bucketing: buckets must be at least 1");
+            }
+        }
+
+        /// Bucket of a k-mer of length k.
+        [[nodiscard]] uint32_t bucket_of(const kmer& value) const {
+            return static_cast<uint32_t>(kmer_minimizer(value, m, canonical) % buckets);
+        }
+
+        /// Index name of a bucket.
+        [[nodiscard]] static std::string index_name(std::string_view prefix, uint32_t bucket) {
+            std::string name(prefix);
+            name += '#';
+            name += std::to_string(bucket);
+            return name;
+        }
+
+        /// Index name holding a k-mer.
+        [[nodiscard]] std::string index_for(std::string_view prefix, const kmer& value) const {
+            return index_name(prefix, bucket_of(value));
+        }
+    };
+
+}
+
+#endif // GENOGROVE_DATA_TYPE_KMER_MINIMIZER_HPP
@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_DATA_TYPE_NEAREST_QUERY_RESULT_HPP
+#define GENOGROVE_DATA_TYPE_NEAREST_QUERY_RESULT_HPP
+
+#include <utility>
+#include <vector>
+
+#include <genogrove/data_type/key.hpp>
+#include <genogrove/data_type/key_type_base.hpp>
+
+namespace genogrove::data_type {
+
+    /**
+     * @brief Result of a nearest-k query — up to k keys on each side of a query,
+     *        ordered nearest first.
+     *
+     * Returned by grove::nearest() and grove_view::nearest(), the k-neighbor
+     * generalization of flanking_query_result:
+     * - `predecessors` are keys before the query in sort order that do not
+     *   overlap it, ordered by increasing gap `query.start - K.end - 1`
+     * - `successors` are keys after the query in sort order that do not
+     *   overlap it, ordered by increasing gap `K.start - query.end - 1`
+     *
+     * For intervals these lie entirely before or after the query. A stranded
+     * key (genomic_coordinate) on another strand may spatially overlap the
+     * query; its gap is 0. Keys at equal distance keep the grove's sort order,
+     * so with k = 1 the two lists hold exactly the predecessor and successor
+     * flanking() returns.
+     * Either list may hold fewer than k keys (or none) when the index runs out
+     * of candidates or a maximum distance cuts the search short.
+     *
+     * ## Memory Ownership
+     * Pointers reference keys owned by the grove (or the grove_view's block
+     * cache, with the same lifetime rules as its other query results).
+     *
+     * @tparam key_t The key type (must satisfy key_type_base concept)
+     * @tparam data_t Optional associated data type (default: void)
+     *
+     * @see grove::nearest()
+     * @see flanking_query_result for the single-neighbor result
+     */
+    template <key_type_base key_t, typename data_t = void>
+    class nearest_query_result {
+        public:
+            /**
+             * @brief Default-construct with both neighbor lists empty.
+             */
+            nearest_query_result() = default;
+
+            /**
+             * @brief Get the keys before the query, nearest first.
+             */
+            [[nodiscard]] const std::vector<key<key_t, data_t>*>& get_predecessors() const noexcept {
+                return this->predecessors;
+            }
+
+            /**
+             * @brief Get the keys after the query, nearest first.
+             */
+            [[nodiscard]] const std::vector<key<key_t, data_t>*>& get_successors() const noexcept {
+                return this->successors;
+            }
+
+            /**
+             * @brief Replace the predecessor list (nearest first).
+             *
+             * Used internally once the descent has settled the k best candidates.
+             */
+            void set_predecessors(std::vector<key<key_t, data_t>*> keys) noexcept {
+                this->predecessors = std::move(keys);
+            }
+
+            /**
+             * @brief Replace the successor list (nearest first).
+             */
+            void set_successors(std::vector<key<key_t, data_t>*> keys) noexcept {
+                this->successors = std::move(keys);
+            }
+
+        private:
+            std::vector<key<key_t, data_t>*> predecessors;
+            std::vector<key<key_t, data_t>*> successors;
+    };
+
+}
+
+#endif //GENOGROVE_DATA_TYPE_NEAREST_QUERY_RESULT_HPP
@@ -6,9 +6,13 @@
 #ifndef GENOGROVE_REGISTRY_HPP
 #define GENOGROVE_REGISTRY_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
-#include <deque>
 #include <functional>
 #include <istream>
 #include <limits>
@@ -17,8 +21,10 @@
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <genogrove/data_type/serialization_traits.hpp>
@@ -38,6 +44,111 @@ concept registry_value =
         { std::hash<T>{}(t) } -> std::convertible_to<std::size_t>;
     };
 
+namespace detail {
+
+/**
+ * @brief Append-only element store whose elements never move
+ *
+ * Elements live in segments of doubling size (1024, 2048, 4096, ...), so
+ * appending never relocates an existing element and a reader can index the
+ * store while a writer appends. The writer constructs the element before it
+ * publishes the new size (release); a reader that observes `size() > i`
+ * (acquire), or that received `i` through any other happens-before edge,
+ * may read element `i` without a lock.
+ *
+ * Appends must be serialized by the caller; clear(), moves and destruction
+ * must not race any reader.
+ */
+template<typename T>
+class segmented_store {
+  public:
+    segmented_store() = default;
+    segmented_store(const segmented_store&) = delete;
+    segmented_store& operator=(const segmented_store&) = delete;
+
+    segmented_store(segmented_store&& other) noexcept { steal(other); }
+
+    segmented_store& operator=(segmented_store&& other) noexcept {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~segmented_store() { clear(); }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return count.load(std::memory_order_acquire);
+    }
+
+    const T& operator[](std::size_t i) const noexcept {
+        const auto [seg, offset] = locate(i);
+        return segments[seg].load(std::memory_order_acquire)[offset];
+    }
+
+    /// Append `value`; strong exception guarantee.
+    template<typename U>
+    void push_back(U&& value) {
+        const std::size_t i = count.load(std::memory_order_relaxed);
+        const auto [seg, offset] = locate(i);
+        T* block = segments[seg].load(std::memory_order_relaxed);
+        if (block == nullptr) {
+            block = std::allocator<T>{}.allocate(segment_size(seg));
+            segments[seg].store(block, std::memory_order_release);
+        }
+        std::construct_at(block + offset, std::forward<U>(value));
+        count.store(i + 1, std::memory_order_release);
+    }
+
+    void clear() noexcept {
+        const std::size_t n = count.load(std::memory_order_relaxed);
+        for (std::size_t seg = 0; seg < segments.size(); ++seg) {
+            T* block = segments[seg].load(std::memory_order_relaxed);
+            if (block == nullptr) {
+                continue;
+            }
+            const std::size_t first = segment_size(seg) - first_segment;
+            const std::size_t used =
+                n > first ? std::min(n - first, segment_size(seg)) : 0;
+            std::destroy_n(block, used);
+            std::allocator<T>{}.deallocate(block, segment_size(seg));
+            segments[seg].store(nullptr, std::memory_order_relaxed);
+        }
+        count.store(0, std::memory_order_release);
+    }
+
+  private:
+    static constexpr unsigned first_segment_bits = 10;
+    static constexpr std::size_t first_segment = std::size_t{1} << first_segment_bits;
+    // Enough segments for every id below 2^32 (registry ids are uint32_t).
+    static constexpr std::size_t segment_count = 33 - first_segment_bits;
+
+    static constexpr std::size_t segment_size(std::size_t seg) noexcept {
+        return first_segment << seg;
+    }
+
+    // Segment `s` holds elements [first_segment * (2^s - 1), first_segment * (2^(s+1) - 1)).
+    static constexpr std::pair<std::size_t, std::size_t> locate(std::size_t i) noexcept {
+        const std::uint64_t v = static_cast<std::uint64_t>(i) + first_segment;
+        const auto seg = static_cast<std::size_t>(std::bit_width(v) - 1 - first_segment_bits);
+        return {seg, static_cast<std::size_t>(v - segment_size(seg))};
+    }
+
+    void steal(segmented_store& other) noexcept {
+        for (std::size_t seg = 0; seg < segments.size(); ++seg) {
+            segments[seg].store(other.segments[seg].exchange(nullptr, std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+        }
+        count.store(other.count.exchange(0, std::memory_order_relaxed), std::memory_order_release);
+    }
+
+    std::array<std::atomic<T*>, segment_count> segments{};
+    std::atomic<std::size_t> count{0};
+};
+
+} // namespace detail
+
 /**
  * @brief Singleton registry that interns values into small integer IDs.
  *
@@ -83,18 +194,20 @@ concept registry_value =
  * source_registry::instance().intern("HAVANA");           // 0 in source pool (separate)
  * @endcode
  *
- * @note Thread safety: intern(), find(), clear(), serialize(), and deserialize()
- *       are mutex-protected and may be called concurrently with one another.
- *       get(), contains(), size(), and empty() are UNLOCKED fast paths — they are
- *       safe only when no writer (intern/clear/reset/deserialize) runs concurrently.
- *       Calling any of them while a writer is in flight is a data race, and thus
- *       undefined behavior (not a stale-but-defined read): they touch the same
- *       std::deque / std::unordered_map that intern() grows and deserialize()
- *       move-assigns, and even a std::deque push_back races an unlocked reader on
- *       the container's internal bookkeeping. Intended pattern: intern during a
- *       build phase, then — once mutation has ceased and that fact is published to
- *       reader threads (a thread join, mutex, atomic, or queue that establishes
- *       happens-before) — read freely and lock-free from many threads.
+ * @note Thread safety: all members may be called concurrently with intern() and
+ *       find(). The key→id lookup is split into `shard_count` hash shards, each
+ *       with its own mutex, so threads interning different keys rarely contend;
+ *       a short global append lock is taken only when a new key is allocated
+ *       its id, which keeps ids dense and assigned in first-intern order. Each
+ *       thread also keeps a small direct-mapped front cache of recently
+ *       interned keys, so re-interning a hot key (a gene id repeated on every
+ *       exon) takes no lock at all. get(), contains(), size() and empty() are
+ *       lock-free: payloads live in an append-only store whose elements never
+ *       move, so get(id) is safe for any id the caller obtained from intern()
+ *       or find(). clear(), reset() and deserialize() lock every shard and
+ *       invalidate the front caches; they are safe against concurrent intern()
+ *       and find(), but an id obtained before them must not be passed to get()
+ *       afterwards, and get() must not run concurrently with them.
  *
  * @note Singleton lifetime: Data persists for program duration. Call reset() in
  *       tests to clear state between cases.
@@ -166,24 +279,39 @@ class registry {
      * @note Thread-safe.
      */
     [[nodiscard]] id_type intern(const Key& key, const Payload& payload) {
-        std::lock_guard lock(mtx);
-        if (auto it = lookup.find(key); it != lookup.end()) {
-            return it->second;
+        const std::size_t hash = std::hash<Key>{}(key);
+        const std::uint64_t gen = generation.load(std::memory_order_acquire);
+        auto& cache = local_cache();
+        if (auto id = cache.find(key, hash, gen); id != null_id) {
+            return id;
         }
-        if (storage.size() >= null_id) {
-            throw std::runtime_error("registry: maximum capacity reached");
-        }
-        auto id = static_cast<id_type>(storage.size());
-        storage.push_back(payload);
-        try {
-            lookup.emplace(key, id);
-        } catch (...) {
-            // Roll back the deque entry so storage and lookup stay consistent;
-            // otherwise the orphaned value would be invisible to future
-            // intern() calls but still occupy an id slot.
-            storage.pop_back();
-            throw;
+
+        auto& s = shard_for(hash);
+        id_type id;
+        {
+            std::lock_guard lock(s.mtx);
+            if (auto it = s.lookup.find(prehashed_key{key, hash}); it != s.lookup.end()) {
+                id = it->second;
+            } else {
+                // The append lock orders id allocation across shards. The key
+                // is entered first so that a throwing payload copy can be
+                // rolled back with a non-throwing erase; no other thread sees
+                // the entry until the shard lock is released.
+                std::lock_guard append_lock(append_mtx);
+                if (storage.size() >= null_id) {
+                    throw std::runtime_error("registry: maximum capacity reached");
+                }
+                id = static_cast<id_type>(storage.size());
+                const auto entry = s.lookup.emplace(key, id).first;
+                try {
+                    storage.push_back(payload);
+                } catch (...) {
+                    s.lookup.erase(entry);
+                    throw;
+                }
+            }
         }
+        cache.store(key, hash, gen, id);
         return id;
     }
 
@@ -207,8 +335,16 @@ class registry {
      * @note Thread-safe.
      */
     [[nodiscard]] std::optional<id_type> find(const Key& key) const {
-        std::lock_guard lock(mtx);
-        if (auto it = lookup.find(key); it != lookup.end()) {
+        const std::size_t hash = std::hash<Key>{}(key);
+        const std::uint64_t gen = generation.load(std::memory_order_acquire);
+        auto& cache = local_cache();
+        if (auto id = cache.find(key, hash, gen); id != null_id) {
+            return id;
+        }
+        const auto& s = shard_for(hash);
+        std::lock_guard lock(s.mtx);
+        if (auto it = s.lookup.find(prehashed_key{key, hash}); it != s.lookup.end()) {
+            cache.store(key, hash, gen, it->second);
             return it->second;
         }
         return std::nullopt;
@@ -219,9 +355,8 @@ class registry {
      * @param id The ID returned from intern().
      * @return Const reference to the stored payload.
      * @throws std::out_of_range if `id` is not a valid ID.
-     * @note Unlocked. Safe only when no writer (intern/clear/reset/deserialize) runs
-     *       concurrently — a concurrent writer makes this a data race (undefined
-     *       behavior). See the class-level thread-safety note.
+     * @note Lock-free; safe concurrently with intern() and find(), but not with
+     *       clear/reset/deserialize. See the class-level thread-safety note.
      */
     const Payload& get(id_type id) const {
         if (id >= storage.size()) {
@@ -234,9 +369,7 @@ class registry {
      * @brief Check whether an ID refers to a valid entry.
      * @param id The ID to check.
      * @return true if valid, false otherwise.
-     * @note Unlocked. Not safe to call concurrently with a writer
-     *       (intern/clear/reset/deserialize) — that is a data race (undefined behavior);
-     *       see the class-level thread-safety note.
+     * @note Lock-free; safe concurrently with intern() and find().
      */
     [[nodiscard]] bool contains(id_type id) const noexcept {
         return id < storage.size();
@@ -244,9 +377,7 @@ class registry {
 
     /**
      * @brief Number of interned entries.
-     * @note Unlocked. Not safe to call concurrently with a writer
-     *       (intern/clear/reset/deserialize) — that is a data race (undefined behavior);
-     *       see the class-level thread-safety note.
+     * @note Lock-free; safe concurrently with intern() and find().
      */
     [[nodiscard]] std::size_t size() const noexcept {
         return storage.size();
@@ -254,12 +385,10 @@ class registry {
 
     /**
      * @brief Whether the registry has any entries.
-     * @note Unlocked. Not safe to call concurrently with a writer
-     *       (intern/clear/reset/deserialize) — that is a data race (undefined behavior);
-     *       see the class-level thread-safety note.
+     * @note Lock-free; safe concurrently with intern() and find().
      */
     [[nodiscard]] bool empty() const noexcept {
-        return storage.empty();
+        return storage.size() == 0;
     }
 
     /**
@@ -269,9 +398,12 @@ class registry {
      * @note Thread-safe.
      */
     void clear() {
-        std::lock_guard lock(mtx);
+        auto locks = lock_all();
+        for (auto& s : shards) {
+            s.lookup.clear();
+        }
         storage.clear();
-        lookup.clear();
+        generation.fetch_add(1, std::memory_order_release);
     }
 
     /**
@@ -293,24 +425,26 @@ class registry {
      *       - When `Key != Payload`: `uint64_t count` followed by
      *         `(key, payload)` pairs written in ID order. Both `serializer<Key>`
      *         and `serializer<Payload>` are required.
-     * @note Thread-safe (acquires the mutex for a coherent snapshot).
+     * @note Thread-safe (locks every shard for a coherent snapshot).
      */
     void serialize(std::ostream& os) const {
-        std::lock_guard lock(mtx);
+        auto locks = lock_all();
         uint64_t count = storage.size();
         os.write(reinterpret_cast<const char*>(&count), sizeof(count));
 
         if constexpr (key_is_payload) {
-            for (const auto& entry : storage) {
-                serializer<Payload>::write(os, entry);
+            for (std::size_t i = 0; i < storage.size(); ++i) {
+                serializer<Payload>::write(os, storage[i]);
             }
         } else {
-            // The lookup map is the only place the canonical key lives, so
+            // The lookup shards are the only place the canonical key lives, so
             // build a temporary id->key* index to walk storage and lookup
-            // together in id order without touching the map twice per entry.
+            // together in id order without touching a map twice per entry.
             std::vector<const Key*> key_by_id(storage.size(), nullptr);
-            for (const auto& kv : lookup) {
-                key_by_id[kv.second] = &kv.first;
+            for (const auto& s : shards) {
+                for (const auto& kv : s.lookup) {
+                    key_by_id[kv.second] = &kv.first;
+                }
             }
             for (std::size_t i = 0; i < storage.size(); ++i) {
                 serializer<Key>::write(os, *key_by_id[i]);
@@ -354,9 +488,11 @@ class registry {
         // serializer read failure, ctor failure) doesn't leave the singleton
         // in a partial state. Holding no lock during the slow I/O also stops
         // the read loop from blocking concurrent readers.
-        std::deque<Payload> new_storage;
-        std::unordered_map<Key, id_type> new_lookup;
-        new_lookup.reserve(static_cast<std::size_t>(count));
+        detail::segmented_store<Payload> new_storage;
+        std::array<lookup_map, shard_count> new_lookup;
+        for (auto& shard_lookup : new_lookup) {
+            shard_lookup.reserve(static_cast<std::size_t>(count / shard_count));
+        }
 
         for (uint64_t i = 0; i < count; ++i) {
             // Reject duplicate keys: emplace silently no-ops on the second
@@ -368,16 +504,18 @@ class registry {
             if constexpr (key_is_payload) {
                 Payload value = serializer<Payload>::read(is);
                 auto id = static_cast<id_type>(new_storage.size());
-                new_storage.push_back(std::move(value));
-                if (!new_lookup.emplace(new_storage.back(), id).second) {
+                auto& shard_lookup = new_lookup[shard_index(std::hash<Key>{}(value))];
+                if (!shard_lookup.emplace(value, id).second) {
                     throw std::runtime_error(
                         "Failed to deserialize registry: duplicate key");
                 }
+                new_storage.push_back(std::move(value));
             } else {
                 Key k = serializer<Key>::read(is);
                 Payload p = serializer<Payload>::read(is);
                 auto id = static_cast<id_type>(new_storage.size());
-                if (!new_lookup.emplace(std::move(k), id).second) {
+                auto& shard_lookup = new_lookup[shard_index(std::hash<Key>{}(k))];
+                if (!shard_lookup.emplace(std::move(k), id).second) {
                     throw std::runtime_error(
                         "Failed to deserialize registry: duplicate key");
                 }
@@ -385,21 +523,129 @@ class registry {
             }
         }
 
-        // Commit: noexcept move-assign of std::deque + std::unordered_map
-        // (both have propagate_on_container_move_assignment for std::allocator).
+        // Commit: noexcept move-assign of the store and the shard maps
+        // (std::unordered_map has propagate_on_container_move_assignment for
+        // std::allocator).
         auto& inst = instance();
-        std::lock_guard lock(inst.mtx);
+        auto locks = inst.lock_all();
+        for (std::size_t i = 0; i < shard_count; ++i) {
+            inst.shards[i].lookup = std::move(new_lookup[i]);
+        }
         inst.storage = std::move(new_storage);
-        inst.lookup = std::move(new_lookup);
+        inst.generation.fetch_add(1, std::memory_order_release);
         return inst;
     }
 
   private:
     registry() = default;
 
-    std::deque<Payload> storage;
-    std::unordered_map<Key, id_type> lookup;
-    mutable std::mutex mtx;
+    /// Number of lookup shards (a power of two). lock_all() holds every shard
+    /// lock at once, so this also stays below ThreadSanitizer's limit of 64
+    /// simultaneously held locks per thread.
+    static constexpr std::size_t shard_count = 32;
+    /// Entries in each thread's front cache (a power of two).
+    static constexpr std::size_t cache_size = 64;
+
+    // A key paired with its already-computed hash: intern() and find() hash
+    // once for the front cache and reuse the value for the shard lookup.
+    struct prehashed_key {
+        const Key& key;
+        std::size_t hash;
+    };
+    struct lookup_hash {
+        using is_transparent = void;
+        std::size_t operator()(const Key& k) const { return std::hash<Key>{}(k); }
+        std::size_t operator()(const prehashed_key& k) const noexcept { return k.hash; }
+    };
+    struct lookup_equal {
+        using is_transparent = void;
+        bool operator()(const Key& a, const Key& b) const { return a == b; }
+        bool operator()(const prehashed_key& a, const Key& b) const { return a.key == b; }
+        bool operator()(const Key& a, const prehashed_key& b) const { return a == b.key; }
+    };
+    using lookup_map = std::unordered_map<Key, id_type, lookup_hash, lookup_equal>;
+
+    // One cache line per shard so threads locking neighbouring shards do not
+    // false-share the mutexes.
+    struct alignas(64) shard {
+        mutable std::mutex mtx;
+        lookup_map lookup;
+    };
+
+    /**
+     * Per-thread, direct-mapped cache of recent (key, id) results. Entries are
+     * tagged with the registry generation they were filled in, so clear() and
+     * deserialize() invalidate every thread's cache by bumping the generation.
+     * Keys are held by copy so that a concurrent clear() can never leave a
+     * dangling reference behind.
+     */
+    struct front_cache {
+        struct entry {
+            std::optional<Key> key;
+            std::size_t hash = 0;
+            std::uint64_t generation = 0;
+            id_type id = null_id;
+        };
+        std::array<entry, cache_size> entries{};
+
+        id_type find(const Key& key, std::size_t hash, std::uint64_t gen) const {
+            const auto& e = entries[cache_slot(hash)];
+            if (e.generation == gen && e.hash == hash && e.key && *e.key == key) {
+                return e.id;
+            }
+            return null_id;
+        }
+
+        void store(const Key& key, std::size_t hash, std::uint64_t gen, id_type id) {
+            auto& e = entries[cache_slot(hash)];
+            if (e.generation == gen && e.hash == hash && e.key && *e.key == key) {
+                return;
+            }
+            e.key = key;
+            e.hash = hash;
+            e.generation = gen;
+            e.id = id;
+        }
+    };
+
+    // Fibonacci mixing, so that identity hashes (std::hash<int>) spread over
+    // the shards and cache slots. Shards take the top bits, cache slots the
+    // bits below them.
+    static constexpr std::uint64_t mix(std::size_t hash) noexcept {
+        return static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+    }
+    static constexpr std::size_t shard_index(std::size_t hash) noexcept {
+        return static_cast<std::size_t>(mix(hash) >> (64 - std::countr_zero(shard_count)));
+    }
+    static constexpr std::size_t cache_slot(std::size_t hash) noexcept {
+        return static_cast<std::size_t>(mix(hash) >> (64 - 2 * std::countr_zero(cache_size)))
+               & (cache_size - 1);
+    }
+
+    shard& shard_for(std::size_t hash) noexcept { return shards[shard_index(hash)]; }
+    const shard& shard_for(std::size_t hash) const noexcept { return shards[shard_index(hash)]; }
+
+    /// The calling thread's front cache for this registry type.
+    static front_cache& local_cache() {
+        thread_local front_cache cache;
+        return cache;
+    }
+
+    /// Lock every shard (in index order) and then the append lock.
+    std::array<std::unique_lock<std::mutex>, shard_count + 1> lock_all() const {
+        std::array<std::unique_lock<std::mutex>, shard_count + 1> locks;
+        for (std::size_t i = 0; i < shard_count; ++i) {
+            locks[i] = std::unique_lock(shards[i].mtx);
+        }
+        locks[shard_count] = std::unique_lock(append_mtx);
+        return locks;
+    }
+
+    detail::segmented_store<Payload> storage;
+    std::array<shard, shard_count> shards;
+    mutable std::mutex append_mtx;
+    // Starts at 1 so that a value-initialized cache entry never matches.
+    std::atomic<std::uint64_t> generation{1};
 };
 
 } // namespace genogrove::data_type
@@ -244,6 +244,7 @@ namespace genogrove::io {
     struct sam_entry {
         std::string qname;              ///< Query template NAME (read name)
         std::string chrom;              ///< Reference sequence name (RNAME)
+        int32_t ref_id = -1;            ///< Index of RNAME in bam_reader::get_reference_names() (htslib tid); -1 when RNAME is "*"
         size_t start = 0;              ///< 0-based start position (htslib-native, from POS). Unmapped reads carry `start == 0`; zero-ref-consuming CIGARs (e.g. pure soft-clip) carry `start == end == POS`.
         size_t end = 0;                ///< 0-based exclusive end position (htslib-native, from POS + CIGAR-consumed reference length). Equals `start` for unmapped reads and for zero-ref-consuming CIGARs (pure soft-clip, hard-clip-only secondaries). Convert to closed `gdt::interval(start, end - 1)` only when `consumes_reference()` is true.
         alignment_flags flags;          ///< Bitwise FLAG
@@ -12,6 +12,7 @@
 #include <filesystem>
 #include <iosfwd>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -67,6 +68,7 @@ namespace genogrove::io {
      */
     struct bed_entry {
         std::string chrom;
+        int32_t chrom_id = -1;  ///< Index of `chrom` in bed_reader::get_chromosomes() (order of first appearance); -1 when not read by a bed_reader. Not serialized.
         size_t start = 0;   ///< 0-based start position (BED chromStart)
         size_t end = 0;     ///< 0-based exclusive end position (BED chromEnd)
 
@@ -127,7 +129,10 @@ namespace genogrove::io {
               bgzf_file(other.bgzf_file), line_num(other.line_num),
               error_message(std::move(other.error_message)),
               options(std::move(other.options)),
-              region_reader(std::move(other.region_reader)) {
+              region_reader(std::move(other.region_reader)),
+              chromosomes(std::move(other.chromosomes)),
+              chrom_ids(std::move(other.chrom_ids)),
+              last_chrom_id(other.last_chrom_id) {
             other.bgzf_file = nullptr;
         }
         bed_reader& operator=(bed_reader&& other) noexcept {
@@ -139,6 +144,9 @@ namespace genogrove::io {
                 error_message = std::move(other.error_message);
                 options = std::move(other.options);
                 region_reader = std::move(other.region_reader);
+                chromosomes = std::move(other.chromosomes);
+                chrom_ids = std::move(other.chrom_ids);
+                last_chrom_id = other.last_chrom_id;
                 other.bgzf_file = nullptr;
             }
             return *this;
@@ -148,6 +156,10 @@ namespace genogrove::io {
         [[nodiscard]] bool has_next() override;
         [[nodiscard]] std::string get_error_message() const override;
         [[nodiscard]] size_t get_current_line() const override;
+
+        /// Chromosome names seen so far, indexed by bed_entry::chrom_id.
+        [[nodiscard]] const std::vector<std::string>& get_chromosomes() const;
+
         ~bed_reader() override;
 
     private:
@@ -159,6 +171,15 @@ namespace genogrove::io {
         // region iterator instead of the streaming bgzf_file. See #456.
         std::unique_ptr<tabix_reader> region_reader;
 
+        // Dense chromosome ids (bed_entry::chrom_id). Records of one chromosome
+        // are usually contiguous, so the previous id is checked before the map.
+        std::vector<std::string> chromosomes;
+        std::unordered_map<std::string, int32_t> chrom_ids;
+        int32_t last_chrom_id = -1;
+
+        // Id of `chrom`, assigning the next one on first appearance.
+        int32_t chrom_id_of(std::string_view chrom);
+
         // Helper functions for parsing BED fields
         bool parse_score(bed_entry& entry, std::string_view score_str);
         bool parse_strand(bed_entry& entry, std::string_view strand_str);
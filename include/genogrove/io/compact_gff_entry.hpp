@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_IO_COMPACT_GFF_ENTRY_HPP
+#define GENOGROVE_IO_COMPACT_GFF_ENTRY_HPP
+
+// standard
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// genogrove
+#include <genogrove/data_type/registry.hpp>
+#include <genogrove/io/gff_reader.hpp>
+
+namespace genogrove::io {
+
+    /// Tag of the registry that interns the repeated GFF fields.
+    struct gff_field_tag {};
+
+    /**
+     * @brief Registry that interns the repeated fields of compact_gff_entry:
+     *        seqid, source, type and attribute keys.
+     *
+     * A .gg file with payload type GFF_COMPACT carries this registry once,
+     * directly after the gg_header (see gg_format.hpp); it must be loaded with
+     * `gff_field_registry::deserialize()` before the grove that refers to it.
+     */
+    using gff_field_registry = data_type::registry<std::string, gff_field_tag>;
+
+    /**
+     * @brief GFF/GTF record with its repeated fields interned
+     *
+     * Holds the same information as gff_entry, but seqid, source, type and the
+     * attribute keys are gff_field_registry ids, and the attributes are a flat
+     * vector of (key id, value) pairs instead of a std::map. In a GTF grove
+     * where every exon repeats the same handful of short strings and attribute
+     * names, this removes one heap node per attribute and one string per
+     * repeated field, and the serialized payload writes 4-byte ids in place of
+     * those strings.
+     *
+     * Attributes keep the key-name order of gff_entry::attributes, so
+     * `compact_gff_entry(e).to_gff_entry()` reproduces `e` exactly.
+     */
+    struct compact_gff_entry {
+        using field_id = gff_field_registry::id_type;
+
+        field_id seqid = gff_field_registry::null_id;   // chromosome/contig name
+        field_id source = gff_field_registry::null_id;  // source of the feature
+        field_id type = gff_field_registry::null_id;    // feature type (gene, exon, CDS, etc.)
+        gff_format format = gff_format::UNKNOWN;        // detected format (GFF3 or GTF)
+        size_t start = 0;                               // 1-based inclusive start position (native GFF)
+        size_t end = 0;                                 // 1-based inclusive end position (native GFF)
+        std::optional<double> score;                    // score (if not '.')
+        std::optional<char> strand;                     // strand (+, -, ., or ?)
+        std::optional<int> phase;                       // phase for CDS features (0, 1, or 2)
+        std::vector<std::pair<field_id, std::string>> attributes;  // (key id, value), by key name
+
+        compact_gff_entry() = default;
+
+        // Intern the repeated fields of `entry` into gff_field_registry.
+        explicit compact_gff_entry(const gff_entry& entry);
+
+        // Expand back into a gff_entry (resolves every id through the registry).
+        [[nodiscard]] gff_entry to_gff_entry() const;
+
+        // Field names, resolved through gff_field_registry.
+        [[nodiscard]] const std::string& get_seqid() const;
+        [[nodiscard]] const std::string& get_source() const;
+        [[nodiscard]] const std::string& get_type() const;
+
+        // Value of attribute `key`, or nullptr if the record has no such
+        // attribute. The pointer stays valid for the lifetime of this entry.
+        [[nodiscard]] const std::string* find_attribute(std::string_view key) const;
+
+        // Generic attribute getter (same contract as gff_entry::get_attribute).
+        [[nodiscard]] std::optional<std::string> get_attribute(std::string_view key) const;
+
+        // Check if this entry is in GTF format
+        bool is_gtf() const { return format == gff_format::GTF; }
+
+        // Check if this entry is in GFF3 format
+        bool is_gff3() const { return format == gff_format::GFF3; }
+
+        // Serialize this entry to a binary output stream; fields are written as
+        // their registry ids, so the registry must be serialized alongside.
+        void serialize(std::ostream& os) const;
+
+        // Deserialize an entry produced by serialize(). The gff_field_registry
+        // the entry was written against must already be loaded; an id it does
+        // not contain (other than the null_id of an unset field) throws
+        // std::runtime_error.
+        [[nodiscard]] static compact_gff_entry deserialize(std::istream& is);
+    };
+
+}
+
+#endif // GENOGROVE_IO_COMPACT_GFF_ENTRY_HPP
@@ -16,7 +16,16 @@ namespace genogrove::io {
     /// to the correct grove instantiation.
     enum class gg_payload_type : uint8_t {
         BED = 0x01,
-        GFF = 0x02,
+        GFF = 0x02,          ///< io::gff_entry
+        GFF_COMPACT = 0x03,  ///< io::compact_gff_entry; a payload dictionary follows the header
+    };
+
+    /// Key type tag stored in the .gg header: which interval key the grove
+    /// was built with. The payload's key columns are only readable by a
+    /// grove of the same key type.
+    enum class gg_key_type : uint8_t {
+        INTERVAL = 0x00,    ///< gdt::interval (64-bit positions)
+        INTERVAL32 = 0x01,  ///< gdt::interval32 (32-bit positions)
     };
 
     /// On-disk header for a serialised grove (.gg file).
@@ -29,21 +38,38 @@ namespace genogrove::io {
     ///   offset  size  field
     ///        0     4  magic           = "GROV"
     ///        4     1  format_major    = 0   (pre-1.0; format still evolving, may break)
-    ///        5     1  format_minor    = 3   (block-structured payload; see grove serialize)
+    ///        5     1  format_minor    = 8   (block-structured payload; see grove serialize)
     ///        6     1  lib_major       = genogrove_VERSION_MAJOR (informational)
     ///        7     1  lib_minor       = genogrove_VERSION_MINOR (informational)
     ///        8     1  lib_patch       = genogrove_VERSION_PATCH (informational)
-    ///        9     1  payload_type    (BED = 0x01, GFF = 0x02)
-    ///       10     2  reserved        (zero)
+    ///        9     1  payload_type    (BED = 0x01, GFF = 0x02, GFF_COMPACT = 0x03)
+    ///       10     1  key_type        (INTERVAL = 0x00, INTERVAL32 = 0x01)
+    ///       11     1  reserved        (zero)
+    ///
+    /// Format 0.8 is the block-structured, random-access-capable payload:
+    /// a plain directory (block codec, optional zstd dictionary, per-index root
+    /// block ids + block metadata) followed by node and external-key blocks
+    /// packed into independently compressed (stored / zlib / zstd / lz4),
+    /// length-prefixed frames of one or more consecutive blocks — each index's
+    /// leaves are laid out in leaf-chain order so a range scan reads one frame
+    /// per run of leaves, and each block stores its keys column-wise (delta /
+    /// varint coordinates) — with each key's edges recorded as an outgoing then
+    /// an incoming list so either endpoint's block surfaces that side of an edge
+    /// on its own (edge metadata as an index into a per-block table of distinct
+    /// values), and a trailing per-frame offset directory (footer) so a
+    /// partial reader opens without walking every frame. Earlier formats (0.1
+    /// whole-file zlib stream; 0.2 block-structured but forward-only edges; 0.3
+    /// without the footer; 0.4 zlib-only; 0.5 one block per compressed record;
+    /// 0.6 raw row-wise keys; 0.7 edge metadata inline in every edge reference)
+    /// are not readable by this build — no serialization back-compat is
+    /// maintained; regenerate the index. key_type occupies what was a reserved
+    /// byte, so 0.8 files written before it existed read as INTERVAL.
     ///
-    /// Format 0.3 is the block-structured, random-access-capable payload:
-    /// a plain directory (per-index root block ids + block metadata) followed by
-    /// independently zlib-compressed, length-prefixed node and external-key
-    /// blocks, each key's edges recorded as an outgoing then an incoming list so
-    /// either endpoint's block surfaces that side of an edge on its own. Earlier
-    /// formats (0.1 whole-file zlib stream; 0.2 block-structured but forward-only
-    /// edges) are not readable by this build — no serialization back-compat is
-    /// maintained; regenerate the index.
+    /// Payload dictionary: when payload_type is GFF_COMPACT the header is
+    /// followed by the io::gff_field_registry the payloads' field ids refer to,
+    /// in gdt::registry::serialize() form (uint64 count, then length-prefixed
+    /// strings in id order), and the grove payload starts after it. Load it
+    /// with gff_field_registry::deserialize() before reading the grove.
     ///
     /// While format_major == 0 the format is still evolving. read() requires an
     /// exact match on (format_major, format_minor) and throws std::runtime_error
@@ -51,7 +77,7 @@ namespace genogrove::io {
     struct gg_header {
         static constexpr std::array<char, 4> MAGIC = {'G', 'R', 'O', 'V'};
         static constexpr uint8_t CURRENT_FORMAT_MAJOR = 0;
-        static constexpr uint8_t CURRENT_FORMAT_MINOR = 3;
+        static constexpr uint8_t CURRENT_FORMAT_MINOR = 8;
         static constexpr std::size_t SIZE = 12;
 
         uint8_t format_major = CURRENT_FORMAT_MAJOR;
@@ -60,10 +86,12 @@ namespace genogrove::io {
         uint8_t lib_minor = 0;
         uint8_t lib_patch = 0;
         gg_payload_type payload_type = gg_payload_type::BED;
+        gg_key_type key_type = gg_key_type::INTERVAL;
 
         /// Build a header stamped with the current library version and the
-        /// given payload type. Use this at the writer side.
-        [[nodiscard]] static gg_header current(gg_payload_type payload_type);
+        /// given payload and key types. Use this at the writer side.
+        [[nodiscard]] static gg_header current(gg_payload_type payload_type,
+                                               gg_key_type key_type = gg_key_type::INTERVAL);
 
         /// Write the 12-byte header to a binary output stream.
         /// Throws std::runtime_error if the stream is in a bad state after writing.
@@ -75,7 +103,7 @@ namespace genogrove::io {
         ///   - short read (not enough bytes for a header)
         ///   - magic mismatch ("not a .gg file")
         ///   - unsupported (format_major, format_minor)
-        ///   - unknown payload_type value
+        ///   - unknown payload_type or key_type value
         ///
         /// A library-version difference (lib_major/minor/patch) does NOT cause
         /// rejection — those fields are informational and the read succeeds.
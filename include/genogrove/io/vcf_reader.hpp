@@ -108,6 +108,7 @@ namespace genogrove::io {
      */
     struct vcf_entry {
         std::string chrom;                  ///< CHROM (contig name)
+        int32_t contig_id = -1;             ///< Index of CHROM in vcf_reader::get_contigs() (htslib rid); -1 if CHROM is not in the header
         size_t start = 0;                   ///< 0-based start (htslib pos)
         size_t end = 0;                     ///< 0-based exclusive end (pos + len(REF))
         std::string id;                     ///< ID, empty when "."
@@ -6,6 +6,7 @@
 #ifndef GENOGROVE_STRUCTURE_ALL_HPP
 #define GENOGROVE_STRUCTURE_ALL_HPP
 
+#include <genogrove/structure/grove/flat_index.hpp>
 #include <genogrove/structure/grove/grove.hpp>
 #include <genogrove/structure/grove/node.hpp>
 
@@ -17,6 +18,7 @@
   * - grove: The primary genogrove container for genomic storage
   * - node: The node implementation with parent/child/sibling relationships
   * - graph_overlay: Couple graph structure for managing relationships between keys
+  * - flat_index: Read-only sorted-array index for point lookups over scalar keys (kmer, numeric)
   *
   * These structures are designed for efficient genomic data operations with support
   * for interval queries, sorted insertion optimization, and graph-based relationships.
@@ -0,0 +1,389 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_STRUCTURE_GROVE_BLOCK_CODEC_HPP
+#define GENOGROVE_STRUCTURE_GROVE_BLOCK_CODEC_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "genogrove/structure/grove/zlib_streambuf.hpp"
+
+#if defined(GENOGROVE_HAS_ZSTD)
+#include <zdict.h>
+#include <zstd.h>
+#endif
+#if defined(GENOGROVE_HAS_LZ4)
+#include <lz4.h>
+#endif
+
+namespace genogrove::structure {
+
+/**
+ * @brief Compression applied to each block of a grove stream
+ *
+ * Recorded once in the stream header; every block of a stream uses the same
+ * codec. zstd and lz4 are optional build dependencies (detected by CMake via
+ * pkg-config, see GENOGROVE_HAS_ZSTD / GENOGROVE_HAS_LZ4); stored and zlib are
+ * always available.
+ */
+enum class block_codec : std::uint8_t {
+    stored = 0,  ///< No compression — blocks are parsed in place, no inflate copy
+    zlib = 1,    ///< zlib at Z_DEFAULT_COMPRESSION (the default)
+    zstd = 2,    ///< zstd at its default level, optionally with a trained dictionary
+    lz4 = 3      ///< lz4 block format — fastest decode
+};
+
+/**
+ * @brief Whether this build can encode and decode `codec`
+ */
+[[nodiscard]] constexpr bool block_codec_available(block_codec codec) noexcept {
+    switch (codec) {
+        case block_codec::stored:
+        case block_codec::zlib:
+            return true;
+        case block_codec::zstd:
+#if defined(GENOGROVE_HAS_ZSTD)
+            return true;
+#else
+            return false;
+#endif
+        case block_codec::lz4:
+#if defined(GENOGROVE_HAS_LZ4)
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+/**
+ * @brief Lower-case name of a codec ("stored", "zlib", "zstd", "lz4")
+ */
+[[nodiscard]] constexpr std::string_view to_string(block_codec codec) noexcept {
+    switch (codec) {
+        case block_codec::stored: return "stored";
+        case block_codec::zlib: return "zlib";
+        case block_codec::zstd: return "zstd";
+        case block_codec::lz4: return "lz4";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Parse a codec name as printed by to_string(block_codec)
+ * @throws std::invalid_argument if `name` is not a known codec
+ */
+[[nodiscard]] inline block_codec parse_block_codec(std::string_view name) {
+    for (auto codec : {block_codec::stored, block_codec::zlib, block_codec::zstd, block_codec::lz4}) {
+        if (name == to_string(codec)) {
+            return codec;
+        }
+    }
+    throw std::invalid_argument("unknown block codec: " + std::string(name) +
+                                " (expected stored, zlib, zstd or lz4)");
+}
+
+namespace detail {
+
+/// Throws unless this build supports `codec`. `what` prefixes the message
+/// (e.g. "Failed to deserialize grove").
+inline void require_block_codec(block_codec codec, const char* what) {
+    if (static_cast<std::uint8_t>(codec) > static_cast<std::uint8_t>(block_codec::lz4)) {
+        throw std::runtime_error(std::string(what) + ": unknown block codec");
+    }
+    if (!block_codec_available(codec)) {
+        throw std::runtime_error(std::string(what) + ": genogrove was built without " +
+                                 std::string(to_string(codec)) + " support");
+    }
+}
+
+/// Upper bound on a trained zstd dictionary read from a stream header — the
+/// length is file-controlled and sizes an allocation. zstd's own guidance is
+/// ~100 KiB; 16 MiB leaves ample room without allowing an OOM.
+inline constexpr std::uint32_t max_block_dictionary_size = std::uint32_t{1} << 24;
+
+/**
+ * @brief Train a zstd dictionary from sample blocks
+ * @param samples Uncompressed block bytes, typically a spread of the stream's blocks
+ * @param capacity Maximum dictionary size in bytes
+ * @return The dictionary, or an empty string when training is not possible
+ *         (zstd unavailable, too few / too small samples) — callers then
+ *         compress without a dictionary
+ */
+inline std::string train_block_dictionary(const std::vector<std::string>& samples,
+                                          std::size_t capacity) {
+#if defined(GENOGROVE_HAS_ZSTD)
+    if (samples.empty() || capacity == 0) {
+        return {};
+    }
+    std::string flat;
+    std::vector<std::size_t> sizes;
+    sizes.reserve(samples.size());
+    for (const auto& s : samples) {
+        flat += s;
+        sizes.push_back(s.size());
+    }
+    std::string dict(std::min<std::size_t>(capacity, max_block_dictionary_size), '\0');
+    const std::size_t n = ZDICT_trainFromBuffer(dict.data(), dict.size(), flat.data(), sizes.data(),
+                                                static_cast<unsigned>(sizes.size()));
+    if (ZDICT_isError(n)) {
+        return {};
+    }
+    dict.resize(n);
+    return dict;
+#else
+    (void)samples;
+    (void)capacity;
+    return {};
+#endif
+}
+
+/**
+ * @brief Reusable one-shot block compressor for any block_codec
+ *
+ * Holds the codec's compression state (a zlib deflate state, a zstd context
+ * and optional digested dictionary) and reuses it across many independent
+ * blocks. Each compress() call emits one self-contained block. Not
+ * thread-safe; give each worker its own. Not copyable/movable.
+ */
+class block_compressor {
+public:
+    /// @param dictionary zstd dictionary shared by every block (ignored by other codecs)
+    /// @throws std::runtime_error if this build lacks `codec`
+    explicit block_compressor(block_codec codec, std::string_view dictionary = {})
+        : codec(codec) {
+        require_block_codec(codec, "block_compressor");
+        if (codec == block_codec::zlib) {
+            deflater.emplace();
+        }
+#if defined(GENOGROVE_HAS_ZSTD)
+        if (codec == block_codec::zstd) {
+            cctx = ZSTD_createCCtx();
+            if (cctx == nullptr) {
+                throw std::runtime_error("ZSTD_createCCtx failed");
+            }
+            if (!dictionary.empty()) {
+                cdict = ZSTD_createCDict(dictionary.data(), dictionary.size(), ZSTD_CLEVEL_DEFAULT);
+                if (cdict == nullptr) {
+                    ZSTD_freeCCtx(cctx);
+                    throw std::runtime_error("ZSTD_createCDict failed");
+                }
+            }
+        }
+#endif
+        (void)dictionary;
+    }
+    ~block_compressor() {
+#if defined(GENOGROVE_HAS_ZSTD)
+        ZSTD_freeCDict(cdict);
+        ZSTD_freeCCtx(cctx);
+#endif
+    }
+    block_compressor(const block_compressor&) = delete;
+    block_compressor& operator=(const block_compressor&) = delete;
+    block_compressor(block_compressor&&) = delete;
+    block_compressor& operator=(block_compressor&&) = delete;
+
+    /// Compress `src` into `out` (cleared first) as one independent block.
+    void compress(std::string_view src, std::string& out) {
+        switch (codec) {
+            case block_codec::stored:
+                out.assign(src);
+                return;
+            case block_codec::zlib:
+                deflater->compress(src, out);
+                return;
+            case block_codec::zstd:
+                compress_zstd(src, out);
+                return;
+            case block_codec::lz4:
+                compress_lz4(src, out);
+                return;
+        }
+    }
+
+private:
+    void compress_zstd([[maybe_unused]] std::string_view src, [[maybe_unused]] std::string& out) {
+#if defined(GENOGROVE_HAS_ZSTD)
+        out.resize(ZSTD_compressBound(src.size()));
+        const std::size_t n = cdict != nullptr
+            ? ZSTD_compress_usingCDict(cctx, out.data(), out.size(), src.data(), src.size(), cdict)
+            : ZSTD_compressCCtx(cctx, out.data(), out.size(), src.data(), src.size(),
+                                ZSTD_CLEVEL_DEFAULT);
+        if (ZSTD_isError(n)) {
+            throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(n));
+        }
+        out.resize(n);
+#endif
+    }
+
+    // lz4's block format does not carry the decompressed size, so each block
+    // is prefixed with it (uint32) to size the output and bound the decode.
+    void compress_lz4([[maybe_unused]] std::string_view src, [[maybe_unused]] std::string& out) {
+#if defined(GENOGROVE_HAS_LZ4)
+        if (src.size() > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE)) {
+            throw std::runtime_error("lz4 compression failed: block too large");
+        }
+        const auto raw_len = static_cast<std::uint32_t>(src.size());
+        const int bound = LZ4_compressBound(static_cast<int>(src.size()));
+        out.resize(sizeof(raw_len) + static_cast<std::size_t>(bound));
+        std::memcpy(out.data(), &raw_len, sizeof(raw_len));
+        const int n = LZ4_compress_default(src.data(), out.data() + sizeof(raw_len),
+                                           static_cast<int>(src.size()), bound);
+        if (n <= 0 && !src.empty()) {
+            throw std::runtime_error("lz4 compression failed");
+        }
+        out.resize(sizeof(raw_len) + static_cast<std::size_t>(n));
+#endif
+    }
+
+    block_codec codec;
+    std::optional<block_deflater> deflater;
+#if defined(GENOGROVE_HAS_ZSTD)
+    ZSTD_CCtx* cctx = nullptr;
+    ZSTD_CDict* cdict = nullptr;
+#endif
+};
+
+/**
+ * @brief Reusable one-shot block decompressor for any block_codec
+ *
+ * Mirror of block_compressor for reads. decode() returns a view of the
+ * block's uncompressed bytes: for `stored` that is the input itself (no copy),
+ * otherwise the caller's scratch buffer. Every codec enforces the same
+ * per-block output cap as block_inflater (decompression-bomb guard). Not
+ * thread-safe; not copyable/movable.
+ */
+class block_decompressor {
+public:
+    /// @param dictionary zstd dictionary the stream was written with (ignored by other codecs)
+    /// @throws std::runtime_error if this build lacks `codec`
+    explicit block_decompressor(block_codec codec, std::string_view dictionary = {})
+        : codec(codec) {
+        require_block_codec(codec, "Failed to decode block");
+        if (codec == block_codec::zlib) {
+            inflater.emplace();
+        }
+#if defined(GENOGROVE_HAS_ZSTD)
+        if (codec == block_codec::zstd) {
+            dctx = ZSTD_createDCtx();
+            if (dctx == nullptr) {
+                throw std::runtime_error("ZSTD_createDCtx failed");
+            }
+            if (!dictionary.empty()) {
+                ddict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+                if (ddict == nullptr) {
+                    ZSTD_freeDCtx(dctx);
+                    throw std::runtime_error("ZSTD_createDDict failed");
+                }
+            }
+        }
+#endif
+        (void)dictionary;
+    }
+    ~block_decompressor() {
+#if defined(GENOGROVE_HAS_ZSTD)
+        ZSTD_freeDDict(ddict);
+        ZSTD_freeDCtx(dctx);
+#endif
+    }
+    block_decompressor(const block_decompressor&) = delete;
+    block_decompressor& operator=(const block_decompressor&) = delete;
+    block_decompressor(block_decompressor&&) = delete;
+    block_decompressor& operator=(block_decompressor&&) = delete;
+
+    /// Decode the block in [src, src+len). Returns a view of its uncompressed
+    /// bytes — into [src, src+len) for `stored`, else into `out` — valid until
+    /// the next call with the same `out` or the source buffer changes.
+    /// Throws std::runtime_error on corrupt input or output above `max_output`.
+    std::string_view decode(const char* src, std::size_t len, std::string& out,
+                            std::size_t max_output = block_inflater::default_max_block_output) {
+        switch (codec) {
+            case block_codec::stored:
+                if (len > max_output) {
+                    throw std::runtime_error("stored block exceeds size limit");
+                }
+                return {src, len};
+            case block_codec::zlib:
+                inflater->decompress(src, len, out, max_output);
+                return out;
+            case block_codec::zstd:
+                decode_zstd(src, len, out, max_output);
+                return out;
+            case block_codec::lz4:
+                decode_lz4(src, len, out, max_output);
+                return out;
+        }
+        throw std::runtime_error("unknown block codec");
+    }
+
+private:
+    void decode_zstd([[maybe_unused]] const char* src, [[maybe_unused]] std::size_t len,
+                     [[maybe_unused]] std::string& out, [[maybe_unused]] std::size_t max_output) {
+#if defined(GENOGROVE_HAS_ZSTD)
+        // The frame header records the content size (the writer always sets
+        // it); check it against the cap before allocating.
+        const unsigned long long size = ZSTD_getFrameContentSize(src, len);
+        if (size == ZSTD_CONTENTSIZE_ERROR || size == ZSTD_CONTENTSIZE_UNKNOWN) {
+            throw std::runtime_error("zstd decode failed: truncated or corrupt block");
+        }
+        if (size > max_output) {
+            throw std::runtime_error("zstd decode failed: decompressed block exceeds size limit");
+        }
+        out.resize(static_cast<std::size_t>(size));
+        const std::size_t n = ddict != nullptr
+            ? ZSTD_decompress_usingDDict(dctx, out.data(), out.size(), src, len, ddict)
+            : ZSTD_decompressDCtx(dctx, out.data(), out.size(), src, len);
+        if (ZSTD_isError(n) || n != out.size()) {
+            throw std::runtime_error("zstd decode failed: truncated or corrupt block");
+        }
+#endif
+    }
+
+    void decode_lz4([[maybe_unused]] const char* src, [[maybe_unused]] std::size_t len,
+                    [[maybe_unused]] std::string& out, [[maybe_unused]] std::size_t max_output) {
+#if defined(GENOGROVE_HAS_LZ4)
+        std::uint32_t raw_len;
+        if (len < sizeof(raw_len) ||
+            len - sizeof(raw_len) > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+            throw std::runtime_error("lz4 decode failed: truncated or corrupt block");
+        }
+        std::memcpy(&raw_len, src, sizeof(raw_len));
+        if (raw_len > max_output || raw_len > static_cast<std::uint32_t>(LZ4_MAX_INPUT_SIZE)) {
+            throw std::runtime_error("lz4 decode failed: decompressed block exceeds size limit");
+        }
+        out.resize(raw_len);
+        const int n = LZ4_decompress_safe(src + sizeof(raw_len), out.data(),
+                                          static_cast<int>(len - sizeof(raw_len)),
+                                          static_cast<int>(raw_len));
+        if (n < 0 || static_cast<std::uint32_t>(n) != raw_len) {
+            throw std::runtime_error("lz4 decode failed: truncated or corrupt block");
+        }
+#endif
+    }
+
+    block_codec codec;
+    std::optional<block_inflater> inflater;
+#if defined(GENOGROVE_HAS_ZSTD)
+    ZSTD_DCtx* dctx = nullptr;
+    ZSTD_DDict* ddict = nullptr;
+#endif
+};
+
+} // namespace detail
+
+} // namespace genogrove::structure
+
+#endif // GENOGROVE_STRUCTURE_GROVE_BLOCK_CODEC_HPP
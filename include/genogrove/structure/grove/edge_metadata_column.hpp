@@ -0,0 +1,216 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_STRUCTURE_GROVE_EDGE_METADATA_COLUMN_HPP
+#define GENOGROVE_STRUCTURE_GROVE_EDGE_METADATA_COLUMN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <genogrove/data_type/registry.hpp>
+#include <genogrove/data_type/serialization_traits.hpp>
+#include <genogrove/structure/grove/pod_io.hpp>
+
+namespace genogrove::structure {
+
+/// Tag of the registry that interns std::string edge metadata.
+struct edge_metadata_tag {};
+
+/**
+ * @brief Intern pool shared by every graph_overlay with std::string edge metadata.
+ *
+ * Follows the registry's threading contract: intern (add edges) during a
+ * build phase, then read from any number of threads. Clearing it while a
+ * graph with string metadata is alive leaves that graph's ids dangling.
+ */
+using edge_metadata_registry = data_type::registry<std::string, edge_metadata_tag>;
+
+/**
+ * @brief Edge metadata kept out of line, in one array indexed by slot.
+ *
+ * graph_overlay stores each edge's metadata here instead of in the edge
+ * itself, so walks that only follow edges never load it, and a metadata
+ * predicate scans one contiguous column. Slots freed by release() are reused
+ * by later add() calls.
+ *
+ * Specializations change the representation, not the interface:
+ * - std::string values are interned through edge_metadata_registry and the
+ *   column holds 4-byte ids — repeated transcript or source names cost one
+ *   copy in total;
+ * - std::monostate (a graph without edge metadata) stores nothing.
+ *
+ * @tparam M Metadata type (graph_overlay::metadata_type)
+ */
+template<typename M>
+class edge_metadata_column {
+  public:
+    using slot_type = std::uint32_t;
+
+    /// Store `value`, returning its slot.
+    template<typename V>
+    slot_type add(V&& value) {
+        if (!free_.empty()) {
+            const slot_type slot = free_.back();
+            free_.pop_back();
+            values_[slot] = std::forward<V>(value);
+            return slot;
+        }
+        values_.emplace_back(std::forward<V>(value));
+        return static_cast<slot_type>(values_.size() - 1);
+    }
+
+    /// Store a copy of slot `slot` of `other`, returning its slot here.
+    slot_type add_copy(const edge_metadata_column& other, slot_type slot) {
+        return add(other.values_[slot]);
+    }
+
+    /// Overwrite slot `slot` (which must exist) with `value`.
+    template<typename V>
+    void set(slot_type slot, V&& value) {
+        values_[slot] = std::forward<V>(value);
+    }
+
+    /// Free slot `slot` for reuse, dropping its value.
+    void release(slot_type slot) {
+        values_[slot] = M{};
+        free_.push_back(slot);
+    }
+
+    [[nodiscard]] const M& get(slot_type slot) const { return values_[slot]; }
+
+    /// Grow to `n` slots of default metadata (for filling by set()).
+    void resize(std::size_t n) { values_.resize(n); }
+    void reserve(std::size_t n) { values_.reserve(n); }
+    void clear() {
+        values_.clear();
+        free_.clear();
+    }
+
+  private:
+    std::vector<M> values_;
+    std::vector<slot_type> free_;
+};
+
+template<>
+class edge_metadata_column<std::string> {
+  public:
+    using slot_type = std::uint32_t;
+
+    slot_type add(const std::string& value) { return add_id(edge_metadata_registry::instance().intern(value)); }
+
+    slot_type add_copy(const edge_metadata_column& other, slot_type slot) {
+        return add_id(other.ids_[slot]);
+    }
+
+    void set(slot_type slot, const std::string& value) {
+        ids_[slot] = edge_metadata_registry::instance().intern(value);
+    }
+
+    void release(slot_type slot) { free_.push_back(slot); }
+
+    [[nodiscard]] const std::string& get(slot_type slot) const {
+        return edge_metadata_registry::instance().get(ids_[slot]);
+    }
+
+    void resize(std::size_t n) {
+        ids_.resize(n, n > ids_.size() ? edge_metadata_registry::instance().intern(std::string{}) : 0);
+    }
+    void reserve(std::size_t n) { ids_.reserve(n); }
+    void clear() {
+        ids_.clear();
+        free_.clear();
+    }
+
+  private:
+    slot_type add_id(edge_metadata_registry::id_type id) {
+        if (!free_.empty()) {
+            const slot_type slot = free_.back();
+            free_.pop_back();
+            ids_[slot] = id;
+            return slot;
+        }
+        ids_.push_back(id);
+        return static_cast<slot_type>(ids_.size() - 1);
+    }
+
+    std::vector<edge_metadata_registry::id_type> ids_;
+    std::vector<slot_type> free_;
+};
+
+template<>
+class edge_metadata_column<std::monostate> {
+  public:
+    using slot_type = std::uint32_t;
+
+    template<typename V>
+    slot_type add(V&&) { return 0; }
+    slot_type add_copy(const edge_metadata_column&, slot_type) { return 0; }
+    template<typename V>
+    void set(slot_type, V&&) {}
+    void release(slot_type) {}
+    [[nodiscard]] const std::monostate& get(slot_type) const { return none_; }
+    void resize(std::size_t) {}
+    void reserve(std::size_t) {}
+    void clear() {}
+
+  private:
+    static constexpr std::monostate none_{};
+};
+
+}  // namespace genogrove::structure
+
+namespace genogrove::structure::detail {
+
+/**
+ * @brief Read a block's edge metadata table: a uint32 count, then that many
+ *        serialized values. Edge refs in the block name their metadata by a
+ *        uint32 index into it.
+ * @throws std::runtime_error on a short read or an implausible count
+ */
+template<typename M>
+std::vector<M> read_edge_metadata_table(std::istream& is) {
+    std::uint32_t count;
+    read_pod(is, count);
+    if (!is) {
+        throw std::runtime_error("Failed to deserialize: stream error reading edge metadata table");
+    }
+    require_backing_bytes(is, count, 1, "edge metadata");
+    std::vector<M> table;
+    table.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        table.push_back(data_type::serializer<M>::read(is));
+        if (!is) {
+            throw std::runtime_error("Failed to deserialize: stream error reading edge metadata");
+        }
+    }
+    return table;
+}
+
+/**
+ * @brief Read one edge ref's metadata index and look it up in `table`
+ * @throws std::runtime_error on a short read or an index past the table
+ */
+template<typename M>
+const M& read_edge_metadata_ref(std::istream& is, const std::vector<M>& table) {
+    std::uint32_t index;
+    read_pod(is, index);
+    if (!is) {
+        throw std::runtime_error("Failed to deserialize: stream error reading edge metadata index");
+    }
+    if (index >= table.size()) {
+        throw std::runtime_error("Failed to deserialize: edge metadata index out of range");
+    }
+    return table[index];
+}
+
+}  // namespace genogrove::structure::detail
+
+#endif  // GENOGROVE_STRUCTURE_GROVE_EDGE_METADATA_COLUMN_HPP
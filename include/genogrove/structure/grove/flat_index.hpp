@@ -0,0 +1,425 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_STRUCTURE_GROVE_FLAT_INDEX_HPP
+#define GENOGROVE_STRUCTURE_GROVE_FLAT_INDEX_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <genogrove/data_type/kmer.hpp>
+#include <genogrove/data_type/numeric.hpp>
+#include <genogrove/data_type/serialization_traits.hpp>
+#include <genogrove/structure/grove/gg_block_format.hpp>
+#include <genogrove/structure/grove/grove.hpp>
+#include <genogrove/structure/grove/pod_io.hpp>
+
+namespace genogrove::structure {
+
+/**
+ * @brief Maps a scalar key type onto ordered 64-bit codes for flat_index.
+ *
+ * A scalar key type is one whose overlaps() is plain equality, so a lookup
+ * is an exact search over sorted codes. Specializations provide:
+ * - `shape(key)`: a byte that must be the same for every key of one index
+ *   (the k of a k-mer); keys of another shape never match
+ * - `encode(key)`: a code whose order matches the key order within a shape
+ * - `decode(code, shape)`: the inverse of encode
+ */
+template<typename key_type>
+struct flat_key_traits;
+
+template<>
+struct flat_key_traits<gdt::kmer> {
+    static std::uint8_t shape(const gdt::kmer& key) noexcept { return key.get_k(); }
+    static std::uint64_t encode(const gdt::kmer& key) noexcept { return key.get_encoding(); }
+    static gdt::kmer decode(std::uint64_t code, std::uint8_t shape) { return gdt::kmer(code, shape); }
+};
+
+template<>
+struct flat_key_traits<gdt::numeric> {
+    // Flip the sign bit so two's-complement order becomes unsigned order.
+    static std::uint8_t shape(const gdt::numeric&) noexcept { return 0; }
+    static std::uint64_t encode(const gdt::numeric& key) noexcept {
+        return static_cast<std::uint32_t>(key.get_value()) ^ 0x80000000u;
+    }
+    static gdt::numeric decode(std::uint64_t code, std::uint8_t) {
+        return gdt::numeric(static_cast<int>(static_cast<std::uint32_t>(code) ^ 0x80000000u));
+    }
+};
+
+/**
+ * @brief Read-only point-lookup index for scalar key types (kmer, numeric).
+ *
+ * A grove answers a point lookup by descending a B+ tree of pointers to
+ * keys. For key types where overlap is equality that is far more machinery
+ * than needed: flat_index keeps each index as one contiguous array of key
+ * codes in Eytzinger (BFS) order plus a parallel payload array. A search
+ * touches one cache line per level, the first levels stay hot in cache, and
+ * there are no pointers to chase.
+ *
+ * Built once from a grove (from_grove) and immutable afterwards; edges are
+ * not carried over. Safe to query from any number of threads.
+ *
+ * @code
+ * auto flat = gst::flat_index<gdt::kmer, uint32_t>::from_grove(kmer_grove);
+ * if (const uint32_t* count = flat.find("genome", gdt::kmer("ACGTACGT"))) { ... }
+ * @endcode
+ *
+ * @tparam key_type A key type with a flat_key_traits specialization
+ * @tparam data_type Payload type (void for a membership-only index)
+ */
+template<typename key_type, typename data_type = void>
+class flat_index {
+    using traits = flat_key_traits<key_type>;
+    using payload_t = std::conditional_t<std::is_void_v<data_type>, std::monostate, data_type>;
+
+  public:
+    flat_index() = default;
+
+    /**
+     * @brief Build a flat index holding every indexed key of a grove
+     * @param g Source grove; external keys and edges are ignored
+     * @return An index with one segment per grove index
+     * @throws std::invalid_argument if an index mixes key shapes (k-mers of
+     *         different lengths)
+     */
+    template<typename edge_data_type>
+    [[nodiscard]] static flat_index from_grove(const grove<key_type, data_type, edge_data_type>& g) {
+        flat_index result;
+        for (const auto& [name, root] : g.get_root_nodes()) {
+            std::vector<std::uint64_t> codes;
+            std::vector<payload_t> payloads;
+            std::uint8_t shape = 0;
+            const auto* leaf = root;
+            while (leaf != nullptr && !leaf->get_is_leaf()) {
+                leaf = leaf->get_children().front();
+            }
+            for (; leaf != nullptr; leaf = leaf->get_next()) {
+                for (const auto* k : leaf->get_keys()) {
+                    const auto key_shape = traits::shape(k->get_value());
+                    if (codes.empty()) {
+                        shape = key_shape;
+                    } else if (key_shape != shape) {
+                        throw std::invalid_argument("flat_index: index '" + name + "' mixes key shapes");
+                    }
+                    codes.push_back(traits::encode(k->get_value()));
+                    if constexpr (!std::is_void_v<data_type>) {
+                        payloads.push_back(k->get_data());
+                    } else {
+                        payloads.emplace_back();
+                    }
+                }
+            }
+            result.segments.emplace(name, make_segment(shape, codes, payloads));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Test whether a key is in an index
+     * @param index Index name
+     * @param key Key to look up
+     * @return true if the index holds a key equal to `key`
+     */
+    [[nodiscard]] bool contains(std::string_view index, const key_type& key) const {
+        const auto* seg = segment_of(index);
+        return seg != nullptr && seg->search(key) != 0;
+    }
+
+    /**
+     * @brief Look up a key's payload
+     * @param index Index name
+     * @param key Key to look up
+     * @return Pointer to the payload of the (first) equal key, or nullptr
+     */
+    [[nodiscard]] const data_type* find(std::string_view index, const key_type& key) const
+        requires (!std::is_void_v<data_type>) {
+        const auto* seg = segment_of(index);
+        if (seg == nullptr) return nullptr;
+        const std::size_t pos = seg->search(key);
+        return pos == 0 ? nullptr : &seg->payloads[pos];
+    }
+
+    /**
+     * @brief Test many keys of one index at once
+     *
+     * Faster than calling contains() per key on indices too large for the
+     * CPU cache: the lookups are interleaved so their memory accesses overlap.
+     *
+     * @param index Index name
+     * @param keys Keys to look up
+     * @return One flag per key, 1 if the index holds it
+     */
+    [[nodiscard]] std::vector<std::uint8_t> contains(std::string_view index,
+                                                     std::span<const key_type> keys) const {
+        std::vector<std::uint8_t> found(keys.size(), 0);
+        const auto* seg = segment_of(index);
+        if (seg == nullptr) return found;
+        std::vector<std::size_t> positions(keys.size());
+        seg->search(keys, positions);
+        for (std::size_t i = 0; i < keys.size(); ++i) found[i] = positions[i] != 0;
+        return found;
+    }
+
+    /**
+     * @brief Look up the payloads of many keys of one index at once
+     * @param index Index name
+     * @param keys Keys to look up
+     * @return One payload pointer per key, nullptr where the key is absent
+     * @see contains(std::string_view, std::span<const key_type>) const
+     */
+    [[nodiscard]] std::vector<const data_type*> find(std::string_view index,
+                                                     std::span<const key_type> keys) const
+        requires (!std::is_void_v<data_type>) {
+        std::vector<const data_type*> found(keys.size(), nullptr);
+        const auto* seg = segment_of(index);
+        if (seg == nullptr) return found;
+        std::vector<std::size_t> positions(keys.size());
+        seg->search(keys, positions);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            if (positions[i] != 0) found[i] = &seg->payloads[positions[i]];
+        }
+        return found;
+    }
+
+    /// Number of keys in an index (0 if there is no such index).
+    [[nodiscard]] std::size_t size(std::string_view index) const {
+        const auto* seg = segment_of(index);
+        return seg == nullptr ? 0 : seg->codes.size() - 1;
+    }
+
+    /// Number of keys across all indices.
+    [[nodiscard]] std::size_t size() const {
+        std::size_t total = 0;
+        for (const auto& [_, seg] : segments) total += seg.codes.size() - 1;
+        return total;
+    }
+
+    /// Number of indices.
+    [[nodiscard]] std::size_t index_count() const noexcept { return segments.size(); }
+
+    /**
+     * @brief Collect the keys of an index in ascending order
+     * @param index Index name
+     * @return The keys (empty if there is no such index)
+     */
+    [[nodiscard]] std::vector<key_type> keys(std::string_view index) const {
+        std::vector<key_type> out;
+        const auto* seg = segment_of(index);
+        if (seg == nullptr) return out;
+        out.reserve(seg->codes.size() - 1);
+        seg->in_order(1, [&](std::size_t pos) { out.push_back(traits::decode(seg->codes[pos], seg->shape)); });
+        return out;
+    }
+
+    /**
+     * @brief Write the index to a binary stream
+     *
+     * Layout: flat_index_stream_magic, uint32 index count, then per index a
+     * uint32 name length, the name, a uint8 shape, a uint64 key count, the
+     * codes in Eytzinger order (uint64 each) and, for non-void data, the
+     * payloads in the same order. The arrays are stored as laid out in
+     * memory, so loading is a straight read with no rebuild.
+     *
+     * @param os Output stream
+     * @throws std::runtime_error if the stream fails
+     */
+    void serialize(std::ostream& os) const {
+        os.write(detail::flat_index_stream_magic.data(), detail::flat_index_stream_magic.size());
+        detail::write_pod(os, static_cast<std::uint32_t>(segments.size()));
+        for (const auto& [name, seg] : segments) {
+            detail::write_pod(os, static_cast<std::uint32_t>(name.size()));
+            os.write(name.data(), static_cast<std::streamsize>(name.size()));
+            detail::write_pod(os, seg.shape);
+            const std::uint64_t n = seg.codes.size() - 1;
+            detail::write_pod(os, n);
+            os.write(reinterpret_cast<const char*>(seg.codes.data() + 1),
+                     static_cast<std::streamsize>(n * sizeof(std::uint64_t)));
+            if constexpr (!std::is_void_v<data_type>) {
+                for (std::size_t i = 1; i <= n; ++i) {
+                    gdt::serializer<data_type>::write(os, seg.payloads[i]);
+                }
+            }
+        }
+        if (!os) {
+            throw std::runtime_error("Failed to serialize flat_index: stream error");
+        }
+    }
+
+    /**
+     * @brief Read an index written by serialize()
+     * @param is Input stream positioned at the magic
+     * @return The index
+     * @throws std::runtime_error on a bad magic, short read or implausible count
+     */
+    [[nodiscard]] static flat_index deserialize(std::istream& is) {
+        std::array<char, 4> magic{};
+        is.read(magic.data(), magic.size());
+        if (!is || magic != detail::flat_index_stream_magic) {
+            throw std::runtime_error("Failed to deserialize flat_index: not a flat index stream");
+        }
+        std::uint32_t count;
+        detail::read_pod(is, count);
+        if (!is) {
+            throw std::runtime_error("Failed to deserialize flat_index: stream error reading index count");
+        }
+        detail::require_backing_bytes(is, count, sizeof(std::uint32_t) + 1 + sizeof(std::uint64_t), "index");
+        flat_index result;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            std::uint32_t name_len;
+            detail::read_pod(is, name_len);
+            if (!is) {
+                throw std::runtime_error("Failed to deserialize flat_index: stream error reading index name length");
+            }
+            detail::require_backing_bytes(is, name_len, 1, "index name");
+            std::string name(name_len, '\0');
+            is.read(name.data(), static_cast<std::streamsize>(name_len));
+            segment seg;
+            std::uint64_t n;
+            detail::read_pod(is, seg.shape);
+            detail::read_pod(is, n);
+            if (!is) {
+                throw std::runtime_error("Failed to deserialize flat_index: stream error reading index header");
+            }
+            detail::require_backing_bytes(is, n, sizeof(std::uint64_t), "key");
+            seg.codes.resize(static_cast<std::size_t>(n) + 1);
+            is.read(reinterpret_cast<char*>(seg.codes.data() + 1),
+                    static_cast<std::streamsize>(n * sizeof(std::uint64_t)));
+            if (!is) {
+                throw std::runtime_error("Failed to deserialize flat_index: stream error reading keys");
+            }
+            seg.payloads.resize(static_cast<std::size_t>(n) + 1);
+            if constexpr (!std::is_void_v<data_type>) {
+                for (std::size_t p = 1; p <= n; ++p) {
+                    seg.payloads[p] = gdt::serializer<data_type>::read(is);
+                }
+                if (!is) {
+                    throw std::runtime_error("Failed to deserialize flat_index: stream error reading payloads");
+                }
+            }
+            if (!result.segments.emplace(std::move(name), std::move(seg)).second) {
+                throw std::runtime_error("Failed to deserialize flat_index: duplicate index name");
+            }
+        }
+        return result;
+    }
+
+  private:
+    /// One index: codes[1..n] and payloads[1..n] in Eytzinger order (slot 0 unused).
+    struct segment {
+        std::uint8_t shape = 0;
+        std::vector<std::uint64_t> codes{0};
+        std::vector<payload_t> payloads{payload_t{}};
+
+        /// Eytzinger position of the first code equal to `key`'s, or 0.
+        [[nodiscard]] std::size_t search(const key_type& key) const {
+            const std::size_t n = codes.size() - 1;
+            if (n == 0 || traits::shape(key) != shape) return 0;
+            const std::uint64_t code = traits::encode(key);
+            std::size_t k = 1;
+            while (k <= n) {
+#if defined(__GNUC__)
+                // The grandchildren 4 levels down share one cache line.
+                __builtin_prefetch(codes.data() + std::min(16 * k, n));
+#endif
+                k = 2 * k + (codes[k] < code);
+            }
+            // Undo the trailing right turns (1 bits) plus the last left turn
+            // to land on the lower bound; 0 means every code is smaller.
+            k >>= std::countr_one(k) + 1;
+            return k != 0 && codes[k] == code ? k : 0;
+        }
+
+        /**
+         * search() for many keys at once: the searches advance level by level
+         * in lockstep, so the cache misses of up to batch_width searches are
+         * in flight together instead of one after another.
+         */
+        void search(std::span<const key_type> keys, std::span<std::size_t> positions) const {
+            constexpr std::size_t batch_width = 16;
+            const std::size_t n = codes.size() - 1;
+            std::array<std::uint64_t, batch_width> probe{};
+            std::array<std::size_t, batch_width> k{};
+            for (std::size_t begin = 0; begin < keys.size(); begin += batch_width) {
+                const std::size_t width = std::min(batch_width, keys.size() - begin);
+                for (std::size_t j = 0; j < width; ++j) {
+                    probe[j] = traits::encode(keys[begin + j]);
+                    k[j] = 1;
+                }
+                // Every search of a complete tree takes the same number of
+                // steps; in the last, partial level some run one step longer.
+                for (bool active = n > 0; active;) {
+                    active = false;
+                    for (std::size_t j = 0; j < width; ++j) {
+                        if (k[j] > n) continue;
+                        k[j] = 2 * k[j] + (codes[k[j]] < probe[j]);
+#if defined(__GNUC__)
+                        __builtin_prefetch(codes.data() + std::min(k[j], n));
+#endif
+                        active = true;
+                    }
+                }
+                for (std::size_t j = 0; j < width; ++j) {
+                    std::size_t pos = k[j] >> (std::countr_one(k[j]) + 1);
+                    const auto& key = keys[begin + j];
+                    positions[begin + j] =
+                        pos != 0 && traits::shape(key) == shape && codes[pos] == probe[j] ? pos : 0;
+                }
+            }
+        }
+
+        /// Visit positions in ascending key order.
+        template<typename Fn>
+        void in_order(std::size_t k, Fn&& fn) const {
+            if (k >= codes.size()) return;
+            in_order(2 * k, fn);
+            fn(k);
+            in_order(2 * k + 1, fn);
+        }
+    };
+
+    // Lays sorted codes out in Eytzinger order by an in-order walk of the
+    // implicit tree: position k's children are 2k and 2k + 1.
+    static segment make_segment(std::uint8_t shape, const std::vector<std::uint64_t>& sorted_codes,
+                                std::vector<payload_t>& payloads) {
+        segment seg;
+        seg.shape = shape;
+        seg.codes.resize(sorted_codes.size() + 1);
+        seg.payloads.resize(sorted_codes.size() + 1);
+        std::size_t next = 0;
+        seg.in_order(1, [&](std::size_t k) {
+            seg.codes[k] = sorted_codes[next];
+            seg.payloads[k] = std::move(payloads[next]);
+            ++next;
+        });
+        return seg;
+    }
+
+    [[nodiscard]] const segment* segment_of(std::string_view index) const {
+        auto it = segments.find(index);
+        return it == segments.end() ? nullptr : &it->second;
+    }
+
+    std::unordered_map<std::string, segment, string_hash, std::equal_to<>> segments;
+};
+
+}  // namespace genogrove::structure
+
+#endif  // GENOGROVE_STRUCTURE_GROVE_FLAT_INDEX_HPP
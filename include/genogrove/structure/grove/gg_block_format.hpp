@@ -7,14 +7,21 @@
 #define GENOGROVE_STRUCTURE_GROVE_GG_BLOCK_FORMAT_HPP
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
 
 namespace genogrove::structure::detail {
 
 /// Identifier of a single serialized block within a grove stream. Every node
 /// (internal or leaf) is one block; external keys occupy one or more fixed-size
-/// blocks after the node blocks. A block_id is a dense index in [0, num_blocks)
-/// and doubles as the high half of a key's global id (block_id, slot).
+/// blocks after the node blocks. Consecutive blocks are packed into frames —
+/// the unit of compression and I/O — but stay individually addressable. A
+/// block_id is a dense index in [0, num_blocks) and doubles as the high half
+/// of a key's global id (block_id, slot).
 using block_id = std::uint32_t;
 
 /// Sentinel meaning "no block here" — used for the `next` reference of the last
@@ -28,6 +35,42 @@ inline constexpr block_id no_block = 0xFFFFFFFFu;
 /// chunk size and this cap in lock-step by referencing this constant in both.
 inline constexpr std::uint32_t max_external_keys_per_block = 512;
 
+/// Maximum blocks packed into one frame (the stream's unit of compression and
+/// I/O). A frame's block count is read from the file, so readers reject any
+/// count above this; the writer refuses to pack more.
+inline constexpr std::uint32_t max_blocks_per_frame = 4096;
+
+/**
+ * @brief Split a decoded frame into its blocks' uncompressed bytes
+ * @param frame A frame's uncompressed payload: `count` uint32 block lengths,
+ *        then the blocks back to back
+ * @param count Number of blocks the frame header declares
+ * @param blocks Receives one view per block, into `frame` (cleared first)
+ * @throws std::runtime_error if the length table does not exactly cover `frame`
+ */
+inline void split_frame(std::string_view frame, std::uint32_t count,
+                        std::vector<std::string_view>& blocks) {
+    blocks.clear();
+    const std::size_t table = std::size_t{count} * sizeof(std::uint32_t);
+    if (frame.size() < table) {
+        throw std::runtime_error("Failed to deserialize: truncated frame block table");
+    }
+    std::size_t pos = table;
+    blocks.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        std::uint32_t len;
+        std::memcpy(&len, frame.data() + std::size_t{i} * sizeof(len), sizeof(len));
+        if (len > frame.size() - pos) {
+            throw std::runtime_error("Failed to deserialize: frame block length exceeds frame");
+        }
+        blocks.push_back(frame.substr(pos, len));
+        pos += len;
+    }
+    if (pos != frame.size()) {
+        throw std::runtime_error("Failed to deserialize: trailing bytes after frame blocks");
+    }
+}
+
 /// Magic + version at the very start of a grove serialization stream (distinct
 /// from the CLI-level io::gg_header that wraps a .gg file). Lets grove::deserialize
 /// reject a foreign / older-layout stream with a clear error before parsing. The
@@ -35,7 +78,11 @@ inline constexpr std::uint32_t max_external_keys_per_block = 512;
 /// kept numerically equal to io::gg_header::CURRENT_FORMAT_MINOR (both track the
 /// same on-disk layout — no technical link between the two constants, just a
 /// convention to avoid two version numbers drifting apart for one format).
-inline constexpr std::array<char, 4> grove_stream_magic = {'G', 'G', 'B', '\x03'};
+inline constexpr std::array<char, 4> grove_stream_magic = {'G', 'G', 'B', '\x08'};
+
+/// Magic + version at the start of a flat_index stream. Versioned on its own:
+/// the flat layout does not share the grove block format.
+inline constexpr std::array<char, 4> flat_index_stream_magic = {'G', 'G', 'F', '\x01'};
 
 } // namespace genogrove::structure::detail
 
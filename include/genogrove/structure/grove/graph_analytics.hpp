@@ -0,0 +1,273 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_STRUCTURE_GROVE_GRAPH_ANALYTICS_HPP
+#define GENOGROVE_STRUCTURE_GROVE_GRAPH_ANALYTICS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <genogrove/utility/parallel.hpp>
+
+namespace genogrove::structure {
+
+/**
+ * @brief Weakly connected components of a graph, as returned by
+ *        graph_overlay::weakly_connected_components.
+ *
+ * `keys` lists every key that has an edge, in order of first appearance in
+ * the edge list; `labels[i]` is the component of `keys[i]`. Components are
+ * numbered 0 .. count - 1 in order of their first key, so the labelling is
+ * the same for every thread count.
+ *
+ * @tparam key_ptr Key pointer type
+ */
+template<typename key_ptr>
+struct graph_components {
+    std::vector<key_ptr> keys;
+    std::vector<std::uint32_t> labels;
+    std::size_t count = 0;
+};
+
+/// Parameters of graph_overlay::rank_vertices (PageRank over outgoing edges).
+struct ranking_options {
+    double damping = 0.85;            ///< Probability of following an edge, in [0, 1]
+    std::size_t max_iterations = 100; ///< Hard bound on power iterations
+    double tolerance = 1e-9;          ///< Stop once the L1 change of an iteration is below this
+};
+
+/**
+ * @brief Per-key scores, as returned by graph_overlay::rank_vertices.
+ *
+ * `scores[i]` belongs to `keys[i]` (first-appearance order, as for
+ * graph_components) and the scores sum to 1. `iterations` is the number of
+ * power iterations run.
+ *
+ * @tparam key_ptr Key pointer type
+ */
+template<typename key_ptr>
+struct graph_scores {
+    std::vector<key_ptr> keys;
+    std::vector<double> scores;
+    std::size_t iterations = 0;
+};
+
+}  // namespace genogrove::structure
+
+namespace genogrove::structure::detail {
+
+/**
+ * @brief A graph over dense vertex ids 0 .. num_vertices - 1, in CSR form.
+ *
+ * Vertex v's targets are out_targets[out_offsets[v] .. out_offsets[v + 1])
+ * and its sources in_sources[in_offsets[v] .. in_offsets[v + 1]). The
+ * analytics below work on this shape only, so the overlay can hand them its
+ * frozen arrays without copying.
+ */
+struct id_graph {
+    std::size_t num_vertices = 0;
+    std::span<const std::uint32_t> out_offsets;
+    std::span<const std::uint32_t> out_targets;
+    std::span<const std::uint32_t> in_offsets;
+    std::span<const std::uint32_t> in_sources;
+};
+
+/// Vertices per work item. Fixed (not derived from the thread count) so the
+/// chunk-ordered reductions give bit-identical results for any thread count.
+inline constexpr std::size_t analytics_chunk = 1024;
+
+// Runs fn(begin, end, chunk) over [0, n) in analytics_chunk pieces. Idle
+// workers claim the next unprocessed piece, so a piece holding a hub does
+// not hold up the rest.
+template<typename Fn>
+void for_each_vertex_chunk(std::size_t n, std::size_t num_threads, Fn&& fn) {
+    const std::size_t chunks = (n + analytics_chunk - 1) / analytics_chunk;
+    utility::parallel_for(chunks, num_threads, [&](std::size_t c) {
+        fn(c * analytics_chunk, std::min(n, (c + 1) * analytics_chunk), c);
+    });
+}
+
+/**
+ * @brief Lock-free union-find over dense ids.
+ *
+ * unite() links the larger root under the smaller one with a CAS, so a
+ * parent id never exceeds its child's and every root is its component's
+ * smallest id. find() halves paths as it goes. Safe to call concurrently.
+ */
+class concurrent_union_find {
+  public:
+    explicit concurrent_union_find(std::size_t n) : parent_(n) {
+        for (std::size_t v = 0; v < n; ++v) {
+            parent_[v].store(static_cast<std::uint32_t>(v), std::memory_order_relaxed);
+        }
+    }
+
+    std::uint32_t find(std::uint32_t v) {
+        for (;;) {
+            std::uint32_t p = parent_[v].load(std::memory_order_acquire);
+            if (p == v) return v;
+            const std::uint32_t gp = parent_[p].load(std::memory_order_acquire);
+            if (gp != p) {
+                parent_[v].compare_exchange_weak(p, gp, std::memory_order_acq_rel);
+            }
+            v = gp;
+        }
+    }
+
+    void unite(std::uint32_t a, std::uint32_t b) {
+        for (;;) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return;
+            if (a < b) std::swap(a, b);
+            std::uint32_t expected = a;
+            if (parent_[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+  private:
+    std::vector<std::atomic<std::uint32_t>> parent_;
+};
+
+/// Component label per vertex (numbered by first vertex) and component count.
+inline std::pair<std::vector<std::uint32_t>, std::size_t> connected_components(
+    const id_graph& g, std::size_t num_threads) {
+    concurrent_union_find sets(g.num_vertices);
+    for_each_vertex_chunk(g.num_vertices, num_threads, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t v = begin; v < end; ++v) {
+            for (auto i = g.out_offsets[v]; i < g.out_offsets[v + 1]; ++i) {
+                sets.unite(static_cast<std::uint32_t>(v), g.out_targets[i]);
+            }
+        }
+    });
+    // Roots are component minima, so a sequential sweep meets every root
+    // before any of its members.
+    std::vector<std::uint32_t> labels(g.num_vertices);
+    std::size_t count = 0;
+    for (std::size_t v = 0; v < g.num_vertices; ++v) {
+        const auto root = sets.find(static_cast<std::uint32_t>(v));
+        labels[v] = root == v ? static_cast<std::uint32_t>(count++) : labels[root];
+    }
+    return {std::move(labels), count};
+}
+
+/**
+ * @brief Vertices reachable from `sources` along outgoing edges (sources included).
+ *
+ * Level-synchronous: each level's frontier is split into chunks whose
+ * workers claim unvisited targets with an atomic exchange and collect them
+ * per chunk; the next frontier is the chunks concatenated in order.
+ *
+ * @return One flag per vertex, 1 if reached
+ */
+inline std::vector<std::uint8_t> reachable_vertices(const id_graph& g,
+                                                    std::span<const std::uint32_t> sources,
+                                                    std::size_t num_threads) {
+    std::vector<std::atomic<std::uint8_t>> visited(g.num_vertices);
+    std::vector<std::uint32_t> frontier;
+    for (const auto s : sources) {
+        if (visited[s].exchange(1, std::memory_order_relaxed) == 0) frontier.push_back(s);
+    }
+    std::vector<std::vector<std::uint32_t>> found;
+    while (!frontier.empty()) {
+        found.assign((frontier.size() + analytics_chunk - 1) / analytics_chunk, {});
+        for_each_vertex_chunk(frontier.size(), num_threads,
+                              [&](std::size_t begin, std::size_t end, std::size_t c) {
+            for (std::size_t f = begin; f < end; ++f) {
+                const auto v = frontier[f];
+                for (auto i = g.out_offsets[v]; i < g.out_offsets[v + 1]; ++i) {
+                    const auto t = g.out_targets[i];
+                    if (visited[t].load(std::memory_order_relaxed) == 0 &&
+                        visited[t].exchange(1, std::memory_order_relaxed) == 0) {
+                        found[c].push_back(t);
+                    }
+                }
+            }
+        });
+        frontier.clear();
+        for (const auto& part : found) {
+            frontier.insert(frontier.end(), part.begin(), part.end());
+        }
+    }
+    std::vector<std::uint8_t> reached(g.num_vertices);
+    for (std::size_t v = 0; v < g.num_vertices; ++v) {
+        reached[v] = visited[v].load(std::memory_order_relaxed);
+    }
+    return reached;
+}
+
+/**
+ * @brief PageRank by pull-based power iteration.
+ *
+ * Each vertex sums its sources' shares itself, so there are no write
+ * conflicts. The mass of vertices without outgoing edges is spread evenly.
+ * The dangling mass and the L1 change are summed per chunk and then across
+ * chunks in order, so the scores do not depend on the thread count.
+ *
+ * @return Scores per vertex and the number of iterations run
+ */
+inline std::pair<std::vector<double>, std::size_t> page_rank(const id_graph& g,
+                                                              const ranking_options& options,
+                                                              std::size_t num_threads) {
+    const std::size_t n = g.num_vertices;
+    if (n == 0) return {{}, 0};
+    const double d = options.damping;
+    const double base = (1.0 - d) / static_cast<double>(n);
+    const std::size_t chunks = (n + analytics_chunk - 1) / analytics_chunk;
+
+    std::vector<double> rank(n, 1.0 / static_cast<double>(n));
+    std::vector<double> next(n);
+    std::vector<double> share(n);  // rank / out-degree, or 0 for dangling vertices
+    std::vector<double> partial(chunks);
+    auto sum_partials = [&partial] {
+        double total = 0.0;
+        for (const double p : partial) total += p;
+        return total;
+    };
+
+    std::size_t iterations = 0;
+    while (iterations < options.max_iterations) {
+        for_each_vertex_chunk(n, num_threads, [&](std::size_t begin, std::size_t end, std::size_t c) {
+            double dangling = 0.0;
+            for (std::size_t v = begin; v < end; ++v) {
+                const auto degree = g.out_offsets[v + 1] - g.out_offsets[v];
+                share[v] = degree == 0 ? 0.0 : rank[v] / static_cast<double>(degree);
+                if (degree == 0) dangling += rank[v];
+            }
+            partial[c] = dangling;
+        });
+        const double spread = base + d * sum_partials() / static_cast<double>(n);
+
+        for_each_vertex_chunk(n, num_threads, [&](std::size_t begin, std::size_t end, std::size_t c) {
+            double delta = 0.0;
+            for (std::size_t v = begin; v < end; ++v) {
+                double in = 0.0;
+                for (auto i = g.in_offsets[v]; i < g.in_offsets[v + 1]; ++i) {
+                    in += share[g.in_sources[i]];
+                }
+                next[v] = spread + d * in;
+                delta += std::abs(next[v] - rank[v]);
+            }
+            partial[c] = delta;
+        });
+        rank.swap(next);
+        ++iterations;
+        if (sum_partials() < options.tolerance) break;
+    }
+    return {std::move(rank), iterations};
+}
+
+}  // namespace genogrove::structure::detail
+
+#endif  // GENOGROVE_STRUCTURE_GROVE_GRAPH_ANALYTICS_HPP
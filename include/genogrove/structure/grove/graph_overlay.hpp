@@ -9,28 +9,64 @@
 #include <algorithm>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <iterator>
 #include <list>
+#include <ranges>
+#include <span>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include <genogrove/data_type/expansion_result.hpp>
 #include <genogrove/data_type/key.hpp>
+#include <genogrove/structure/grove/edge_metadata_column.hpp>
+#include <genogrove/structure/grove/graph_analytics.hpp>
+#include <genogrove/structure/grove/graph_traversal.hpp>
 
 namespace gdt = genogrove::data_type;
 
 namespace genogrove::structure {
 
+/// Representation graph_overlay::add_edges leaves the graph in.
+enum class edge_layout {
+    list,   ///< Mutable edge list and incidence index (the default representation)
+    frozen  ///< Frozen CSR adjacency, as after graph_overlay::freeze()
+};
+
+/// A tuple-like (source, target) or (source, target, metadata) element accepted
+/// by graph_overlay::add_edges.
+template<typename T>
+concept bulk_edge = requires { std::tuple_size<std::remove_cvref_t<T>>::value; } &&
+                    (std::tuple_size_v<std::remove_cvref_t<T>> == 2 ||
+                     std::tuple_size_v<std::remove_cvref_t<T>> == 3);
+
 /**
  * @brief Graph overlay for grove - decoupled graph structure
  * @details Provides graph capabilities on top of any grove by storing directed edges
  * between keys. The graph is completely separate from the tree structure, allowing
  * multiple graphs with different edge metadata types on the same grove.
  *
- * Every edge is stored once, in @ref edges_, and indexed under both of its endpoints
- * in @ref incident so it can be found from either the source side (forward traversal)
- * or the target side (reverse traversal) without scanning the whole graph.
+ * Every edge is stored once, in @ref edges_, and indexed in @ref adjacency_ on
+ * its source's outgoing list and its target's incoming list, so forward and
+ * reverse queries touch only edges in the queried direction and degrees are
+ * O(1) — a hub key with thousands of incoming edges costs nothing when only
+ * its outgoing edges are asked for.
+ *
+ * Edge metadata is kept out of line in an edge_metadata_column indexed by a
+ * per-edge slot, not in the edges themselves: following edges never loads it,
+ * and std::string metadata is interned, so each distinct value is stored
+ * once. Accessors that hand out an @ref edge materialize it.
+ *
+ * Once a graph is built, freeze() converts it to compressed sparse row (CSR)
+ * adjacency (see @ref frozen_adjacency): every read accessor then answers from
+ * a contiguous slice, and the list and incidence index are released.
  *
  * @tparam key_type The key_type of the keys (e.g., interval)
  * @tparam data_type The data_type of the keys
@@ -42,19 +78,22 @@ template<
     typename edge_data_type = void>
 class graph_overlay {
   public:
+    /// Stored per-edge metadata: edge_data_type, or std::monostate when it is void.
+    using metadata_type = std::conditional_t<
+        std::is_void_v<edge_data_type>, std::monostate, edge_data_type>;
+
     /**
      * @brief Edge structure representing a directed connection
+     *
+     * A value type: accessors such as get_edge_list() build these from the
+     * graph's internal edge records and metadata column.
      */
     struct edge {
         gdt::key<key_type, data_type>* source;
         gdt::key<key_type, data_type>* target;
 
         [[no_unique_address]]
-        std::conditional_t<
-            std::is_void_v<edge_data_type>,
-            std::monostate,
-            edge_data_type
-        > metadata;
+        metadata_type metadata;
 
         edge(gdt::key<key_type, data_type>* src, gdt::key<key_type, data_type>* tgt)
             : source(src), target(tgt), metadata{} {}
@@ -80,7 +119,8 @@ class graph_overlay {
         if (!source || !target) {
             throw std::invalid_argument("add_edge: source and target must not be null");
         }
-        register_edge(edges_.emplace(edges_.end(), source, target));
+        thaw();
+        register_edge(link_edge(source, target, metadata_type{}));
     }
 
     /**
@@ -97,7 +137,63 @@ class graph_overlay {
         if (!source || !target) {
             throw std::invalid_argument("add_edge: source and target must not be null");
         }
-        register_edge(edges_.emplace(edges_.end(), source, target, std::forward<M>(metadata)));
+        thaw();
+        register_edge(link_edge(source, target, std::forward<M>(metadata)));
+    }
+
+    /**
+     * @brief Add a batch of edges
+     *
+     * `edges` yields tuple-like (source, target) or, when edge_data_type is
+     * non-void, (source, target, metadata) elements — e.g. a
+     * `std::vector<std::pair<key*, key*>>`. The result is the same as calling
+     * add_edge on each element in order, but cheaper:
+     * - `edge_layout::list` sizes the incidence index for the whole batch up
+     *   front, so it never rehashes while the edges are filed;
+     * - `edge_layout::frozen` leaves the graph frozen. On an empty graph the
+     *   CSR arrays are built straight from the batch by counting sort — no
+     *   list nodes or incidence index at all; otherwise the batch is added to
+     *   the list and the graph frozen afterwards.
+     *
+     * Every element is checked before any edge is added, so a null endpoint
+     * leaves the graph unchanged.
+     *
+     * @param edges Forward range of edges, in insertion order
+     * @param layout Representation to leave the graph in
+     * @return Number of edges added
+     * @throws std::invalid_argument if any source or target is null
+     * @throws std::length_error as freeze() does
+     */
+    template<std::ranges::forward_range R>
+        requires bulk_edge<std::ranges::range_reference_t<R>>
+    std::size_t add_edges(R&& edges, edge_layout layout = edge_layout::list) {
+        static_assert(std::tuple_size_v<std::remove_cvref_t<std::ranges::range_reference_t<R>>> == 2 ||
+                          !std::is_void_v<edge_data_type>,
+                      "add_edges: metadata given for a graph without edge data");
+        std::size_t count = 0;
+        for (auto&& e : edges) {
+            if (!std::get<0>(e) || !std::get<1>(e)) {
+                throw std::invalid_argument("add_edges: source and target must not be null");
+            }
+            ++count;
+        }
+        if (layout == edge_layout::frozen && edge_count() == 0 && count != 0) {
+            build_frozen(edges, count);
+            return count;
+        }
+        thaw();
+        adjacency_.reserve(adjacency_.size() + 2 * count);  // each edge touches up to 2 new keys
+        for (auto&& e : edges) {
+            if constexpr (std::tuple_size_v<std::remove_cvref_t<decltype(e)>> == 2) {
+                register_edge(link_edge(std::get<0>(e), std::get<1>(e), metadata_type{}));
+            } else {
+                register_edge(link_edge(std::get<0>(e), std::get<1>(e), std::get<2>(e)));
+            }
+        }
+        if (layout == edge_layout::frozen) {
+            freeze();
+        }
+        return count;
     }
 
     /**
@@ -108,12 +204,13 @@ class graph_overlay {
      */
     bool remove_edge(gdt::key<key_type, data_type>* source,
                      gdt::key<key_type, data_type>* target) {
-        auto it = incident.find(source);
-        if (it == incident.end()) {
+        thaw();
+        auto it = adjacency_.find(source);
+        if (it == adjacency_.end()) {
             return false;
         }
-        for (auto edge_it : it->second) {
-            if (edge_it->source == source && edge_it->target == target) {
+        for (auto edge_it : it->second.out) {
+            if (edge_it->target == target) {
                 erase_edge(edge_it);
                 return true;
             }
@@ -131,14 +228,17 @@ class graph_overlay {
         if (!source) {
             throw std::invalid_argument("get_neighbors: source must not be null");
         }
+        if (frozen_) {
+            const auto [begin, end] = frozen_out_range(source);
+            return std::vector<gdt::key<key_type, data_type>*>(
+                csr_.out_targets.begin() + begin, csr_.out_targets.begin() + end);
+        }
         std::vector<gdt::key<key_type, data_type>*> neighbors;
-        auto it = incident.find(source);
-        if (it != incident.end()) {
-            neighbors.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->source == source) {
-                    neighbors.push_back(edge_it->target);
-                }
+        auto it = adjacency_.find(source);
+        if (it != adjacency_.end()) {
+            neighbors.reserve(it->second.out.size());
+            for (const auto& edge_it : it->second.out) {
+                neighbors.push_back(edge_it->target);
             }
         }
         return neighbors;
@@ -154,14 +254,17 @@ class graph_overlay {
         if (!target) {
             throw std::invalid_argument("get_in_neighbors: target must not be null");
         }
+        if (frozen_) {
+            const auto [begin, end] = frozen_in_range(target);
+            return std::vector<gdt::key<key_type, data_type>*>(
+                csr_.in_sources.begin() + begin, csr_.in_sources.begin() + end);
+        }
         std::vector<gdt::key<key_type, data_type>*> sources;
-        auto it = incident.find(target);
-        if (it != incident.end()) {
-            sources.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->target == target) {
-                    sources.push_back(edge_it->source);
-                }
+        auto it = adjacency_.find(target);
+        if (it != adjacency_.end()) {
+            sources.reserve(it->second.in.size());
+            for (const auto& edge_it : it->second.in) {
+                sources.push_back(edge_it->source);
             }
         }
         return sources;
@@ -176,13 +279,19 @@ class graph_overlay {
     [[nodiscard]] std::vector<M> get_edges(const gdt::key<key_type, data_type>* source) const
         requires (!std::is_void_v<edge_data_type>) {
         std::vector<M> metadata_list;
-        auto it = incident.find(source);
-        if (it != incident.end()) {
-            metadata_list.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->source == source) {
-                    metadata_list.push_back(edge_it->metadata);
-                }
+        if (frozen_) {
+            const auto [begin, end] = frozen_out_range(source);
+            metadata_list.reserve(end - begin);
+            for (auto i = begin; i < end; ++i) {
+                metadata_list.push_back(csr_.out_metadata.get(i));
+            }
+            return metadata_list;
+        }
+        auto it = adjacency_.find(source);
+        if (it != adjacency_.end()) {
+            metadata_list.reserve(it->second.out.size());
+            for (const auto& edge_it : it->second.out) {
+                metadata_list.push_back(metadata_.get(edge_it->slot));
             }
         }
         return metadata_list;
@@ -197,13 +306,19 @@ class graph_overlay {
     [[nodiscard]] std::vector<M> get_in_edges(const gdt::key<key_type, data_type>* target) const
         requires (!std::is_void_v<edge_data_type>) {
         std::vector<M> metadata_list;
-        auto it = incident.find(target);
-        if (it != incident.end()) {
-            metadata_list.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->target == target) {
-                    metadata_list.push_back(edge_it->metadata);
-                }
+        if (frozen_) {
+            const auto [begin, end] = frozen_in_range(target);
+            metadata_list.reserve(end - begin);
+            for (auto i = begin; i < end; ++i) {
+                metadata_list.push_back(csr_.out_metadata.get(csr_.in_edges[i]));
+            }
+            return metadata_list;
+        }
+        auto it = adjacency_.find(target);
+        if (it != adjacency_.end()) {
+            metadata_list.reserve(it->second.in.size());
+            for (const auto& edge_it : it->second.in) {
+                metadata_list.push_back(metadata_.get(edge_it->slot));
             }
         }
         return metadata_list;
@@ -219,14 +334,24 @@ class graph_overlay {
             throw std::invalid_argument("get_edge_list: source must not be null");
         }
         std::vector<edge> result;
-        auto it = incident.find(source);
-        if (it != incident.end()) {
-            result.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->source == source) {
-                    result.push_back(*edge_it);
+        if (frozen_) {
+            const auto v = frozen_vertex(source);
+            if (v != no_vertex) {
+                const auto begin = csr_.out_offsets[v];
+                const auto end = csr_.out_offsets[v + 1];
+                result.reserve(end - begin);
+                for (auto i = begin; i < end; ++i) {
+                    result.push_back(frozen_edge(csr_.vertex_key[v], csr_.out_targets[i], i));
                 }
             }
+            return result;
+        }
+        auto it = adjacency_.find(source);
+        if (it != adjacency_.end()) {
+            result.reserve(it->second.out.size());
+            for (const auto& edge_it : it->second.out) {
+                result.push_back(to_edge(*edge_it));
+            }
         }
         return result;
     }
@@ -241,14 +366,24 @@ class graph_overlay {
             throw std::invalid_argument("get_in_edge_list: target must not be null");
         }
         std::vector<edge> result;
-        auto it = incident.find(target);
-        if (it != incident.end()) {
-            result.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->target == target) {
-                    result.push_back(*edge_it);
+        if (frozen_) {
+            const auto v = frozen_vertex(target);
+            if (v != no_vertex) {
+                const auto begin = csr_.in_offsets[v];
+                const auto end = csr_.in_offsets[v + 1];
+                result.reserve(end - begin);
+                for (auto i = begin; i < end; ++i) {
+                    result.push_back(frozen_edge(csr_.in_sources[i], csr_.vertex_key[v], csr_.in_edges[i]));
                 }
             }
+            return result;
+        }
+        auto it = adjacency_.find(target);
+        if (it != adjacency_.end()) {
+            result.reserve(it->second.in.size());
+            for (const auto& edge_it : it->second.in) {
+                result.push_back(to_edge(*edge_it));
+            }
         }
         return result;
     }
@@ -268,11 +403,19 @@ class graph_overlay {
             throw std::invalid_argument("get_neighbors_if: source must not be null");
         }
         std::vector<gdt::key<key_type, data_type>*> neighbors;
-        auto it = incident.find(source);
-        if (it != incident.end()) {
-            neighbors.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->source == source && predicate(edge_it->metadata)) {
+        if (frozen_) {
+            const auto [begin, end] = frozen_out_range(source);
+            for (auto i = begin; i < end; ++i) {
+                if (predicate(csr_.out_metadata.get(i))) {
+                    neighbors.push_back(csr_.out_targets[i]);
+                }
+            }
+            return neighbors;
+        }
+        auto it = adjacency_.find(source);
+        if (it != adjacency_.end()) {
+            for (const auto& edge_it : it->second.out) {
+                if (predicate(metadata_.get(edge_it->slot))) {
                     neighbors.push_back(edge_it->target);
                 }
             }
@@ -295,11 +438,19 @@ class graph_overlay {
             throw std::invalid_argument("get_in_neighbors_if: target must not be null");
         }
         std::vector<gdt::key<key_type, data_type>*> sources;
-        auto it = incident.find(target);
-        if (it != incident.end()) {
-            sources.reserve(it->second.size());
-            for (const auto& edge_it : it->second) {
-                if (edge_it->target == target && predicate(edge_it->metadata)) {
+        if (frozen_) {
+            const auto [begin, end] = frozen_in_range(target);
+            for (auto i = begin; i < end; ++i) {
+                if (predicate(csr_.out_metadata.get(csr_.in_edges[i]))) {
+                    sources.push_back(csr_.in_sources[i]);
+                }
+            }
+            return sources;
+        }
+        auto it = adjacency_.find(target);
+        if (it != adjacency_.end()) {
+            for (const auto& edge_it : it->second.in) {
+                if (predicate(metadata_.get(edge_it->slot))) {
                     sources.push_back(edge_it->source);
                 }
             }
@@ -315,12 +466,17 @@ class graph_overlay {
      */
     [[nodiscard]] bool has_edge(const gdt::key<key_type, data_type>* source,
                   const gdt::key<key_type, data_type>* target) const {
-        auto it = incident.find(source);
-        if (it == incident.end()) {
+        if (frozen_) {
+            const auto [begin, end] = frozen_out_range(source);
+            return std::find(csr_.out_targets.begin() + begin, csr_.out_targets.begin() + end, target) !=
+                   csr_.out_targets.begin() + end;
+        }
+        auto it = adjacency_.find(source);
+        if (it == adjacency_.end()) {
             return false;
         }
-        return std::ranges::any_of(it->second, [source, target](const auto& edge_it) {
-            return edge_it->source == source && edge_it->target == target;
+        return std::ranges::any_of(it->second.out, [target](const auto& edge_it) {
+            return edge_it->target == target;
         });
     }
 
@@ -328,26 +484,30 @@ class graph_overlay {
      * @brief Get number of outgoing edges from a key
      * @param source Pointer to source key
      * @return Number of outgoing edges
+     * @note O(1) — one hash lookup
      */
     [[nodiscard]] std::size_t out_degree(const gdt::key<key_type, data_type>* source) const {
-        auto it = incident.find(source);
-        if (it == incident.end()) return 0;
-        return static_cast<std::size_t>(std::ranges::count_if(it->second, [source](const auto& edge_it) {
-            return edge_it->source == source;
-        }));
+        if (frozen_) {
+            const auto [begin, end] = frozen_out_range(source);
+            return end - begin;
+        }
+        auto it = adjacency_.find(source);
+        return it == adjacency_.end() ? 0 : it->second.out.size();
     }
 
     /**
      * @brief Get number of incoming edges to a key
      * @param target Pointer to target key
      * @return Number of incoming edges
+     * @note O(1) — one hash lookup
      */
     [[nodiscard]] std::size_t in_degree(const gdt::key<key_type, data_type>* target) const {
-        auto it = incident.find(target);
-        if (it == incident.end()) return 0;
-        return static_cast<std::size_t>(std::ranges::count_if(it->second, [target](const auto& edge_it) {
-            return edge_it->target == target;
-        }));
+        if (frozen_) {
+            const auto [begin, end] = frozen_in_range(target);
+            return end - begin;
+        }
+        auto it = adjacency_.find(target);
+        return it == adjacency_.end() ? 0 : it->second.in.size();
     }
 
     /**
@@ -355,22 +515,16 @@ class graph_overlay {
      * @return Total edge count
      */
     [[nodiscard]] size_t edge_count() const {
-        return edges_.size();
+        return frozen_ ? csr_.out_targets.size() : edges_.size();
     }
 
     /**
      * @brief Get number of vertices (keys) with at least one outgoing edge
      * @return Number of keys that have outgoing edges
+     * @note O(1) — the count is maintained as edges are added and removed
      */
     [[nodiscard]] size_t vertex_count_with_edges() const {
-        size_t count = 0;
-        for (const auto& [k, edge_its] : incident) {
-            bool has_out = std::ranges::any_of(edge_its, [k](const auto& edge_it) {
-                return edge_it->source == k;
-            });
-            if (has_out) ++count;
-        }
-        return count;
+        return source_count_;
     }
 
     /**
@@ -379,39 +533,24 @@ class graph_overlay {
      * @return Number of edges removed
      */
     size_t remove_edges_from(gdt::key<key_type, data_type>* source) {
-        auto it = incident.find(source);
-        if (it == incident.end()) return 0;
-        std::vector<edge_iterator> to_remove;
-        for (const auto& edge_it : it->second) {
-            if (edge_it->source == source) {
-                to_remove.push_back(edge_it);
-            }
-        }
-        for (auto edge_it : to_remove) {
-            erase_edge(edge_it);
-        }
-        return to_remove.size();
+        thaw();
+        auto it = adjacency_.find(source);
+        if (it == adjacency_.end()) return 0;
+        return erase_edges(std::vector<edge_iterator>(it->second.out));
     }
 
     /**
      * @brief Remove all incoming edges to a target key
      * @param target Pointer to target key
      * @return Number of edges removed
-     * @note O(in-degree) — only touches edges incident to target
+     * @note O(in-degree + out-degree of the sources) — only touches the
+     *       adjacency lists the removed edges are filed in
      */
     size_t remove_edges_to(gdt::key<key_type, data_type>* target) {
-        auto it = incident.find(target);
-        if (it == incident.end()) return 0;
-        std::vector<edge_iterator> to_remove;
-        for (const auto& edge_it : it->second) {
-            if (edge_it->target == target) {
-                to_remove.push_back(edge_it);
-            }
-        }
-        for (auto edge_it : to_remove) {
-            erase_edge(edge_it);
-        }
-        return to_remove.size();
+        thaw();
+        auto it = adjacency_.find(target);
+        if (it == adjacency_.end()) return 0;
+        return erase_edges(std::vector<edge_iterator>(it->second.in));
     }
 
     /**
@@ -427,24 +566,21 @@ class graph_overlay {
 
     /**
      * @brief Remove all edges matching a predicate
-     * @param predicate Callable taking const edge& and returning bool
+     * @param predicate Callable taking const edge& and returning bool; each
+     *        edge is materialized (metadata copied) to be tested
      * @return Number of edges removed
      */
     template<typename Predicate>
     size_t remove_edges_if(Predicate predicate)
         requires std::predicate<Predicate, const edge&> {
-        size_t count = 0;
-        for (auto it = edges_.begin(); it != edges_.end(); ) {
-            if (predicate(*it)) {
-                auto next = std::next(it);
-                erase_edge(it);
-                it = next;
-                ++count;
-            } else {
-                ++it;
+        thaw();
+        std::vector<edge_iterator> doomed;
+        for (auto it = edges_.begin(); it != edges_.end(); ++it) {
+            if (predicate(to_edge(*it))) {
+                doomed.push_back(it);
             }
         }
-        return count;
+        return erase_edges(std::move(doomed));
     }
 
     /**
@@ -452,28 +588,54 @@ class graph_overlay {
      * @param remap Map from old key pointer to new key pointer
      *
      * Rewrites `edge.source`/`edge.target` for every edge that appears in `remap`,
-     * then rebuilds the incidence index from scratch against the rewritten edge
+     * then rebuilds the adjacency index from scratch against the rewritten edge
      * list. Keys absent from the remap (e.g. external keys, which were not
      * migrated) are preserved unchanged. Intended for grove::compact() to migrate
-     * the graph after rebuilding the indexed key storage.
+     * the graph after rebuilding the indexed key storage. A frozen graph is
+     * remapped in place and stays frozen.
      */
     void remap_keys(
         const std::unordered_map<const gdt::key<key_type, data_type>*,
                                  gdt::key<key_type, data_type>*>& remap) {
         if (remap.empty()) return;
+        if (frozen_) {
+            auto apply = [&remap](gdt::key<key_type, data_type>*& k) {
+                if (auto it = remap.find(k); it != remap.end()) k = it->second;
+            };
+            std::ranges::for_each(csr_.vertex_key, apply);
+            std::ranges::for_each(csr_.out_targets, apply);
+            std::ranges::for_each(csr_.in_sources, apply);
+            csr_.vertex_id.clear();
+            for (std::size_t v = 0; v < csr_.vertex_key.size(); ++v) {
+                csr_.vertex_id.try_emplace(csr_.vertex_key[v], static_cast<std::uint32_t>(v),
+                                           csr_.vertex_key);
+            }
+            return;
+        }
         for (auto& e : edges_) {
             if (auto it = remap.find(e.source); it != remap.end()) e.source = it->second;
             if (auto it = remap.find(e.target); it != remap.end()) e.target = it->second;
         }
-        incident.clear();
-        incident.reserve(edges_.size() * 2); // each edge touches up to 2 distinct keys
+        adjacency_.clear();
+        adjacency_.reserve(edges_.size() * 2); // each edge touches up to 2 distinct keys
+        source_count_ = 0;
         for (auto it = edges_.begin(); it != edges_.end(); ++it) {
             register_edge(it);
         }
     }
 
+  private:
+    // The stored form of an edge: its endpoints and the slot of its metadata
+    // in metadata_ (0 and unused when edge_data_type is void).
+    struct edge_record {
+        gdt::key<key_type, data_type>* source;
+        gdt::key<key_type, data_type>* target;
+        typename edge_metadata_column<metadata_type>::slot_type slot;
+    };
+
   public:
-    using edge_iterator = std::list<edge>::iterator;
+    /// Handle to a stored edge, as returned by find_edge().
+    using edge_iterator = typename std::list<edge_record>::iterator;
 
     /**
      * @brief Find the `occurrence`-th edge iterator for a specific directed edge.
@@ -491,10 +653,11 @@ class graph_overlay {
         const gdt::key<key_type, data_type>* source,
         const gdt::key<key_type, data_type>* target,
         std::size_t occurrence = 0) {
-        auto it = incident.find(source);
-        if (it == incident.end()) return edges_.end();
-        for (auto eit : it->second) {
-            if (eit->source == source && eit->target == target) {
+        thaw();
+        auto it = adjacency_.find(source);
+        if (it == adjacency_.end()) return edges_.end();
+        for (auto eit : it->second.out) {
+            if (eit->target == target) {
                 if (occurrence == 0) return eit;
                 --occurrence;
             }
@@ -505,33 +668,432 @@ class graph_overlay {
     /// Past-the-end iterator for the edge list.
     [[nodiscard]] edge_iterator edge_end() { return edges_.end(); }
 
+    // -------------------------------------------------------------------------
+    // Lazy adjacency views. Unlike the get_* accessors these allocate nothing:
+    // they walk the key's outgoing or incoming adjacency list or, once
+    // frozen, its contiguous CSR slice. A view and its
+    // iterators are invalidated by any edge mutation, freeze() or thaw().
+    // -------------------------------------------------------------------------
+
+    /// One edge as seen from a key: the key at its other end and its metadata.
+    struct adjacent_edge {
+        gdt::key<key_type, data_type>* key;  ///< target (outgoing) or source (incoming)
+        const metadata_type& metadata;       ///< std::monostate when edge_data_type is void
+    };
+
+    /// Forward iterator over one key's outgoing (`outgoing` = true) or incoming
+    /// edges, yielding adjacent_edge values — or, with `with_metadata` = false,
+    /// just the key at the other end, never touching the metadata column.
+    template<bool outgoing, bool with_metadata = true>
+    class adjacency_iterator {
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::conditional_t<with_metadata, adjacent_edge, gdt::key<key_type, data_type>*>;
+        using difference_type = std::ptrdiff_t;
+
+        adjacency_iterator() = default;
+
+        value_type operator*() const {
+            if (pos_ == nullptr) {
+                const auto& csr = graph_->csr_;
+                const auto slot = outgoing ? slot_ : csr.in_edges[slot_];
+                auto* other = outgoing ? csr.out_targets[slot_] : csr.in_sources[slot_];
+                if constexpr (with_metadata) {
+                    return {other, graph_->csr_.out_metadata.get(slot)};
+                } else {
+                    return other;
+                }
+            }
+            const edge_record& e = **pos_;
+            if constexpr (with_metadata) {
+                return {outgoing ? e.target : e.source, graph_->metadata_.get(e.slot)};
+            } else {
+                return outgoing ? e.target : e.source;
+            }
+        }
+
+        adjacency_iterator& operator++() {
+            if (pos_ == nullptr) {
+                ++slot_;
+            } else {
+                ++pos_;
+            }
+            return *this;
+        }
+
+        adjacency_iterator operator++(int) {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool operator==(const adjacency_iterator& other) const {
+            return slot_ == other.slot_ && pos_ == other.pos_;
+        }
+
+      private:
+        friend class graph_overlay;
+
+        // Frozen: a CSR slot.
+        adjacency_iterator(const graph_overlay* graph, std::uint32_t slot)
+            : graph_(graph), slot_(slot) {}
+
+        // List: a position in a key's outgoing or incoming adjacency list.
+        adjacency_iterator(const graph_overlay* graph, const edge_iterator* pos)
+            : graph_(graph), pos_(pos) {}
+
+        const graph_overlay* graph_ = nullptr;
+        std::uint32_t slot_ = 0;
+        const edge_iterator* pos_ = nullptr;  // null in frozen mode
+    };
+
+    /// Projects an adjacent_edge onto its key (by value: the edge is a prvalue).
+    static constexpr auto adjacent_key = [](const adjacent_edge& e) { return e.key; };
+
+    /// View over one key's outgoing or incoming edges; see adjacency_iterator.
+    template<bool outgoing, bool with_metadata = true>
+    class adjacency_range : public std::ranges::view_interface<adjacency_range<outgoing, with_metadata>> {
+      public:
+        using iterator = adjacency_iterator<outgoing, with_metadata>;
+        adjacency_range() = default;
+        adjacency_range(iterator first, iterator last) : first_(first), last_(last) {}
+        [[nodiscard]] iterator begin() const { return first_; }
+        [[nodiscard]] iterator end() const { return last_; }
+
+      private:
+        iterator first_;
+        iterator last_;
+    };
+
     /**
-     * @brief Rebuild incident[target] so both its outgoing order and its
-     *        incoming order (the given `ordered` sequence) are correct
-     *        simultaneously.
+     * @brief Lazy view over the outgoing edges of `source`, as adjacent_edge values
+     * @param source Pointer to source key
+     * @return Range yielding (target, metadata) in get_edge_list order; empty
+     *         for a key with no outgoing edges
+     */
+    [[nodiscard]] adjacency_range<true> out_edges_view(const gdt::key<key_type, data_type>* source) const {
+        if (!source) {
+            throw std::invalid_argument("out_edges_view: source must not be null");
+        }
+        return make_adjacency_range<true>(source);
+    }
+
+    /**
+     * @brief Lazy view over the incoming edges of `target`, as adjacent_edge values
+     * @param target Pointer to target key
+     * @return Range yielding (source, metadata) in get_in_edge_list order
+     */
+    [[nodiscard]] adjacency_range<false> in_edges_view(const gdt::key<key_type, data_type>* target) const {
+        if (!target) {
+            throw std::invalid_argument("in_edges_view: target must not be null");
+        }
+        return make_adjacency_range<false>(target);
+    }
+
+    /**
+     * @brief Lazy counterpart of get_neighbors
+     * @param source Pointer to source key
+     * @return Range of target key pointers, in get_neighbors order
+     */
+    [[nodiscard]] adjacency_range<true, false> neighbors_view(
+        const gdt::key<key_type, data_type>* source) const {
+        if (!source) {
+            throw std::invalid_argument("neighbors_view: source must not be null");
+        }
+        return make_adjacency_range<true, false>(source);
+    }
+
+    /**
+     * @brief Lazy counterpart of get_in_neighbors
+     * @param target Pointer to target key
+     * @return Range of source key pointers, in get_in_neighbors order
+     */
+    [[nodiscard]] adjacency_range<false, false> in_neighbors_view(
+        const gdt::key<key_type, data_type>* target) const {
+        if (!target) {
+            throw std::invalid_argument("in_neighbors_view: target must not be null");
+        }
+        return make_adjacency_range<false, false>(target);
+    }
+
+    /**
+     * @brief Lazy counterpart of get_neighbors_if
+     * @param source Pointer to source key
+     * @param predicate Function to filter edges by metadata (copied into the view)
+     * @return Range of target key pointers whose edge metadata satisfies predicate
+     */
+    template<typename Predicate>
+    [[nodiscard]] auto neighbors_if_view(const gdt::key<key_type, data_type>* source,
+                                         Predicate predicate) const
+        requires (!std::is_void_v<edge_data_type> && std::predicate<Predicate, const edge_data_type&>) {
+        return out_edges_view(source)
+            | std::views::filter([predicate](const adjacent_edge& e) { return predicate(e.metadata); })
+            | std::views::transform(adjacent_key);
+    }
+
+    /**
+     * @brief Lazy counterpart of get_in_neighbors_if
+     * @param target Pointer to target key
+     * @param predicate Function to filter edges by metadata (copied into the view)
+     * @return Range of source key pointers whose edge metadata satisfies predicate
+     */
+    template<typename Predicate>
+    [[nodiscard]] auto in_neighbors_if_view(const gdt::key<key_type, data_type>* target,
+                                            Predicate predicate) const
+        requires (!std::is_void_v<edge_data_type> && std::predicate<Predicate, const edge_data_type&>) {
+        return in_edges_view(target)
+            | std::views::filter([predicate](const adjacent_edge& e) { return predicate(e.metadata); })
+            | std::views::transform(adjacent_key);
+    }
+
+    // -------------------------------------------------------------------------
+    // Traversal over outgoing edges, built on neighbors_view: a walk allocates
+    // its own bookkeeping (visited set, frontier or stack) but nothing per hop.
+    // See graph_traversal.hpp for the shared algorithms.
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Breadth-first walk over outgoing edges
+     * @param start Key to start from, visited at depth 0
+     * @param visit Called once per reachable key in BFS order as
+     *        visit(key, depth); if it returns bool, false stops the walk from
+     *        expanding that key
+     * @param max_depth Hop bound; unbounded_depth (the default) walks everything reachable
+     * @throws std::invalid_argument if start is null
+     */
+    template<typename Visitor>
+        requires detail::traversal_visitor<Visitor, gdt::key<key_type, data_type>*>
+    void bfs(gdt::key<key_type, data_type>* start, Visitor visit,
+             std::size_t max_depth = unbounded_depth) const {
+        if (!start) {
+            throw std::invalid_argument("bfs: start must not be null");
+        }
+        overlay_adjacency adj{this};
+        detail::breadth_first(adj, start, max_depth, visit);
+    }
+
+    /**
+     * @brief Depth-first (pre-order) walk over outgoing edges, following edge order
+     * @param start Key to start from, visited at depth 0
+     * @param visit Called once per reachable key as visit(key, depth), where
+     *        depth is the DFS tree depth; returning false prunes as in bfs
+     * @param max_depth Bound on the DFS tree depth
+     * @throws std::invalid_argument if start is null
+     */
+    template<typename Visitor>
+        requires detail::traversal_visitor<Visitor, gdt::key<key_type, data_type>*>
+    void dfs(gdt::key<key_type, data_type>* start, Visitor visit,
+             std::size_t max_depth = unbounded_depth) const {
+        if (!start) {
+            throw std::invalid_argument("dfs: start must not be null");
+        }
+        overlay_adjacency adj{this};
+        detail::depth_first(adj, start, max_depth, visit);
+    }
+
+    /**
+     * @brief Keys reachable from `start` in 1 to `k` hops
+     * @param start Key to start from (not included in the result)
+     * @param k Hop bound
+     * @return Keys in BFS order, each once
+     * @throws std::invalid_argument if start is null
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> k_hop(
+        gdt::key<key_type, data_type>* start, std::size_t k) const {
+        std::vector<gdt::key<key_type, data_type>*> out;
+        bfs(start, [&out, start](gdt::key<key_type, data_type>* key, std::size_t) {
+            if (key != start) out.push_back(key);
+        }, k);
+        return out;
+    }
+
+    /**
+     * @brief Every simple path from `from` to `to`, e.g. the isoforms of a splice graph
+     * @param from First key of each path
+     * @param to Last key of each path
+     * @param max_paths Stop after this many paths
+     * @param max_depth Longest path to consider, in edges
+     * @return Paths as key sequences (from ... to), in depth-first edge order
+     * @throws std::invalid_argument if from or to is null
+     */
+    [[nodiscard]] std::vector<std::vector<gdt::key<key_type, data_type>*>> all_paths(
+        gdt::key<key_type, data_type>* from, gdt::key<key_type, data_type>* to,
+        std::size_t max_paths, std::size_t max_depth = unbounded_depth) const {
+        if (!from || !to) {
+            throw std::invalid_argument("all_paths: from and to must not be null");
+        }
+        overlay_adjacency adj{this};
+        return detail::simple_paths(adj, from, to, max_paths, max_depth);
+    }
+
+    /**
+     * @brief Topological order of the keys reachable from `roots`
+     * @param roots Keys to start from; unrelated roots keep their relative order
+     * @return Every reachable key once, each before all of its targets
+     * @throws std::invalid_argument if a root is null
+     * @throws std::runtime_error if the reachable subgraph has a cycle
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> topological_order(
+        std::span<gdt::key<key_type, data_type>* const> roots) const {
+        if (std::ranges::find(roots, nullptr) != roots.end()) {
+            throw std::invalid_argument("topological_order: roots must not be null");
+        }
+        overlay_adjacency adj{this};
+        return detail::topological_sort(adj, roots);
+    }
+
+    /**
+     * @brief Topological order of every key that has an edge
      *
-     * Used by grove::deserialize() to restore on-disk incoming-edge order
-     * after add_edge() replay (block-visitation order) scrambles it, without
-     * disturbing outgoing order (which replay already gets right).
+     * Keys are taken in order of their first appearance in the edge list, so
+     * the result is deterministic for a given insertion history.
      *
-     * A self-loop occupies one shared incident[target] slot (register_edge
-     * files it once, serving both directions at once), so a naive
-     * erase+append or positional overwrite can satisfy one direction's order
-     * only by breaking the other whenever a self-loop is interleaved with
-     * another source targeting the same key (#546). This instead merges two
-     * already-correct sequences — incident[target] filtered by
-     * source==target (untouched by replay, so already right) and `ordered`
-     * (the desired incoming order) — using self-loops as sync points: they
-     * are the only entries present in both sequences, and their relative
-     * order is identical in each (both are projections of the same original
-     * incident bucket), so segments between consecutive self-loops can be
-     * concatenated in either order while each self-loop anchors where both
-     * sequences must align.
+     * @throws std::runtime_error if the graph has a cycle
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> topological_order() const {
+        const auto roots = vertices();
+        return topological_order(std::span<gdt::key<key_type, data_type>* const>(roots));
+    }
+
+    // -------------------------------------------------------------------------
+    // Whole-graph analytics over dense vertex ids (see graph_analytics.hpp).
+    // On a frozen graph they read the CSR arrays in place; otherwise they
+    // first lay the adjacency lists out the same way, at O(V + E). Work is
+    // split into fixed vertex chunks that idle workers claim one at a time,
+    // and every result is identical for every thread count.
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Weakly connected components (edge direction ignored)
+     * @param num_threads Worker count (0 = one per core)
+     * @return Every key with an edge and its component label
+     */
+    [[nodiscard]] graph_components<gdt::key<key_type, data_type>*> weakly_connected_components(
+        std::size_t num_threads = 1) const {
+        return with_id_graph([&](const detail::id_graph& g, const auto& layout) {
+            auto [labels, count] = detail::connected_components(g, num_threads);
+            return graph_components<gdt::key<key_type, data_type>*>{
+                layout.keys(), std::move(labels), count};
+        });
+    }
+
+    /**
+     * @brief Keys reachable from any of `sources` along outgoing edges
+     * @param sources Keys to start from
+     * @param num_threads Worker count (0 = one per core)
+     * @return The sources (input order, each once), then every other
+     *         reachable key in first-appearance order
+     * @throws std::invalid_argument if a source is null
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> reachable(
+        std::span<gdt::key<key_type, data_type>* const> sources, std::size_t num_threads = 1) const {
+        if (std::ranges::find(sources, nullptr) != sources.end()) {
+            throw std::invalid_argument("reachable: sources must not be null");
+        }
+        return with_id_graph([&](const detail::id_graph& g, const auto& layout) {
+            std::vector<gdt::key<key_type, data_type>*> out;
+            std::unordered_set<const gdt::key<key_type, data_type>*> listed;
+            std::vector<std::uint32_t> source_ids;
+            for (auto* s : sources) {
+                if (!listed.insert(s).second) continue;
+                out.push_back(s);
+                if (const auto v = layout.vertex_of(s); v != no_vertex) source_ids.push_back(v);
+            }
+            const auto reached = detail::reachable_vertices(g, source_ids, num_threads);
+            const auto& keys = layout.keys();
+            for (std::size_t v = 0; v < keys.size(); ++v) {
+                if (reached[v] && !listed.contains(keys[v])) out.push_back(keys[v]);
+            }
+            return out;
+        });
+    }
+
+    /**
+     * @brief PageRank-style importance score of every key with an edge
      *
-     * If `ordered` doesn't account for an incoming-role entry actually in
-     * incident[target] (a malformed/tampered file whose incoming section
-     * disagrees with what add_edge() replay created from the outgoing
-     * sections), that entry is appended at the end rather than dropped.
+     * Power iteration over outgoing edges: a key's score is shared equally
+     * among its targets, keys without outgoing edges spread theirs over all
+     * keys, and (1 - damping) is spread uniformly every round. Parallel edges
+     * count once each.
+     *
+     * @param options Damping factor, iteration bound and convergence tolerance
+     * @param num_threads Worker count (0 = one per core)
+     * @return Every key with an edge and its score (scores sum to 1)
+     * @throws std::invalid_argument if damping is outside [0, 1] or tolerance
+     *         is negative
+     */
+    [[nodiscard]] graph_scores<gdt::key<key_type, data_type>*> rank_vertices(
+        const ranking_options& options = {}, std::size_t num_threads = 1) const {
+        if (!(options.damping >= 0.0 && options.damping <= 1.0)) {
+            throw std::invalid_argument("rank_vertices: damping must be in [0, 1]");
+        }
+        if (!(options.tolerance >= 0.0)) {
+            throw std::invalid_argument("rank_vertices: tolerance must not be negative");
+        }
+        return with_id_graph([&](const detail::id_graph& g, const auto& layout) {
+            auto [scores, iterations] = detail::page_rank(g, options, num_threads);
+            return graph_scores<gdt::key<key_type, data_type>*>{
+                layout.keys(), std::move(scores), iterations};
+        });
+    }
+
+    /**
+     * @brief Breadth-first expansion from a set of seed keys, as used by
+     *        grove::intersect_expand
+     *
+     * Appends the seeds to `result` at depth 0, then every key reached along
+     * outgoing edges that pass `spec.edge_filter`, level by level up to
+     * `spec.max_depth` hops, each once. Reached keys outside
+     * `spec.target_region` (when set) are dropped and not expanded. On a
+     * frozen graph the visited set is a bitmap over vertex ids, fed by the
+     * per-slot target ids; otherwise it is a hash set of key pointers.
+     *
+     * @param seeds Distinct keys to start from
+     * @param spec Depth bound, edge filter and optional target region
+     * @param result Result to append to
+     * @throws std::invalid_argument if a seed is null
+     */
+    template<typename EdgeFilter>
+        requires std::predicate<const EdgeFilter&, const metadata_type&>
+    void expand(std::span<gdt::key<key_type, data_type>* const> seeds,
+                const expansion_spec<key_type, EdgeFilter>& spec,
+                gdt::expansion_result<key_type, data_type>& result) const {
+        if (std::ranges::find(seeds, nullptr) != seeds.end()) {
+            throw std::invalid_argument("expand: seeds must not be null");
+        }
+        auto accept = [&spec](const gdt::key<key_type, data_type>* k) {
+            return !spec.target_region || key_type::overlaps(k->get_value(), *spec.target_region);
+        };
+        auto run = [&](auto& adj) {
+            std::vector<gdt::key<key_type, data_type>*> frontier;
+            frontier.reserve(seeds.size());
+            for (auto* s : seeds) {
+                if (adj.mark_seed(s)) frontier.push_back(s);
+            }
+            detail::expand_levels(adj, std::move(frontier), spec.max_depth, spec.edge_filter, accept, result);
+        };
+        if (frozen_) {
+            frozen_expansion adj{this, detail::sparse_bitmap(csr_.vertex_key.size())};
+            run(adj);
+        } else {
+            list_expansion adj{this, {}};
+            run(adj);
+        }
+    }
+
+    /**
+     * @brief Replace the incoming order of `target` with the given sequence
+     *
+     * Used by grove::deserialize() to restore on-disk incoming-edge order
+     * after add_edge() replay (block-visitation order) scrambles it. Outgoing
+     * lists live separately, so their order — which replay already gets
+     * right — is untouched, self-loops included.
+     *
+     * If `ordered` doesn't account for an edge actually in target's incoming
+     * list (a malformed/tampered file whose incoming section disagrees with
+     * what add_edge() replay created from the outgoing sections), that edge
+     * is appended at the end rather than dropped.
      *
      * @param target Pointer to the target key whose incoming order to fix.
      * @param ordered_begin Beginning of an iterator range of edge_iterator values
@@ -542,49 +1104,23 @@ class graph_overlay {
         const gdt::key<key_type, data_type>* target,
         std::vector<edge_iterator>::const_iterator ordered_begin,
         std::vector<edge_iterator>::const_iterator ordered_end) {
-        auto it = incident.find(target);
-        if (it == incident.end()) return;
-
-        auto is_self_loop = [target](edge_iterator e) {
-            return e->source == target && e->target == target;
-        };
+        thaw();
+        auto it = adjacency_.find(target);
+        if (it == adjacency_.end()) return;
+        auto& in = it->second.in;
 
-        std::vector<edge_iterator> outgoing_correct;
-        std::vector<edge_iterator> incoming_asis;
-        for (edge_iterator e : it->second) {
-            if (e->source == target) outgoing_correct.push_back(e);
-            if (e->target == target) incoming_asis.push_back(e);
-        }
-
-        std::vector<edge_iterator> merged;
-        merged.reserve(it->second.size());
-        std::size_t oi = 0;
-        auto ci = ordered_begin;
-        while (oi < outgoing_correct.size() || ci != ordered_end) {
-            while (oi < outgoing_correct.size() && !is_self_loop(outgoing_correct[oi])) {
-                merged.push_back(outgoing_correct[oi++]);
-            }
-            while (ci != ordered_end && !is_self_loop(*ci)) {
-                merged.push_back(*ci++);
-            }
-            if (oi < outgoing_correct.size() && ci != ordered_end) {
-                merged.push_back(outgoing_correct[oi]);  // same self-loop on both sides
-                ++oi;
-                ++ci;
-            } else if (oi < outgoing_correct.size()) {
-                merged.push_back(outgoing_correct[oi++]);
-            } else if (ci != ordered_end) {
-                merged.push_back(*ci++);
-            }
+        std::vector<edge_iterator> merged(ordered_begin, ordered_end);
+        std::unordered_set<const edge_record*> placed;
+        placed.reserve(merged.size());
+        for (edge_iterator e : merged) {
+            placed.insert(&*e);
         }
-
-        for (edge_iterator e : incoming_asis) {
-            if (std::find(merged.begin(), merged.end(), e) == merged.end()) {
+        for (edge_iterator e : in) {
+            if (!placed.contains(&*e)) {
                 merged.push_back(e);
             }
         }
-
-        it->second = std::move(merged);
+        in = std::move(merged);
     }
 
     /**
@@ -592,7 +1128,11 @@ class graph_overlay {
      */
     void clear() {
         edges_.clear();
-        incident.clear();
+        metadata_.clear();
+        adjacency_.clear();
+        source_count_ = 0;
+        csr_ = frozen_adjacency{};
+        frozen_ = false;
     }
 
     /**
@@ -600,23 +1140,506 @@ class graph_overlay {
      * @return true if no edges exist
      */
     [[nodiscard]] bool empty() const {
-        return edges_.empty();
+        return edge_count() == 0;
+    }
+
+    /**
+     * @brief Convert the graph into frozen CSR adjacency for read-only traversal
+     *
+     * Assigns every key that has an edge a dense vertex id and lays out, per
+     * vertex, its outgoing targets (with metadata) and its incoming sources as
+     * contiguous slices delimited by offset arrays, then releases the edge list
+     * and incidence index. Read accessors answer from those slices — no list
+     * iterators, no per-edge direction filtering — and each edge costs a few
+     * array slots instead of a list node plus two index entries. Every
+     * accessor returns the same results, in the same order, as before.
+     *
+     * A frozen graph stays mutable: any call that adds, removes or reorders
+     * edges thaw()s it first, at O(V + E). Freeze again after a batch of
+     * changes. No-op if already frozen.
+     *
+     * @throws std::length_error if the graph has more edges or vertices than
+     *         a 32-bit offset can address
+     */
+    void freeze() {
+        if (frozen_) return;
+        using key_ptr = gdt::key<key_type, data_type>*;
+        if (edges_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("freeze: too many edges for 32-bit CSR offsets");
+        }
+        frozen_adjacency csr;
+
+        // Dense ids in first-appearance order over the edge list, so the
+        // layout is deterministic (adjacency_'s iteration order is not).
+        csr.vertex_key.reserve(adjacency_.size());
+        auto assign_id = [&csr](key_ptr k) {
+            const auto [v, inserted] = csr.vertex_id.try_emplace(
+                k, static_cast<std::uint32_t>(csr.vertex_key.size()), csr.vertex_key);
+            if (inserted) csr.vertex_key.push_back(k);
+        };
+        for (const auto& e : edges_) {
+            assign_id(e.source);
+            assign_id(e.target);
+        }
+        const std::size_t num_vertices = csr.vertex_key.size();
+
+        // Slices follow each vertex's adjacency lists, so per-vertex order
+        // matches what the list-based accessors returned.
+        std::unordered_map<const edge_record*, std::uint32_t> out_index;
+        out_index.reserve(edges_.size());
+        csr.out_offsets.resize(num_vertices + 1);
+        csr.out_targets.reserve(edges_.size());
+        csr.out_target_ids.reserve(edges_.size());
+        csr.out_metadata.reserve(edges_.size());
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            const key_ptr k = csr.vertex_key[v];
+            csr.out_offsets[v] = static_cast<std::uint32_t>(csr.out_targets.size());
+            for (const auto& e : adjacency_.at(k).out) {
+                out_index.emplace(&*e, static_cast<std::uint32_t>(csr.out_targets.size()));
+                csr.out_targets.push_back(e->target);
+                csr.out_target_ids.push_back(csr.vertex_id.find(e->target, csr.vertex_key));
+                csr.out_metadata.add_copy(metadata_, e->slot);
+            }
+        }
+        csr.out_offsets[num_vertices] = static_cast<std::uint32_t>(csr.out_targets.size());
+
+        csr.in_offsets.resize(num_vertices + 1);
+        csr.in_sources.reserve(edges_.size());
+        csr.in_edges.reserve(edges_.size());
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            const key_ptr k = csr.vertex_key[v];
+            csr.in_offsets[v] = static_cast<std::uint32_t>(csr.in_sources.size());
+            for (const auto& e : adjacency_.at(k).in) {
+                csr.in_sources.push_back(e->source);
+                csr.in_edges.push_back(out_index.at(&*e));
+            }
+        }
+        csr.in_offsets[num_vertices] = static_cast<std::uint32_t>(csr.in_sources.size());
+
+        csr_ = std::move(csr);
+        edge_list_t().swap(edges_);
+        metadata_ = edge_metadata_column<metadata_type>{};
+        decltype(adjacency_)().swap(adjacency_);
+        frozen_ = true;
+    }
+
+    /**
+     * @brief Convert a frozen graph back into the mutable list representation
+     *
+     * Rebuilds the edge list and incidence index from the CSR arrays,
+     * preserving every accessor's per-key order, then releases the arrays.
+     * Called implicitly by every mutating operation; no-op if not frozen.
+     */
+    void thaw() {
+        if (!frozen_) return;
+        // The CSR slices are each vertex's adjacency lists in order, so both
+        // are rebuilt directly; the edge count and source count carry over.
+        std::vector<edge_iterator> by_index;
+        by_index.reserve(csr_.out_targets.size());
+        adjacency_.reserve(csr_.vertex_key.size());
+        for (std::size_t v = 0; v < csr_.vertex_key.size(); ++v) {
+            auto& lists = adjacency_[csr_.vertex_key[v]];
+            lists.out.reserve(csr_.out_offsets[v + 1] - csr_.out_offsets[v]);
+            for (auto i = csr_.out_offsets[v]; i < csr_.out_offsets[v + 1]; ++i) {
+                const auto slot = metadata_.add_copy(csr_.out_metadata, i);
+                const auto it = edges_.insert(edges_.end(), edge_record{csr_.vertex_key[v], csr_.out_targets[i], slot});
+                lists.out.push_back(it);
+                by_index.push_back(it);
+            }
+        }
+        for (std::size_t v = 0; v < csr_.vertex_key.size(); ++v) {
+            auto& in = adjacency_[csr_.vertex_key[v]].in;
+            in.reserve(csr_.in_offsets[v + 1] - csr_.in_offsets[v]);
+            for (auto i = csr_.in_offsets[v]; i < csr_.in_offsets[v + 1]; ++i) {
+                in.push_back(by_index[csr_.in_edges[i]]);
+            }
+        }
+        frozen_ = false;
+        csr_ = frozen_adjacency{};
+    }
+
+    /**
+     * @brief Check whether the graph is currently in frozen CSR form
+     * @return true between freeze() and the next mutation / thaw() / clear()
+     */
+    [[nodiscard]] bool is_frozen() const noexcept {
+        return frozen_;
     }
 
   private:
-    using edge_list_t = std::list<edge>;
+    using edge_list_t = std::list<edge_record>;
 
-    // Files a newly-inserted edge under both of its endpoints in `incident`.
-    // A self-loop (source == target) is filed once, not twice — filing it
-    // twice would double-count degree for that key.
-    void register_edge(edge_iterator it) {
-        incident[it->source].push_back(it);
-        if (it->target != it->source) {
-            incident[it->target].push_back(it);
+    /// Returned by frozen_vertex() for a key with no edges.
+    static constexpr std::uint32_t no_vertex = std::numeric_limits<std::uint32_t>::max();
+
+    // Key -> CSR vertex id. A grove numbers every key it creates (key::get_id),
+    // so the lookup is a flat table indexed by that id: one read for the
+    // vertex id, one to confirm vertex_key[v] is this key — no hashing on the
+    // frozen read path. Keys without an id (standalone keys, grove_view keys)
+    // and keys whose id is already taken by another vertex (keys from two
+    // different groves in one overlay) fall back to a pointer map, which stays
+    // empty for a grove's own graph. The table costs 4 bytes per id up to the
+    // largest vertex id.
+    struct vertex_index {
+        using key_ptr = gdt::key<key_type, data_type>*;
+        std::vector<std::uint32_t> by_key_id;
+        std::unordered_map<const gdt::key<key_type, data_type>*, std::uint32_t> unnumbered;
+
+        [[nodiscard]] std::uint32_t find(const gdt::key<key_type, data_type>* k,
+                                         const std::vector<key_ptr>& vertex_key) const {
+            // A null key has no edges, as on the thawed incidence index.
+            if (k == nullptr) return no_vertex;
+            const std::uint32_t id = k->get_id();
+            if (id < by_key_id.size()) {
+                const std::uint32_t v = by_key_id[id];
+                if (v != no_vertex && vertex_key[v] == k) return v;
+            }
+            if (unnumbered.empty()) return no_vertex;
+            auto it = unnumbered.find(k);
+            return it == unnumbered.end() ? no_vertex : it->second;
+        }
+
+        // Record `k` as vertex `v` unless it already has one; returns the
+        // key's vertex id and whether it was newly recorded. `vertex_key`
+        // must hold every vertex recorded so far.
+        std::pair<std::uint32_t, bool> try_emplace(key_ptr k, std::uint32_t v,
+                                                    const std::vector<key_ptr>& vertex_key) {
+            const std::uint32_t id = k->get_id();
+            if (id != gdt::no_key_id) {
+                if (id >= by_key_id.size()) {
+                    by_key_id.resize(std::size_t{id} + 1, no_vertex);
+                }
+                std::uint32_t& slot = by_key_id[id];
+                if (slot == no_vertex) {
+                    slot = v;
+                    return {v, true};
+                }
+                if (vertex_key[slot] == k) return {slot, false};
+            }
+            const auto [it, inserted] = unnumbered.try_emplace(k, v);
+            return {it->second, inserted};
         }
+
+        void clear() {
+            std::fill(by_key_id.begin(), by_key_id.end(), no_vertex);
+            unnumbered.clear();
+        }
+    };
+
+    // CSR adjacency built by freeze(). Vertex v's outgoing edges are slots
+    // [out_offsets[v], out_offsets[v + 1]) of out_targets / out_metadata; its
+    // incoming edges are slots [in_offsets[v], in_offsets[v + 1]) of in_sources
+    // / in_edges, where in_edges names the edge's outgoing slot so metadata is
+    // stored once. out_target_ids holds each outgoing slot's target as a
+    // vertex id, so walks can mark visited vertices without hashing pointers.
+    struct frozen_adjacency {
+        vertex_index vertex_id;
+        std::vector<gdt::key<key_type, data_type>*> vertex_key;
+        std::vector<std::uint32_t> out_offsets;
+        std::vector<gdt::key<key_type, data_type>*> out_targets;
+        std::vector<std::uint32_t> out_target_ids;
+        edge_metadata_column<metadata_type> out_metadata;  // slot i = outgoing slot i
+        std::vector<std::uint32_t> in_offsets;
+        std::vector<gdt::key<key_type, data_type>*> in_sources;
+        std::vector<std::uint32_t> in_edges;
+    };
+
+    // Outgoing adjacency for the shared traversal algorithms.
+    struct overlay_adjacency {
+        using key_ptr = gdt::key<key_type, data_type>*;
+        const graph_overlay* graph;
+        [[nodiscard]] auto neighbors(key_ptr k) const { return graph->neighbors_view(k); }
+        void prefetch(std::span<const key_ptr>) const noexcept {}
+    };
+
+    // add_edges into an empty graph, frozen: the CSR arrays freeze() would
+    // produce for the same edges added one by one — vertex ids in order of
+    // first appearance, each vertex's outgoing and incoming slices in batch
+    // order — laid out by counting sort over the batch.
+    template<typename R>
+    void build_frozen(R& edges, std::size_t count) {
+        using key_ptr = gdt::key<key_type, data_type>*;
+        if (count >= std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("add_edges: too many edges for 32-bit CSR offsets");
+        }
+        frozen_adjacency csr;
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> ends;
+        ends.reserve(count);
+        csr.vertex_key.reserve(count);
+        auto assign_id = [&csr](key_ptr k) {
+            const auto [v, inserted] = csr.vertex_id.try_emplace(
+                k, static_cast<std::uint32_t>(csr.vertex_key.size()), csr.vertex_key);
+            if (inserted) csr.vertex_key.push_back(k);
+            return v;
+        };
+        for (auto&& e : edges) {
+            const auto s = assign_id(std::get<0>(e));
+            ends.emplace_back(s, assign_id(std::get<1>(e)));
+        }
+        const std::size_t num_vertices = csr.vertex_key.size();
+
+        // Degrees, then exclusive prefix sums; the offsets double as fill cursors.
+        csr.out_offsets.assign(num_vertices + 1, 0);
+        csr.in_offsets.assign(num_vertices + 1, 0);
+        for (const auto& [s, t] : ends) {
+            ++csr.out_offsets[s + 1];
+            ++csr.in_offsets[t + 1];
+        }
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            csr.out_offsets[v + 1] += csr.out_offsets[v];
+            csr.in_offsets[v + 1] += csr.in_offsets[v];
+        }
+        std::vector<std::uint32_t> out_cursor(csr.out_offsets.begin(), csr.out_offsets.end() - 1);
+        std::vector<std::uint32_t> in_cursor(csr.in_offsets.begin(), csr.in_offsets.end() - 1);
+
+        csr.out_targets.resize(count);
+        csr.out_target_ids.resize(count);
+        csr.in_sources.resize(count);
+        csr.in_edges.resize(count);
+        csr.out_metadata.resize(count);
+        std::size_t i = 0;
+        for (auto&& e : edges) {
+            const auto [s, t] = ends[i++];
+            const std::uint32_t slot = out_cursor[s]++;
+            csr.out_targets[slot] = csr.vertex_key[t];
+            csr.out_target_ids[slot] = t;
+            if constexpr (!std::is_void_v<edge_data_type>) {
+                if constexpr (std::tuple_size_v<std::remove_cvref_t<decltype(e)>> == 3) {
+                    csr.out_metadata.set(slot, std::get<2>(e));
+                }
+            }
+            const std::uint32_t in_slot = in_cursor[t]++;
+            csr.in_sources[in_slot] = csr.vertex_key[s];
+            csr.in_edges[in_slot] = slot;
+        }
+        source_count_ = 0;
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            if (csr.out_offsets[v + 1] != csr.out_offsets[v]) ++source_count_;
+        }
+        csr_ = std::move(csr);
+        frozen_ = true;
     }
 
-    // Order-preserving erase: the O(bucket-size) cost is already paid by the
+    // Expansion backends for expand(): the frozen one keys its visited set on
+    // vertex ids, the list one on key pointers. A seed with no edges has no
+    // vertex id, but nothing can reach it either, so it needs no mark.
+    struct frozen_expansion {
+        using key_ptr = gdt::key<key_type, data_type>*;
+        const graph_overlay* graph;
+        detail::sparse_bitmap visited;
+
+        bool mark_seed(key_ptr k) {
+            const auto v = graph->frozen_vertex(k);
+            return v == no_vertex || visited.test_and_set(v);
+        }
+        template<typename Filter, typename Emit>
+        void expand(key_ptr k, const Filter& filter, Emit&& emit) {
+            const auto& csr = graph->csr_;
+            const auto [begin, end] = graph->frozen_out_range(k);
+            for (auto slot = begin; slot < end; ++slot) {
+                if (filter(graph->frozen_metadata(slot)) && visited.test_and_set(csr.out_target_ids[slot])) {
+                    emit(csr.out_targets[slot]);
+                }
+            }
+        }
+        template<typename Filter>
+        void prefetch(std::span<const key_ptr>, const Filter&) const noexcept {}
+    };
+
+    struct list_expansion {
+        using key_ptr = gdt::key<key_type, data_type>*;
+        const graph_overlay* graph;
+        std::unordered_set<const gdt::key<key_type, data_type>*> visited;
+
+        bool mark_seed(key_ptr k) { return visited.insert(k).second; }
+        template<typename Filter, typename Emit>
+        void expand(key_ptr k, const Filter& filter, Emit&& emit) {
+            for (const auto& e : graph->out_edges_view(k)) {
+                if (filter(e.metadata) && visited.insert(e.key).second) {
+                    emit(e.key);
+                }
+            }
+        }
+        template<typename Filter>
+        void prefetch(std::span<const key_ptr>, const Filter&) const noexcept {}
+    };
+
+    // Every key with an edge, in order of first appearance in the edge list
+    // (the order freeze() assigns vertex ids in).
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> vertices() const {
+        if (frozen_) return csr_.vertex_key;
+        std::vector<gdt::key<key_type, data_type>*> out;
+        out.reserve(adjacency_.size());
+        std::unordered_set<const gdt::key<key_type, data_type>*> seen;
+        seen.reserve(adjacency_.size());
+        for (const auto& e : edges_) {
+            if (seen.insert(e.source).second) out.push_back(e.source);
+            if (seen.insert(e.target).second) out.push_back(e.target);
+        }
+        return out;
+    }
+
+    // The vertex numbering an id_graph was laid out with: keys() in
+    // vertices() order, and vertex_of(k) mapping a key back to its id
+    // (no_vertex for a key without edges). Frozen, both are csr_'s own;
+    // otherwise they are built once per with_id_graph call.
+    struct frozen_layout {
+        const graph_overlay* graph;
+        [[nodiscard]] const std::vector<gdt::key<key_type, data_type>*>& keys() const {
+            return graph->csr_.vertex_key;
+        }
+        [[nodiscard]] std::uint32_t vertex_of(const gdt::key<key_type, data_type>* k) const {
+            return graph->frozen_vertex(k);
+        }
+    };
+    struct list_layout {
+        std::vector<gdt::key<key_type, data_type>*> vertex_keys;
+        std::unordered_map<const gdt::key<key_type, data_type>*, std::uint32_t> id;
+        [[nodiscard]] const std::vector<gdt::key<key_type, data_type>*>& keys() const { return vertex_keys; }
+        [[nodiscard]] std::uint32_t vertex_of(const gdt::key<key_type, data_type>* k) const {
+            auto it = id.find(k);
+            return it == id.end() ? no_vertex : it->second;
+        }
+    };
+
+    // Calls fn(id_graph, layout) over vertex ids in vertices() order. Frozen:
+    // the outgoing side is csr_ itself and only the incoming source ids are
+    // derived. Otherwise the vertex list, its key -> id map and both sides
+    // are laid out from the adjacency lists in one pass, and the layout hands
+    // the same list and map to fn so the caller builds neither again.
+    template<typename Fn>
+    decltype(auto) with_id_graph(Fn&& fn) const {
+        std::vector<std::uint32_t> out_offsets, out_targets, in_offsets, in_sources;
+        detail::id_graph g;
+        if (frozen_) {
+            const std::size_t n = csr_.vertex_key.size();
+            std::vector<std::uint32_t> slot_source(csr_.out_targets.size());
+            for (std::size_t v = 0; v < n; ++v) {
+                std::fill(slot_source.begin() + csr_.out_offsets[v],
+                          slot_source.begin() + csr_.out_offsets[v + 1], static_cast<std::uint32_t>(v));
+            }
+            in_sources.resize(csr_.in_edges.size());
+            for (std::size_t i = 0; i < in_sources.size(); ++i) {
+                in_sources[i] = slot_source[csr_.in_edges[i]];
+            }
+            g = {n, csr_.out_offsets, csr_.out_target_ids, csr_.in_offsets, in_sources};
+            return fn(std::as_const(g), frozen_layout{this});
+        }
+        // vertices(), with the first-appearance set doubling as the id map.
+        list_layout layout;
+        layout.vertex_keys.reserve(adjacency_.size());
+        layout.id.reserve(adjacency_.size());
+        for (const auto& e : edges_) {
+            for (auto* k : {e.source, e.target}) {
+                const auto next = static_cast<std::uint32_t>(layout.vertex_keys.size());
+                if (layout.id.try_emplace(k, next).second) layout.vertex_keys.push_back(k);
+            }
+        }
+        const auto& keys = layout.vertex_keys;
+        out_offsets.reserve(keys.size() + 1);
+        in_offsets.reserve(keys.size() + 1);
+        out_targets.reserve(edges_.size());
+        in_sources.reserve(edges_.size());
+        for (auto* k : keys) {
+            const auto& lists = adjacency_.at(k);
+            out_offsets.push_back(static_cast<std::uint32_t>(out_targets.size()));
+            for (const auto& e : lists.out) out_targets.push_back(layout.id.at(e->target));
+            in_offsets.push_back(static_cast<std::uint32_t>(in_sources.size()));
+            for (const auto& e : lists.in) in_sources.push_back(layout.id.at(e->source));
+        }
+        out_offsets.push_back(static_cast<std::uint32_t>(out_targets.size()));
+        in_offsets.push_back(static_cast<std::uint32_t>(in_sources.size()));
+        g = {keys.size(), out_offsets, out_targets, in_offsets, in_sources};
+        return fn(std::as_const(g), std::as_const(layout));
+    }
+
+    [[nodiscard]] std::uint32_t frozen_vertex(const gdt::key<key_type, data_type>* k) const {
+        return csr_.vertex_id.find(k, csr_.vertex_key);
+    }
+
+    // [begin, end) of a key's outgoing slots; empty for a key with no edges.
+    [[nodiscard]] std::pair<std::uint32_t, std::uint32_t> frozen_out_range(
+        const gdt::key<key_type, data_type>* k) const {
+        const auto v = frozen_vertex(k);
+        if (v == no_vertex) return {0, 0};
+        return {csr_.out_offsets[v], csr_.out_offsets[v + 1]};
+    }
+
+    // [begin, end) of a key's incoming slots; empty for a key with no edges.
+    [[nodiscard]] std::pair<std::uint32_t, std::uint32_t> frozen_in_range(
+        const gdt::key<key_type, data_type>* k) const {
+        const auto v = frozen_vertex(k);
+        if (v == no_vertex) return {0, 0};
+        return {csr_.in_offsets[v], csr_.in_offsets[v + 1]};
+    }
+
+    template<bool outgoing, bool with_metadata = true>
+    [[nodiscard]] adjacency_range<outgoing, with_metadata> make_adjacency_range(
+        const gdt::key<key_type, data_type>* k) const {
+        using iterator = adjacency_iterator<outgoing, with_metadata>;
+        if (frozen_) {
+            const auto [begin, end] = outgoing ? frozen_out_range(k) : frozen_in_range(k);
+            return {iterator(this, begin), iterator(this, end)};
+        }
+        auto it = adjacency_.find(k);
+        if (it == adjacency_.end()) return {};
+        const auto& list = outgoing ? it->second.out : it->second.in;
+        return {iterator(this, list.data()), iterator(this, list.data() + list.size())};
+    }
+
+    // Metadata of outgoing slot `slot`; a shared monostate when edge_data_type is void.
+    [[nodiscard]] const metadata_type& frozen_metadata(std::uint32_t slot) const {
+        return csr_.out_metadata.get(slot);
+    }
+
+    // Materializes outgoing slot `slot` as an edge value.
+    [[nodiscard]] edge frozen_edge(gdt::key<key_type, data_type>* source,
+                                   gdt::key<key_type, data_type>* target, std::uint32_t slot) const {
+        if constexpr (std::is_void_v<edge_data_type>) {
+            return edge(source, target);
+        } else {
+            return edge(source, target, csr_.out_metadata.get(slot));
+        }
+    }
+
+    // Appends an edge record to edges_, its metadata to metadata_.
+    template<typename M>
+    edge_iterator link_edge(gdt::key<key_type, data_type>* source,
+                            gdt::key<key_type, data_type>* target, M&& metadata) {
+        const auto slot = metadata_.add(std::forward<M>(metadata));
+        try {
+            return edges_.insert(edges_.end(), edge_record{source, target, slot});
+        } catch (...) {
+            metadata_.release(slot);
+            throw;
+        }
+    }
+
+    // Materializes a stored edge (copying its metadata).
+    [[nodiscard]] edge to_edge(const edge_record& e) const {
+        if constexpr (std::is_void_v<edge_data_type>) {
+            return edge(e.source, e.target);
+        } else {
+            return edge(e.source, e.target, metadata_.get(e.slot));
+        }
+    }
+
+    // Files a newly-inserted edge on its source's outgoing list and its
+    // target's incoming list (both lists of the same key for a self-loop).
+    void register_edge(edge_iterator it) {
+        auto& out = adjacency_[it->source].out;
+        if (out.empty()) ++source_count_;
+        out.push_back(it);
+        adjacency_[it->target].in.push_back(it);
+    }
+
+    // Drops an adjacency_ entry once its key has no edges left in either direction.
+    template<typename MapIterator>
+    void erase_if_unused(MapIterator mit) {
+        if (mit->second.out.empty() && mit->second.in.empty()) adjacency_.erase(mit);
+    }
+
+    // Order-preserving erase: the O(list-size) cost is already paid by the
     // find() above, so shifting (rather than swap-and-pop) costs nothing
     // extra while keeping accessor results in insertion order after removal.
     static void erase_iter_from(std::vector<edge_iterator>& v, edge_iterator it) {
@@ -626,39 +1649,86 @@ class graph_overlay {
         }
     }
 
-    // Removes one edge from every structure that references it: both
-    // incidence buckets, then the edge list itself. `it` is invalidated by
-    // this call; no other iterator into `edges_` is affected, since erasing
-    // from a std::list never moves other elements.
+    // Removes one edge from every structure that references it: its
+    // source's outgoing list, its target's incoming list, then the edge list
+    // itself. `it` is invalidated by this call; no other iterator into
+    // `edges_` is affected, since erasing from a std::list never moves other
+    // elements.
     void erase_edge(edge_iterator it) {
-        auto src = it->source;
-        auto tgt = it->target;
-        if (auto mit = incident.find(src); mit != incident.end()) {
-            erase_iter_from(mit->second, it);
-            if (mit->second.empty()) incident.erase(mit);
+        if (auto mit = adjacency_.find(it->source); mit != adjacency_.end()) {
+            erase_iter_from(mit->second.out, it);
+            if (mit->second.out.empty()) --source_count_;
+            erase_if_unused(mit);
         }
-        if (tgt != src) {
-            if (auto mit = incident.find(tgt); mit != incident.end()) {
-                erase_iter_from(mit->second, it);
-                if (mit->second.empty()) incident.erase(mit);
-            }
+        if (auto mit = adjacency_.find(it->target); mit != adjacency_.end()) {
+            erase_iter_from(mit->second.in, it);
+            erase_if_unused(mit);
         }
+        metadata_.release(it->slot);
         edges_.erase(it);
     }
 
+    // Removes a batch of distinct edges. Each affected adjacency list is
+    // swept once, so removing all k edges of a hub costs O(k) plus the
+    // lists of its neighbours, not O(k) per edge as repeated erase_edge
+    // calls would. Returns the number of edges removed.
+    std::size_t erase_edges(std::vector<edge_iterator> doomed) {
+        if (doomed.empty()) return 0;
+        std::unordered_set<const edge_record*> gone;
+        std::unordered_set<const gdt::key<key_type, data_type>*> touched;
+        gone.reserve(doomed.size());
+        for (edge_iterator e : doomed) {
+            gone.insert(&*e);
+            touched.insert(e->source);
+            touched.insert(e->target);
+        }
+        auto is_gone = [&gone](edge_iterator e) { return gone.contains(&*e); };
+        for (const auto* k : touched) {
+            auto mit = adjacency_.find(k);
+            if (mit == adjacency_.end()) continue;
+            const bool had_out = !mit->second.out.empty();
+            std::erase_if(mit->second.out, is_gone);
+            std::erase_if(mit->second.in, is_gone);
+            if (had_out && mit->second.out.empty()) --source_count_;
+            erase_if_unused(mit);
+        }
+        for (edge_iterator e : doomed) {
+            metadata_.release(e->slot);
+            edges_.erase(e);
+        }
+        return doomed.size();
+    }
+
     // Single source of truth: every edge lives here exactly once. A
     // std::list is used (not std::vector) so that an iterator into it
     // remains valid until that specific edge is erased — no other edge's
     // iterator is ever invalidated as a side effect of removing one.
     edge_list_t edges_;
 
-    // key -> iterators of edges touching that key, in either direction.
-    // Map key is const-pointer so read-only accessors can take `const key*`
-    // and `find()` it directly. Each edge appears under both its source and
-    // its target (see register_edge); forward vs. reverse queries filter the
-    // same bucket by comparing edge_it->source / edge_it->target against the
-    // queried key.
-    std::unordered_map<const gdt::key<key_type, data_type>*, std::vector<edge_iterator>> incident;
+    // Metadata of the edges in edges_, at each record's slot.
+    edge_metadata_column<metadata_type> metadata_;
+
+    // A key's edges split by direction, each list in insertion order (or the
+    // on-disk order reorder_incoming() restores). The list sizes are the
+    // key's degrees.
+    struct vertex_adjacency {
+        std::vector<edge_iterator> out;  ///< Edges with this key as source
+        std::vector<edge_iterator> in;   ///< Edges with this key as target
+    };
+
+    // key -> its outgoing and incoming edges. Map key is const-pointer so
+    // read-only accessors can take `const key*` and `find()` it directly.
+    // Each edge appears once under its source (out) and once under its
+    // target (in); see register_edge.
+    std::unordered_map<const gdt::key<key_type, data_type>*, vertex_adjacency> adjacency_;
+
+    // Keys with at least one outgoing edge, kept current by every mutation
+    // (and unchanged by freeze()/thaw()) for vertex_count_with_edges().
+    std::size_t source_count_ = 0;
+
+    // Set by freeze(): reads go through csr_ while edges_ / adjacency_ are empty.
+    bool frozen_ = false;
+    frozen_adjacency csr_;
 };
 
 } // namespace genogrove::structure
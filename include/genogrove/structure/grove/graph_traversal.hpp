@@ -0,0 +1,383 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_STRUCTURE_GROVE_GRAPH_TRAVERSAL_HPP
+#define GENOGROVE_STRUCTURE_GROVE_GRAPH_TRAVERSAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace genogrove::structure {
+
+/// Depth bound meaning "no bound" for the traversal entry points.
+inline constexpr std::size_t unbounded_depth = std::numeric_limits<std::size_t>::max();
+
+/// Edge filter that follows every edge — the expansion_spec default.
+struct follow_every_edge {
+    template<typename M>
+    constexpr bool operator()(const M&) const noexcept { return true; }
+};
+
+/**
+ * @brief What intersect_expand does after the overlap search.
+ *
+ * From every key overlapping the query, follow outgoing edges breadth-first:
+ * - `max_depth`: hop bound (0 returns only the overlapping keys);
+ * - `edge_filter`: `bool(const edge_data_type&)` deciding which edges to
+ *   follow (for a graph without edge metadata it receives a std::monostate);
+ * - `target_region`: if set, a reached key that does not overlap it is
+ *   neither reported nor expanded further.
+ *
+ * An aggregate, so a spec reads as
+ * `expansion_spec<interval>{.max_depth = 3, .target_region = interval{0, 5000}}`.
+ *
+ * @tparam key_type The grove's key type
+ * @tparam EdgeFilter Edge predicate type
+ */
+template<typename key_type, typename EdgeFilter = follow_every_edge>
+struct expansion_spec {
+    std::size_t max_depth = 1;
+    EdgeFilter edge_filter{};
+    std::optional<key_type> target_region{};
+};
+
+}  // namespace genogrove::structure
+
+namespace genogrove::structure::detail {
+
+/**
+ * @brief Abstracts where a traversal's outgoing adjacency comes from.
+ *
+ * The walks are identical whether the graph is the in-memory graph_overlay
+ * (neighbors are already materialized) or a paged grove_view (a neighbor's
+ * block is loaded when it is dereferenced). An adjacency exposes:
+ * - `key_ptr`: the key pointer type it hands back;
+ * - `neighbors(k)`: a lazy range of `k`'s outgoing targets in edge order;
+ * - `prefetch(frontier)`: a hint that every neighbor of `frontier` is about to
+ *   be resolved, so a paged backend can load their blocks in one ordered pass.
+ *   In-memory backends make it a no-op.
+ */
+template<typename A>
+concept traversal_adjacency = requires(A& a, typename A::key_ptr k,
+                                       std::span<const typename A::key_ptr> frontier) {
+    { a.neighbors(k) } -> std::ranges::input_range;
+    a.prefetch(frontier);
+};
+
+/**
+ * @brief A traversal visitor: `void(key_ptr, std::size_t depth)` or
+ *        `bool(key_ptr, std::size_t depth)`, where returning false stops the
+ *        walk from expanding that key (it is still counted as visited).
+ */
+template<typename V, typename key_ptr>
+concept traversal_visitor = std::invocable<V&, key_ptr, std::size_t>;
+
+// Invoke a visitor; a void visitor never prunes.
+template<typename key_ptr, typename Visitor>
+bool visit_key(Visitor& visit, key_ptr k, std::size_t depth) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, key_ptr, std::size_t>>) {
+        std::invoke(visit, k, depth);
+        return true;
+    } else {
+        return static_cast<bool>(std::invoke(visit, k, depth));
+    }
+}
+
+// One key being expanded by a depth-first walk: its neighbor range and the
+// position reached in it. Frames live in a std::deque so a frame's address —
+// which a range adaptor's iterator may point back into — never changes while
+// deeper frames are pushed and popped.
+template<traversal_adjacency A>
+struct dfs_frame {
+    using key_ptr = typename A::key_ptr;
+    using range_t = decltype(std::declval<A&>().neighbors(std::declval<key_ptr>()));
+
+    dfs_frame(A& adj, key_ptr k, std::size_t d)
+        : key(k), depth(d), range(adj.neighbors(k)), it(std::ranges::begin(range)) {}
+    dfs_frame(const dfs_frame&) = delete;
+    dfs_frame& operator=(const dfs_frame&) = delete;
+
+    [[nodiscard]] bool done() { return it == std::ranges::end(range); }
+
+    key_ptr key;
+    std::size_t depth;
+    range_t range;
+    std::ranges::iterator_t<range_t> it;
+};
+
+// Push a frame for `k`, telling the adjacency its neighbors come next.
+template<traversal_adjacency A>
+void push_frame(A& adj, std::deque<dfs_frame<A>>& stack, typename A::key_ptr k, std::size_t depth) {
+    adj.prefetch(std::span<const typename A::key_ptr>(&k, 1));
+    stack.emplace_back(adj, k, depth);
+}
+
+/**
+ * @brief Level-synchronous breadth-first walk from `start`.
+ *
+ * Each reachable key is visited once, in BFS order, with its hop distance;
+ * keys farther than `max_depth` hops are not visited. Before a level is
+ * expanded the whole frontier is handed to `prefetch`.
+ */
+template<traversal_adjacency A, typename Visitor>
+    requires traversal_visitor<Visitor, typename A::key_ptr>
+void breadth_first(A& adj, typename A::key_ptr start, std::size_t max_depth, Visitor& visit) {
+    using key_ptr = typename A::key_ptr;
+    std::unordered_set<key_ptr> seen{start};
+    std::vector<key_ptr> frontier;
+    std::vector<key_ptr> next;
+    if (visit_key(visit, start, 0)) {
+        frontier.push_back(start);
+    }
+    for (std::size_t depth = 0; !frontier.empty() && depth < max_depth; ++depth) {
+        adj.prefetch(std::span<const key_ptr>(frontier));
+        next.clear();
+        for (key_ptr k : frontier) {
+            for (key_ptr n : adj.neighbors(k)) {
+                if (seen.insert(n).second && visit_key(visit, n, depth + 1)) {
+                    next.push_back(n);
+                }
+            }
+        }
+        frontier.swap(next);
+    }
+}
+
+/**
+ * @brief Depth-first (pre-order) walk from `start`.
+ *
+ * Visits keys in the order a recursive DFS following edge order would, but
+ * with an explicit stack, so a long chain cannot overflow the call stack.
+ * `depth` is the length of the DFS tree path, not the shortest distance.
+ */
+template<traversal_adjacency A, typename Visitor>
+    requires traversal_visitor<Visitor, typename A::key_ptr>
+void depth_first(A& adj, typename A::key_ptr start, std::size_t max_depth, Visitor& visit) {
+    using key_ptr = typename A::key_ptr;
+    std::unordered_set<key_ptr> seen{start};
+    std::deque<dfs_frame<A>> stack;
+    if (visit_key(visit, start, 0) && max_depth > 0) {
+        push_frame(adj, stack, start, 0);
+    }
+    while (!stack.empty()) {
+        auto& top = stack.back();
+        if (top.done()) {
+            stack.pop_back();
+            continue;
+        }
+        const key_ptr n = *top.it;
+        ++top.it;
+        const std::size_t depth = top.depth + 1;
+        if (seen.insert(n).second && visit_key(visit, n, depth) && depth < max_depth) {
+            push_frame(adj, stack, n, depth);
+        }
+    }
+}
+
+/**
+ * @brief Every simple path from `from` to `to` of at most `max_depth` edges.
+ *
+ * Paths are produced in depth-first edge order and the search stops once
+ * `max_paths` have been found. A path never revisits a key, so cycles are
+ * harmless; the search itself is exponential in the worst case, which is what
+ * the caps are for. `from == to` yields the single zero-edge path.
+ */
+template<traversal_adjacency A>
+std::vector<std::vector<typename A::key_ptr>> simple_paths(A& adj, typename A::key_ptr from,
+                                                           typename A::key_ptr to,
+                                                           std::size_t max_paths,
+                                                           std::size_t max_depth) {
+    using key_ptr = typename A::key_ptr;
+    std::vector<std::vector<key_ptr>> paths;
+    if (max_paths == 0) {
+        return paths;
+    }
+    if (from == to) {
+        paths.push_back({from});
+        return paths;
+    }
+    std::unordered_set<key_ptr> on_path{from};
+    std::vector<key_ptr> path{from};
+    std::deque<dfs_frame<A>> stack;
+    if (max_depth > 0) {
+        push_frame(adj, stack, from, 0);
+    }
+    while (!stack.empty()) {
+        auto& top = stack.back();
+        if (top.done()) {
+            on_path.erase(top.key);
+            path.pop_back();
+            stack.pop_back();
+            continue;
+        }
+        const key_ptr n = *top.it;
+        ++top.it;
+        const std::size_t edges = top.depth + 1;  // path length once n is appended
+        if (n == to) {
+            paths.push_back(path);
+            paths.back().push_back(n);
+            if (paths.size() == max_paths) {
+                break;
+            }
+        } else if (edges < max_depth && on_path.insert(n).second) {
+            path.push_back(n);
+            push_frame(adj, stack, n, edges);
+        }
+    }
+    return paths;
+}
+
+/**
+ * @brief Topological order of the subgraph reachable from `roots`.
+ *
+ * Reverse post-order of a depth-first walk that follows edge order and takes
+ * the roots in the given order, so an edge u -> v always puts u before v and
+ * unrelated roots keep their relative order.
+ *
+ * @throws std::runtime_error if the reachable subgraph has a cycle (a
+ *         self-loop included)
+ */
+template<traversal_adjacency A>
+std::vector<typename A::key_ptr> topological_sort(A& adj,
+                                                  std::span<const typename A::key_ptr> roots) {
+    using key_ptr = typename A::key_ptr;
+    enum class mark : std::uint8_t { active, finished };
+    std::unordered_map<key_ptr, mark> marks;
+    std::vector<key_ptr> order;
+    std::deque<dfs_frame<A>> stack;
+    // Later roots are walked first so that, once reversed, earlier roots lead.
+    for (auto r = roots.rbegin(); r != roots.rend(); ++r) {
+        if (!marks.try_emplace(*r, mark::active).second) {
+            continue;
+        }
+        push_frame(adj, stack, *r, 0);
+        while (!stack.empty()) {
+            auto& top = stack.back();
+            if (top.done()) {
+                marks[top.key] = mark::finished;
+                order.push_back(top.key);
+                stack.pop_back();
+                continue;
+            }
+            const key_ptr n = *top.it;
+            ++top.it;
+            auto [it, inserted] = marks.try_emplace(n, mark::active);
+            if (inserted) {
+                push_frame(adj, stack, n, top.depth + 1);
+            } else if (it->second == mark::active) {
+                throw std::runtime_error("topological_order: graph has a cycle");
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/**
+ * @brief Visited set over dense key ids, as a bitmap allocated page by page.
+ *
+ * Ids up to `bits` are addressable; a 4096-id page is allocated the first
+ * time an id in it is set, so a query touching few keys of a large graph
+ * pays for a page table rather than the whole bitmap.
+ */
+class sparse_bitmap {
+  public:
+    explicit sparse_bitmap(std::size_t bits) : pages((bits + page_bits - 1) / page_bits) {}
+
+    /// Whether `id` is set.
+    [[nodiscard]] bool test(std::size_t id) const {
+        const auto& page = pages[id / page_bits];
+        return page && ((*page)[(id % page_bits) / 64] >> (id % 64) & 1u);
+    }
+
+    /// Set `id`; returns true if it was not set before.
+    bool test_and_set(std::size_t id) {
+        auto& page = pages[id / page_bits];
+        if (!page) {
+            page = std::make_unique<page_t>();
+        }
+        std::uint64_t& word = (*page)[(id % page_bits) / 64];
+        const std::uint64_t bit = std::uint64_t{1} << (id % 64);
+        if (word & bit) {
+            return false;
+        }
+        word |= bit;
+        return true;
+    }
+
+  private:
+    static constexpr std::size_t page_bits = 4096;
+    using page_t = std::array<std::uint64_t, page_bits / 64>;
+    std::vector<std::unique_ptr<page_t>> pages;
+};
+
+/**
+ * @brief Abstracts the edge expansion behind intersect_expand.
+ *
+ * - `expand(k, filter, emit)`: call `emit(n)` for each target `n` of `k`'s
+ *   outgoing edges whose metadata passes `filter`, skipping any target it has
+ *   already emitted or been given as a seed — the backend owns the visited
+ *   set, so it can key it on whatever dense id it has;
+ * - `prefetch(frontier, filter)`: as for traversal_adjacency, restricted to
+ *   the edges `expand` will actually resolve.
+ */
+template<typename A, typename Filter>
+concept expansion_adjacency = requires(A& a, typename A::key_ptr k,
+                                       std::span<const typename A::key_ptr> frontier,
+                                       const Filter& filter) {
+    a.expand(k, filter, [](typename A::key_ptr) {});
+    a.prefetch(frontier, filter);
+};
+
+/**
+ * @brief Multi-source breadth-first expansion from `seeds` into `result`.
+ *
+ * The seeds are appended at depth 0 (the backend must already count them as
+ * visited), then each level's newly reached keys, for up to `max_depth`
+ * levels. A reached key rejected by `accept` is dropped and not expanded.
+ */
+template<typename A, typename Filter, typename Accept, typename Result>
+    requires expansion_adjacency<A, Filter>
+void expand_levels(A& adj, std::vector<typename A::key_ptr> frontier, std::size_t max_depth,
+                   const Filter& filter, Accept& accept, Result& result) {
+    using key_ptr = typename A::key_ptr;
+    for (key_ptr k : frontier) {
+        result.add_key(k, 0);
+    }
+    std::vector<key_ptr> next;
+    for (std::size_t depth = 0; !frontier.empty() && depth < max_depth; ++depth) {
+        adj.prefetch(std::span<const key_ptr>(frontier), filter);
+        next.clear();
+        for (key_ptr k : frontier) {
+            adj.expand(k, filter, [&](key_ptr n) {
+                if (accept(n)) {
+                    result.add_key(n, depth + 1);
+                    next.push_back(n);
+                }
+            });
+        }
+        frontier.swap(next);
+    }
+}
+
+}  // namespace genogrove::structure::detail
+
+#endif  // GENOGROVE_STRUCTURE_GROVE_GRAPH_TRAVERSAL_HPP
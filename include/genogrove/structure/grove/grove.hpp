@@ -9,26 +9,40 @@
 // standard
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <deque>
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <queue>
+#include <span>
 #include <sstream>
 #include <utility>
 #include <variant>
 #include <vector>
 
 // genogrove
+#include "genogrove/utility/parallel.hpp"
+#include "genogrove/utility/radix_sort.hpp"
 #include "genogrove/utility/ranges.hpp"
+#include <genogrove/data_type/expansion_result.hpp>
 #include <genogrove/data_type/flanking_query_result.hpp>
+#include <genogrove/data_type/kmer.hpp>
+#include <genogrove/data_type/kmer_extractor.hpp>
+#include <genogrove/data_type/kmer_minimizer.hpp>
+#include <genogrove/data_type/nearest_query_result.hpp>
 #include <genogrove/data_type/query_result.hpp>
+#include <genogrove/structure/grove/block_codec.hpp>
+#include <genogrove/structure/grove/gg_block_format.hpp>
 #include <genogrove/structure/grove/node.hpp>
 #include <genogrove/structure/grove/graph_overlay.hpp>
+#include <genogrove/structure/grove/index_handle.hpp>
 #include <genogrove/structure/grove/pod_io.hpp>
 #include <genogrove/structure/grove/query_engine.hpp>
 #include <genogrove/structure/grove/zlib_streambuf.hpp>
@@ -37,17 +51,6 @@ namespace ggu = genogrove::utility;
 namespace gdt = genogrove::data_type;
 
 namespace genogrove::structure {
-    /**
-     * @brief Transparent hash for std::string keys, enabling lookup with std::string_view
-     *        without allocating a temporary std::string.
-     */
-    struct string_hash {
-        using is_transparent = void;
-        size_t operator()(std::string_view sv) const noexcept {
-            return std::hash<std::string_view>{}(sv);
-        }
-    };
-
     /**
      * @brief Tag type for dispatching to sorted insertion algorithm
      * @note Use this when inserting data that is already sorted for optimal performance
@@ -66,6 +69,26 @@ namespace genogrove::structure {
     /// Global constant for bulk insertion dispatch
     inline constexpr bulk_t bulk{};
 
+    /**
+     * @brief Options for grove::serialize(std::ostream&, const serialize_options&)
+     */
+    struct serialize_options {
+        /// Workers compressing blocks (0 = hardware concurrency); the output is
+        /// byte-identical for every count
+        std::size_t num_threads = 1;
+        /// Compression applied to every block, recorded in the stream header
+        block_codec codec = block_codec::zlib;
+        /// zstd only: train a dictionary of up to this many bytes on the grove's
+        /// own blocks and store it in the header (0 = no dictionary)
+        std::size_t dictionary_size = 0;
+        /// Consecutive blocks compressed and read together as one frame (1 =
+        /// every block on its own, at most detail::max_blocks_per_frame). Frames
+        /// never mix indices, internal nodes, leaves and external blocks, and
+        /// leaves are laid out in leaf-chain order, so with more than one a
+        /// grove_view range scan reads one frame per run of adjacent leaves.
+        std::size_t blocks_per_frame = 1;
+    };
+
     namespace detail {
         // Type trait to detect if a type is std::optional
         template<typename T>
@@ -172,12 +195,12 @@ class grove {
      */
     ~grove() {
         // Delete all root nodes (which will recursively delete their children)
-        for(auto& [key, root] : root_nodes) {
-            delete root;
+        for(auto& slot : index_slots) {
+            delete slot.root;
         }
     }
 
-    // Non-copyable: root_nodes are owned raw pointers, shallow copy causes double-free
+    // Non-copyable: index roots are owned raw pointers, shallow copy causes double-free
     grove(const grove&) = delete;
     grove& operator=(const grove&) = delete;
 
@@ -204,11 +227,98 @@ class grove {
 
 
     /**
-     * @brief Get map of all root nodes indexed by their string keys
-     * @return Const reference to unordered map from index names (e.g., chromosome names) to root node pointers
+     * @brief Read-only map-like view of every index that holds a tree
+     *
+     * Iterates `(name, root)` pairs in the order the indices were first used
+     * and offers the lookups of a const map (find, at, count, contains, size,
+     * empty). It reads the grove's index slots directly, so it reflects later
+     * insertions and removals and stays valid for the grove's lifetime.
+     */
+    class root_view {
+      public:
+        using node_pointer = node<key_type, data_type>*;
+        using value_type = std::pair<const std::string&, node_pointer>;
+
+        class iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = root_view::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+
+            struct arrow {
+                value_type entry;
+                const value_type* operator->() const noexcept { return &entry; }
+            };
+
+            iterator() = default;
+            iterator(const grove* owner, std::size_t pos) : owner(owner), pos(pos) { skip_empty(); }
+
+            [[nodiscard]] reference operator*() const {
+                const auto& slot = owner->index_slots[pos];
+                return {slot.name, slot.root};
+            }
+            [[nodiscard]] arrow operator->() const { return {**this}; }
+            iterator& operator++() {
+                ++pos;
+                skip_empty();
+                return *this;
+            }
+            iterator operator++(int) {
+                iterator prev = *this;
+                ++*this;
+                return prev;
+            }
+            [[nodiscard]] bool operator==(const iterator& other) const noexcept {
+                return pos == other.pos && owner == other.owner;
+            }
+
+          private:
+            void skip_empty() {
+                while (pos < owner->index_slots.size() && owner->index_slots[pos].root == nullptr) {
+                    ++pos;
+                }
+            }
+
+            const grove* owner = nullptr;
+            std::size_t pos = 0;
+        };
+        using const_iterator = iterator;
+
+        explicit root_view(const grove& owner) noexcept : owner(&owner) {}
+
+        [[nodiscard]] iterator begin() const { return {owner, 0}; }
+        [[nodiscard]] iterator end() const { return {owner, owner->index_slots.size()}; }
+
+        /// Iterator to the tree of `index`, or end() if it holds none.
+        [[nodiscard]] iterator find(std::string_view index) const {
+            const auto handle = owner->find_index(index);
+            if (owner->get_root(handle) == nullptr) return end();
+            return {owner, handle.id};
+        }
+
+        /// @throws std::out_of_range if `index` holds no tree
+        [[nodiscard]] node_pointer at(std::string_view index) const {
+            if (auto* root = owner->get_root(index)) return root;
+            throw std::out_of_range("grove: no tree for index " + std::string(index));
+        }
+
+        [[nodiscard]] bool contains(std::string_view index) const { return owner->get_root(index) != nullptr; }
+        [[nodiscard]] std::size_t count(std::string_view index) const { return contains(index) ? 1 : 0; }
+        [[nodiscard]] std::size_t size() const { return static_cast<std::size_t>(std::distance(begin(), end())); }
+        [[nodiscard]] bool empty() const { return begin() == end(); }
+
+      private:
+        const grove* owner;
+    };
+
+    /**
+     * @brief Get all root nodes indexed by their index names
+     * @return View from index names (e.g., chromosome names) to root node
+     *         pointers, covering the indices that hold a tree
      */
-    [[nodiscard]] const std::unordered_map<std::string, node<key_type, data_type>*, string_hash, std::equal_to<>>& get_root_nodes() const {
-        return this->root_nodes;
+    [[nodiscard]] root_view get_root_nodes() const {
+        return root_view{*this};
     }
 
     /**
@@ -218,7 +328,60 @@ class grove {
      * @note Used for optimized sorted insertion
      */
     [[nodiscard]] node<key_type, data_type>* get_rightmost_node(std::string_view key) const {
-        return ggu::value_lookup(this->rightmost_nodes, key).value_or(nullptr);
+        return get_rightmost_node(find_index(key));
+    }
+
+    /// @copydoc get_rightmost_node(std::string_view) const
+    [[nodiscard]] node<key_type, data_type>* get_rightmost_node(index_handle handle) const {
+        const index_slot* slot = slot_at(handle);
+        return slot != nullptr ? slot->rightmost : nullptr;
+    }
+
+    // =========================================================================
+    // Index handles
+    // =========================================================================
+
+    /**
+     * @brief Resolve an index name to a handle, interning it if it is new
+     * @param index The index name (e.g., chromosome name)
+     * @return A valid handle; the same one for every call with the same name
+     * @throws std::runtime_error if the 32-bit handle space is exhausted
+     * @note Interning does not create a tree: the index stays empty (and
+     *       absent from get_root_nodes()) until a key is inserted
+     */
+    index_handle resolve_index(std::string_view index) {
+        if (auto it = this->index_ids.find(index); it != this->index_ids.end()) {
+            return {it->second};
+        }
+        if (this->index_slots.size() >= index_handle::invalid_id) {
+            throw std::runtime_error("grove: index handle space exhausted");
+        }
+        const auto id = static_cast<uint32_t>(this->index_slots.size());
+        this->index_slots.push_back({std::string(index), nullptr, nullptr});
+        this->index_ids.emplace(std::string(index), id);
+        return {id};
+    }
+
+    /**
+     * @brief Look up the handle of an index name without interning it
+     * @param index The index name (e.g., chromosome name)
+     * @return The handle, or an invalid handle if the name was never used
+     */
+    [[nodiscard]] index_handle find_index(std::string_view index) const {
+        if (auto it = this->index_ids.find(index); it != this->index_ids.end()) {
+            return {it->second};
+        }
+        return {};
+    }
+
+    /**
+     * @brief Get the name an index handle was resolved from
+     * @param handle A handle of this grove
+     * @return The index name; valid as long as the grove
+     * @throws std::out_of_range if the handle does not belong to this grove
+     */
+    [[nodiscard]] std::string_view get_index_name(index_handle handle) const {
+        return checked_slot(handle).name;
     }
 
   private:
@@ -226,13 +389,69 @@ class grove {
     // Private tree management helpers
     // =========================================================================
 
+    /// An interned index: its name, root and rightmost leaf (both nullptr
+    /// while the index holds no tree). The only record of an index's tree:
+    /// a handle reaches it directly, a name through find_index().
+    struct index_slot {
+        std::string name;
+        node<key_type, data_type>* root;
+        node<key_type, data_type>* rightmost;
+    };
+
+    /// Slot of a handle, or nullptr for an invalid or foreign handle.
+    const index_slot* slot_at(index_handle handle) const noexcept {
+        return handle.id < this->index_slots.size() ? &this->index_slots[handle.id] : nullptr;
+    }
+
+    /// Slot of a handle used to modify the grove.
+    /// @throws std::out_of_range for an invalid or foreign handle
+    index_slot& checked_slot(index_handle handle) {
+        if (handle.id >= this->index_slots.size()) {
+            throw std::out_of_range("grove: index handle does not belong to this grove");
+        }
+        return this->index_slots[handle.id];
+    }
+
+    /// @copydoc checked_slot(index_handle)
+    const index_slot& checked_slot(index_handle handle) const {
+        if (handle.id >= this->index_slots.size()) {
+            throw std::out_of_range("grove: index handle does not belong to this grove");
+        }
+        return this->index_slots[handle.id];
+    }
+
     /**
      * @brief Get the root node for a specific index
      * @param key The index name (e.g., chromosome name) to look up
      * @return Pointer to root node, or nullptr if index doesn't exist
      */
     node<key_type, data_type>* get_root(std::string_view key) const {
-        return ggu::value_lookup(this->root_nodes, key).value_or(nullptr);
+        return get_root(find_index(key));
+    }
+
+    /// @copydoc get_root(std::string_view) const
+    node<key_type, data_type>* get_root(index_handle handle) const {
+        const index_slot* slot = slot_at(handle);
+        return slot != nullptr ? slot->root : nullptr;
+    }
+
+    /// Publish `root` as the root of `index`.
+    void set_root(std::string_view index, node<key_type, data_type>* root) {
+        this->index_slots[resolve_index(index).id].root = root;
+    }
+
+    /// Publish `leaf` as the rightmost leaf of `index`.
+    void set_rightmost(std::string_view index, node<key_type, data_type>* leaf) {
+        this->index_slots[resolve_index(index).id].rightmost = leaf;
+    }
+
+    /// Drop the tree of `index` (the caller owns the nodes); the name stays
+    /// interned so its handles remain valid.
+    void erase_tree(std::string_view index) {
+        if (const auto handle = find_index(index); handle.valid()) {
+            this->index_slots[handle.id].root = nullptr;
+            this->index_slots[handle.id].rightmost = nullptr;
+        }
     }
 
     /**
@@ -243,14 +462,13 @@ class grove {
      */
     node<key_type, data_type>* insert_root(std::string_view key) {
         // check if the root node is already in the map (error)
-        std::string key_str(key);
-        if(ggu::value_lookup(this->root_nodes, key_str)) {
-            throw std::runtime_error("Root node already exists for key: " + key_str);
+        if(get_root(key) != nullptr) {
+            throw std::runtime_error("Root node already exists for key: " + std::string(key));
         }
         node<key_type, data_type>* root = new node<key_type, data_type>(this->order);
-        this->root_nodes.insert({key_str, root});
         root->set_is_leaf(true);
-        this->rightmost_nodes.insert({key_str, root});
+        set_root(key, root);
+        set_rightmost(key, root);
         return root;
     }
 
@@ -317,11 +535,12 @@ class grove {
     /// Maximum number of keys per node (B+ tree order/capacity)
     int order;
 
-    /// Map from index names (e.g., chromosome names) to their root nodes
-    std::unordered_map<std::string, node<key_type, data_type>*, string_hash, std::equal_to<>> root_nodes;
+    /// Interned indices by handle id, each with its root and rightmost leaf
+    /// (the latter used for sorted insertion); a deque so a slot's name never moves
+    std::deque<index_slot> index_slots;
 
-    /// Cache of rightmost leaf nodes for each index (used for sorted insertion optimization)
-    std::unordered_map<std::string, node<key_type, data_type>*, string_hash, std::equal_to<>> rightmost_nodes;
+    /// Handle id of every interned index name
+    std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> index_ids;
 
     /// Deque storage for all indexed keys; provides stable pointers and better cache locality than individual allocations
     std::deque<gdt::key<key_type, data_type>> key_storage;
@@ -332,6 +551,9 @@ class grove {
     /// Count of leaf keys — excludes internal separator keys in key_storage
     size_t leaf_key_count = 0;
 
+    /// Data keys (indexed and external) by dense id; nullptr for ids of removed keys
+    std::vector<gdt::key<key_type, data_type>*> keys_by_id;
+
     /// Embedded graph overlay for managing directed edges and relationships between keys
     graph_overlay<key_type, data_type, edge_data_type> graph_data;
 };
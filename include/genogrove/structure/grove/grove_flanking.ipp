@@ -18,7 +18,10 @@ public:
      * For interval-like keys, picks the key with the smallest gap distance on each
      * side (max end for predecessor, min start for successor) — which can differ
      * from the sort-order extremum when intervals are nested. For scalar keys, sort-
-     * order extremum coincides with nearest-by-value.
+     * order extremum coincides with nearest-by-value. Stranded keys
+     * (genomic_coordinate) overlap only on a compatible strand, so a key on
+     * another strand that spatially overlaps the query — even one nested inside
+     * it — is a candidate on the side it sorts to.
      *
      * Distance is type-specific and computed by the caller from the returned values.
      *
@@ -69,6 +72,30 @@ public:
     [[nodiscard]] gdt::flanking_query_result<key_type, data_type>
     flanking(const key_type& query, std::string_view index,
              Pred is_compatible) const {
+        return this->flanking(query, this->find_index(index), is_compatible);
+    }
+
+    /**
+     * @brief flanking() on the index given by handle
+     * @param query The query key
+     * @param index Handle from resolve_index() / find_index()
+     * @return flanking_query_result; both fields nullptr for an invalid handle
+     */
+    [[nodiscard]] gdt::flanking_query_result<key_type, data_type>
+    flanking(const key_type& query, index_handle index) const {
+        return this->flanking(query, index,
+            [](const key_type&, const key_type&) constexpr noexcept { return true; });
+    }
+
+    /**
+     * @brief flanking() with a compatibility filter on the index given by handle
+     * @see flanking(const key_type&, std::string_view, Pred) const
+     */
+    template <typename Pred>
+        requires detail::flanking_predicate<Pred, key_type>
+    [[nodiscard]] gdt::flanking_query_result<key_type, data_type>
+    flanking(const key_type& query, index_handle index,
+             Pred is_compatible) const {
         gdt::flanking_query_result<key_type, data_type> result{};
         node<key_type, data_type>* root = this->get_root(index);
         if (root == nullptr) {
@@ -80,3 +107,132 @@ public:
         detail::search_flanking(res, root, query, is_compatible, result);
         return result;
     }
+
+    /**
+     * @brief flanking() for a batch of queries sorted in key order, answered by one
+     *        forward sweep over the index's leaf chain.
+     *
+     * `result[i]` is exactly `flanking(queries[i], index)`, stranded keys included
+     * (both follow the same overlap and ordering rules). Instead of one descent
+     * per query (each bounding its catch-all subtrees down the right spine), the
+     * sweep walks the keys once alongside the queries, keeping a running best-by-end
+     * for predecessors, so a closest-feature pass over a sorted VCF or BED costs one
+     * pass over the index however many queries it answers.
+     *
+     * @param queries Queries sorted by key_type::operator< (duplicates allowed)
+     * @param index The index name (e.g., chromosome) to search within
+     * @return One flanking_query_result per query, in input order; all null if the
+     *         index does not exist
+     * @throws std::invalid_argument if `queries` is not sorted
+     *
+     * @note Interval-like key types only, and no compatibility filter: a predicate
+     *       that depends on the query would defeat the shared running best. Use
+     *       flanking(const key_type&, std::string_view, Pred) const per query.
+     */
+    [[nodiscard]] std::vector<gdt::flanking_query_result<key_type, data_type>>
+    flanking_batch(std::span<const key_type> queries, std::string_view index) const
+        requires requires { key_type::is_interval; }
+    {
+        return this->flanking_batch(queries, this->find_index(index));
+    }
+
+    /**
+     * @brief flanking_batch() on the index given by handle
+     * @return One flanking_query_result per query; all null for an invalid handle
+     */
+    [[nodiscard]] std::vector<gdt::flanking_query_result<key_type, data_type>>
+    flanking_batch(std::span<const key_type> queries, index_handle index) const
+        requires requires { key_type::is_interval; }
+    {
+        if (!std::is_sorted(queries.begin(), queries.end())) {
+            throw std::invalid_argument("flanking_batch: queries must be sorted");
+        }
+        std::vector<gdt::flanking_query_result<key_type, data_type>> results;
+        detail::eager_resolver<key_type, data_type> res{};
+        detail::sweep_flanking(res, this->get_root(index), queries, results);
+        return results;
+    }
+
+    /**
+     * @brief Find the k nearest keys on each side of a query — the k-neighbor
+     *        generalization of flanking().
+     *
+     * Candidates follow flanking()'s rules: keys overlapping the query are skipped,
+     * predecessors are keys with `K < query` and successors keys with `K > query`.
+     * For plain intervals that means lying entirely before (`K.end < query.start`)
+     * or after (`K.start > query.end`) the query. Each list is ordered by gap
+     * distance, nearest first, equal gaps in sort order. A stranded key spatially
+     * overlapping the query on another strand sits at gap 0. With k = 1 and
+     * default options the lists hold exactly flanking()'s predecessor and
+     * successor.
+     *
+     * The descent keeps a bounded heap per side and prunes a subtree once it cannot
+     * beat the k-th best candidate (or lies beyond `options.max_distance`), so the
+     * cost grows with k rather than with the distance the neighbors are found at.
+     *
+     * @param query The query key
+     * @param index The index name (e.g., chromosome) to search within
+     * @param k Maximum number of neighbors per side
+     * @param options Sides to collect and an optional maximum gap
+     * @return nearest_query_result; both lists empty if the index does not exist
+     *         or k is 0
+     *
+     * @note Interval-like key types only (those exposing `is_interval`); scalar keys
+     *       have no gap distance to bound the search with.
+     */
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, std::string_view index, std::size_t k,
+            const nearest_options& options = {}) const
+        requires requires { key_type::is_interval; }
+    {
+        return this->nearest(query, this->find_index(index), k, options,
+            [](const key_type&, const key_type&) constexpr noexcept { return true; });
+    }
+
+    /**
+     * @brief nearest() with a caller-supplied compatibility filter, e.g. a strand
+     *        match as in flanking(const key_type&, std::string_view, Pred) const.
+     *
+     * Incompatible keys are skipped at the leaves and do not count towards k.
+     */
+    template <typename Pred>
+        requires detail::flanking_predicate<Pred, key_type> &&
+                 requires { key_type::is_interval; }
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, std::string_view index, std::size_t k,
+            const nearest_options& options, Pred is_compatible) const {
+        return this->nearest(query, this->find_index(index), k, options, is_compatible);
+    }
+
+    /**
+     * @brief nearest() on the index given by handle
+     * @return nearest_query_result; both lists empty for an invalid handle
+     */
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, index_handle index, std::size_t k,
+            const nearest_options& options = {}) const
+        requires requires { key_type::is_interval; }
+    {
+        return this->nearest(query, index, k, options,
+            [](const key_type&, const key_type&) constexpr noexcept { return true; });
+    }
+
+    /**
+     * @brief nearest() with a compatibility filter on the index given by handle
+     * @see nearest(const key_type&, std::string_view, std::size_t, const nearest_options&, Pred) const
+     */
+    template <typename Pred>
+        requires detail::flanking_predicate<Pred, key_type> &&
+                 requires { key_type::is_interval; }
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, index_handle index, std::size_t k,
+            const nearest_options& options, Pred is_compatible) const {
+        node<key_type, data_type>* root = this->get_root(index);
+        if (root == nullptr || k == 0) {
+            return {};
+        }
+        detail::nearest_state<key_type, data_type> state(k, options);
+        detail::eager_resolver<key_type, data_type> res{};
+        detail::search_nearest(res, root, query, is_compatible, state);
+        return state.take();
+    }
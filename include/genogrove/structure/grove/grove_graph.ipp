@@ -48,6 +48,19 @@ public:
         graph_data.add_edge(source, target, std::forward<M>(metadata));
     }
 
+    /**
+     * @brief Add a batch of edges (convenience forwarding to graph)
+     * @param edges Forward range of (source, target[, metadata]) tuples
+     * @param layout Representation to leave the graph in
+     * @return Number of edges added
+     * @see graph_overlay::add_edges
+     */
+    template<std::ranges::forward_range R>
+        requires bulk_edge<std::ranges::range_reference_t<R>>
+    std::size_t add_edges(R&& edges, edge_layout layout = edge_layout::list) {
+        return graph_data.add_edges(std::forward<R>(edges), layout);
+    }
+
     /**
      * @brief Get all neighbors of a key (convenience forwarding to graph)
      * @param source Pointer to source key
@@ -149,6 +162,172 @@ public:
         return graph_data.get_in_neighbors_if(target, predicate);
     }
 
+    /**
+     * @brief Lazy, allocation-free outgoing neighbors (convenience forwarding to graph)
+     * @param source Pointer to source key
+     * @return Range of target key pointers; invalidated by any edge mutation
+     */
+    [[nodiscard]] auto neighbors_view(const gdt::key<key_type, data_type>* source) const {
+        return graph_data.neighbors_view(source);
+    }
+
+    /**
+     * @brief Lazy, allocation-free incoming neighbors (convenience forwarding to graph)
+     * @param target Pointer to target key
+     * @return Range of source key pointers; invalidated by any edge mutation
+     */
+    [[nodiscard]] auto in_neighbors_view(const gdt::key<key_type, data_type>* target) const {
+        return graph_data.in_neighbors_view(target);
+    }
+
+    /**
+     * @brief Lazy outgoing edges as (target, metadata) pairs (convenience forwarding to graph)
+     * @param source Pointer to source key
+     * @return Range of graph_overlay::adjacent_edge; invalidated by any edge mutation
+     */
+    [[nodiscard]] auto out_edges_view(const gdt::key<key_type, data_type>* source) const {
+        return graph_data.out_edges_view(source);
+    }
+
+    /**
+     * @brief Lazy incoming edges as (source, metadata) pairs (convenience forwarding to graph)
+     * @param target Pointer to target key
+     * @return Range of graph_overlay::adjacent_edge; invalidated by any edge mutation
+     */
+    [[nodiscard]] auto in_edges_view(const gdt::key<key_type, data_type>* target) const {
+        return graph_data.in_edges_view(target);
+    }
+
+    /**
+     * @brief Lazy neighbors filtered by edge metadata (convenience forwarding to graph)
+     * @param source Pointer to source key
+     * @param predicate Function to filter edges by metadata
+     * @return Range of target key pointers whose edge metadata satisfies predicate
+     */
+    template<typename Predicate>
+    [[nodiscard]] auto neighbors_if_view(const gdt::key<key_type, data_type>* source,
+                                         Predicate predicate) const
+        requires (!std::is_void_v<edge_data_type> && std::predicate<Predicate, const edge_data_type&>) {
+        return graph_data.neighbors_if_view(source, std::move(predicate));
+    }
+
+    /**
+     * @brief Lazy in-neighbors filtered by edge metadata (convenience forwarding to graph)
+     * @param target Pointer to target key
+     * @param predicate Function to filter edges by metadata
+     * @return Range of source key pointers whose edge metadata satisfies predicate
+     */
+    template<typename Predicate>
+    [[nodiscard]] auto in_neighbors_if_view(const gdt::key<key_type, data_type>* target,
+                                            Predicate predicate) const
+        requires (!std::is_void_v<edge_data_type> && std::predicate<Predicate, const edge_data_type&>) {
+        return graph_data.in_neighbors_if_view(target, std::move(predicate));
+    }
+
+    /**
+     * @brief Breadth-first walk over outgoing edges (convenience forwarding to graph)
+     * @param start Key to start from, visited at depth 0
+     * @param visit visit(key, depth) per reachable key; returning false prunes that key
+     * @param max_depth Hop bound
+     */
+    template<typename Visitor>
+        requires detail::traversal_visitor<Visitor, gdt::key<key_type, data_type>*>
+    void bfs(gdt::key<key_type, data_type>* start, Visitor visit,
+             std::size_t max_depth = unbounded_depth) const {
+        graph_data.bfs(start, std::move(visit), max_depth);
+    }
+
+    /**
+     * @brief Depth-first walk over outgoing edges (convenience forwarding to graph)
+     * @param start Key to start from, visited at depth 0
+     * @param visit visit(key, depth) per reachable key; returning false prunes that key
+     * @param max_depth Bound on the DFS tree depth
+     */
+    template<typename Visitor>
+        requires detail::traversal_visitor<Visitor, gdt::key<key_type, data_type>*>
+    void dfs(gdt::key<key_type, data_type>* start, Visitor visit,
+             std::size_t max_depth = unbounded_depth) const {
+        graph_data.dfs(start, std::move(visit), max_depth);
+    }
+
+    /**
+     * @brief Keys within `k` hops of `start` (convenience forwarding to graph)
+     * @param start Key to start from (not included)
+     * @param k Hop bound
+     * @return Keys in BFS order
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> k_hop(
+        gdt::key<key_type, data_type>* start, std::size_t k) const {
+        return graph_data.k_hop(start, k);
+    }
+
+    /**
+     * @brief Simple paths between two keys (convenience forwarding to graph)
+     * @param from First key of each path
+     * @param to Last key of each path
+     * @param max_paths Stop after this many paths
+     * @param max_depth Longest path to consider, in edges
+     * @return Paths as key sequences, in depth-first edge order
+     */
+    [[nodiscard]] std::vector<std::vector<gdt::key<key_type, data_type>*>> all_paths(
+        gdt::key<key_type, data_type>* from, gdt::key<key_type, data_type>* to,
+        std::size_t max_paths, std::size_t max_depth = unbounded_depth) const {
+        return graph_data.all_paths(from, to, max_paths, max_depth);
+    }
+
+    /**
+     * @brief Topological order of the keys reachable from `roots` (convenience forwarding to graph)
+     * @param roots Keys to start from
+     * @return Every reachable key once, each before all of its targets
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> topological_order(
+        std::span<gdt::key<key_type, data_type>* const> roots) const {
+        return graph_data.topological_order(roots);
+    }
+
+    /**
+     * @brief Topological order of every key with an edge (convenience forwarding to graph)
+     * @return Every key with an edge once, each before all of its targets
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> topological_order() const {
+        return graph_data.topological_order();
+    }
+
+    /**
+     * @brief Weakly connected components of the graph (convenience forwarding to graph)
+     * @param num_threads Worker count (0 = one per core)
+     * @return Every key with an edge and its component label
+     * @see graph_overlay::weakly_connected_components
+     */
+    [[nodiscard]] graph_components<gdt::key<key_type, data_type>*> weakly_connected_components(
+        std::size_t num_threads = 1) const {
+        return graph_data.weakly_connected_components(num_threads);
+    }
+
+    /**
+     * @brief Keys reachable from any of `sources` (convenience forwarding to graph)
+     * @param sources Keys to start from
+     * @param num_threads Worker count (0 = one per core)
+     * @return The sources, then every other reachable key
+     * @see graph_overlay::reachable
+     */
+    [[nodiscard]] std::vector<gdt::key<key_type, data_type>*> reachable(
+        std::span<gdt::key<key_type, data_type>* const> sources, std::size_t num_threads = 1) const {
+        return graph_data.reachable(sources, num_threads);
+    }
+
+    /**
+     * @brief PageRank-style score of every key with an edge (convenience forwarding to graph)
+     * @param options Damping factor, iteration bound and convergence tolerance
+     * @param num_threads Worker count (0 = one per core)
+     * @return Every key with an edge and its score
+     * @see graph_overlay::rank_vertices
+     */
+    [[nodiscard]] graph_scores<gdt::key<key_type, data_type>*> rank_vertices(
+        const ranking_options& options = {}, std::size_t num_threads = 1) const {
+        return graph_data.rank_vertices(options, num_threads);
+    }
+
     /**
      * @brief Check if edge exists between two keys (convenience forwarding to graph)
      * @param source Pointer to source key
@@ -225,6 +404,73 @@ public:
         return key_storage.size();
     }
 
+    /**
+     * @brief Get the dense id of a data key owned by this grove
+     *
+     * Every data key — indexed (`insert_data`) or external
+     * (`add_external_key`) — gets the next id 0, 1, 2, ... when it is created.
+     * Ids are stable: they survive `compact()` and are never reused, although
+     * removal leaves holes. Deserializing renumbers the keys densely in file
+     * order. Use ids to keep per-key data in flat arrays (`make_key_array`)
+     * instead of hash maps keyed by pointer.
+     *
+     * @param k Pointer to a data key of this grove
+     * @return The key's id, in [0, id_count())
+     * @throws std::invalid_argument if `k` is null, a separator, removed, or
+     *         owned by another grove
+     */
+    [[nodiscard]] std::uint32_t id_of(const gdt::key<key_type, data_type>* k) const {
+        if (k == nullptr) {
+            throw std::invalid_argument("id_of: null key");
+        }
+        const auto id = k->get_id();
+        if (id >= keys_by_id.size() || keys_by_id[id] != k) {
+            throw std::invalid_argument("id_of: key is not a live data key of this grove");
+        }
+        return id;
+    }
+
+    /**
+     * @brief Get the data key with a given id
+     * @param id A key id, in [0, id_count())
+     * @return The key, or nullptr if it has been removed
+     * @throws std::out_of_range if `id` was never assigned
+     */
+    [[nodiscard]] gdt::key<key_type, data_type>* key_at(std::uint32_t id) const {
+        if (id >= keys_by_id.size()) {
+            throw std::out_of_range("key_at: invalid key id " + std::to_string(id));
+        }
+        return keys_by_id[id];
+    }
+
+    /**
+     * @brief Get the number of key ids assigned so far
+     * @return One past the largest id; equals `vertex_count()` until keys are
+     *         removed
+     */
+    [[nodiscard]] size_t id_count() const noexcept {
+        return keys_by_id.size();
+    }
+
+    /**
+     * @brief Allocate a flat per-key side array indexed by key id
+     *
+     * @code
+     * auto depth = grove.make_key_array<std::uint32_t>();
+     * for (auto* k : grove.intersect(query, "chr1").get_keys()) {
+     *     ++depth[grove.id_of(k)];
+     * }
+     * @endcode
+     *
+     * @param init Initial value of every element
+     * @return A vector of `id_count()` copies of `init`; keys added later need
+     *         a resize
+     */
+    template <typename T>
+    [[nodiscard]] std::vector<T> make_key_array(const T& init = T{}) const {
+        return std::vector<T>(keys_by_id.size(), init);
+    }
+
     /**
      * @brief Add an external (graph-only) key with associated data
      * @param key_value The key value (e.g., interval)
@@ -248,7 +494,7 @@ public:
     gdt::key<key_type, data_type>* add_external_key(key_type key_value, D data_value)
         requires (!std::is_void_v<data_type>) {
         external_key_storage.emplace_back(std::move(key_value), std::move(data_value));
-        return &external_key_storage.back();
+        return number_key(&external_key_storage.back());
     }
 
     /**
@@ -262,7 +508,7 @@ public:
     gdt::key<key_type, data_type>* add_external_key(key_type key_value)
         requires (std::is_void_v<data_type>) {
         external_key_storage.emplace_back(std::move(key_value));
-        return &external_key_storage.back();
+        return number_key(&external_key_storage.back());
     }
 
     /**
@@ -330,6 +576,30 @@ public:
         return graph_data.empty();
     }
 
+    /**
+     * @brief Freeze the graph into CSR adjacency for read-only traversal (convenience forwarding to graph)
+     * @note Every graph read accessor keeps its results; the next edge mutation
+     *       thaws the graph again (see graph_overlay::freeze)
+     */
+    void freeze_graph() {
+        graph_data.freeze();
+    }
+
+    /**
+     * @brief Convert a frozen graph back to its mutable form (convenience forwarding to graph)
+     */
+    void thaw_graph() {
+        graph_data.thaw();
+    }
+
+    /**
+     * @brief Check whether the graph is frozen (convenience forwarding to graph)
+     * @return true if the graph currently answers reads from CSR adjacency
+     */
+    [[nodiscard]] bool graph_frozen() const {
+        return graph_data.is_frozen();
+    }
+
     /**
      * @brief Create edges between adjacent keys based on a predicate
      * @tparam Predicate A callable type that takes two adjacent key pointers
@@ -22,6 +22,24 @@ public:
         key_type key_value,
         D data_value,
         sorted_t) requires(!std::is_void_v<data_type>) {
+        return insert_data(this->resolve_index(index), key_value, data_value, sorted);
+    }
+
+    /**
+     * @brief Sorted insertion into an index given by handle
+     * @param index Handle from resolve_index()
+     * @param key_value The key value to insert (e.g., interval)
+     * @param data_value The data associated with the key
+     * @return Pointer to the inserted key in the tree
+     * @throws std::out_of_range if the handle does not belong to this grove
+     * @see insert_data(std::string_view, key_type, D, sorted_t)
+     */
+    template <typename D = data_type>
+    gdt::key<key_type, data_type>* insert_data(
+        index_handle index,
+        key_type key_value,
+        D data_value,
+        sorted_t) requires(!std::is_void_v<data_type>) {
         return insert_data_sorted(index, key_value, data_value);
     }
 
@@ -42,6 +60,24 @@ public:
             return insert(index, key);
         }
 
+    /**
+     * @brief Tree-based insertion into an index given by handle
+     * @param index Handle from resolve_index()
+     * @param key_value The key value to insert (e.g., interval)
+     * @param data_value The data associated with the key
+     * @return Pointer to the inserted key in the tree
+     * @throws std::out_of_range if the handle does not belong to this grove
+     * @see insert_data(std::string_view, key_type, D)
+     */
+    template <typename D = data_type>
+    gdt::key<key_type, data_type>* insert_data(
+        index_handle index,
+        key_type key_value,
+        D data_value) requires (!std::is_void_v<data_type>) {
+            gdt::key<key_type, data_type> key(key_value, data_value);
+            return insert(index, key);
+        }
+
     /**
      * @brief Bulk insert pre-sorted data using hybrid bottom-up/append approach
      * @tparam Container A container type holding pairs of (key_type, data_type)
@@ -87,13 +123,12 @@ public:
             auto* existing_root = this->get_root(index);
             if (existing_root != nullptr) {
                 old_root.reset(existing_root);
-                this->root_nodes.erase(index_key);
-                this->rightmost_nodes.erase(index_key);
+                this->erase_tree(index_key);
             }
 
             auto [new_root, keys] = build_tree_bottom_up(index_key, data);
             if (new_root != nullptr) {
-                this->root_nodes[index_key] = new_root;
+                this->set_root(index_key, new_root);
             }
             return keys;
         }
@@ -105,8 +140,7 @@ public:
 
         for (const auto& [key_value, data_value] : data) {
             gdt::key<key_type, data_type> key(key_value, data_value);
-            auto* key_ptr = allocate_key(key);
-            ++this->leaf_key_count;
+            auto* key_ptr = allocate_data_key(key);
             current_node->insert_key_ptr(key_ptr);
             inserted_keys.push_back(key_ptr);
 
@@ -171,6 +205,125 @@ public:
         return insert_data(index, data, sorted, bulk);
     }
 
+    /**
+     * @brief Build a k-mer index from raw 2-bit encodings in one pass
+     * @param index The index name (must be empty)
+     * @param encodings K-mer encodings, in any order and with duplicates (e.g.
+     *        from gdt::collect_kmer_encodings()); consumed
+     * @param k K-mer length of every encoding (1-32)
+     * @return Pointers to the inserted keys, one per distinct k-mer, ascending
+     * @throws std::invalid_argument if k is out of range or the index already
+     *         holds keys
+     *
+     * Sorts the encodings with a radix sort over their 2·k significant bits,
+     * collapses duplicates and builds the tree bottom-up, so no key is ever
+     * inserted individually. For a dataless grove the keys are the distinct
+     * k-mers; for an arithmetic data type each key's data is the number of
+     * times its k-mer occurred.
+     *
+     * Example usage:
+     * @code
+     * gst::grove<gdt::kmer, uint32_t> counts(64);
+     * std::vector<uint64_t> encodings;
+     * io::fasta_reader reader(path);
+     * gdt::collect_kmer_encodings(reader, 31, encodings, {.canonical = true});
+     * counts.insert_kmers("genome", std::move(encodings), 31);
+     * @endcode
+     */
+    std::vector<gdt::key<key_type, data_type>*> insert_kmers(std::string_view index,
+        std::vector<uint64_t> encodings, uint8_t k)
+        requires (std::same_as<key_type, gdt::kmer> &&
+                 (std::is_void_v<data_type> || std::is_arithmetic_v<data_type>)) {
+        if (k == 0 || k > gdt::kmer::max_k) {
+            throw std::invalid_argument("insert_kmers: k must be in [1, 32]");
+        }
+        require_empty_kmer_index(index);
+        if (encodings.empty()) return {};
+
+        mask_kmer_encodings(encodings, k);
+        ggu::radix_sort(encodings, 2u * k);
+        std::vector<gdt::key<key_type, data_type>*> keys;
+        build_kmer_tree(index, encodings, k, keys);
+        return keys;
+    }
+
+    /**
+     * @brief Build a k-mer index spread over minimizer buckets
+     * @param prefix Index name prefix; bucket b is the index
+     *        `gdt::kmer_bucketing::index_name(prefix, b)`
+     * @param encodings K-mer encodings of length `bucketing.k`, in any order and
+     *        with duplicates; consumed
+     * @param bucketing Bucketing parameters (k, minimizer length, bucket count)
+     * @param num_threads Worker count for bucketing and sorting (0 = hardware
+     *        concurrency)
+     * @return Pointers to the inserted keys, bucket by bucket, ascending within
+     *         each bucket
+     * @throws std::invalid_argument if the bucketing is invalid or any bucket
+     *         index already holds keys
+     *
+     * Like insert_kmers(index, encodings, k), but each k-mer goes to the index
+     * of its minimizer's bucket instead of one shared tree. Buckets are
+     * ordinary grove indices, so every query API works on them: route a
+     * k-mer with `bucketing.index_for(prefix, kmer)`. Bucketing and the
+     * per-bucket radix sorts run in parallel; the trees are then built one
+     * bucket at a time.
+     *
+     * Example usage:
+     * @code
+     * const gdt::kmer_bucketing bucketing{.k = 31, .m = 15, .buckets = 1024, .canonical = true};
+     * grove.insert_kmers("genome", std::move(encodings), bucketing, 0);
+     * auto hit = grove.intersect(query, bucketing.index_for("genome", query));
+     * @endcode
+     */
+    std::vector<gdt::key<key_type, data_type>*> insert_kmers(std::string_view prefix,
+        std::vector<uint64_t> encodings, const gdt::kmer_bucketing& bucketing, size_t num_threads = 1)
+        requires (std::same_as<key_type, gdt::kmer> &&
+                 (std::is_void_v<data_type> || std::is_arithmetic_v<data_type>)) {
+        bucketing.validate();
+        for (uint32_t b = 0; b < bucketing.buckets; ++b) {
+            require_empty_kmer_index(gdt::kmer_bucketing::index_name(prefix, b));
+        }
+        if (encodings.empty()) return {};
+
+        const uint8_t k = bucketing.k;
+        mask_kmer_encodings(encodings, k);
+
+        // Bucket every k-mer, then counting-sort the encodings by bucket.
+        constexpr size_t chunk = size_t{1} << 16;
+        const size_t n = encodings.size();
+        std::vector<uint32_t> bucket_of(n);
+        ggu::parallel_for((n + chunk - 1) / chunk, num_threads, [&](size_t c) {
+            for (size_t i = c * chunk; i < std::min(n, (c + 1) * chunk); ++i) {
+                bucket_of[i] = bucketing.bucket_of(gdt::kmer(encodings[i], k));
+            }
+        });
+        std::vector<size_t> offsets(size_t{bucketing.buckets} + 1, 0);
+        for (const auto b : bucket_of) ++offsets[b + 1];
+        for (size_t b = 1; b < offsets.size(); ++b) offsets[b] += offsets[b - 1];
+        std::vector<uint64_t> partitioned(n);
+        {
+            std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < n; ++i) partitioned[fill[bucket_of[i]]++] = encodings[i];
+        }
+        std::vector<uint64_t>().swap(encodings);
+        std::vector<uint32_t>().swap(bucket_of);
+
+        auto segment = [&](size_t b) {
+            return std::span<uint64_t>(partitioned).subspan(offsets[b], offsets[b + 1] - offsets[b]);
+        };
+        ggu::parallel_for(bucketing.buckets, num_threads, [&](size_t b) {
+            ggu::radix_sort(segment(b), 2u * k);
+        });
+
+        std::vector<gdt::key<key_type, data_type>*> keys;
+        for (uint32_t b = 0; b < bucketing.buckets; ++b) {
+            if (offsets[b + 1] != offsets[b]) {
+                build_kmer_tree(gdt::kmer_bucketing::index_name(prefix, b), segment(b), k, keys);
+            }
+        }
+        return keys;
+    }
+
     /**
      * @brief Insert a key into the grove at the specified index
      * @param index The index name (e.g., chromosome name) where the key should be inserted
@@ -180,17 +333,30 @@ public:
      * @note Creates a new root if index doesn't exist; handles node splits automatically
      */
     gdt::key<key_type, data_type>* insert(std::string_view index, const gdt::key<key_type, data_type>& key) {
+        return insert(this->resolve_index(index), key);
+    }
+
+    /**
+     * @brief Insert a key into the index given by handle
+     * @param index Handle from resolve_index()
+     * @param key The key object to insert
+     * @return Pointer to the inserted key in the tree
+     * @throws std::out_of_range if the handle does not belong to this grove
+     * @throws std::runtime_error if insertion fails
+     */
+    gdt::key<key_type, data_type>* insert(index_handle index, const gdt::key<key_type, data_type>& key) {
         // get the root node for the given chromosome (or create a new one if it doesn't exist)
-        node<key_type, data_type>* root = this->get_root(index);
+        index_slot& slot = this->checked_slot(index);
+        node<key_type, data_type>* root = slot.root;
         if(root == nullptr) {
-            root = this->insert_root(index);
+            root = this->insert_root(slot.name);
         }
-        auto* key_ptr = insert_iter(root, key, index);
+        auto* key_ptr = insert_iter(root, key, slot.name);
         if(key_ptr == nullptr) {
             throw std::runtime_error("Failed to insert key into tree");
         }
         if(root->get_keys().size() == this->order) {
-            root = promote_new_root(root, index, /*sorted_append=*/false);
+            root = promote_new_root(root, slot.name, /*sorted_append=*/false);
         }
         return key_ptr;
     }
@@ -205,9 +371,89 @@ private:
      */
     gdt::key<key_type, data_type>* allocate_key(const gdt::key<key_type, data_type>& key) {
         key_storage.push_back(key);
+        key_storage.back().set_id(gdt::no_key_id);  // a copy must not claim its source's id
         return &key_storage.back();
     }
 
+    /**
+     * @brief allocate_key() for a leaf data key: also counts it and gives it
+     *        the next dense id (see id_of)
+     */
+    gdt::key<key_type, data_type>* allocate_data_key(const gdt::key<key_type, data_type>& key) {
+        auto* key_ptr = number_key(allocate_key(key));
+        ++this->leaf_key_count;
+        return key_ptr;
+    }
+
+    /// @throws std::invalid_argument if `index` already holds keys
+    void require_empty_kmer_index(std::string_view index) const {
+        const auto* existing = this->get_root(index);
+        if (existing != nullptr && !existing->get_keys().empty()) {
+            throw std::invalid_argument("insert_kmers: index already holds keys");
+        }
+    }
+
+    /// Clear the bits above 2·k so equal k-mers have equal encodings.
+    static void mask_kmer_encodings(std::span<uint64_t> encodings, uint8_t k) noexcept {
+        if (k < gdt::kmer::max_k) {
+            const uint64_t mask = (uint64_t{1} << (2u * k)) - 1;
+            for (auto& e : encodings) e &= mask;
+        }
+    }
+
+    /**
+     * @brief Build `index` from sorted encodings, one key per distinct k-mer
+     *        (data = occurrence count for arithmetic data), appending the
+     *        keys to `keys`. Replaces an existing empty root.
+     */
+    void build_kmer_tree(std::string_view index, std::span<const uint64_t> sorted, uint8_t k,
+                         std::vector<gdt::key<key_type, data_type>*>& keys) {
+        // Run boundaries: runs[i] is the first position of the i-th distinct k-mer.
+        std::vector<size_t> runs;
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            if (i == 0 || sorted[i] != sorted[i - 1]) runs.push_back(i);
+        }
+        runs.push_back(sorted.size());
+
+        const std::string index_key(index);
+        std::unique_ptr<node<key_type, data_type>> old_root(this->get_root(index));
+        this->erase_tree(index_key);
+
+        size_t run = 0;
+        auto [new_root, built] = build_tree_bottom_up(index_key, runs.size() - 1, [&] {
+            const gdt::kmer value(sorted[runs[run]], k);
+            const size_t occurrences = runs[run + 1] - runs[run];
+            ++run;
+            if constexpr (std::is_void_v<data_type>) {
+                return gdt::key<key_type, data_type>(value);
+            } else {
+                return gdt::key<key_type, data_type>(value, static_cast<data_type>(occurrences));
+            }
+        });
+        this->set_root(index_key, new_root);
+        keys.insert(keys.end(), built.begin(), built.end());
+    }
+
+    /**
+     * @brief Give `k` the next dense id and record it in keys_by_id
+     * @throws std::runtime_error if the 32-bit id space is exhausted
+     */
+    gdt::key<key_type, data_type>* number_key(gdt::key<key_type, data_type>* k) {
+        if (keys_by_id.size() >= gdt::no_key_id) {
+            throw std::runtime_error("grove: key id space exhausted");
+        }
+        k->set_id(static_cast<std::uint32_t>(keys_by_id.size()));
+        keys_by_id.push_back(k);
+        return k;
+    }
+
+    /// Retire the id of a removed data key; the id is not reused.
+    void release_key_id(const gdt::key<key_type, data_type>* k) noexcept {
+        if (k->get_id() < keys_by_id.size() && keys_by_id[k->get_id()] == k) {
+            keys_by_id[k->get_id()] = nullptr;
+        }
+    }
+
     /**
      * @brief Recursively insert a key into the tree starting from a given node
      * @param node The node to start insertion from
@@ -222,8 +468,7 @@ private:
             throw std::runtime_error("Null node passed to insert_iter");
         }
         if(node->get_is_leaf()) {
-            auto* key_ptr = allocate_key(key);
-            ++this->leaf_key_count;
+            auto* key_ptr = allocate_data_key(key);
             node->insert_key_ptr(key_ptr);
             node->refresh_subtree_max();
             return key_ptr;
@@ -360,10 +605,9 @@ private:
         released->set_next(child->get_next());
         child->set_next(released);
 
-        // Update rightmost node cache if the split leaf was the rightmost (O(1) lookup)
-        if (auto it = this->rightmost_nodes.find(index_name);
-            it != this->rightmost_nodes.end() && it->second == child) {
-            it->second = released;
+        // Update rightmost node cache if the split leaf was the rightmost
+        if (this->get_rightmost_node(index_name) == child) {
+            this->set_rightmost(index_name, released);
         }
     }
 
@@ -446,7 +690,7 @@ private:
         old_root->set_parent(new_root);
         split_node(new_root, 0, index, sorted_append);
         new_root->refresh_subtree_max();
-        this->root_nodes[std::string(index)] = new_root;
+        this->set_root(index, new_root);
         return new_root;
     }
 
@@ -476,7 +720,7 @@ private:
 
     /**
      * @brief Insert a pre-sorted data point into the grove using optimized sorted insertion
-     * @param index The index name (e.g., chromosome name) where the data should be inserted
+     * @param index Handle of the index where the data should be inserted
      * @param key_value The key value to insert (e.g., interval)
      * @param data_value The data associated with the key
      * @return Pointer to the inserted key in the tree
@@ -484,7 +728,7 @@ private:
      * @note This is a helper function called by insert_data(..., sorted_t)
      */
     template <typename D = data_type>
-    gdt::key<key_type, data_type>* insert_data_sorted(std::string_view index, key_type key_value, D data_value)
+    gdt::key<key_type, data_type>* insert_data_sorted(index_handle index, key_type key_value, D data_value)
         requires (!std::is_void_v<data_type>) {
             gdt::key<key_type, data_type> key(key_value, data_value); // create the key object
             return insert_sorted(index, key);
@@ -492,38 +736,37 @@ private:
 
     /**
      * @brief Insert a pre-sorted key directly to the rightmost leaf node for optimal performance
-     * @param index The index name (e.g., chromosome name) where the key should be inserted
+     * @param index Handle of the index where the key should be inserted
      * @param key The key object to insert
      * @return Pointer to the inserted key in the tree
+     * @throws std::out_of_range if the handle does not belong to this grove
      * @note Assumes key is greater than all existing keys in the index; bypasses tree traversal
      * @note Significantly faster than regular insert() for sorted data
      */
-    gdt::key<key_type, data_type>* insert_sorted(std::string_view index, const gdt::key<key_type, data_type>& key) {
-        node<key_type, data_type>* root = this->get_root(index);
+    gdt::key<key_type, data_type>* insert_sorted(index_handle index, const gdt::key<key_type, data_type>& key) {
+        index_slot& slot = this->checked_slot(index);
+        node<key_type, data_type>* root = slot.root;
         if(root == nullptr) {
-            root = this->insert_root(index);
+            root = this->insert_root(slot.name);
             // Allocate key from grove's deque storage
-            auto* key_ptr = allocate_key(key);
-            ++this->leaf_key_count;
+            auto* key_ptr = allocate_data_key(key);
             root->insert_key_ptr(key_ptr);
             root->refresh_subtree_max();
             return key_ptr;
         } else {
             // get rightmost node and insert
-            node<key_type, data_type>* rightmost_node = this->get_rightmost_node(index);
+            node<key_type, data_type>* rightmost_node = slot.rightmost;
             // Allocate key from grove's deque storage
-            auto* key_ptr = allocate_key(key);
-            ++this->leaf_key_count;
+            auto* key_ptr = allocate_data_key(key);
             rightmost_node->insert_key_ptr(key_ptr);
 
             // Handle overflow, then refresh the spine the appended key just
-            // raised. The rightmost leaf is only re-looked-up when a split
-            // actually moved it — that map lookup on every key was a
-            // measurable share of this path's cost.
+            // raised. The rightmost leaf is only re-read when a split
+            // actually moved it.
             node<key_type, data_type>* tail = rightmost_node;
             if (rightmost_node->get_keys().size() == this->order) {
-                cascade_split_sorted_append(rightmost_node, index);
-                tail = this->get_rightmost_node(index);
+                cascade_split_sorted_append(rightmost_node, slot.name);
+                tail = slot.rightmost;
             }
             refresh_subtree_max_upward(tail);
             return key_ptr;
@@ -547,35 +790,48 @@ private:
     build_tree_bottom_up(std::string_view index, const Container& data)
         requires (!std::is_void_v<data_type> &&
                  std::ranges::forward_range<Container> && std::ranges::sized_range<Container>) {
+        auto it = data.begin();
+        return build_tree_bottom_up(index, data.size(), [&it] {
+            gdt::key<key_type, data_type> key(it->first, it->second);
+            ++it;
+            return key;
+        });
+    }
+
+    /**
+     * @brief build_tree_bottom_up() over keys produced on demand
+     * @param index The index name for which to build the tree
+     * @param count Number of keys
+     * @param next_key Called `count` times; returns the keys in sorted order
+     */
+    template<typename next_key_fn>
+    std::pair<node<key_type, data_type>*, std::vector<gdt::key<key_type, data_type>*>>
+    build_tree_bottom_up(std::string_view index, size_t count, next_key_fn&& next_key) {
 
         std::vector<gdt::key<key_type, data_type>*> inserted_keys;
-        if (data.empty()) {
+        if (count == 0) {
             return {nullptr, inserted_keys};
         }
 
         // Step 1: Create leaf nodes from sorted data
         // RAII: unique_ptrs own nodes until the root is returned
         std::vector<std::unique_ptr<node<key_type, data_type>>> leaves;
-        inserted_keys.reserve(data.size());
+        inserted_keys.reserve(count);
 
         // Spread the data evenly across leaves — a greedy (order-1)-per-leaf
         // packing could leave the final leaf underfull (below leaf_min_keys).
         const detail::even_distribution leaf_dist =
-            detail::distribute_evenly(data.size(), static_cast<size_t>(this->order - 1));
+            detail::distribute_evenly(count, static_cast<size_t>(this->order - 1));
 
-        auto it = data.begin();
         for (size_t leaf_idx = 0; leaf_idx < leaf_dist.num_groups; ++leaf_idx) {
             auto leaf = std::make_unique<node<key_type, data_type>>(this->order);
             leaf->set_is_leaf(true);
 
             const size_t keys_in_this_leaf = leaf_dist.count_for(leaf_idx);
             for (size_t i = 0; i < keys_in_this_leaf; ++i) {
-                gdt::key<key_type, data_type> key(it->first, it->second);
-                auto* key_ptr = allocate_key(key);
-                ++this->leaf_key_count;
+                auto* key_ptr = allocate_data_key(next_key());
                 leaf->get_keys().push_back(key_ptr);
                 inserted_keys.push_back(key_ptr);
-                ++it;
             }
 
             leaf->refresh_subtree_max();
@@ -664,6 +920,6 @@ private:
         }
 
         // Build succeeded — publish rightmost leaf and release root to caller
-        this->rightmost_nodes[std::string(index)] = rightmost_leaf;
+        this->set_rightmost(index, rightmost_leaf);
         return {current_layer[0].release(), std::move(inserted_keys)};
     }
\ No newline at end of file
@@ -31,6 +31,17 @@ public:
      * @note Returns empty result if index doesn't exist
      */
     [[nodiscard]] gdt::query_result<key_type, data_type> intersect(const key_type& query, std::string_view index) {
+        return intersect(query, this->find_index(index));
+    }
+
+    /**
+     * @brief Find all keys that overlap with the query in the index given by handle
+     * @param query The query key to search for (e.g., genomic interval)
+     * @param index Handle from resolve_index() / find_index()
+     * @return query_result containing all overlapping keys from that index
+     * @note Returns empty result for an invalid handle or an empty index
+     */
+    [[nodiscard]] gdt::query_result<key_type, data_type> intersect(const key_type& query, index_handle index) {
         gdt::query_result<key_type, data_type> result{query};
         node<key_type, data_type>* root = this->get_root(index);
 
@@ -40,4 +51,171 @@ public:
         detail::eager_resolver<key_type, data_type> res{};
         detail::search_overlaps(res, root, query, result);
         return result;
-    }
\ No newline at end of file
+    }
+
+    /**
+     * @brief Look up every k-mer of a read in one pass over an index
+     *
+     * Extracts the read's k-mers with the rolling kmer_extractor, sorts and
+     * deduplicates them, and resolves the sorted batch in a single descent:
+     * each internal node splits the batch among its children by separator,
+     * so nodes shared by several k-mers are visited once, and each leaf is
+     * searched from where the previous k-mer was found. A k-mer occurring
+     * several times in the read is searched for once. No per-k-mer
+     * query_result is allocated.
+     *
+     * @param index The index name to search
+     * @param read The read sequence; windows with non-ACGT bases are skipped
+     * @param k K-mer length (1-32)
+     * @param options Extraction options (e.g. canonical k-mers, if the index
+     *        holds canonical k-mers)
+     * @return One match per (read position, equal key) pair, ordered by read
+     *         position; the key's data is the payload
+     * @throws std::invalid_argument if k is out of range
+     * @note Read-only; safe to call from several threads at once as long as
+     *       no thread modifies the grove.
+     */
+    [[nodiscard]] std::vector<gdt::kmer_match<gdt::key<key_type, data_type>*>> lookup_kmers(
+        std::string_view index, std::string_view read, uint8_t k,
+        gdt::kmer_extractor_options options = gdt::kmer_extractor_options::defaults()) const
+        requires std::same_as<key_type, gdt::kmer> {
+        std::vector<gdt::kmer_match<gdt::key<key_type, data_type>*>> matches;
+        std::vector<std::pair<uint64_t, size_t>> batch;  // (encoding, read position)
+        for (const auto& hit : gdt::kmer_extractor(read, k, options)) {
+            batch.emplace_back(hit.value.get_encoding(), hit.position);
+        }
+        const node<key_type, data_type>* root = this->get_root(index);
+        if (root == nullptr || batch.empty()) return matches;
+        std::sort(batch.begin(), batch.end());
+
+        std::vector<uint64_t> distinct;
+        std::vector<size_t> first_occurrence;  // start of each distinct k-mer's run in batch
+        for (size_t b = 0; b < batch.size(); ++b) {
+            if (b == 0 || batch[b].first != batch[b - 1].first) {
+                distinct.push_back(batch[b].first);
+                first_occurrence.push_back(b);
+            }
+        }
+        first_occurrence.push_back(batch.size());
+
+        std::vector<std::pair<size_t, gdt::key<key_type, data_type>*>> found;  // (distinct index, key)
+        match_sorted_kmers(root, distinct, 0, k, found);
+        for (const auto& [d, key] : found) {
+            for (size_t b = first_occurrence[d]; b < first_occurrence[d + 1]; ++b) {
+                matches.push_back({batch[b].second, key});
+            }
+        }
+        std::stable_sort(matches.begin(), matches.end(),
+                         [](const auto& a, const auto& b) { return a.position < b.position; });
+        return matches;
+    }
+
+    /**
+     * @brief Overlap query followed by graph expansion, as one call
+     *
+     * Finds every key in `index` overlapping `query`, then expands from those
+     * keys along outgoing edges as described by `spec` (hop bound, edge
+     * filter, optional target region) — see graph_overlay::expand. Freeze the
+     * graph first (freeze_graph()) to dedup visited keys with a bitmap over
+     * vertex ids rather than a hash set.
+     *
+     * @param query The query key (e.g., genomic interval)
+     * @param index The index name (e.g., chromosome name) to search within
+     * @param spec Expansion parameters; the default follows every edge one hop
+     * @return Overlapping keys at depth 0, then reached keys in breadth-first order
+     * @note Returns an empty result if the index doesn't exist
+     */
+    template<typename EdgeFilter = follow_every_edge>
+        requires std::predicate<const EdgeFilter&,
+                                const typename graph_overlay<key_type, data_type, edge_data_type>::metadata_type&>
+    [[nodiscard]] gdt::expansion_result<key_type, data_type> intersect_expand(
+        const key_type& query, std::string_view index,
+        const expansion_spec<key_type, EdgeFilter>& spec = {}) {
+        gdt::expansion_result<key_type, data_type> result{query};
+        const auto seeds = intersect(query, index);
+        graph_data.expand(std::span(seeds.get_keys()), spec, result);
+        return result;
+    }
+
+    /**
+     * @brief Overlap query across all indices followed by graph expansion
+     * @param query The query key (e.g., genomic interval)
+     * @param spec Expansion parameters; the default follows every edge one hop
+     * @return Overlapping keys at depth 0, then reached keys in breadth-first order
+     */
+    template<typename EdgeFilter = follow_every_edge>
+        requires std::predicate<const EdgeFilter&,
+                                const typename graph_overlay<key_type, data_type, edge_data_type>::metadata_type&>
+    [[nodiscard]] gdt::expansion_result<key_type, data_type> intersect_expand(
+        const key_type& query, const expansion_spec<key_type, EdgeFilter>& spec = {}) {
+        gdt::expansion_result<key_type, data_type> result{query};
+        const auto seeds = intersect(query);
+        graph_data.expand(std::span(seeds.get_keys()), spec, result);
+        return result;
+    }
+
+private:
+    /**
+     * @brief Resolve a sorted batch of distinct k-mer encodings below `current`
+     *
+     * Splits the batch among the children by separator (a value equal to a
+     * separator stays left, as in search_overlaps), binary-searching the
+     * separators rather than scanning them. At a leaf, each k-mer is
+     * searched for from the previous one's slot and every equal key is
+     * collected, following the leaf chain when equal keys continue.
+     *
+     * @param base Index of `sorted.front()` in the caller's full batch
+     * @param found Receives (batch index, key) pairs in batch order
+     */
+    static void match_sorted_kmers(const node<key_type, data_type>* current, std::span<const uint64_t> sorted,
+                                   size_t base, uint8_t k,
+                                   std::vector<std::pair<size_t, gdt::key<key_type, data_type>*>>& found)
+        requires std::same_as<key_type, gdt::kmer> {
+        if (!current->get_is_leaf()) {
+            // Separators of point keys are ascending, so the child of each
+            // k-mer is found by binary search from the previous k-mer's child.
+            const auto& separators = current->get_keys();
+            const auto& children = current->get_children();
+            size_t child = 0;
+            size_t lo = 0;
+            while (lo < sorted.size()) {
+                const gdt::kmer query(sorted[lo], k);
+                child = static_cast<size_t>(std::lower_bound(
+                    separators.begin() + static_cast<std::ptrdiff_t>(child), separators.end(), query,
+                    [](const auto* separator, const gdt::kmer& q) { return q > separator->get_value(); })
+                    - separators.begin());
+                size_t hi = lo + 1;
+                if (child < separators.size()) {
+                    const auto& separator = separators[child]->get_value();
+                    while (hi < sorted.size() && !(gdt::kmer(sorted[hi], k) > separator)) { ++hi; }
+                } else {
+                    hi = sorted.size();
+                }
+                match_sorted_kmers(children[child], sorted.subspan(lo, hi - lo), base + lo, k, found);
+                lo = hi;
+            }
+            return;
+        }
+        const auto& keys = current->get_keys();
+        size_t slot = 0;
+        for (size_t j = 0; j < sorted.size(); ++j) {
+            const gdt::kmer query(sorted[j], k);
+            slot = static_cast<size_t>(std::lower_bound(keys.begin() + static_cast<std::ptrdiff_t>(slot), keys.end(),
+                query, [](const auto* key, const gdt::kmer& q) { return key->get_value() < q; }) - keys.begin());
+
+            // Collect every equal key; duplicates may continue into later leaves.
+            const node<key_type, data_type>* scan = current;
+            size_t s = slot;
+            while (scan != nullptr) {
+                if (s == scan->get_keys().size()) {
+                    scan = scan->get_next();
+                    s = 0;
+                    continue;
+                }
+                auto* key = scan->get_keys()[s];
+                if (!(key->get_value() == query)) break;
+                found.emplace_back(base + j, key);
+                ++s;
+            }
+        }
+    }
@@ -35,6 +35,7 @@ public:
         if (it == keys.end()) return false;
         keys.erase(it);
         --this->leaf_key_count;
+        release_key_id(key_to_remove);
         leaf->refresh_subtree_max();
 
         this->graph_data.remove_all_edges(key_to_remove);
@@ -43,9 +44,7 @@ public:
         if (leaf->get_parent() == nullptr) {
             if (keys.empty()) {
                 delete leaf;
-                std::string key_str(index_name);
-                this->root_nodes.erase(key_str);
-                this->rightmost_nodes.erase(key_str);
+                this->erase_tree(index_name);
             }
             return true;
         }
@@ -74,6 +73,8 @@ public:
      *          calling `compact()`, callers must rediscover keys via queries.
      * @note External keys (`add_external_key`) are unaffected; their pointers
      *       remain valid and any graph edges referring to them stay intact.
+     * @note Key ids survive compaction: `key_at(id)` returns the key's new
+     *       address, and ids of removed keys stay unused.
      * @note O(N + E) — single tree traversal to migrate keys + a single pass
      *       over graph adjacency to remap pointers.
      */
@@ -83,7 +84,7 @@ public:
                            gdt::key<key_type, data_type>*> remap;
         remap.reserve(this->key_storage.size());
 
-        for (auto& [_, root] : this->root_nodes) {
+        for (const auto& [_, root] : this->get_root_nodes()) {
             migrate_keys(root, new_storage, remap);
         }
         this->graph_data.remap_keys(remap);
@@ -92,7 +93,7 @@ public:
         // Cached routing maxima point into the old storage, which has just
         // been replaced — rebuild them rather than remapping, so compaction
         // cannot leave a node routing through a freed key.
-        for (auto& [_, root] : this->root_nodes) {
+        for (const auto& [_, root] : this->get_root_nodes()) {
             root->refresh_subtree_max_recursive();
         }
     }
@@ -311,9 +312,8 @@ private:
                 right->get_keys().begin(), right->get_keys().end());
             left->set_next(right->get_next());
 
-            if (auto rm_it = this->rightmost_nodes.find(index_name);
-                rm_it != this->rightmost_nodes.end() && rm_it->second == right) {
-                rm_it->second = left;
+            if (this->get_rightmost_node(index_name) == right) {
+                this->set_rightmost(index_name, left);
             }
         } else {
             // Internal merge: left's old last child was catch-all; it becomes
@@ -379,7 +379,7 @@ private:
         old_root->get_children().clear();
         old_root->set_is_leaf(true);  // prevent cascade delete of new_root
         delete old_root;
-        this->root_nodes[std::string(index_name)] = new_root;
+        this->set_root(index_name, new_root);
     }
 
     /**
@@ -396,6 +396,9 @@ private:
             new_storage.push_back(*k);
             auto* new_k = &new_storage.back();
             remap.emplace(k, new_k);
+            if (new_k->get_id() != gdt::no_key_id) {
+                this->keys_by_id[new_k->get_id()] = new_k;
+            }
             k = new_k;
         }
         if (!n->get_is_leaf()) {
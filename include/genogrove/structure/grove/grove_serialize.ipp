@@ -56,11 +56,11 @@ public:
      * @param os Output stream to write to
      * @note Node-less public entry point: walks the grove's own roots, so callers
      *       need no access to internal node pointers. Each index's tree is written
-     *       in turn; an empty grove produces no output. Index iteration order follows
-     *       the underlying hash map and is not guaranteed stable across runs.
+     *       in turn, in the order the indices were first used; an empty grove
+     *       produces no output.
      */
     void grove_to_sif(std::ostream& os) const {
-        for (const auto& [index, root] : root_nodes) {
+        for (const auto& [index, root] : get_root_nodes()) {
             grove_to_sif(os, root);
         }
     }
@@ -68,32 +68,98 @@ public:
     /**
      * @brief Serialize the grove to a block-structured binary output stream
      * @param os Output stream to write to
+     * @param num_threads Workers compressing blocks (0 = hardware concurrency;
+     *        the default 1 compresses on the calling thread). The output is
+     *        byte-identical for every thread count.
      *
-     * Format 0.3 (block-structured, random-access-capable):
-     *   [magic "GGB\x03"]
+     * Equivalent to serialize(os, serialize_options{num_threads}) — zlib blocks,
+     * no dictionary.
+     */
+    void serialize(std::ostream& os, std::size_t num_threads = 1) const {
+        serialize_options opts;
+        opts.num_threads = num_threads;
+        serialize(os, opts);
+    }
+
+    /**
+     * @brief Serialize the grove with an explicit block codec
+     * @param os Output stream to write to
+     * @param opts Worker count, block codec and (zstd only) dictionary size
+     * @throws std::runtime_error if this build lacks opts.codec
+     * @throws std::invalid_argument if a dictionary is requested for a codec other
+     *         than zstd, or opts.blocks_per_frame is 0 or above max_blocks_per_frame
+     *
+     * Format 0.8 (block-structured, random-access-capable):
+     *   [magic "GGB\x08"]
+     *   [frame-directory offset, uint64]: stream-relative offset of the footer,
+     *       or 0 when the output was not seekable (readers then scan the frames)
+     *   [codec, uint8][dictionary length, uint32][dictionary bytes]: the
+     *       block_codec every frame uses; the dictionary is zstd-only and
+     *       usually empty
      *   [directory, plain]: order; per-index (name, root block_id); block count;
-     *       external-block-begin; leaf-key count; external-key count
-     *   [blocks]: each a length-prefixed, independently zlib-compressed record
-     *       - node blocks (id < external-begin), DFS pre-order per index:
+     *       external-block-begin; leaf-key count; external-key count; frame count
+     *   [blocks]: in block-id order
+     *       - node blocks (id < external-begin), per index: internal nodes in DFS
+     *           pre-order, then leaves in leaf-chain order
      *           internal → keys + child block_ids;  leaf → keys + next block_id + edges
      *       - external blocks (id >= external-begin): packed external keys + edges
+     *       a block's keys are one gdt::key_column (interval types: start deltas,
+     *       lengths and strands as varint / bit-packed columns), then their data
+     *   [frames]: runs of up to opts.blocks_per_frame consecutive blocks, each
+     *       [block count, uint32][compressed length, uint64][compressed bytes];
+     *       uncompressed, a frame is its blocks' uint32 lengths then the blocks
+     *   [footer]: per frame, the stream-relative offset of its block count
+     *       (uint64) and its first block_id (uint32) — so a partial reader opens
+     *       without walking the chain and finds any block's frame directly
      *
      * Every key's global id is (block_id, slot). Each key's edge record holds two
      * lists: outgoing, as (target_block_id, target_slot[, metadata]), then
      * incoming, as (source_block_id, source_slot[, metadata]) — every edge is
      * thus written under both endpoints' blocks, so a partial reader can page in
-     * either side without loading the other. The per-block compression makes the
-     * payload seekable for a future partial read path; here the whole grove is
-     * written.
+     * either side without loading the other. Metadata is a uint32 index into a
+     * table of the distinct values, written once per block ahead of its keys'
+     * edge records (absent when edge_data_type is void). The per-frame compression makes the
+     * payload seekable for a partial reader (grove_view).
+     *
+     * A frame never spans two indices, nor internal nodes and leaves, nor node
+     * and external blocks. With blocks_per_frame > 1, a leaf walk thus reads
+     * one frame per blocks_per_frame adjacent leaves instead of one record per
+     * leaf, while a point query decodes at most one frame per tree level.
+     *
+     * Frames are streamed: each is written as soon as it and every frame before
+     * it are compressed, so peak memory is the layout plus a bounded window of
+     * in-flight frames, never the whole payload. With several workers, frames
+     * are compressed in parallel and written in order through a bounded
+     * reorder buffer (see write_serialize_blocks).
      *
-     * @note Blocks are buffered (compressed) in memory to length-prefix them.
-     *       ponytail: fine while groves fit in RAM; revisit with a streaming
-     *       writer + footer index if buffering ever dominates at genome scale.
+     * With opts.dictionary_size > 0 (zstd), a dictionary of up to that many
+     * bytes is trained on a spread of the grove's frames before any output and
+     * stored in the header; blocks of one grove share most of their structure,
+     * so it mostly helps small frames (low orders, one block per frame). When
+     * training is not possible (too few or too small frames) the stream is
+     * written without one.
      */
-    void serialize(std::ostream& os) const {
-        serialize_layout layout = assign_serialize_layout();
-        write_serialize_header(os, layout);
-        write_serialize_blocks(os, layout);
+    void serialize(std::ostream& os, const serialize_options& opts) const {
+        if (opts.dictionary_size != 0 && opts.codec != block_codec::zstd) {
+            throw std::invalid_argument("serialize: a block dictionary requires the zstd codec");
+        }
+        if (opts.blocks_per_frame == 0 || opts.blocks_per_frame > detail::max_blocks_per_frame) {
+            throw std::invalid_argument("serialize: blocks_per_frame must be in [1, " +
+                                        std::to_string(detail::max_blocks_per_frame) + "]");
+        }
+        detail::require_block_codec(opts.codec, "Failed to serialize grove");
+        serialize_layout layout = assign_serialize_layout(opts.blocks_per_frame);
+        const std::string dictionary = opts.dictionary_size != 0
+            ? train_serialize_dictionary(layout, opts.dictionary_size)
+            : std::string();
+        // The footer offset is patched into the header afterwards, which needs a
+        // seekable sink; remember where the stream starts (-1 if not seekable).
+        const std::streampos stream_start = os.tellp();
+        const uint64_t header_bytes = write_serialize_header(os, layout, opts.codec, dictionary);
+        std::vector<uint64_t> frame_offsets;
+        const uint64_t footer_offset = write_serialize_blocks(
+            os, layout, header_bytes, opts.num_threads, opts.codec, dictionary, frame_offsets);
+        write_serialize_footer(os, layout, frame_offsets, footer_offset, stream_start);
         if (!os) {
             throw std::runtime_error("Failed to serialize grove: stream error");
         }
@@ -101,30 +167,50 @@ public:
 
     /**
      * @brief Deserialize a grove from a block-structured binary input stream
-     * @param is Input stream produced by serialize() (format 0.3)
+     * @param is Input stream produced by serialize() (format 0.8)
+     * @param num_threads Workers used to inflate and parse blocks (0 = hardware
+     *        concurrency; the default 1 is the streaming single-threaded reader)
      * @return Deserialized grove object
      *
-     * Eager reader: reads the directory, then reads every length-prefixed block
-     * (each independently inflated from an isolated buffer, so no cross-block
+     * Eager reader: reads the directory, then reads every length-prefixed frame
+     * (each independently decoded from an isolated buffer, so no cross-frame
      * seeking is required — the eager path works on non-seekable sources too),
      * links child/next references and rebuilds the graph overlay from the
      * co-located edge records. A future partial-read path will use the same
      * blocks but load them on demand.
+     *
+     * With more than one worker, frame decoding and block parsing — which dominate
+     * load time — run on a worker pool (see read_deserialize_blocks_parallel).
+     * Linking and edge resolution stay single-threaded, and the result is
+     * identical to the single-threaded reader's, overlay edge order included.
+     *
+     * @note The parallel path holds every compressed frame in memory before
+     *       parsing, i.e. roughly the stream size on top of the grove itself.
      */
-    [[nodiscard]] static grove deserialize(std::istream& is) {
+    [[nodiscard]] static grove deserialize(std::istream& is, std::size_t num_threads = 1) {
         deserialize_header header = read_deserialize_header(is);
         grove g(header.order);
 
         // Node destructors recursively delete children, so on any failure we
         // free every parsed node whose parent is still null (roots free their
-        // subtrees; non-root nodes are freed via their parent). g.root_nodes is
-        // assigned only on success (below), so this cleanup never races grove's
-        // own ownership.
+        // subtrees; non-root nodes are freed via their parent). The index slots
+        // receive their roots only on success (below), so this cleanup never
+        // races grove's own ownership.
         deserialize_blocks_result blocks;
         deserialize_linked linked;
         try {
-            read_deserialize_blocks(is, header, g, blocks);
+            if (ggu::resolve_thread_count(num_threads) > 1) {
+                read_deserialize_blocks_parallel(is, header, g, blocks, num_threads);
+            } else {
+                read_deserialize_blocks(is, header, g, blocks);
+            }
+            skip_deserialize_footer(is, header);
             linked = link_deserialize_structure(header, blocks);
+            // Intern the index names (in file order) while a failure can still
+            // be cleaned up, so the commit below does not allocate.
+            for (const auto& index : linked.indices) {
+                g.resolve_index(index.name);
+            }
             resolve_deserialize_edges(header, blocks, g);
 
             // ---- validate the directory counts against what was parsed ----
@@ -144,9 +230,12 @@ public:
         }
 
         // ---- commit: grove takes ownership of the trees ----
-        g.root_nodes = std::move(linked.local_roots);
-        g.rightmost_nodes = std::move(linked.local_rightmost);
+        for (const auto& index : linked.indices) {
+            g.set_root(index.name, index.root);
+            g.set_rightmost(index.name, index.rightmost);
+        }
         g.leaf_key_count = static_cast<size_t>(header.leaf_count_field);
+        number_deserialized_keys(header, blocks, g);
 
         return g;
     }
@@ -161,28 +250,37 @@ private:
 
     // Block/key id assignment plus everything the write phases need: which
     // node owns which block id, where each key (indexed or external) lives as
-    // (block_id, slot), per-index root block ids, and the external-key chunk
-    // ranges.
+    // (block_id, slot) — indexed by key id —, per-index root block ids, and the external-key chunk
+    // ranges, and how consecutive blocks are grouped into frames.
     struct serialize_layout {
         std::unordered_map<const node<key_type, data_type>*, detail::block_id> node_to_block;
         std::vector<const node<key_type, data_type>*> node_blocks;  // block_id -> node
-        std::unordered_map<key_ptr, std::pair<detail::block_id, uint32_t>> key_to_id;
+        std::vector<std::pair<detail::block_id, uint32_t>> key_slots;  // key id -> (block_id, slot)
         std::vector<std::pair<std::string, detail::block_id>> index_roots;
         uint64_t leaf_keys_total = 0;
         detail::block_id ext_block_begin = 0;
         std::vector<std::pair<size_t, size_t>> ext_ranges;  // [begin,end) in external_key_storage
         detail::block_id num_blocks = 0;
+        std::vector<detail::block_id> frame_begins;  // frame -> first block_id, ascending
+
+        [[nodiscard]] detail::block_id frame_end(std::size_t f) const {
+            return f + 1 < frame_begins.size() ? frame_begins[f + 1] : num_blocks;
+        }
     };
 
-    // Walks every index's tree in DFS pre-order to assign block ids (node
-    // blocks first, per index in root_nodes iteration order), then
-    // distributes external keys into fixed-size chunks (#484) to assign their
-    // block ids. Every key's global id — (block_id, slot) — is recorded in
-    // key_to_id as it's assigned.
-    [[nodiscard]] serialize_layout assign_serialize_layout() const {
+    // Assigns block ids index by index (in index handle order): first
+    // the internal nodes in DFS pre-order — so each root is its index's first
+    // block — then the leaves in leaf-chain order, so a range scan's leaves are
+    // adjacent. External keys are then distributed into fixed-size chunks
+    // (#484) to assign their block ids. Every key's global id — (block_id,
+    // slot) — is recorded in key_slots as it's assigned. Each run of internal
+    // nodes, leaves or external blocks is cut into frames of up to
+    // blocks_per_frame blocks.
+    [[nodiscard]] serialize_layout assign_serialize_layout(std::size_t blocks_per_frame) const {
         serialize_layout layout;
+        layout.key_slots.resize(keys_by_id.size());
 
-        auto assign = [&](const node<key_type, data_type>* n, auto&& self) -> void {
+        auto add_block = [&](const node<key_type, data_type>* n) {
             detail::block_id id = static_cast<detail::block_id>(layout.node_blocks.size());
             layout.node_to_block[n] = id;
             layout.node_blocks.push_back(n);
@@ -190,17 +288,37 @@ private:
                 const auto& ks = n->get_keys();
                 layout.leaf_keys_total += ks.size();
                 for (uint32_t i = 0; i < ks.size(); ++i) {
-                    layout.key_to_id[ks[i]] = {id, i};
-                }
-            } else {
-                for (const auto* child : n->get_children()) {
-                    self(child, self);
+                    layout.key_slots[ks[i]->get_id()] = {id, i};
                 }
             }
         };
-        for (const auto& [name, root] : root_nodes) {
-            layout.index_roots.emplace_back(name, static_cast<detail::block_id>(layout.node_blocks.size()));
-            assign(root, assign);
+        auto cut_frames = [&](detail::block_id begin, detail::block_id end) {
+            for (detail::block_id b = begin; b < end; b += static_cast<detail::block_id>(blocks_per_frame)) {
+                layout.frame_begins.push_back(b);
+            }
+        };
+        std::vector<const node<key_type, data_type>*> leaves;
+        auto assign_internal = [&](const node<key_type, data_type>* n, auto&& self) -> void {
+            if (n->get_is_leaf()) {
+                leaves.push_back(n);
+                return;
+            }
+            add_block(n);
+            for (const auto* child : n->get_children()) {
+                self(child, self);
+            }
+        };
+        for (const auto& [name, root] : get_root_nodes()) {
+            const auto internal_begin = static_cast<detail::block_id>(layout.node_blocks.size());
+            layout.index_roots.emplace_back(name, internal_begin);
+            leaves.clear();
+            assign_internal(root, assign_internal);
+            const auto leaf_begin = static_cast<detail::block_id>(layout.node_blocks.size());
+            for (const auto* leaf : leaves) {
+                add_block(leaf);
+            }
+            cut_frames(internal_begin, leaf_begin);
+            cut_frames(leaf_begin, static_cast<detail::block_id>(layout.node_blocks.size()));
         }
         layout.ext_block_begin = static_cast<detail::block_id>(layout.node_blocks.size());
 
@@ -213,62 +331,107 @@ private:
             size_t end = std::min(start + static_cast<size_t>(ext_chunk), external_key_storage.size());
             detail::block_id id = layout.ext_block_begin + static_cast<detail::block_id>(layout.ext_ranges.size());
             for (size_t j = start; j < end; ++j) {
-                layout.key_to_id[&external_key_storage[j]] = {id, static_cast<uint32_t>(j - start)};
+                layout.key_slots[external_key_storage[j].get_id()] = {id, static_cast<uint32_t>(j - start)};
             }
             layout.ext_ranges.emplace_back(start, end);
         }
         layout.num_blocks = layout.ext_block_begin + static_cast<detail::block_id>(layout.ext_ranges.size());
+        cut_frames(layout.ext_block_begin, layout.num_blocks);
 
         return layout;
     }
 
     // Writes one edge reference: the other endpoint's (block_id, slot), then
-    // metadata if edge_data_type is non-void.
-    void write_edge_ref(std::ostream& zos, key_ptr other, const auto& e,
+    // (edge_data_type non-void) its metadata's index in the block's table.
+    void write_edge_ref(std::ostream& zos, key_ptr other, uint32_t meta_index,
                         const serialize_layout& layout) const {
-        auto found = layout.key_to_id.find(other);
-        if (found == layout.key_to_id.end()) {
+        const auto other_id = other->get_id();
+        if (other_id >= keys_by_id.size() || keys_by_id[other_id] != other) {
             throw std::runtime_error("Failed to serialize grove: edge endpoint not indexed");
         }
-        detail::block_id ob = found->second.first;
-        uint32_t oslot = found->second.second;
+        const auto [ob, oslot] = layout.key_slots[other_id];
         detail::write_pod(zos, ob);
         detail::write_pod(zos, oslot);
         if constexpr (!std::is_void_v<edge_data_type>) {
-            gdt::serializer<edge_data_type>::write(zos, e.metadata);
+            detail::write_pod(zos, meta_index);
         }
     }
 
-    // Writes one key's outgoing then incoming edge lists. Generic over the key
-    // pointer iterator so leaf keys (key*) and external keys (const key*)
-    // share it. Every edge is thus written twice — once under its source's
-    // outgoing list, once under its target's incoming list — so a partial
-    // reader (grove_view) can page in either endpoint's block and see that
-    // side of the edge without loading the other endpoint.
+    // Writes a block's edge section: (edge_data_type non-void) a table of the
+    // distinct metadata values of every edge touching its keys, then each
+    // key's outgoing and incoming edge lists. Generic over the key pointer
+    // iterator so leaf keys (key*) and external keys (const key*) share it.
+    // Every edge is thus written twice — once under its source's outgoing
+    // list, once under its target's incoming list — so a partial reader
+    // (grove_view) can page in either endpoint's block and see that side of
+    // the edge without loading the other endpoint; the table keeps the second
+    // copy (and every repeat of a transcript or source name) to 4 bytes.
     void write_key_edges(std::ostream& zos, auto first, auto last,
                          const serialize_layout& layout) const {
+        std::vector<uint32_t> meta_index;  // per edge ref, in write order
+        if constexpr (!std::is_void_v<edge_data_type>) {
+            std::unordered_map<std::string, uint32_t> distinct;
+            std::vector<const std::string*> table;
+            std::ostringstream encoded;
+            auto intern = [&](const edge_data_type& meta) {
+                encoded.str(std::string{});
+                gdt::serializer<edge_data_type>::write(encoded, meta);
+                auto [it, added] = distinct.try_emplace(encoded.str(), static_cast<uint32_t>(table.size()));
+                if (added) table.push_back(&it->first);
+                meta_index.push_back(it->second);
+            };
+            for (auto it = first; it != last; ++it) {
+                for (const auto& e : graph_data.out_edges_view(*it)) intern(e.metadata);
+                for (const auto& e : graph_data.in_edges_view(*it)) intern(e.metadata);
+            }
+            const auto count = static_cast<uint32_t>(table.size());
+            detail::write_pod(zos, count);
+            for (const std::string* bytes : table) {
+                zos.write(bytes->data(), static_cast<std::streamsize>(bytes->size()));
+            }
+        }
+        std::size_t ref = 0;
+        auto next_index = [&]() -> uint32_t {
+            if constexpr (std::is_void_v<edge_data_type>) {
+                return 0;
+            } else {
+                return meta_index[ref++];
+            }
+        };
         for (auto it = first; it != last; ++it) {
             key_ptr k = *it;
-            const auto& out_edges = graph_data.get_edge_list(k);
-            uint32_t out_count = static_cast<uint32_t>(out_edges.size());
+            uint32_t out_count = static_cast<uint32_t>(graph_data.out_degree(k));
             detail::write_pod(zos, out_count);
-            for (const auto& e : out_edges) {
-                write_edge_ref(zos, e.target, e, layout);
+            for (auto* target : graph_data.neighbors_view(k)) {
+                write_edge_ref(zos, target, next_index(), layout);
             }
-            const auto& in_edges = graph_data.get_in_edge_list(k);
-            uint32_t in_count = static_cast<uint32_t>(in_edges.size());
+            uint32_t in_count = static_cast<uint32_t>(graph_data.in_degree(k));
             detail::write_pod(zos, in_count);
-            for (const auto& e : in_edges) {
-                write_edge_ref(zos, e.source, e, layout);
+            for (auto* source : graph_data.in_neighbors_view(k)) {
+                write_edge_ref(zos, source, next_index(), layout);
             }
         }
     }
 
-    // Writes the plain (uncompressed) magic + order + index directory +
-    // block/key counts.
-    void write_serialize_header(std::ostream& os, const serialize_layout& layout) const {
+    // Writes the plain (uncompressed) magic + footer-offset placeholder +
+    // codec + dictionary + order + index directory + block/key/frame counts.
+    // Returns the bytes written, so block offsets can be tracked without
+    // tellp() (non-seekable sinks).
+    uint64_t write_serialize_header(std::ostream& os, const serialize_layout& layout,
+                                    block_codec codec, const std::string& dictionary) const {
+        uint64_t bytes = 0;
         os.write(detail::grove_stream_magic.data(),
                  static_cast<std::streamsize>(detail::grove_stream_magic.size()));
+        uint64_t footer_offset_placeholder = 0;  // patched by write_serialize_footer
+        detail::write_pod(os, footer_offset_placeholder);
+        bytes += detail::grove_stream_magic.size() + sizeof(footer_offset_placeholder);
+
+        uint8_t codec_field = static_cast<uint8_t>(codec);
+        detail::write_pod(os, codec_field);
+        uint32_t dict_len = static_cast<uint32_t>(dictionary.size());
+        detail::write_pod(os, dict_len);
+        os.write(dictionary.data(), static_cast<std::streamsize>(dict_len));
+        bytes += sizeof(codec_field) + sizeof(dict_len) + dict_len;
 
         detail::write_pod(os, this->order);
         uint32_t num_indices = static_cast<uint32_t>(layout.index_roots.size());
@@ -279,6 +442,7 @@ private:
             os.write(name.data(), static_cast<std::streamsize>(name_len));
             detail::block_id rid = root_id;
             detail::write_pod(os, rid);
+            bytes += sizeof(name_len) + name_len + sizeof(rid);
         }
         detail::write_pod(os, layout.num_blocks);
         detail::block_id ext_begin_field = layout.ext_block_begin;
@@ -287,56 +451,188 @@ private:
         detail::write_pod(os, leaf_count_field);
         uint64_t external_count_field = static_cast<uint64_t>(external_key_storage.size());
         detail::write_pod(os, external_count_field);
+        uint32_t num_frames = static_cast<uint32_t>(layout.frame_begins.size());
+        detail::write_pod(os, num_frames);
+        bytes += sizeof(this->order) + sizeof(num_indices) + sizeof(layout.num_blocks) +
+                 sizeof(ext_begin_field) + sizeof(leaf_count_field) + sizeof(external_count_field) +
+                 sizeof(num_frames);
+        return bytes;
+    }
+
+    // Writes the frame directory — each frame's stream-relative offset and
+    // first block_id — after the last frame, then, if the sink is seekable,
+    // patches its offset into the header placeholder. A non-seekable sink
+    // keeps the placeholder's 0 and readers fall back to walking the frame
+    // chain.
+    static void write_serialize_footer(std::ostream& os, const serialize_layout& layout,
+                                       const std::vector<uint64_t>& frame_offsets,
+                                       uint64_t footer_offset, std::streampos stream_start) {
+        for (std::size_t f = 0; f < frame_offsets.size(); ++f) {
+            detail::write_pod(os, frame_offsets[f]);
+            detail::block_id first = layout.frame_begins[f];
+            detail::write_pod(os, first);
+        }
+        if (stream_start == std::streampos(-1) || !os) {
+            return;
+        }
+        const std::streampos end = os.tellp();
+        if (end == std::streampos(-1)) {
+            return;
+        }
+        os.seekp(stream_start + static_cast<std::streamoff>(detail::grove_stream_magic.size()));
+        detail::write_pod(os, footer_offset);
+        os.seekp(end);
     }
 
-    // Compresses and writes every block, node blocks then external blocks,
-    // each length-prefixed as it is produced (no whole-payload buffering).
-    void write_serialize_blocks(std::ostream& os, const serialize_layout& layout) const {
-        // One deflate state and one uncompressed-scratch stream reused across all
-        // blocks (deflateReset per block, no per-block deflateInit or stream
-        // construction).
-        detail::block_deflater deflater;
+    // Per-worker frame encoder: one compressor, one per-block scratch stream
+    // and one frame buffer reused across every frame the worker encodes (no
+    // per-frame codec-state setup or stream construction). The compressor is
+    // created on first use — parallel_ordered default-constructs worker
+    // state, and the codec is only known per call.
+    struct block_encoder {
+        std::optional<detail::block_compressor> compressor;
+        std::ostringstream raw{std::ios::binary};
+        std::string frame;
+    };
+
+    // Compressed frames produced ahead of the writer, per worker. Bounds the
+    // reorder buffer — and so peak memory — independently of the frame count.
+    static constexpr std::size_t serialize_blocks_in_flight_per_worker = 4;
+
+    // Serializes block b's uncompressed bytes into raw (reset first). Reads
+    // only const grove state, so workers may run it concurrently.
+    void write_raw_block(std::ostringstream& raw, detail::block_id b,
+                         const serialize_layout& layout) const {
+        raw.str(std::string());  // reset content + put pointer, reuse capacity
+        raw.clear();             // clear any residual state flags
+        if (b < layout.ext_block_begin) {
+            write_node_block(raw, layout.node_blocks[b], layout);
+        } else {
+            write_external_block(raw, layout.ext_ranges[b - layout.ext_block_begin], layout);
+        }
+        if (!raw) {
+            throw std::runtime_error("Failed to serialize grove: block stream error");
+        }
+    }
+
+    // Builds frame f's uncompressed bytes in `frame`: each block's uint32
+    // length, then the blocks back to back (the layout split_frame() reads).
+    void write_raw_frame(std::ostringstream& raw, std::string& frame, std::size_t f,
+                         const serialize_layout& layout) const {
+        const detail::block_id first = layout.frame_begins[f];
+        const detail::block_id last = layout.frame_end(f);
+        frame.assign(std::size_t{last - first} * sizeof(uint32_t), '\0');
+        for (detail::block_id b = first; b < last; ++b) {
+            write_raw_block(raw, b, layout);
+            const std::string_view bytes = raw.view();
+            if (bytes.size() > std::numeric_limits<uint32_t>::max()) {
+                throw std::runtime_error("Failed to serialize grove: block exceeds 4 GiB");
+            }
+            const uint32_t len = static_cast<uint32_t>(bytes.size());
+            std::memcpy(frame.data() + std::size_t{b - first} * sizeof(len), &len, sizeof(len));
+            frame.append(bytes);
+        }
+    }
+
+    // Serializes frame f and returns it compressed with `codec`.
+    std::string encode_frame(block_encoder& enc, std::size_t f, const serialize_layout& layout,
+                             block_codec codec, std::string_view dictionary) const {
+        if (!enc.compressor) {
+            enc.compressor.emplace(codec, dictionary);
+        }
+        write_raw_frame(enc.raw, enc.frame, f, layout);
         std::string comp;
+        enc.compressor->compress(enc.frame, comp);
+        return comp;
+    }
+
+    // Most frames sampled to train a zstd dictionary. Samples are spread
+    // evenly over the frames so every index and the external blocks are
+    // represented, and bound the training input regardless of grove size.
+    static constexpr std::size_t serialize_dictionary_max_samples = 1024;
+
+    // Trains a dictionary of up to `capacity` bytes on a spread of the
+    // layout's uncompressed frames; empty if training is not possible.
+    std::string train_serialize_dictionary(const serialize_layout& layout,
+                                           std::size_t capacity) const {
+        const std::size_t num_frames = layout.frame_begins.size();
+        const std::size_t step =
+            std::max<std::size_t>(1, num_frames / serialize_dictionary_max_samples);
+        std::vector<std::string> samples;
         std::ostringstream raw(std::ios::binary);
-        auto write_block = [&](auto&& write_fn) {
-            raw.str(std::string());  // reset content + put pointer, reuse capacity
-            raw.clear();             // clear any residual state flags
-            write_fn(raw);
-            if (!raw) {
-                throw std::runtime_error("Failed to serialize grove: block stream error");
-            }
-            deflater.compress(raw.view(), comp);  // view(): compress without a copy
-            uint64_t clen = static_cast<uint64_t>(comp.size());
-            detail::write_pod(os, clen);
-            os.write(comp.data(), static_cast<std::streamsize>(comp.size()));
-        };
+        std::string frame;
+        for (std::size_t f = 0; f < num_frames; f += step) {
+            write_raw_frame(raw, frame, f, layout);
+            samples.push_back(frame);
+        }
+        return detail::train_block_dictionary(samples, capacity);
+    }
 
-        for (detail::block_id b = 0; b < layout.ext_block_begin; ++b) {
-            const node<key_type, data_type>* n = layout.node_blocks[b];
-            write_block([&](std::ostream& zos) {
-                n->serialize_block(zos, layout.node_to_block);
-                if (n->get_is_leaf()) {
-                    write_key_edges(zos, n->get_keys().begin(), n->get_keys().end(), layout);
+    // Compresses and writes every frame in block-id order, each prefixed with
+    // its block count and compressed length and written as soon as it and its
+    // predecessors are ready (no whole-payload buffering). Workers compress
+    // ahead of the writer through a bounded reorder buffer. Records each
+    // frame's stream-relative offset (the stream starts `first_offset` bytes
+    // before the first frame) and returns the offset just past the last
+    // frame, where the footer goes.
+    uint64_t write_serialize_blocks(std::ostream& os, const serialize_layout& layout,
+                                    uint64_t first_offset, std::size_t num_threads,
+                                    block_codec codec, std::string_view dictionary,
+                                    std::vector<uint64_t>& frame_offsets) const {
+        frame_offsets.clear();
+        frame_offsets.reserve(layout.frame_begins.size());
+        uint64_t offset = first_offset;
+        const std::size_t window =
+            ggu::resolve_thread_count(num_threads) * serialize_blocks_in_flight_per_worker;
+        ggu::parallel_ordered<block_encoder>(
+            layout.frame_begins.size(), num_threads, window,
+            [&](block_encoder& enc, std::size_t f) {
+                return encode_frame(enc, f, layout, codec, dictionary);
+            },
+            [&](std::size_t f, std::string&& comp) {
+                frame_offsets.push_back(offset);
+                uint32_t count = layout.frame_end(f) - layout.frame_begins[f];
+                uint64_t clen = static_cast<uint64_t>(comp.size());
+                detail::write_pod(os, count);
+                detail::write_pod(os, clen);
+                os.write(comp.data(), static_cast<std::streamsize>(comp.size()));
+                if (!os) {
+                    throw std::runtime_error("Failed to serialize grove: stream error");
                 }
+                offset += sizeof(count) + sizeof(clen) + clen;
             });
+        return offset;
+    }
+
+    // A node block's uncompressed bytes: the node itself, then (leaf only)
+    // every key's edge record.
+    void write_node_block(std::ostream& zos, const node<key_type, data_type>* n,
+                          const serialize_layout& layout) const {
+        n->serialize_block(zos, layout.node_to_block);
+        if (n->get_is_leaf()) {
+            write_key_edges(zos, n->get_keys().begin(), n->get_keys().end(), layout);
         }
-        for (const auto& [start, end] : layout.ext_ranges) {
-            write_block([&](std::ostream& zos) {
-                uint32_t cnt = static_cast<uint32_t>(end - start);
-                detail::write_pod(zos, cnt);
-                std::vector<key_ptr> keyptrs;
-                keyptrs.reserve(cnt);
-                for (size_t j = start; j < end; ++j) {
-                    const auto& k = external_key_storage[j];
-                    k.get_value().serialize(zos);
-                    if constexpr (!std::is_void_v<data_type>) {
-                        gdt::serializer<data_type>::write(zos, k.get_data());
-                    }
-                    keyptrs.push_back(&k);
-                }
-                write_key_edges(zos, keyptrs.begin(), keyptrs.end(), layout);
-            });
+    }
+
+    // An external block's uncompressed bytes: key count, the key values as one
+    // column (gdt::key_column), each key's data, then every key's edge record.
+    void write_external_block(std::ostream& zos, const std::pair<size_t, size_t>& range,
+                              const serialize_layout& layout) const {
+        const auto& [start, end] = range;
+        uint32_t cnt = static_cast<uint32_t>(end - start);
+        detail::write_pod(zos, cnt);
+        gdt::key_column<key_type>::write(zos, cnt,
+            [&](size_t i) -> const key_type& { return external_key_storage[start + i].get_value(); });
+        std::vector<key_ptr> keyptrs;
+        keyptrs.reserve(cnt);
+        for (size_t j = start; j < end; ++j) {
+            const auto& k = external_key_storage[j];
+            if constexpr (!std::is_void_v<data_type>) {
+                gdt::serializer<data_type>::write(zos, k.get_data());
+            }
+            keyptrs.push_back(&k);
         }
+        write_key_edges(zos, keyptrs.begin(), keyptrs.end(), layout);
     }
 
     // ---- deserialize() phases ---------------------------------------------
@@ -345,17 +641,19 @@ private:
     // commit. Split into phases so each is independently readable; behavior
     // is unchanged from the single-function version.
 
-    using root_map_t = std::unordered_map<std::string, node<key_type, data_type>*,
-                                          string_hash, std::equal_to<>>;
-
-    // Plain (uncompressed) magic + order + index directory + block/key counts.
+    // Plain (uncompressed) magic + footer offset + codec/dictionary + order +
+    // index directory + block/key/frame counts.
     struct deserialize_header {
+        uint64_t footer_offset = 0;  // unused by the eager reader (it streams)
+        block_codec codec = block_codec::zlib;
+        std::string dictionary;
         int order = 0;
         std::vector<std::pair<std::string, detail::block_id>> index_roots;
         detail::block_id num_blocks = 0;
         detail::block_id ext_block_begin = 0;
         uint64_t leaf_count_field = 0;
         uint64_t external_count_field = 0;
+        uint32_t num_frames = 0;
     };
 
     [[nodiscard]] static deserialize_header read_deserialize_header(std::istream& is) {
@@ -364,10 +662,29 @@ private:
         if (is.gcount() != static_cast<std::streamsize>(magic.size()) ||
             magic != detail::grove_stream_magic) {
             throw std::runtime_error(
-                "Failed to deserialize grove: bad magic (not a format 0.3 grove stream)");
+                "Failed to deserialize grove: bad magic (not a format 0.8 grove stream)");
         }
 
         deserialize_header h;
+        detail::read_pod(is, h.footer_offset);
+        uint8_t codec_field;
+        uint32_t dict_len;
+        detail::read_pod(is, codec_field);
+        detail::read_pod(is, dict_len);
+        if (!is) {
+            throw std::runtime_error("Failed to deserialize grove: stream error reading codec");
+        }
+        h.codec = static_cast<block_codec>(codec_field);
+        detail::require_block_codec(h.codec, "Failed to deserialize grove");
+        if (dict_len > detail::max_block_dictionary_size) {
+            throw std::runtime_error("Failed to deserialize grove: dictionary length out of range");
+        }
+        detail::require_backing_bytes(is, dict_len, 1, "dictionary");
+        h.dictionary.resize(dict_len);
+        is.read(h.dictionary.data(), static_cast<std::streamsize>(dict_len));
+        if (!is) {
+            throw std::runtime_error("Failed to deserialize grove: stream error reading dictionary");
+        }
         detail::read_pod(is, h.order);
         if (!is) {
             throw std::runtime_error("Failed to deserialize grove: stream error reading order");
@@ -413,17 +730,23 @@ private:
         detail::read_pod(is, h.ext_block_begin);
         detail::read_pod(is, h.leaf_count_field);
         detail::read_pod(is, h.external_count_field);
+        detail::read_pod(is, h.num_frames);
         if (!is) {
             throw std::runtime_error("Failed to deserialize grove: stream error reading directory");
         }
         if (h.ext_block_begin > h.num_blocks) {
             throw std::runtime_error("Failed to deserialize grove: external-block-begin exceeds block count");
         }
-        // num_blocks is file-controlled and sizes the per-block index vectors
-        // below (all <= num_blocks entries). Each block is at least an 8-byte
-        // length prefix on disk, so reject a count the stream can't back before
-        // allocating — otherwise a tiny corrupt header forces a multi-GB resize.
-        detail::require_backing_bytes(is, h.num_blocks, sizeof(uint64_t), "block");
+        // Every frame holds 1..max_blocks_per_frame blocks.
+        if (h.num_frames > h.num_blocks ||
+            h.num_blocks > uint64_t{h.num_frames} * detail::max_blocks_per_frame) {
+            throw std::runtime_error("Failed to deserialize grove: frame count inconsistent with block count");
+        }
+        // num_frames is file-controlled and, with the check above, bounds
+        // num_blocks. Each frame is at least its count + length prefix on disk,
+        // so reject a count the stream can't back. The per-block vectors are
+        // still grown only as frames actually decode (see grow_block_slots).
+        detail::require_backing_bytes(is, h.num_frames, sizeof(uint32_t) + sizeof(uint64_t), "frame");
 
         return h;
     }
@@ -438,6 +761,11 @@ private:
             std::is_void_v<edge_data_type>, std::monostate, edge_data_type> meta;
     };
 
+    // On-disk incoming-edge order per key, so incident[target] can be
+    // reordered after add_edge() replay (which uses block-visitation order).
+    using pending_in_map = std::unordered_map<gdt::key<key_type, data_type>*,
+                                              std::vector<std::pair<detail::block_id, uint32_t>>>;
+
     // Working state filled by read_deserialize_blocks() and consumed by
     // link_deserialize_structure() / resolve_deserialize_edges(). Lives in
     // deserialize()'s own scope (not returned by value) so its failure-path
@@ -448,18 +776,18 @@ private:
         std::vector<detail::block_id> next_ids;
         std::vector<std::vector<gdt::key<key_type, data_type>*>> ext_block_keys;
         std::vector<pending_edge> pending;
-        // On-disk incoming-edge order per key, so incident[target] can be
-        // reordered after add_edge() replay (which uses block-visitation order).
-        std::unordered_map<gdt::key<key_type, data_type>*,
-                           std::vector<std::pair<detail::block_id, uint32_t>>>
-            pending_in;
+        pending_in_map pending_in;
         uint64_t actual_leaf_key_count = 0;
     };
 
-    // Reads ecount (block_id, slot[, metadata]) entries and records the
+    // A block's edge metadata table (empty when edge_data_type is void).
+    using edge_metadata_table = std::vector<std::conditional_t<
+        std::is_void_v<edge_data_type>, std::monostate, edge_data_type>>;
+
+    // Reads ecount (block_id, slot[, metadata index]) entries and records the
     // (source_block, source_slot) pairs into `out` for later resolution.
     // Metadata is skipped — only the order matters for incident[target].
-    static void read_in_edge_refs(std::istream& zis, uint32_t ecount,
+    static void read_in_edge_refs(std::istream& zis, uint32_t ecount, const edge_metadata_table& table,
                                   std::vector<std::pair<detail::block_id, uint32_t>>& out) {
         detail::require_backing_bytes(zis, ecount, sizeof(detail::block_id) + sizeof(uint32_t),
                                       "edge");
@@ -472,20 +800,18 @@ private:
                 throw std::runtime_error("Failed to deserialize grove: stream error reading edge");
             }
             if constexpr (!std::is_void_v<edge_data_type>) {
-                [[maybe_unused]] auto meta = gdt::serializer<edge_data_type>::read(zis);
-                if (!zis) {
-                    throw std::runtime_error("Failed to deserialize grove: stream error reading edge metadata");
-                }
+                detail::read_edge_metadata_ref(zis, table);
             }
             out.emplace_back(b, s);
         }
     }
 
     // Reads one key's outgoing then incoming edge record (the .gg writer's
-    // per-key layout): outgoing refs go to result.pending for later add_edge()
-    // replay, incoming refs to result.pending_in for later reorder.
+    // per-key layout): outgoing refs go to `pending` for later add_edge()
+    // replay, incoming refs to `pending_in` for later reorder.
     static void read_key_edges(std::istream& zis, gdt::key<key_type, data_type>* src,
-                               deserialize_blocks_result& result) {
+                               const edge_metadata_table& table,
+                               std::vector<pending_edge>& pending, pending_in_map& pending_in) {
         uint32_t ecount;
         detail::read_pod(zis, ecount);
         if (!zis) {
@@ -502,13 +828,9 @@ private:
                 throw std::runtime_error("Failed to deserialize grove: stream error reading edge");
             }
             if constexpr (std::is_void_v<edge_data_type>) {
-                result.pending.push_back(pending_edge{src, tb, ts, {}});
+                pending.push_back(pending_edge{src, tb, ts, {}});
             } else {
-                auto meta = gdt::serializer<edge_data_type>::read(zis);
-                if (!zis) {
-                    throw std::runtime_error("Failed to deserialize grove: stream error reading edge metadata");
-                }
-                result.pending.push_back(pending_edge{src, tb, ts, std::move(meta)});
+                pending.push_back(pending_edge{src, tb, ts, detail::read_edge_metadata_ref(zis, table)});
             }
         }
         uint32_t in_ecount;
@@ -519,44 +841,74 @@ private:
         // Skip keys with no incoming edges so the reorder pass below only
         // visits keys that actually need it.
         if (in_ecount > 0) {
-            read_in_edge_refs(zis, in_ecount, result.pending_in[src]);
+            read_in_edge_refs(zis, in_ecount, table, pending_in[src]);
         }
     }
 
-    // Reads block b's length-prefixed, compressed bytes and inflates them into
-    // raw_buf. block_bytes_left bounds clen against the file's remaining size
-    // without a seek (#513); inflater/comp_buf/raw_buf are reused scratch state
-    // across all blocks in a stream (one inflateReset per block).
-    static void read_one_block(std::istream& is, std::streamoff& block_bytes_left,
-                               detail::block_inflater& inflater, std::string& comp_buf,
-                               std::string& raw_buf) {
+    // Reads a block's edge section (the writer's write_key_edges): the
+    // metadata table, then each of `keys`' edge records in order.
+    static void read_block_edges(std::istream& zis, const auto& keys,
+                                 std::vector<pending_edge>& pending, pending_in_map& pending_in) {
+        edge_metadata_table table;
+        if constexpr (!std::is_void_v<edge_data_type>) {
+            table = detail::read_edge_metadata_table<edge_data_type>(zis);
+        }
+        for (auto* k : keys) {
+            read_key_edges(zis, k, table, pending, pending_in);
+        }
+    }
+
+    // Reads one frame's block count and compressed bytes (into comp_buf).
+    // `first` is the frame's first block_id; the count must keep the frame
+    // within num_blocks. block_bytes_left bounds clen against the file's
+    // remaining size without a seek (#513).
+    static uint32_t read_frame_bytes(std::istream& is, const deserialize_header& header,
+                                     detail::block_id first, std::streamoff& block_bytes_left,
+                                     std::string& comp_buf) {
+        uint32_t count;
+        detail::read_pod(is, count);
         uint64_t clen;
         detail::read_pod(is, clen);
         if (!is) {
-            throw std::runtime_error("Failed to deserialize grove: stream error reading block length");
+            throw std::runtime_error("Failed to deserialize grove: stream error reading frame header");
+        }
+        if (count == 0 || count > detail::max_blocks_per_frame || count > header.num_blocks - first) {
+            throw std::runtime_error("Failed to deserialize grove: frame block count out of range");
         }
         // clen is file-controlled: reject a value that would overflow the
         // signed streamsize cast (a negative read count is UB) before it
         // sizes the buffer.
         if (clen > static_cast<uint64_t>(std::numeric_limits<std::streamsize>::max())) {
-            throw std::runtime_error("Failed to deserialize grove: block length out of range");
+            throw std::runtime_error("Failed to deserialize grove: frame length out of range");
         }
         // clen bytes must actually remain: reject a bogus multi-GB length
         // before resize allocates it (OOM guard). Arithmetic only — the
         // budget was measured once above.
         if (block_bytes_left >= 0) {
-            block_bytes_left -= static_cast<std::streamoff>(sizeof(clen));
+            block_bytes_left -= static_cast<std::streamoff>(sizeof(count) + sizeof(clen));
             if (block_bytes_left < 0 || clen > static_cast<uint64_t>(block_bytes_left)) {
-                throw std::runtime_error("Failed to deserialize grove: compressed block length exceeds remaining stream");
+                throw std::runtime_error("Failed to deserialize grove: compressed frame length exceeds remaining stream");
             }
             block_bytes_left -= static_cast<std::streamoff>(clen);
         }
         comp_buf.resize(static_cast<size_t>(clen));
         is.read(comp_buf.data(), static_cast<std::streamsize>(clen));
         if (is.gcount() != static_cast<std::streamsize>(clen)) {
-            throw std::runtime_error("Failed to deserialize grove: truncated block");
+            throw std::runtime_error("Failed to deserialize grove: truncated frame");
         }
-        inflater.decompress(comp_buf.data(), static_cast<size_t>(clen), raw_buf);
+        return count;
+    }
+
+    // Extends the per-block result vectors to cover blocks [0, end). Grown a
+    // frame at a time, after the frame decodes, so memory tracks the blocks
+    // actually present rather than the header's counts.
+    static void grow_block_slots(const deserialize_header& header, deserialize_blocks_result& result,
+                                 detail::block_id end) {
+        const detail::block_id nodes = std::min(end, header.ext_block_begin);
+        result.block_node.resize(nodes, nullptr);
+        result.child_ids.resize(nodes);
+        result.next_ids.resize(nodes, detail::no_block);
+        result.ext_block_keys.resize(end - nodes);
     }
 
     // Deserializes node block b from its already-decompressed bytes: the node
@@ -568,16 +920,18 @@ private:
         result.block_node[b] = n;
         if (n->get_is_leaf()) {
             result.actual_leaf_key_count += n->get_keys().size();
-            for (auto* k : n->get_keys()) {
-                read_key_edges(zis, k, result);
-            }
+            read_block_edges(zis, n->get_keys(), result.pending, result.pending_in);
         }
     }
 
     // Reads external block b's packed keys (up to max_external_keys_per_block,
-    // enforced below) into g.external_key_storage, then each key's edges.
-    static void read_external_block(std::istream& zis, grove& g,
-                                    deserialize_blocks_result& result, std::size_t ext_index) {
+    // enforced below) into key_storage (g.external_key_storage, or a staging
+    // vector reserved to that cap), recording them in ekeys, then each key's
+    // edges.
+    template<typename key_storage_type>
+    static void read_external_block(std::istream& zis, key_storage_type& key_storage,
+                                    std::vector<gdt::key<key_type, data_type>*>& ekeys,
+                                    std::vector<pending_edge>& pending, pending_in_map& pending_in) {
         uint32_t cnt;
         detail::read_pod(zis, cnt);
         if (!zis) {
@@ -590,65 +944,221 @@ private:
         if (cnt > detail::max_external_keys_per_block) {
             throw std::runtime_error("Failed to deserialize grove: external block key count exceeds limit");
         }
-        auto& ekeys = result.ext_block_keys[ext_index];
+        std::vector<key_type> values;
+        gdt::key_column<key_type>::read(zis, cnt, values);
         ekeys.reserve(cnt);
         for (uint32_t i = 0; i < cnt; ++i) {
-            key_type key_value = key_type::deserialize(zis);
             if constexpr (std::is_void_v<data_type>) {
-                if (!zis) {
-                    throw std::runtime_error("Failed to deserialize grove: stream error reading external key");
-                }
-                g.external_key_storage.emplace_back(key_value);
+                key_storage.emplace_back(std::move(values[i]));
             } else {
                 data_type data_value = gdt::serializer<data_type>::read(zis);
                 if (!zis) {
                     throw std::runtime_error("Failed to deserialize grove: stream error reading external key");
                 }
-                g.external_key_storage.emplace_back(key_value, data_value);
+                key_storage.emplace_back(std::move(values[i]), data_value);
             }
-            ekeys.push_back(&g.external_key_storage.back());
-        }
-        for (auto* k : ekeys) {
-            read_key_edges(zis, k, result);
+            ekeys.push_back(&key_storage.back());
         }
+        read_block_edges(zis, ekeys, pending, pending_in);
     }
 
-    // Reads every length-prefixed block (node blocks then external blocks),
-    // each independently inflated from an isolated buffer. Only records
-    // child/next block ids and per-key edge references — node linking happens
-    // in link_deserialize_structure(), edge resolution in
+    // Reads every frame in order and parses its blocks (node blocks then
+    // external blocks), each frame independently decoded from an isolated
+    // buffer. Only records child/next block ids and per-key edge references —
+    // node linking happens in link_deserialize_structure(), edge resolution in
     // resolve_deserialize_edges(), once every block's contents are known.
     static void read_deserialize_blocks(std::istream& is, const deserialize_header& header,
                                         grove& g, deserialize_blocks_result& result) {
-        result.block_node.assign(header.ext_block_begin, nullptr);
-        result.child_ids.assign(header.ext_block_begin, {});
-        result.next_ids.assign(header.ext_block_begin, detail::no_block);
-        result.ext_block_keys.assign(header.num_blocks - header.ext_block_begin, {});
-
-        // One inflate state and two scratch buffers reused across all blocks
-        // (inflateReset per block, no per-block inflateInit or buffer copy).
-        detail::block_inflater inflater;
+        // One decoder and the scratch buffers reused across all frames (no
+        // per-frame codec-state setup or buffer copy).
+        detail::block_decompressor decoder(header.codec, header.dictionary);
         std::string comp_buf;
         std::string raw_buf;
+        std::vector<std::string_view> blocks;
         std::streamoff block_bytes_left = detail::remaining_bytes(is);
 
-        for (detail::block_id b = 0; b < header.num_blocks; ++b) {
-            read_one_block(is, block_bytes_left, inflater, comp_buf, raw_buf);
-            detail::memory_streambuf mb(raw_buf.data(), raw_buf.size());
-            std::istream zis(&mb);
+        detail::block_id b = 0;
+        for (uint32_t f = 0; f < header.num_frames; ++f) {
+            if (b == header.num_blocks) {
+                throw std::runtime_error("Failed to deserialize grove: more frames than blocks");
+            }
+            const uint32_t count = read_frame_bytes(is, header, b, block_bytes_left, comp_buf);
+            detail::split_frame(decoder.decode(comp_buf.data(), comp_buf.size(), raw_buf),
+                                count, blocks);
+            grow_block_slots(header, result, b + count);
+            for (const std::string_view raw : blocks) {
+                detail::memory_streambuf mb(raw.data(), raw.size());
+                std::istream zis(&mb);
+                if (b < header.ext_block_begin) {
+                    read_node_block(zis, header, g, result, b);
+                } else {
+                    read_external_block(zis, g.external_key_storage,
+                                        result.ext_block_keys[b - header.ext_block_begin],
+                                        result.pending, result.pending_in);
+                }
+                ++b;
+            }
+        }
+        if (b != header.num_blocks) {
+            throw std::runtime_error("Failed to deserialize grove: frames do not cover every block");
+        }
+    }
 
-            if (b < header.ext_block_begin) {
-                read_node_block(zis, header, g, result, b);
-            } else {
-                read_external_block(zis, g, result, b - header.ext_block_begin);
+    // One block's parse output, held by the parallel reader until the serial
+    // merge: its keys (in a vector reserved up front so emplace_back never
+    // moves them — nodes and edge refs point into it), and the child/next ids
+    // and edge refs read_node_block / read_external_block would have written
+    // into the shared result.
+    struct staged_block {
+        std::vector<gdt::key<key_type, data_type>> keys;
+        std::vector<gdt::key<key_type, data_type>*> ext_keys;
+        std::vector<detail::block_id> child_ids;
+        detail::block_id next_id = detail::no_block;
+        std::vector<pending_edge> pending;
+        pending_in_map pending_in;
+    };
+
+    // Per-worker scratch: a decoder must not be shared across threads. Created
+    // on first use — parallel_for default-constructs worker state, and the
+    // codec comes from the stream header.
+    struct inflate_worker {
+        std::optional<detail::block_decompressor> decoder;
+        std::string raw_buf;
+        std::vector<std::string_view> blocks;
+    };
+
+    // One frame's compressed bytes and block range, read up front by the
+    // parallel reader.
+    struct staged_frame {
+        detail::block_id first = 0;
+        uint32_t count = 0;
+        std::string comp;
+    };
+
+    // Parallel counterpart of read_deserialize_blocks(), in three phases:
+    //   1. read every frame's compressed bytes (sequential — one pass over is);
+    //   2. decode each frame and parse its blocks into their staged_blocks on
+    //      a worker pool;
+    //   3. move keys into the grove's storage in block order and rewrite the
+    //      node key pointers and edge-ref sources to the moved keys.
+    // Phase 3 appends keys, edges and incoming-edge refs in exactly the order
+    // the serial reader would, so everything downstream — linking, add_edge()
+    // replay, reorder_incoming() — behaves identically. Parsed nodes go straight
+    // into result.block_node (one slot per block, no sharing), so deserialize()'s
+    // failure cleanup frees them on any error, including one from a worker.
+    static void read_deserialize_blocks_parallel(std::istream& is, const deserialize_header& header,
+                                                 grove& g, deserialize_blocks_result& result,
+                                                 std::size_t num_threads) {
+        std::vector<staged_frame> frames(header.num_frames);
+        std::streamoff block_bytes_left = detail::remaining_bytes(is);
+        detail::block_id next = 0;
+        for (staged_frame& fr : frames) {
+            if (next == header.num_blocks) {
+                throw std::runtime_error("Failed to deserialize grove: more frames than blocks");
             }
+            fr.first = next;
+            fr.count = read_frame_bytes(is, header, next, block_bytes_left, fr.comp);
+            next += fr.count;
+        }
+        if (next != header.num_blocks) {
+            throw std::runtime_error("Failed to deserialize grove: frames do not cover every block");
+        }
+
+        // Workers write their nodes straight into block_node, so it is sized
+        // up front; the other per-block vectors are filled by the merge.
+        result.block_node.assign(header.ext_block_begin, nullptr);
+        std::vector<staged_block> staged(header.num_blocks);
+
+        ggu::parallel_for<inflate_worker>(frames.size(), num_threads,
+                                          [&](inflate_worker& w, std::size_t f) {
+            staged_frame& fr = frames[f];
+            if (!w.decoder) {
+                w.decoder.emplace(header.codec, header.dictionary);
+            }
+            // For the stored codec the views alias fr.comp, so the compressed
+            // bytes are released only once every block is parsed.
+            detail::split_frame(w.decoder->decode(fr.comp.data(), fr.comp.size(), w.raw_buf),
+                                fr.count, w.blocks);
+            for (uint32_t i = 0; i < fr.count; ++i) {
+                const detail::block_id b = fr.first + i;
+                staged_block& st = staged[b];
+                detail::memory_streambuf mb(w.blocks[i].data(), w.blocks[i].size());
+                std::istream zis(&mb);
+
+                if (b < header.ext_block_begin) {
+                    st.keys.reserve(static_cast<std::size_t>(header.order));
+                    node<key_type, data_type>* n = node<key_type, data_type>::deserialize_block(
+                        zis, header.order, st.keys, st.child_ids, st.next_id);
+                    result.block_node[b] = n;
+                    if (n->get_is_leaf()) {
+                        read_block_edges(zis, n->get_keys(), st.pending, st.pending_in);
+                    }
+                } else {
+                    st.keys.reserve(detail::max_external_keys_per_block);
+                    read_external_block(zis, st.keys, st.ext_keys, st.pending, st.pending_in);
+                }
+            }
+            std::string().swap(fr.comp);  // release the compressed bytes early
+        });
+
+        grow_block_slots(header, result, header.num_blocks);
+
+        for (detail::block_id b = 0; b < header.num_blocks; ++b) {
+            staged_block& st = staged[b];
+            const bool is_node = b < header.ext_block_begin;
+            auto& storage = is_node ? g.key_storage : g.external_key_storage;
+            std::vector<gdt::key<key_type, data_type>*>& final_keys = is_node
+                ? result.block_node[b]->get_keys()
+                : result.ext_block_keys[b - header.ext_block_begin];
+            final_keys.resize(st.keys.size());
+            for (std::size_t i = 0; i < st.keys.size(); ++i) {
+                storage.push_back(std::move(st.keys[i]));
+                final_keys[i] = &storage.back();
+            }
+            // Staged pointers index into st.keys; the slot is the offset.
+            const auto* staged_base = st.keys.data();
+            auto moved = [&](gdt::key<key_type, data_type>* k) {
+                return final_keys[static_cast<std::size_t>(k - staged_base)];
+            };
+            if (is_node) {
+                result.child_ids[b] = std::move(st.child_ids);
+                result.next_ids[b] = st.next_id;
+                if (result.block_node[b]->get_is_leaf()) {
+                    result.actual_leaf_key_count += final_keys.size();
+                }
+            }
+            for (auto& pe : st.pending) {
+                pe.src = moved(pe.src);
+                result.pending.push_back(std::move(pe));
+            }
+            for (auto& [src, refs] : st.pending_in) {
+                result.pending_in.emplace(moved(src), std::move(refs));
+            }
+            st = staged_block{};  // free this block's staging as we go
         }
     }
 
-    // Roots + rightmost leaves per index, staged for deserialize() to commit.
+    // Consumes the frame directory after the last frame. The eager reader has
+    // already walked every frame in order, so it only needs the stream left
+    // positioned after the grove (callers may have appended data of their own).
+    static void skip_deserialize_footer(std::istream& is, const deserialize_header& header) {
+        constexpr std::streamsize entry_bytes = sizeof(uint64_t) + sizeof(detail::block_id);
+        const std::streamsize footer_bytes = static_cast<std::streamsize>(header.num_frames) * entry_bytes;
+        is.ignore(footer_bytes);
+        if (is.gcount() != footer_bytes) {
+            throw std::runtime_error("Failed to deserialize grove: truncated block directory");
+        }
+    }
+
+    // Root + rightmost leaf of every index in file order, staged for
+    // deserialize() to commit.
     struct deserialize_linked {
-        root_map_t local_roots;
-        root_map_t local_rightmost;
+        struct index_tree {
+            std::string name;
+            node<key_type, data_type>* root;
+            node<key_type, data_type>* rightmost;
+        };
+        std::vector<index_tree> indices;
     };
 
     // Links each internal node's children and each leaf's next-leaf pointer
@@ -686,26 +1196,50 @@ private:
         }
 
         deserialize_linked linked;
+        linked.indices.reserve(header.index_roots.size());
+        std::unordered_set<std::string_view> seen_names;
         for (const auto& [name, root_id] : header.index_roots) {
             if (root_id >= header.ext_block_begin || blocks.block_node[root_id] == nullptr) {
                 throw std::runtime_error("Failed to deserialize grove: invalid root block id");
             }
+            if (!seen_names.insert(name).second) {
+                throw std::runtime_error("Failed to deserialize grove: duplicate index name");
+            }
             node<key_type, data_type>* root = blocks.block_node[root_id];
 
             // Routing maxima are derived state, so they are not serialized —
             // rebuild them now that children are linked. O(nodes).
             root->refresh_subtree_max_recursive();
 
-            linked.local_roots[name] = root;
             node<key_type, data_type>* cur = root;
             while (!cur->get_is_leaf() && !cur->get_children().empty()) {
                 cur = cur->get_children().back();
             }
-            linked.local_rightmost[name] = cur;
+            linked.indices.push_back({name, root, cur});
         }
         return linked;
     }
 
+    // Gives the deserialized data keys dense ids in file order: indexed keys
+    // block by block, then external keys. Called once the grove owns them.
+    static void number_deserialized_keys(const deserialize_header& header,
+                                         const deserialize_blocks_result& blocks, grove& g) {
+        g.keys_by_id.reserve(g.leaf_key_count + g.external_key_storage.size());
+        for (detail::block_id b = 0; b < header.ext_block_begin; ++b) {
+            const auto* n = blocks.block_node[b];
+            if (n->get_is_leaf()) {
+                for (auto* k : n->get_keys()) {
+                    g.number_key(k);
+                }
+            }
+        }
+        for (const auto& ks : blocks.ext_block_keys) {
+            for (auto* k : ks) {
+                g.number_key(k);
+            }
+        }
+    }
+
     // Resolves every pending edge (source known from its own block, target
     // resolved now that all blocks are read) and restores on-disk incoming
     // order, which add_edge() replay's block-visitation order does not
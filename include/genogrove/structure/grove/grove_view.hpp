@@ -6,28 +6,41 @@
 #ifndef GENOGROVE_STRUCTURE_GROVE_GROVE_VIEW_HPP
 #define GENOGROVE_STRUCTURE_GROVE_GROVE_VIEW_HPP
 
+#include <algorithm>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <deque>
 #include <fstream>
 #include <ios>
 #include <istream>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include "genogrove/data_type/expansion_result.hpp"
 #include "genogrove/data_type/key.hpp"
 #include "genogrove/data_type/key_type_base.hpp"
+#include "genogrove/data_type/nearest_query_result.hpp"
 #include "genogrove/data_type/query_result.hpp"
 #include "genogrove/data_type/serialization_traits.hpp"
+#include "genogrove/structure/grove/block_codec.hpp"
+#include "genogrove/structure/grove/edge_metadata_column.hpp"
 #include "genogrove/structure/grove/gg_block_format.hpp"
+#include "genogrove/structure/grove/graph_traversal.hpp"
+#include "genogrove/structure/grove/index_handle.hpp"
 #include "genogrove/structure/grove/node.hpp"
 #include "genogrove/structure/grove/pod_io.hpp"
 #include "genogrove/structure/grove/query_engine.hpp"
@@ -36,31 +49,34 @@
 namespace genogrove::structure {
 
 /**
- * @brief Read-only, partial reader over a serialized (format 0.3) grove.
+ * @brief Read-only, partial reader over a serialized (format 0.8) grove.
  *
  * Where grove::deserialize eagerly loads every block, grove_view loads only the
- * blocks a query walks. It reads the directory and builds a block_id -> file
- * offset index at open, then pages in individual blocks on demand and caches
- * them for its lifetime (no eviction — you keep what you touch). intersect() and
- * get_neighbors() share the same query engine as the in-memory grove; only how a
- * child / next-leaf / edge-target reference resolves differs.
+ * blocks a query walks. It reads the directory and the frame -> file offset
+ * index (the stream's footer) at open, then pages in individual blocks on demand
+ * and caches them for its lifetime (no eviction — you keep what you touch). A
+ * block is read by decoding its frame; the most recently decoded frame is kept,
+ * so walking a run of leaves packed into one frame decodes it once. intersect()
+ * and get_neighbors() share the same query engine as the in-memory grove; only
+ * how a child / next-leaf / edge-target reference resolves differs.
  *
  * Random access needs a seekable source, so open() takes a file path and owns
  * the ifstream. Not thread-safe. Non-copyable (owns the file + heap nodes).
  *
- * ponytail: cache never evicts and the offset index is a flat per-block table
- * read whole at open — fine until genome-scale block counts; add LRU eviction /
+ * ponytail: cache never evicts and the offset index is a flat per-frame table
+ * read whole at open — fine until genome-scale frame counts; add LRU eviction /
  * a hierarchical directory only when benchmarks show either dominates.
  */
 template <gdt::key_type_base key_type, typename data_type = void, typename edge_data_type = void>
 class grove_view {
     using key_t = gdt::key<key_type, data_type>;
     using node_t = node<key_type, data_type>;
+    using edge_meta_t = std::conditional_t<std::is_void_v<edge_data_type>, std::monostate, edge_data_type>;
 
   public:
     /**
      * @brief Open a serialized grove for partial reading.
-     * @param path Path to a file containing a `.gg` grove stream (format 0.3).
+     * @param path Path to a file containing a `.gg` grove stream (format 0.8).
      * @param data_offset Byte offset where the grove stream starts. Defaults to
      *        0 (a bare grove stream); pass the size of any leading wrapper (e.g.
      *        the CLI's `gg_header`) when the grove is embedded after a header.
@@ -77,7 +93,7 @@ class grove_view {
 
     grove_view(const grove_view&) = delete;
     grove_view& operator=(const grove_view&) = delete;
-    // Non-movable: block_inflater owns a z_stream and is move-deleted. open()
+    // Non-movable: block_decompressor owns codec state and is move-deleted. open()
     // returns by value via guaranteed copy elision, so no move is ever needed.
     grove_view(grove_view&&) = delete;
     grove_view& operator=(grove_view&&) = delete;
@@ -90,13 +106,18 @@ class grove_view {
      */
     [[nodiscard]] gdt::query_result<key_type, data_type> intersect(const key_type& query,
                                                                    std::string_view index) {
+        return intersect(query, resolve_index(index));
+    }
+
+    /** @brief Overlap query within the index given by a handle from resolve_index(). */
+    [[nodiscard]] gdt::query_result<key_type, data_type> intersect(const key_type& query,
+                                                                   index_handle index) {
         gdt::query_result<key_type, data_type> result{query};
-        auto it = index_roots.find(std::string(index));
-        if (it == index_roots.end()) {
+        if (index.id >= indices.size()) {
             return result;
         }
         block_resolver res{this};
-        detail::search_overlaps(res, load_node(it->second), query, result);
+        detail::search_overlaps(res, load_node(indices[index.id].second), query, result);
         return result;
     }
 
@@ -104,12 +125,41 @@ class grove_view {
     [[nodiscard]] gdt::query_result<key_type, data_type> intersect(const key_type& query) {
         gdt::query_result<key_type, data_type> result{query};
         block_resolver res{this};
-        for (const auto& [name, root_id] : index_roots) {
+        for (const auto& [name, root_id] : indices) {
             detail::search_overlaps(res, load_node(root_id), query, result);
         }
         return result;
     }
 
+    /**
+     * @brief Overlap query within one index followed by graph expansion, as
+     *        one pipeline; see grove::intersect_expand.
+     *
+     * Visited keys are deduplicated on their (block, slot) position with a
+     * bitmap, checked before a target is resolved, so an edge to an
+     * already-reached key — or one the edge filter rejects — never loads a
+     * block. Each level's surviving targets are loaded in block-id order.
+     */
+    template <typename EdgeFilter = follow_every_edge>
+        requires std::predicate<const EdgeFilter&, const edge_meta_t&>
+    [[nodiscard]] gdt::expansion_result<key_type, data_type> intersect_expand(
+        const key_type& query, std::string_view index,
+        const expansion_spec<key_type, EdgeFilter>& spec = {}) {
+        gdt::expansion_result<key_type, data_type> result{query};
+        expand_seeds(intersect(query, index).get_keys(), spec, result);
+        return result;
+    }
+
+    /** @brief Overlap query across every index followed by graph expansion. */
+    template <typename EdgeFilter = follow_every_edge>
+        requires std::predicate<const EdgeFilter&, const edge_meta_t&>
+    [[nodiscard]] gdt::expansion_result<key_type, data_type> intersect_expand(
+        const key_type& query, const expansion_spec<key_type, EdgeFilter>& spec = {}) {
+        gdt::expansion_result<key_type, data_type> result{query};
+        expand_seeds(intersect(query).get_keys(), spec, result);
+        return result;
+    }
+
     /**
      * @brief Nearest non-overlapping predecessor and successor of a query within
      *        a single index, loading only the blocks the descent walks.
@@ -140,22 +190,127 @@ class grove_view {
         requires detail::flanking_predicate<Pred, key_type>
     [[nodiscard]] gdt::flanking_query_result<key_type, data_type>
     flanking(const key_type& query, std::string_view index, Pred is_compatible) {
+        return flanking(query, resolve_index(index), is_compatible);
+    }
+
+    /** @brief flanking() on the index given by a handle from resolve_index(). */
+    [[nodiscard]] gdt::flanking_query_result<key_type, data_type>
+    flanking(const key_type& query, index_handle index) {
+        return flanking(query, index,
+            [](const key_type&, const key_type&) constexpr noexcept { return true; });
+    }
+
+    /** @brief flanking() with a compatibility filter on the index given by handle. */
+    template <typename Pred>
+        requires detail::flanking_predicate<Pred, key_type>
+    [[nodiscard]] gdt::flanking_query_result<key_type, data_type>
+    flanking(const key_type& query, index_handle index, Pred is_compatible) {
         gdt::flanking_query_result<key_type, data_type> result{};
-        auto it = index_roots.find(std::string(index));
-        if (it == index_roots.end()) {
+        if (index.id >= indices.size()) {
             return result;
         }
         block_resolver res{this};
-        detail::search_flanking(res, load_node(it->second), query, is_compatible, result);
+        detail::search_flanking(res, load_node(indices[index.id].second), query, is_compatible,
+                                result);
         return result;
     }
 
+    /**
+     * @brief Batched flanking over queries sorted in key order — one forward sweep
+     *        of the index's leaf chain.
+     *
+     * Returns exactly what grove::flanking_batch() would. Leaves are paged in in
+     * chain order, which with leaf-chain block packing reads the index's leaf
+     * frames front to back once.
+     *
+     * @throws std::invalid_argument if `queries` is not sorted
+     */
+    [[nodiscard]] std::vector<gdt::flanking_query_result<key_type, data_type>>
+    flanking_batch(std::span<const key_type> queries, std::string_view index)
+        requires requires { key_type::is_interval; }
+    {
+        return flanking_batch(queries, resolve_index(index));
+    }
+
+    /** @brief flanking_batch() on the index given by a handle from resolve_index(). */
+    [[nodiscard]] std::vector<gdt::flanking_query_result<key_type, data_type>>
+    flanking_batch(std::span<const key_type> queries, index_handle index)
+        requires requires { key_type::is_interval; }
+    {
+        if (!std::is_sorted(queries.begin(), queries.end())) {
+            throw std::invalid_argument("flanking_batch: queries must be sorted");
+        }
+        std::vector<gdt::flanking_query_result<key_type, data_type>> results;
+        block_resolver res{this};
+        node_t* root = index.id < indices.size() ? load_node(indices[index.id].second) : nullptr;
+        detail::sweep_flanking(res, root, queries, results);
+        return results;
+    }
+
+    /**
+     * @brief Up to k nearest keys on each side of a query within a single index,
+     *        loading only the blocks the bounded descent walks.
+     *
+     * Returns exactly what the eager grove's nearest() would (see there for the
+     * side and ordering rules); subtrees that cannot beat the k-th best
+     * candidate or lie beyond `options.max_distance` are never paged in. Both
+     * lists are empty if the index does not exist or k is 0.
+     */
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, std::string_view index, std::size_t k,
+            const nearest_options& options = {})
+        requires requires { key_type::is_interval; }
+    {
+        return nearest(query, resolve_index(index), k, options,
+            [](const key_type&, const key_type&) constexpr noexcept { return true; });
+    }
+
+    /** @brief nearest() with a compatibility filter (e.g. strand match). */
+    template <typename Pred>
+        requires detail::flanking_predicate<Pred, key_type> &&
+                 requires { key_type::is_interval; }
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, std::string_view index, std::size_t k,
+            const nearest_options& options, Pred is_compatible) {
+        return nearest(query, resolve_index(index), k, options, is_compatible);
+    }
+
+    /** @brief nearest() on the index given by a handle from resolve_index(). */
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, index_handle index, std::size_t k,
+            const nearest_options& options = {})
+        requires requires { key_type::is_interval; }
+    {
+        return nearest(query, index, k, options,
+            [](const key_type&, const key_type&) constexpr noexcept { return true; });
+    }
+
+    /** @brief nearest() with a compatibility filter on the index given by handle. */
+    template <typename Pred>
+        requires detail::flanking_predicate<Pred, key_type> &&
+                 requires { key_type::is_interval; }
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type>
+    nearest(const key_type& query, index_handle index, std::size_t k,
+            const nearest_options& options, Pred is_compatible) {
+        if (index.id >= indices.size() || k == 0) {
+            return {};
+        }
+        detail::nearest_state<key_type, data_type> state(k, options);
+        block_resolver res{this};
+        detail::search_nearest(res, load_node(indices[index.id].second), query, is_compatible,
+                               state);
+        return state.take();
+    }
+
     /**
      * @brief Outgoing graph neighbors of a key returned by this grove_view.
      *
-     * Loads each target's block on demand — the cross-chromosome hop. `source`
-     * must be a key pointer this grove_view produced (via intersect or a prior
-     * get_neighbors); edges are recorded when its block was paged in.
+     * Loads the targets' blocks — the cross-chromosome hop — in one batch
+     * before resolving any of them: block ids are sorted into file order and
+     * adjacent frames are read together (see load_blocks), so a key with many
+     * far-flung targets costs a forward sweep instead of one seek per edge.
+     * `source` must be a key pointer this grove_view produced (via intersect or
+     * a prior get_neighbors); edges are recorded when its block was paged in.
      */
     [[nodiscard]] std::vector<key_t*> get_neighbors(const key_t* source) {
         if (source == nullptr) {
@@ -166,6 +321,7 @@ class grove_view {
         if (it == adjacency.end()) {
             return out;
         }
+        load_edge_targets(it->second);
         out.reserve(it->second.size());
         for (const auto& e : it->second) {
             out.push_back(resolve_target(e.tb, e.ts));
@@ -173,10 +329,30 @@ class grove_view {
         return out;
     }
 
+    /**
+     * @brief Outgoing graph neighbors of each of `sources`, one list per source.
+     *
+     * Every target block of every source is loaded in a single batch first —
+     * one file-order pass for a whole traversal frontier — then each list is
+     * resolved as get_neighbors would.
+     */
+    [[nodiscard]] std::vector<std::vector<key_t*>> get_neighbors(std::span<key_t* const> sources) {
+        if (std::ranges::find(sources, nullptr) != sources.end()) {
+            throw std::invalid_argument("get_neighbors: source must not be null");
+        }
+        prefetch_neighbors(sources);
+        std::vector<std::vector<key_t*>> out;
+        out.reserve(sources.size());
+        for (const key_t* k : sources) {
+            out.push_back(get_neighbors(k));
+        }
+        return out;
+    }
+
     /**
      * @brief Incoming graph neighbors of a key returned by this grove_view.
      *
-     * Loads each source's block on demand, exactly like get_neighbors. `target`
+     * Loads the sources' blocks in one batch, exactly like get_neighbors. `target`
      * must be a key pointer this grove_view produced; incoming edges are
      * recorded co-located with `target`'s own block (written there by the .gg
      * writer alongside its outgoing edges), so no scan of other blocks is needed.
@@ -190,6 +366,7 @@ class grove_view {
         if (it == in_adjacency.end()) {
             return out;
         }
+        load_edge_targets(it->second);
         out.reserve(it->second.size());
         for (const auto& e : it->second) {
             out.push_back(resolve_target(e.tb, e.ts));
@@ -244,8 +421,8 @@ class grove_view {
     /**
      * @brief Outgoing neighbors of `source` whose edge metadata satisfies `pred`.
      *
-     * Only available when edge_data_type is non-void. Resolves the surviving
-     * targets' blocks on demand, exactly like get_neighbors.
+     * Only available when edge_data_type is non-void. Loads the surviving
+     * targets' blocks in one batch, exactly like get_neighbors.
      */
     template <typename Predicate>
     [[nodiscard]] std::vector<key_t*> get_neighbors_if(const key_t* source, Predicate pred)
@@ -259,19 +436,29 @@ class grove_view {
         if (it == adjacency.end()) {
             return out;
         }
+        std::vector<const edge_ref*> kept;
         for (const auto& e : it->second) {
             if (pred(e.meta)) {
-                out.push_back(resolve_target(e.tb, e.ts));
+                kept.push_back(&e);
             }
         }
+        std::vector<detail::block_id> blocks;
+        for (const edge_ref* e : kept) {
+            blocks.push_back(e->tb);
+        }
+        load_blocks(blocks);
+        out.reserve(kept.size());
+        for (const edge_ref* e : kept) {
+            out.push_back(resolve_target(e->tb, e->ts));
+        }
         return out;
     }
 
     /**
      * @brief Incoming sources of `target` whose edge metadata satisfies `pred`.
      *
-     * Only available when edge_data_type is non-void. Resolves the surviving
-     * sources' blocks on demand, exactly like get_in_neighbors.
+     * Only available when edge_data_type is non-void. Loads the surviving
+     * sources' blocks in one batch, exactly like get_in_neighbors.
      */
     template <typename Predicate>
     [[nodiscard]] std::vector<key_t*> get_in_neighbors_if(const key_t* target, Predicate pred)
@@ -285,18 +472,28 @@ class grove_view {
         if (it == in_adjacency.end()) {
             return out;
         }
+        std::vector<const edge_ref*> kept;
         for (const auto& e : it->second) {
             if (pred(e.meta)) {
-                out.push_back(resolve_target(e.tb, e.ts));
+                kept.push_back(&e);
             }
         }
+        std::vector<detail::block_id> blocks;
+        for (const edge_ref* e : kept) {
+            blocks.push_back(e->tb);
+        }
+        load_blocks(blocks);
+        out.reserve(kept.size());
+        for (const edge_ref* e : kept) {
+            out.push_back(resolve_target(e->tb, e->ts));
+        }
         return out;
     }
 
     /**
      * @brief Each outgoing target of `source` paired with its edge metadata, in edge order.
      *
-     * Only available when edge_data_type is non-void. Resolves targets on demand
+     * Only available when edge_data_type is non-void. Loads targets in one batch
      * exactly like get_neighbors, so it throws std::invalid_argument on a null
      * source (unlike the metadata-only get_edges, which returns empty). Parity
      * with graph_overlay::get_edge_list. Empty vector for a source with no edges.
@@ -312,6 +509,7 @@ class grove_view {
         if (it == adjacency.end()) {
             return out;
         }
+        load_edge_targets(it->second);
         out.reserve(it->second.size());
         for (const auto& e : it->second) {
             out.emplace_back(resolve_target(e.tb, e.ts), e.meta);
@@ -322,7 +520,7 @@ class grove_view {
     /**
      * @brief Each incoming source of `target` paired with its edge metadata, in edge order.
      *
-     * Only available when edge_data_type is non-void. Resolves sources on demand
+     * Only available when edge_data_type is non-void. Loads sources in one batch
      * exactly like get_in_neighbors, so it throws std::invalid_argument on a null
      * target (unlike the metadata-only get_in_edges, which returns empty). Parity
      * with graph_overlay::get_in_edge_list. Empty vector for a target with no
@@ -339,6 +537,7 @@ class grove_view {
         if (it == in_adjacency.end()) {
             return out;
         }
+        load_edge_targets(it->second);
         out.reserve(it->second.size());
         for (const auto& e : it->second) {
             out.emplace_back(resolve_target(e.tb, e.ts), e.meta);
@@ -346,6 +545,195 @@ class grove_view {
         return out;
     }
 
+    // ---- Lazy adjacency views ---------------------------------------------
+    // Allocation-free counterparts of the get_* accessors: each walks the
+    // key's recorded edge list in place and resolves the key at the other end
+    // only when an element is dereferenced, so a traversal that stops early
+    // pages in only the blocks it visited. A key's recorded edges never change
+    // once its block is loaded, so a view stays valid for this grove_view's
+    // lifetime.
+
+    /**
+     * @brief Lazy counterpart of get_neighbors.
+     * @throws std::invalid_argument if `source` is null
+     */
+    [[nodiscard]] auto neighbors_view(const key_t* source) {
+        if (source == nullptr) {
+            throw std::invalid_argument("neighbors_view: source must not be null");
+        }
+        return recorded_edges(adjacency, source) | std::views::transform(resolve_ref());
+    }
+
+    /**
+     * @brief Lazy counterpart of get_in_neighbors.
+     * @throws std::invalid_argument if `target` is null
+     */
+    [[nodiscard]] auto in_neighbors_view(const key_t* target) {
+        if (target == nullptr) {
+            throw std::invalid_argument("in_neighbors_view: target must not be null");
+        }
+        return recorded_edges(in_adjacency, target) | std::views::transform(resolve_ref());
+    }
+
+    /**
+     * @brief Each outgoing edge of `source` as (target, metadata), resolved lazily.
+     *
+     * The metadata is a reference to the copy parsed with `source`'s block
+     * (std::monostate when edge_data_type is void). Lazy counterpart of get_edge_list.
+     * @throws std::invalid_argument if `source` is null
+     */
+    [[nodiscard]] auto out_edges_view(const key_t* source) {
+        if (source == nullptr) {
+            throw std::invalid_argument("out_edges_view: source must not be null");
+        }
+        return recorded_edges(adjacency, source) | std::views::transform(resolve_pair());
+    }
+
+    /**
+     * @brief Each incoming edge of `target` as (source, metadata), resolved lazily.
+     *
+     * Lazy counterpart of get_in_edge_list; see out_edges_view.
+     * @throws std::invalid_argument if `target` is null
+     */
+    [[nodiscard]] auto in_edges_view(const key_t* target) {
+        if (target == nullptr) {
+            throw std::invalid_argument("in_edges_view: target must not be null");
+        }
+        return recorded_edges(in_adjacency, target) | std::views::transform(resolve_pair());
+    }
+
+    /**
+     * @brief Lazy counterpart of get_neighbors_if: only surviving targets are resolved.
+     * @throws std::invalid_argument if `source` is null
+     */
+    template <typename Predicate>
+    [[nodiscard]] auto neighbors_if_view(const key_t* source, Predicate pred)
+        requires(!std::is_void_v<edge_data_type> &&
+                 std::predicate<Predicate, const edge_data_type&>) {
+        if (source == nullptr) {
+            throw std::invalid_argument("neighbors_if_view: source must not be null");
+        }
+        return recorded_edges(adjacency, source)
+            | std::views::filter([pred](const edge_ref& e) { return pred(e.meta); })
+            | std::views::transform(resolve_ref());
+    }
+
+    /**
+     * @brief Lazy counterpart of get_in_neighbors_if: only surviving sources are resolved.
+     * @throws std::invalid_argument if `target` is null
+     */
+    template <typename Predicate>
+    [[nodiscard]] auto in_neighbors_if_view(const key_t* target, Predicate pred)
+        requires(!std::is_void_v<edge_data_type> &&
+                 std::predicate<Predicate, const edge_data_type&>) {
+        if (target == nullptr) {
+            throw std::invalid_argument("in_neighbors_if_view: target must not be null");
+        }
+        return recorded_edges(in_adjacency, target)
+            | std::views::filter([pred](const edge_ref& e) { return pred(e.meta); })
+            | std::views::transform(resolve_ref());
+    }
+
+    // ---- Traversal ----------------------------------------------------------
+    // The same walks as graph_overlay (see graph_traversal.hpp), over the
+    // paged adjacency. Before a BFS level (or a DFS key) is expanded, every
+    // neighbor block it is about to resolve is loaded in one ascending pass,
+    // so targets packed into a shared frame decode that frame once instead of
+    // once per alternation with another frame.
+
+    /**
+     * @brief Load the blocks holding every outgoing neighbor of `keys`.
+     *
+     * Blocks are loaded in block-id order, which is file order, so a frontier
+     * whose targets share frames reads each frame once, and frames close
+     * together on disk are read in one request (see load_blocks).
+     * Already-loaded blocks cost nothing. Traversals call this per level; call
+     * it directly before resolving many keys' neighbors by hand.
+     */
+    void prefetch_neighbors(std::span<key_t* const> keys) {
+        std::vector<detail::block_id> blocks;
+        for (const key_t* k : keys) {
+            for (const auto& e : recorded_edges(adjacency, k)) {
+                if (!block_loaded(e.tb)) {
+                    blocks.push_back(e.tb);
+                }
+            }
+        }
+        load_blocks(blocks);
+    }
+
+    /**
+     * @brief Breadth-first walk over outgoing edges; see graph_overlay::bfs.
+     * @throws std::invalid_argument if `start` is null
+     */
+    template <typename Visitor>
+        requires detail::traversal_visitor<Visitor, key_t*>
+    void bfs(key_t* start, Visitor visit, std::size_t max_depth = unbounded_depth) {
+        if (start == nullptr) {
+            throw std::invalid_argument("bfs: start must not be null");
+        }
+        paged_adjacency adj{this};
+        detail::breadth_first(adj, start, max_depth, visit);
+    }
+
+    /**
+     * @brief Depth-first (pre-order) walk over outgoing edges; see graph_overlay::dfs.
+     * @throws std::invalid_argument if `start` is null
+     */
+    template <typename Visitor>
+        requires detail::traversal_visitor<Visitor, key_t*>
+    void dfs(key_t* start, Visitor visit, std::size_t max_depth = unbounded_depth) {
+        if (start == nullptr) {
+            throw std::invalid_argument("dfs: start must not be null");
+        }
+        paged_adjacency adj{this};
+        detail::depth_first(adj, start, max_depth, visit);
+    }
+
+    /**
+     * @brief Keys reachable from `start` in 1 to `k` hops, in BFS order; see
+     *        graph_overlay::k_hop.
+     * @throws std::invalid_argument if `start` is null
+     */
+    [[nodiscard]] std::vector<key_t*> k_hop(key_t* start, std::size_t k) {
+        std::vector<key_t*> out;
+        bfs(start, [&out, start](key_t* key, std::size_t) {
+            if (key != start) {
+                out.push_back(key);
+            }
+        }, k);
+        return out;
+    }
+
+    /**
+     * @brief Simple paths from `from` to `to`; see graph_overlay::all_paths.
+     * @throws std::invalid_argument if `from` or `to` is null
+     */
+    [[nodiscard]] std::vector<std::vector<key_t*>> all_paths(key_t* from, key_t* to,
+                                                             std::size_t max_paths,
+                                                             std::size_t max_depth = unbounded_depth) {
+        if (from == nullptr || to == nullptr) {
+            throw std::invalid_argument("all_paths: from and to must not be null");
+        }
+        paged_adjacency adj{this};
+        return detail::simple_paths(adj, from, to, max_paths, max_depth);
+    }
+
+    /**
+     * @brief Topological order of the keys reachable from `roots`; see
+     *        graph_overlay::topological_order. (A view has no whole-graph
+     *        overload: enumerating every key would load every block.)
+     * @throws std::invalid_argument if a root is null
+     * @throws std::runtime_error if the reachable subgraph has a cycle
+     */
+    [[nodiscard]] std::vector<key_t*> topological_order(std::span<key_t* const> roots) {
+        if (std::ranges::find(roots, nullptr) != roots.end()) {
+            throw std::invalid_argument("topological_order: roots must not be null");
+        }
+        paged_adjacency adj{this};
+        return detail::topological_sort(adj, roots);
+    }
+
     /**
      * @brief Number of outgoing edges from `source`, or 0 if `source` is null or
      *        has none.
@@ -373,31 +761,59 @@ class grove_view {
     /// The B+ tree order the `.gg` was built with. Mirrors grove::get_order().
     [[nodiscard]] int get_order() const { return order; }
 
-    /// Names of every index (e.g. chromosome) in the `.gg`, in unspecified order
-    /// (like grove's unordered root map). The view-appropriate analogue of
+    /// Names of every index (e.g. chromosome) in the `.gg`, in directory order:
+    /// the order the writing grove's get_root_nodes() iterated, i.e. the order
+    /// its indices were first used. The view-appropriate analogue of
     /// grove::get_root_nodes() — lets a caller discover what intersect(query) /
     /// flanking can run against. Reads nothing extra: the directory is already
     /// in memory from open().
     [[nodiscard]] std::vector<std::string> get_index_names() const {
         std::vector<std::string> names;
-        names.reserve(index_roots.size());
-        for (const auto& [name, root_id] : index_roots) {
+        names.reserve(indices.size());
+        for (const auto& [name, root_id] : indices) {
             names.push_back(name);
         }
         return names;
     }
 
+    /**
+     * @brief Resolve an index name to a handle for the handle overloads of
+     *        intersect() / flanking()
+     * @return The handle, or an invalid handle if the `.gg` has no such index
+     * @note A view is read-only, so unknown names are not interned; this is
+     *       find_index() under the name index_handle_map expects.
+     */
+    [[nodiscard]] index_handle resolve_index(std::string_view index) const {
+        return find_index(index);
+    }
+
+    /// @copydoc resolve_index
+    [[nodiscard]] index_handle find_index(std::string_view index) const {
+        if (auto it = index_ids.find(index); it != index_ids.end()) {
+            return {it->second};
+        }
+        return {};
+    }
+
     /// Blocks paged in so far — for tests asserting a query is actually partial.
     [[nodiscard]] std::size_t blocks_loaded() const { return node_cache.size() + ext_cache.size(); }
     /// Total block count from the directory.
     [[nodiscard]] detail::block_id block_count() const { return num_blocks; }
+    /// Frames read and decoded so far (a frame re-read after another frame
+    /// was decoded counts again) — the I/O a query actually cost.
+    [[nodiscard]] std::size_t frames_loaded() const { return frames_read; }
+    /// Total frame count from the directory.
+    [[nodiscard]] std::size_t frame_count() const { return frame_offsets.size(); }
+    /// Seek-and-read requests issued against the file so far. A batch of
+    /// frames read together (see prefetch_neighbors) counts once.
+    [[nodiscard]] std::size_t reads_issued() const { return file_reads; }
 
   private:
     struct edge_ref {
         detail::block_id tb;
         std::uint32_t ts;
         [[no_unique_address]]
-        std::conditional_t<std::is_void_v<edge_data_type>, std::monostate, edge_data_type> meta;
+        edge_meta_t meta;
     };
     struct loaded_node {
         std::unique_ptr<node_t> n;
@@ -409,9 +825,11 @@ class grove_view {
     int order = 0;
     detail::block_id num_blocks = 0;
     detail::block_id ext_block_begin = 0;
-    std::vector<std::uint64_t> block_offsets;  // block_id -> offset of [clen][bytes]
-    std::uint64_t stream_size = 0;  // file end; bounds each block's clen without a seek (#513)
-    std::unordered_map<std::string, detail::block_id> index_roots;
+    std::vector<std::uint64_t> frame_offsets;       // frame -> offset of [count][clen][bytes]
+    std::vector<detail::block_id> frame_first;      // frame -> first block_id, ascending
+    std::uint64_t stream_size = 0;  // file end; bounds each frame's clen without a seek (#513)
+    std::vector<std::pair<std::string, detail::block_id>> indices;  // handle id -> (name, root block)
+    std::unordered_map<std::string, std::uint32_t, string_hash, std::equal_to<>> index_ids;  // name -> handle id
 
     std::deque<key_t> key_storage;  // stable addresses for loaded keys
     std::unordered_map<detail::block_id, loaded_node> node_cache;
@@ -420,17 +838,32 @@ class grove_view {
     std::unordered_map<const key_t*, std::vector<edge_ref>> adjacency;
     std::unordered_map<const key_t*, std::vector<edge_ref>> in_adjacency;
 
-    detail::block_inflater inflater;
+    std::optional<detail::block_decompressor> decoder;  // codec comes from the header
     std::string comp_buf;
     std::string raw_buf;
+    // The last decoded frame: its index and its blocks' views into comp_buf
+    // (stored codec) or raw_buf. Consecutive loads from one frame reuse it.
+    std::size_t cached_frame = std::numeric_limits<std::size_t>::max();
+    std::vector<std::string_view> frame_blocks;
+    std::size_t frames_read = 0;
+    std::size_t file_reads = 0;
+    std::uint64_t run_offset = 0;  // file offset of comp_buf[0] after read_frame_run
+
+    // A batch load reads consecutive needed frames with one request when the
+    // bytes between them (frames nobody asked for) are at most coalesce_gap,
+    // up to coalesce_limit bytes per request.
+    static constexpr std::uint64_t coalesce_gap = std::uint64_t{64} << 10;
+    static constexpr std::uint64_t coalesce_limit = std::uint64_t{16} << 20;
 
     explicit grove_view(std::unique_ptr<std::ifstream> f, std::streamoff data_offset)
         : file(std::move(f)) {
         read_directory_and_scan(data_offset);
     }
 
-    // Read the plain directory, then walk the length-prefix chain once to record
-    // each block's offset (reading only the 8-byte length, seeking past the data).
+    // Read the plain directory, then the frame offsets: from the footer when the
+    // header records where it is, otherwise by walking the frame chain once
+    // (reading only each frame's count and length, seeking past the data) — a
+    // stream written to a non-seekable sink has no patched footer offset.
     void read_directory_and_scan(std::streamoff data_offset) {
         std::istream& is = *file;
         is.seekg(data_offset, std::ios::beg);
@@ -441,8 +874,30 @@ class grove_view {
         is.read(magic.data(), static_cast<std::streamsize>(magic.size()));
         if (is.gcount() != static_cast<std::streamsize>(magic.size()) ||
             magic != detail::grove_stream_magic) {
-            throw std::runtime_error("grove_view: bad magic (not a format 0.3 grove stream)");
+            throw std::runtime_error("grove_view: bad magic (not a format 0.8 grove stream)");
+        }
+
+        std::uint64_t footer_offset;
+        detail::read_pod(is, footer_offset);
+        std::uint8_t codec_field;
+        std::uint32_t dict_len;
+        detail::read_pod(is, codec_field);
+        detail::read_pod(is, dict_len);
+        if (!is) {
+            throw std::runtime_error("grove_view: stream error reading codec");
         }
+        const auto codec = static_cast<block_codec>(codec_field);
+        detail::require_block_codec(codec, "grove_view");
+        if (dict_len > detail::max_block_dictionary_size) {
+            throw std::runtime_error("grove_view: dictionary length out of range");
+        }
+        detail::require_backing_bytes(is, dict_len, 1, "dictionary");
+        std::string dictionary(dict_len, '\0');
+        is.read(dictionary.data(), static_cast<std::streamsize>(dict_len));
+        if (!is) {
+            throw std::runtime_error("grove_view: stream error reading dictionary");
+        }
+        decoder.emplace(codec, dictionary);
 
         detail::read_pod(is, order);
         if (!is) {
@@ -474,16 +929,20 @@ class grove_view {
             if (!is) {
                 throw std::runtime_error("grove_view: stream error reading root block id");
             }
-            index_roots.emplace(std::move(name), root_id);
+            if (index_ids.emplace(name, static_cast<std::uint32_t>(indices.size())).second) {
+                indices.emplace_back(std::move(name), root_id);
+            }
         }
 
         // leaf/external key counts are validation aids the eager reader uses;
         // the view reader parses on demand and ignores them.
         std::uint64_t leaf_count, ext_count;
+        std::uint32_t num_frames;
         detail::read_pod(is, num_blocks);
         detail::read_pod(is, ext_block_begin);
         detail::read_pod(is, leaf_count);
         detail::read_pod(is, ext_count);
+        detail::read_pod(is, num_frames);
         (void)leaf_count;
         (void)ext_count;
         if (!is) {
@@ -492,67 +951,234 @@ class grove_view {
         if (ext_block_begin > num_blocks) {
             throw std::runtime_error("grove_view: external-block-begin exceeds block count");
         }
-        // num_blocks is file-controlled; each block is at least an 8-byte length
-        // prefix on disk, so reject a count the file can't back before resizing
-        // block_offsets (a corrupt header could otherwise force a huge alloc).
-        detail::require_backing_bytes(is, num_blocks, sizeof(std::uint64_t), "block");
+        if (num_frames > num_blocks ||
+            num_blocks > std::uint64_t{num_frames} * detail::max_blocks_per_frame) {
+            throw std::runtime_error("grove_view: frame count inconsistent with block count");
+        }
+        // num_frames is file-controlled; each frame is at least its count +
+        // length prefix on disk, so reject a count the file can't back before
+        // resizing the frame tables (a corrupt header could otherwise force a
+        // huge alloc).
+        detail::require_backing_bytes(is, num_frames, sizeof(std::uint32_t) + sizeof(std::uint64_t),
+                                      "frame");
 
-        block_offsets.resize(num_blocks);
-        for (detail::block_id b = 0; b < num_blocks; ++b) {
+        if (footer_offset != 0) {
+            read_footer(data_offset, footer_offset, num_frames);
+            return;
+        }
+        frame_offsets.resize(num_frames);
+        frame_first.resize(num_frames);
+        detail::block_id next = 0;
+        for (std::uint32_t f = 0; f < num_frames; ++f) {
             std::streampos pos = is.tellg();
             if (pos == std::streampos(-1)) {
                 throw std::runtime_error("grove_view: source is not seekable");
             }
-            block_offsets[b] = static_cast<std::uint64_t>(pos);
+            frame_offsets[f] = static_cast<std::uint64_t>(pos);
+            frame_first[f] = next;
+            std::uint32_t count;
             std::uint64_t clen;
+            detail::read_pod(is, count);
             detail::read_pod(is, clen);
             if (!is) {
-                throw std::runtime_error("grove_view: stream error scanning block length");
+                throw std::runtime_error("grove_view: stream error scanning frame header");
             }
+            if (count == 0 || count > detail::max_blocks_per_frame || count > num_blocks - next) {
+                throw std::runtime_error("grove_view: frame block count out of range");
+            }
+            next += count;
             is.seekg(static_cast<std::streamoff>(clen), std::ios::cur);
             if (!is) {
-                throw std::runtime_error("grove_view: truncated block during scan");
+                throw std::runtime_error("grove_view: truncated frame during scan");
             }
         }
-        // End of the block region — used to bound each block's clen at load time
+        if (next != num_blocks) {
+            throw std::runtime_error("grove_view: frames do not cover every block");
+        }
+        // End of the frame region — used to bound each frame's clen at load time
         // by arithmetic instead of a per-load seek-to-end (#513).
         const std::streampos end = is.tellg();
         stream_size = (end == std::streampos(-1)) ? 0 : static_cast<std::uint64_t>(end);
     }
 
-    // Seek to block b, read its length prefix, and inflate it into raw_buf.
-    void read_block_raw(detail::block_id b) {
+    // Read the footer's per-frame (offset, first block_id) entries and rebase
+    // the stream-relative offsets onto the file. Every entry is
+    // file-controlled, so offsets must fall strictly between the end of the
+    // directory and the footer, in increasing order, and first block ids must
+    // start at 0 and increase within num_blocks — anything else would let a
+    // corrupt footer aim a load at the directory or at another frame's bytes.
+    // A frame's on-disk block count is checked against its span at load time.
+    void read_footer(std::streamoff data_offset, std::uint64_t footer_offset,
+                     std::uint32_t num_frames) {
+        std::istream& is = *file;
+        const std::streampos dir_end = is.tellg();
+        if (dir_end == std::streampos(-1)) {
+            throw std::runtime_error("grove_view: source is not seekable");
+        }
+        const auto first_block = static_cast<std::uint64_t>(dir_end);
+        const std::uint64_t footer_pos = static_cast<std::uint64_t>(data_offset) + footer_offset;
+        if (footer_pos < first_block) {
+            throw std::runtime_error("grove_view: block directory offset out of range");
+        }
+        is.seekg(static_cast<std::streamoff>(footer_pos), std::ios::beg);
+        if (!is) {
+            throw std::runtime_error("grove_view: seek to block directory failed");
+        }
+        constexpr std::uint64_t frame_prefix = sizeof(std::uint32_t) + sizeof(std::uint64_t);
+        detail::require_backing_bytes(is, num_frames, sizeof(std::uint64_t) + sizeof(detail::block_id),
+                                      "frame directory");
+        frame_offsets.resize(num_frames);
+        frame_first.resize(num_frames);
+        std::uint64_t min_next = first_block;
+        for (std::uint32_t f = 0; f < num_frames; ++f) {
+            std::uint64_t rel;
+            detail::block_id first;
+            detail::read_pod(is, rel);
+            detail::read_pod(is, first);
+            if (!is) {
+                throw std::runtime_error("grove_view: stream error reading frame directory");
+            }
+            // Each frame is at least its count + length prefix.
+            if (rel > footer_offset || footer_offset - rel < frame_prefix) {
+                throw std::runtime_error("grove_view: frame directory entry out of range");
+            }
+            const std::uint64_t pos = static_cast<std::uint64_t>(data_offset) + rel;
+            if (pos < min_next) {
+                throw std::runtime_error("grove_view: frame directory entry out of range");
+            }
+            if ((f == 0 && first != 0) || (f > 0 && first <= frame_first[f - 1]) || first >= num_blocks) {
+                throw std::runtime_error("grove_view: frame directory block id out of range");
+            }
+            frame_offsets[f] = pos;
+            frame_first[f] = first;
+            min_next = pos + frame_prefix;
+        }
+        // Frames end where the footer starts — a tighter clen bound than EOF.
+        stream_size = footer_pos;
+    }
+
+    // Returns block b's uncompressed bytes (a view into comp_buf for the
+    // stored codec, raw_buf otherwise), valid until a block from another frame
+    // is loaded. Decodes b's frame unless it is the one decoded last.
+    std::string_view read_block_raw(detail::block_id b) {
         // Choke point for every block load. A malformed edge target can reach
         // load_external with an id past the block count, so bound-check here
-        // before indexing block_offsets (load_node is already guarded separately).
+        // before searching the frame table (load_node is already guarded separately).
         if (b >= num_blocks) {
             throw std::runtime_error("grove_view: block id out of range");
         }
+        const std::size_t f = frame_of(b);
+        if (f != cached_frame) {
+            read_frame(f);
+        }
+        return frame_blocks[b - frame_first[f]];
+    }
+
+    // frame_first starts at 0 and ascends, so b's frame is the last whose
+    // first block is <= b.
+    [[nodiscard]] std::size_t frame_of(detail::block_id b) const {
+        return static_cast<std::size_t>(
+            std::upper_bound(frame_first.begin(), frame_first.end(), b) - frame_first.begin() - 1);
+    }
+
+    // Seek to frame f, read its count + length prefix, decode it and split it
+    // into frame_blocks.
+    void read_frame(std::size_t f) {
+        cached_frame = std::numeric_limits<std::size_t>::max();  // until f decodes cleanly
         std::istream& is = *file;
         is.clear();
-        is.seekg(static_cast<std::streamoff>(block_offsets[b]), std::ios::beg);
+        is.seekg(static_cast<std::streamoff>(frame_offsets[f]), std::ios::beg);
         if (!is) {
-            throw std::runtime_error("grove_view: seek to block failed");
+            throw std::runtime_error("grove_view: seek to frame failed");
         }
+        std::uint32_t count;
         std::uint64_t clen;
+        detail::read_pod(is, count);
         detail::read_pod(is, clen);
         if (!is) {
-            throw std::runtime_error("grove_view: stream error reading block length");
-        }
-        if (clen > static_cast<std::uint64_t>(std::numeric_limits<std::streamsize>::max())) {
-            throw std::runtime_error("grove_view: block length out of range");
-        }
-        // clen bytes must fit between this block's data start and the file end
-        // (measured once at scan time) — arithmetic only, no per-load seek (#513).
-        if (stream_size != 0 && clen > stream_size - block_offsets[b] - sizeof(clen)) {
-            throw std::runtime_error("grove_view: compressed block length exceeds file");
+            throw std::runtime_error("grove_view: stream error reading frame header");
         }
+        check_frame_header(f, count, clen);
         comp_buf.resize(static_cast<std::size_t>(clen));
         is.read(comp_buf.data(), static_cast<std::streamsize>(clen));
         if (is.gcount() != static_cast<std::streamsize>(clen)) {
-            throw std::runtime_error("grove_view: truncated block");
+            throw std::runtime_error("grove_view: truncated frame");
+        }
+        ++file_reads;
+        decode_frame(f, count, comp_buf.data(), clen);
+    }
+
+    // Validates frame f's count + length prefix against the directory.
+    void check_frame_header(std::size_t f, std::uint32_t count, std::uint64_t clen) const {
+        const detail::block_id end = f + 1 < frame_first.size() ? frame_first[f + 1] : num_blocks;
+        if (count != end - frame_first[f]) {
+            throw std::runtime_error("grove_view: frame block count disagrees with frame directory");
+        }
+        if (clen > static_cast<std::uint64_t>(std::numeric_limits<std::streamsize>::max())) {
+            throw std::runtime_error("grove_view: frame length out of range");
+        }
+        // clen bytes must fit between this frame's data start and the file end
+        // (measured once at open) — arithmetic only, no per-load seek (#513).
+        if (stream_size != 0 &&
+            clen > stream_size - frame_offsets[f] - sizeof(count) - sizeof(clen)) {
+            throw std::runtime_error("grove_view: compressed frame length exceeds file");
         }
-        inflater.decompress(comp_buf.data(), static_cast<std::size_t>(clen), raw_buf);
+    }
+
+    // Decodes frame f's compressed bytes into frame_blocks and makes it the
+    // cached frame. For the stored codec the blocks alias `data`.
+    void decode_frame(std::size_t f, std::uint32_t count, const char* data, std::uint64_t clen) {
+        ++frames_read;
+        detail::split_frame(decoder->decode(data, static_cast<std::size_t>(clen), raw_buf),
+                            count, frame_blocks);
+        cached_frame = f;
+    }
+
+    // Frame f's bytes on disk end where frame f + 1 starts (the footer, for
+    // the last frame), or 0 if that is unknown.
+    [[nodiscard]] std::uint64_t frame_end(std::size_t f) const {
+        return f + 1 < frame_offsets.size() ? frame_offsets[f + 1] : stream_size;
+    }
+
+    // Reads frames [first, last] (file-order neighbours, possibly with frames
+    // nobody needs between them) into comp_buf with one request. The bytes
+    // stay there until the next read; decode_run_frame() decodes from them.
+    void read_frame_run(std::size_t first, std::size_t last) {
+        cached_frame = std::numeric_limits<std::size_t>::max();
+        const std::uint64_t begin = frame_offsets[first];
+        const std::uint64_t bytes = frame_end(last) - begin;
+        std::istream& is = *file;
+        is.clear();
+        is.seekg(static_cast<std::streamoff>(begin), std::ios::beg);
+        if (!is) {
+            throw std::runtime_error("grove_view: seek to frame failed");
+        }
+        comp_buf.resize(static_cast<std::size_t>(bytes));
+        is.read(comp_buf.data(), static_cast<std::streamsize>(bytes));
+        if (is.gcount() != static_cast<std::streamsize>(bytes)) {
+            throw std::runtime_error("grove_view: truncated frame");
+        }
+        ++file_reads;
+        run_offset = begin;
+    }
+
+    // Decodes frame f out of the run read_frame_run() last read.
+    void decode_run_frame(std::size_t f) {
+        cached_frame = std::numeric_limits<std::size_t>::max();
+        const std::size_t at = static_cast<std::size_t>(frame_offsets[f] - run_offset);
+        const std::size_t extent = static_cast<std::size_t>(frame_end(f) - frame_offsets[f]);
+        std::uint32_t count;
+        std::uint64_t clen;
+        if (extent < sizeof(count) + sizeof(clen)) {
+            throw std::runtime_error("grove_view: stream error reading frame header");
+        }
+        std::memcpy(&count, comp_buf.data() + at, sizeof(count));
+        std::memcpy(&clen, comp_buf.data() + at + sizeof(count), sizeof(clen));
+        check_frame_header(f, count, clen);
+        if (clen > extent - sizeof(count) - sizeof(clen)) {
+            throw std::runtime_error("grove_view: compressed frame length exceeds frame directory");
+        }
+        decode_frame(f, count, comp_buf.data() + at + sizeof(count) + sizeof(clen), clen);
     }
 
     // Load (or return cached) a node block and record its child/next references.
@@ -577,8 +1203,8 @@ class grove_view {
         if (cached != node_cache.end()) {
             return cached->second.n.get();
         }
-        read_block_raw(b);
-        detail::memory_streambuf mb(raw_buf.data(), raw_buf.size());
+        const std::string_view raw = read_block_raw(b);
+        detail::memory_streambuf mb(raw.data(), raw.size());
         std::istream zis(&mb);
         std::vector<detail::block_id> child_ids;
         detail::block_id next_id = detail::no_block;
@@ -586,9 +1212,7 @@ class grove_view {
             node_t::deserialize_block(zis, order, key_storage, child_ids, next_id));
         node_t* n = owner.get();
         if (n->get_is_leaf()) {
-            for (auto* k : n->get_keys()) {
-                read_key_edges(zis, k);
-            }
+            read_block_edges(zis, n->get_keys());
         }
         node_block[n] = b;
         auto [ins, _] = node_cache.emplace(
@@ -602,8 +1226,8 @@ class grove_view {
         if (cached != ext_cache.end()) {
             return cached->second;
         }
-        read_block_raw(b);
-        detail::memory_streambuf mb(raw_buf.data(), raw_buf.size());
+        const std::string_view raw = read_block_raw(b);
+        detail::memory_streambuf mb(raw.data(), raw.size());
         std::istream zis(&mb);
         std::uint32_t cnt;
         detail::read_pod(zis, cnt);
@@ -617,35 +1241,32 @@ class grove_view {
         if (cnt > detail::max_external_keys_per_block) {
             throw std::runtime_error("grove_view: external block key count exceeds limit");
         }
+        std::vector<key_type> values;
+        gdt::key_column<key_type>::read(zis, cnt, values);
         std::vector<key_t*> keys;
         keys.reserve(cnt);
         for (std::uint32_t i = 0; i < cnt; ++i) {
-            key_type key_value = key_type::deserialize(zis);
             if constexpr (std::is_void_v<data_type>) {
-                if (!zis) {
-                    throw std::runtime_error("grove_view: stream error reading external key");
-                }
-                key_storage.emplace_back(key_value);
+                key_storage.emplace_back(std::move(values[i]));
             } else {
                 data_type data_value = gdt::serializer<data_type>::read(zis);
                 if (!zis) {
                     throw std::runtime_error("grove_view: stream error reading external key");
                 }
-                key_storage.emplace_back(key_value, data_value);
+                key_storage.emplace_back(std::move(values[i]), data_value);
             }
             keys.push_back(&key_storage.back());
         }
-        for (auto* k : keys) {
-            read_key_edges(zis, k);
-        }
+        read_block_edges(zis, keys);
         auto [ins, _] = ext_cache.emplace(b, std::move(keys));
         return ins->second;
     }
 
-    // Parses one edge-ref list — (block, slot[, metadata]) x count — into `map[key]`.
-    // Shared by the outgoing and incoming sections of read_key_edges; only which
+    // Parses one edge-ref list — (block, slot[, metadata index]) x count — into `map[key]`.
+    // Shared by the outgoing and incoming sections of read_block_edges; only which
     // map they land in differs.
     void read_edge_ref_list(std::istream& zis, const key_t* key,
+                            const std::vector<edge_meta_t>& table,
                             std::unordered_map<const key_t*, std::vector<edge_ref>>& map) {
         std::uint32_t ecount;
         detail::read_pod(zis, ecount);
@@ -674,22 +1295,179 @@ class grove_view {
             if constexpr (std::is_void_v<edge_data_type>) {
                 bucket->push_back(edge_ref{b, s, {}});
             } else {
-                edge_data_type meta = gdt::serializer<edge_data_type>::read(zis);
-                if (!zis) {
-                    throw std::runtime_error("grove_view: stream error reading edge metadata");
+                bucket->push_back(edge_ref{b, s, detail::read_edge_metadata_ref(zis, table)});
+            }
+        }
+    }
+
+    // Record a block's edges: its metadata table, then per key the outgoing
+    // edges as (target_block, target_slot[, metadata index]) and the incoming
+    // ones as (source_block, source_slot[, metadata index]) — the .gg writer
+    // stores both, co-located with the key's own block, so paging in one key's
+    // block surfaces both directions without touching any other block.
+    void read_block_edges(std::istream& zis, const auto& keys) {
+        std::vector<edge_meta_t> table;
+        if constexpr (!std::is_void_v<edge_data_type>) {
+            table = detail::read_edge_metadata_table<edge_data_type>(zis);
+        }
+        for (const key_t* key : keys) {
+            read_edge_ref_list(zis, key, table, adjacency);
+            read_edge_ref_list(zis, key, table, in_adjacency);
+        }
+    }
+
+    // `key`'s recorded edges in `map`, or an empty span if it has none.
+    static std::span<const edge_ref> recorded_edges(
+        const std::unordered_map<const key_t*, std::vector<edge_ref>>& map, const key_t* key) {
+        auto it = map.find(key);
+        return it == map.end() ? std::span<const edge_ref>{} : std::span<const edge_ref>(it->second);
+    }
+
+    // Projections for the lazy views: edge_ref -> key at the other end, or
+    // -> (that key, the edge's metadata).
+    auto resolve_ref() {
+        return [this](const edge_ref& e) { return resolve_target(e.tb, e.ts); };
+    }
+    auto resolve_pair() {
+        using meta_t = decltype(edge_ref::meta);
+        return [this](const edge_ref& e) {
+            return std::pair<key_t*, const meta_t&>(resolve_target(e.tb, e.ts), e.meta);
+        };
+    }
+
+    [[nodiscard]] bool block_loaded(detail::block_id b) const {
+        return b < ext_block_begin ? node_cache.contains(b) : ext_cache.contains(b);
+    }
+
+    // Outgoing adjacency for the shared traversal algorithms.
+    struct paged_adjacency {
+        using key_ptr = key_t*;
+        grove_view* view;
+        [[nodiscard]] auto neighbors(key_ptr k) { return view->neighbors_view(k); }
+        void prefetch(std::span<const key_ptr> frontier) { view->prefetch_neighbors(frontier); }
+    };
+
+    // Dense id of the key at (block, slot): node blocks hold fewer than
+    // `order` keys and external blocks at most max_external_keys_per_block,
+    // so slots are laid out at those strides, node blocks first.
+    [[nodiscard]] std::size_t key_id(detail::block_id b, std::uint32_t slot) const {
+        if (b < ext_block_begin && slot < static_cast<std::uint32_t>(order)) {
+            return std::size_t{b} * static_cast<std::size_t>(order) + slot;
+        }
+        if (b >= ext_block_begin && b < num_blocks && slot < detail::max_external_keys_per_block) {
+            return std::size_t{ext_block_begin} * static_cast<std::size_t>(order) +
+                   std::size_t{b - ext_block_begin} * detail::max_external_keys_per_block + slot;
+        }
+        throw std::runtime_error("grove_view: invalid edge target");
+    }
+    [[nodiscard]] std::size_t key_id_count() const {
+        return std::size_t{ext_block_begin} * static_cast<std::size_t>(order) +
+               std::size_t{num_blocks - ext_block_begin} * detail::max_external_keys_per_block;
+    }
+
+    // Expansion backend for intersect_expand. Seeds come out of the overlap
+    // search as bare pointers with no (block, slot) handle, so they are held
+    // in a small set and checked once per newly reached key instead.
+    struct paged_expansion {
+        using key_ptr = key_t*;
+        grove_view* view;
+        detail::sparse_bitmap visited;
+        std::unordered_set<const key_t*> seeds;
+
+        bool mark_seed(key_ptr k) { return seeds.insert(k).second; }
+        template <typename Filter, typename Emit>
+        void expand(key_ptr k, const Filter& filter, Emit&& emit) {
+            for (const auto& e : recorded_edges(view->adjacency, k)) {
+                if (filter(e.meta) && visited.test_and_set(view->key_id(e.tb, e.ts))) {
+                    key_t* n = view->resolve_target(e.tb, e.ts);
+                    if (!seeds.contains(n)) {
+                        emit(n);
+                    }
                 }
-                bucket->push_back(edge_ref{b, s, std::move(meta)});
             }
         }
+        template <typename Filter>
+        void prefetch(std::span<const key_ptr> frontier, const Filter& filter) {
+            std::vector<detail::block_id> blocks;
+            for (const key_t* k : frontier) {
+                for (const auto& e : recorded_edges(view->adjacency, k)) {
+                    if (filter(e.meta) && !visited.test(view->key_id(e.tb, e.ts)) &&
+                        !view->block_loaded(e.tb)) {
+                        blocks.push_back(e.tb);
+                    }
+                }
+            }
+            view->load_blocks(blocks);
+        }
+    };
+
+    template <typename EdgeFilter>
+    void expand_seeds(const std::vector<key_t*>& seeds, const expansion_spec<key_type, EdgeFilter>& spec,
+                      gdt::expansion_result<key_type, data_type>& result) {
+        paged_expansion adj{this, detail::sparse_bitmap(key_id_count()), {}};
+        std::vector<key_t*> frontier;
+        frontier.reserve(seeds.size());
+        for (key_t* s : seeds) {
+            if (adj.mark_seed(s)) {
+                frontier.push_back(s);
+            }
+        }
+        auto accept = [&spec](const key_t* k) {
+            return !spec.target_region || key_type::overlaps(k->get_value(), *spec.target_region);
+        };
+        detail::expand_levels(adj, std::move(frontier), spec.max_depth, spec.edge_filter, accept, result);
     }
 
-    // Record a key's outgoing edges as (target_block, target_slot[, metadata]),
-    // then its incoming edges as (source_block, source_slot[, metadata]) — the
-    // .gg writer stores both, co-located with this key's own block, so paging in
-    // one key's block surfaces both directions without touching any other block.
-    void read_key_edges(std::istream& zis, const key_t* key) {
-        read_edge_ref_list(zis, key, adjacency);
-        read_edge_ref_list(zis, key, in_adjacency);
+    // Load `blocks` (sorted and deduplicated here) in block-id order, which
+    // is file order. Runs of needed frames no more than coalesce_gap apart
+    // are read with one request and decoded one frame at a time; a lone frame
+    // (or the cached one) takes the ordinary per-frame path.
+    void load_blocks(std::vector<detail::block_id>& blocks) {
+        std::sort(blocks.begin(), blocks.end());
+        blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+        std::erase_if(blocks, [this](detail::block_id b) { return b >= num_blocks || block_loaded(b); });
+        std::size_t i = 0;
+        while (i < blocks.size()) {
+            // Gather the frames of blocks[i..j) into one run.
+            const std::size_t first = frame_of(blocks[i]);
+            std::size_t last = first;
+            std::size_t j = i + 1;
+            for (; j < blocks.size(); ++j) {
+                const std::size_t f = frame_of(blocks[j]);
+                if (f == last) continue;
+                const std::uint64_t end = frame_end(f);
+                if (end == 0 || frame_offsets[f] - frame_end(last) > coalesce_gap ||
+                    end - frame_offsets[first] > coalesce_limit) {
+                    break;
+                }
+                last = f;
+            }
+            const bool run = last != first && frame_end(last) != 0;
+            if (run) {
+                read_frame_run(first, last);
+            }
+            for (; i < j; ++i) {
+                const detail::block_id b = blocks[i];
+                if (run && frame_of(b) != cached_frame) {
+                    decode_run_frame(frame_of(b));
+                }
+                if (b < ext_block_begin) {
+                    load_node(b);
+                } else {
+                    load_external(b);
+                }
+            }
+        }
+    }
+
+    // Loads the blocks at the other end of `edges` in one batch.
+    void load_edge_targets(std::span<const edge_ref> edges) {
+        std::vector<detail::block_id> blocks;
+        blocks.reserve(edges.size());
+        for (const auto& e : edges) {
+            blocks.push_back(e.tb);
+        }
+        load_blocks(blocks);
     }
 
     key_t* resolve_target(detail::block_id tb, std::uint32_t ts) {
@@ -0,0 +1,110 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_STRUCTURE_GROVE_INDEX_HANDLE_HPP
+#define GENOGROVE_STRUCTURE_GROVE_INDEX_HANDLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace genogrove::structure {
+
+/**
+ * @brief Transparent hash for std::string keys, enabling lookup with std::string_view
+ *        without allocating a temporary std::string.
+ */
+struct string_hash {
+    using is_transparent = void;
+    size_t operator()(std::string_view sv) const noexcept {
+        return std::hash<std::string_view>{}(sv);
+    }
+};
+
+/**
+ * @brief An index (e.g. chromosome) name resolved once to a small integer
+ *
+ * Obtained from grove::resolve_index() / grove_view::resolve_index() and
+ * passed to intersect(), flanking() and insert_data() in place of the name,
+ * so the per-call name hash (and, for grove_view, a string allocation) is
+ * paid once per index instead of once per record.
+ *
+ * A handle is only meaningful for the grove or grove_view that produced it.
+ * Handles of a grove stay valid for its lifetime, including after every key
+ * of the index has been removed; they are not serialized.
+ */
+struct index_handle {
+    static constexpr std::uint32_t invalid_id = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t id = invalid_id;
+
+    /// False for a default-constructed handle or the result of a failed lookup.
+    [[nodiscard]] constexpr bool valid() const noexcept { return id != invalid_id; }
+
+    constexpr bool operator==(const index_handle&) const = default;
+};
+
+/**
+ * @brief Translates a reader's dense contig ids to index handles
+ *
+ * The readers number contigs densely — vcf_entry::contig_id (htslib rid),
+ * sam_entry::ref_id (htslib tid), bed_entry::chrom_id (order of first
+ * appearance). Each id is resolved against the grove once; every later
+ * record of that contig is a vector lookup.
+ *
+ * @code
+ * gst::index_handle_map handles;
+ * for (const auto& entry : reader) {
+ *     auto h = handles.get(grove, entry.contig_id, entry.chrom);
+ *     grove.insert_data(h, gdt::interval(entry.start, entry.end - 1), entry);
+ * }
+ * @endcode
+ *
+ * Use one map per (reader, grove) pair: the ids are only dense within one file.
+ */
+class index_handle_map {
+  public:
+    /**
+     * @brief Handle of a contig, resolving and caching it on first use
+     * @param target grove (interns unknown names) or grove_view (unknown
+     *        names yield an invalid handle)
+     * @param contig_id The reader's id for the contig; negative ids (e.g. an
+     *        unplaced read) resolve by name without caching
+     * @param name The contig name, used only on the first lookup of `contig_id`
+     */
+    template <typename target_t>
+    index_handle get(target_t& target, std::int64_t contig_id, std::string_view name) {
+        if (contig_id < 0) {
+            return target.resolve_index(name);
+        }
+        const auto id = static_cast<std::size_t>(contig_id);
+        if (id >= handles.size()) {
+            handles.resize(id + 1);
+            resolved.resize(id + 1, false);
+        }
+        if (!resolved[id]) {
+            handles[id] = target.resolve_index(name);
+            resolved[id] = true;
+        }
+        return handles[id];
+    }
+
+    /// Forget every cached handle (e.g. before reusing the map for another file).
+    void clear() noexcept {
+        handles.clear();
+        resolved.clear();
+    }
+
+  private:
+    std::vector<index_handle> handles;
+    std::vector<bool> resolved;
+};
+
+} // namespace genogrove::structure
+
+#endif // GENOGROVE_STRUCTURE_GROVE_INDEX_HANDLE_HPP
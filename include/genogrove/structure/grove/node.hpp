@@ -22,6 +22,7 @@
 // genogrove
 #include "genogrove/data_type/interval.hpp"
 #include "genogrove/data_type/key.hpp"
+#include "genogrove/data_type/key_column.hpp"
 #include "genogrove/data_type/serialization_traits.hpp"
 #include "genogrove/structure/grove/gg_block_format.hpp"
 #include "genogrove/structure/grove/pod_io.hpp"
@@ -378,8 +379,10 @@ class node {
      * @param os Output stream to write the block's structural bytes to
      * @param node_to_block Map from every node pointer to its assigned block_id
      *
-     * Writes: a packed header (is_leaf flag + key count), then each key's value
-     * (and data if data_type != void), then the block references — child
+     * Writes: a packed header (is_leaf flag + key count), then the keys' values
+     * as one column (gdt::key_column — delta/varint encoded for the built-in
+     * interval types), then each key's data if data_type != void, then the
+     * block references — child
      * block_ids for an internal node, or the single next-leaf block_id (or
      * detail::no_block) for a leaf. Children are NOT recursed into; each node is
      * its own independently-addressable block (see grove::serialize).
@@ -397,7 +400,10 @@ class node {
      * @brief Parse this node's own block written by serialize_block (non-recursive)
      * @param is Input stream positioned at the start of the block's structural bytes
      * @param order The B+ tree order to construct the node with
-     * @param key_storage Deque to emplace keys into for stable pointer addresses
+     * @param key_storage Container to emplace keys into for stable pointer addresses:
+     *        the grove's deque, or any container whose emplace_back never moves
+     *        existing elements (e.g. a std::vector reserved to >= order - 1 keys,
+     *        as the parallel deserializer's per-block staging does)
      * @param out_child_ids Filled with child block_ids for an internal node (empty for a leaf)
      * @param out_next_id Set to the next-leaf block_id for a leaf (detail::no_block otherwise)
      * @return Pointer to the newly created node with keys populated
@@ -408,9 +414,10 @@ class node {
      * Keys are emplaced into key_storage (owned by the grove) rather than
      * heap-allocated, preserving pointer stability and single-owner semantics.
      */
+    template<typename key_storage_type>
     [[nodiscard]] static node<key_type, data_type>* deserialize_block(
         std::istream& is, int order,
-        std::deque<gdt::key<key_type, data_type>>& key_storage,
+        key_storage_type& key_storage,
         std::vector<detail::block_id>& out_child_ids,
         detail::block_id& out_next_id);
 
@@ -531,11 +538,13 @@ void node<key_type, data_type>::serialize_block(std::ostream& os,
     if (is_leaf) packed |= 0x80000000u;
     detail::write_pod(os, packed);
 
-    // Write each key: value (+ data if present). NOTE: per-key edges are written
-    // by grove::serialize after this structural part, not here.
-    for (const auto* key_ptr : keys) {
-        key_ptr->get_value().serialize(os);
-        if constexpr (!std::is_void_v<data_type>) {
+    // Write the key values as one column, then each key's data (if present).
+    // NOTE: per-key edges are written by grove::serialize after this
+    // structural part, not here.
+    gdt::key_column<key_type>::write(os, keys.size(),
+        [this](std::size_t i) -> const key_type& { return keys[i]->get_value(); });
+    if constexpr (!std::is_void_v<data_type>) {
+        for (const auto* key_ptr : keys) {
             gdt::serializer<data_type>::write(os, key_ptr->get_data());
         }
     }
@@ -572,9 +581,10 @@ void node<key_type, data_type>::serialize_block(std::ostream& os,
 }
 
 template<typename key_type, typename data_type>
+template<typename key_storage_type>
 node<key_type, data_type>* node<key_type, data_type>::deserialize_block(
         std::istream& is, int order,
-        std::deque<gdt::key<key_type, data_type>>& key_storage,
+        key_storage_type& key_storage,
         std::vector<detail::block_id>& out_child_ids,
         detail::block_id& out_next_id) {
     auto n = std::make_unique<node<key_type, data_type>>(order);
@@ -593,16 +603,17 @@ node<key_type, data_type>* node<key_type, data_type>::deserialize_block(
         throw std::runtime_error("Failed to deserialize node block: num_keys exceeds order");
     }
 
-    // Read each key directly into grove's deque for stable pointer addresses
+    // Decode the key column, then pair each value with its data directly in the
+    // caller's storage for stable pointer addresses
+    std::vector<key_type> values;
+    gdt::key_column<key_type>::read(is, num_keys, values);
     n->keys.reserve(num_keys);
     for (uint32_t i = 0; i < num_keys; ++i) {
-        key_type key_value = key_type::deserialize(is);
-
         if constexpr (std::is_void_v<data_type>) {
-            key_storage.emplace_back(key_value);
+            key_storage.emplace_back(std::move(values[i]));
         } else {
             data_type data_value = gdt::serializer<data_type>::read(is);
-            key_storage.emplace_back(key_value, data_value);
+            key_storage.emplace_back(std::move(values[i]), data_value);
         }
         n->keys.push_back(&key_storage.back());
     }
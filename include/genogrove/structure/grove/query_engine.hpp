@@ -6,15 +6,36 @@
 #ifndef GENOGROVE_STRUCTURE_GROVE_QUERY_ENGINE_HPP
 #define GENOGROVE_STRUCTURE_GROVE_QUERY_ENGINE_HPP
 
+#include <algorithm>
 #include <concepts>
 #include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
 
 #include "genogrove/data_type/flanking_query_result.hpp"
 #include "genogrove/data_type/key.hpp"
 #include "genogrove/data_type/key_type_base.hpp"
+#include "genogrove/data_type/nearest_query_result.hpp"
 #include "genogrove/data_type/query_result.hpp"
 #include "genogrove/structure/grove/node.hpp"
 
+namespace genogrove::structure {
+
+/**
+ * @brief Options of a nearest-k query (grove::nearest, grove_view::nearest).
+ *
+ * Distances are gaps in closed coordinates: the number of positions strictly
+ * between key and query, so a key ending at `query.start - 1` is at distance 0.
+ */
+struct nearest_options {
+    bool predecessors = true;                // collect keys lying before the query
+    bool successors = true;                  // collect keys lying after the query
+    std::optional<std::size_t> max_distance; // largest admissible gap; unbounded if unset
+};
+
+} // namespace genogrove::structure
+
 namespace genogrove::structure::detail {
 
 /**
@@ -160,6 +181,15 @@ key_type subtree_range(Resolver& res, node<key_type, data_type>* n) {
     return agg;
 }
 
+/**
+ * Interval-like keys whose overlaps() also compares a strand (genomic
+ * coordinates). Such a key can spatially overlap the query yet not overlap()
+ * it, and is then a flanking candidate on whichever side of the query it sorts:
+ * a predecessor may start at query.start, a successor may end inside the query.
+ */
+template<typename key_type>
+concept stranded_key = requires(const key_type& k) { k.get_strand(); };
+
 /**
  * @brief Decide whether a subtree with aggregate `agg` could improve the current
  *        predecessor or successor in `state`.
@@ -168,7 +198,9 @@ key_type subtree_range(Resolver& res, node<key_type, data_type>* n) {
  * the same pruning drives the in-memory grove and the paged view. For
  * interval-like keys (those exposing `is_interval`), uses the [min_start,
  * max_end] structure of the aggregate for tight pruning; for scalar key types,
- * falls back to looser comparison-based pruning.
+ * falls back to looser comparison-based pruning. Every condition is necessary
+ * for a leaf candidate of search_flanking (not overlapping, then `K < query` or
+ * `K > query`), so pruning never changes the result.
  */
 template<gdt::key_type_base key_type, typename data_type>
 bool flanking_could_descend(const key_type& agg, const key_type& query,
@@ -177,21 +209,26 @@ bool flanking_could_descend(const key_type& agg, const key_type& query,
         // Interval pruning. Aggregate has start = min(starts), end = max(ends).
         //
         // Predecessor improvement requires a key K in the subtree with
-        //   K.end < query.start  AND  K.end > current_pred.end (if current_pred exists).
-        // Necessary aggregate condition for the first: agg.start < query.start
-        // (no key in subtree starts before query.start ⇒ no key ends before
-        // query.start either, since end >= start). For the second: agg.end >
-        // current_pred.end (subtree's max end must exceed the best-so-far end).
-        bool could_pred = agg.get_start() < query.get_start();
+        //   K < query, not overlapping it  AND  K.end > current_pred.end.
+        // Without a strand that means K.end < query.start, so a key must
+        // start before query.start: agg.start < query.start. A stranded K only
+        // needs K < query, i.e. K.start <= query.start. For the second:
+        // agg.end > current_pred.end (subtree's max end must exceed the
+        // best-so-far end).
+        bool could_pred = stranded_key<key_type> ? agg.get_start() <= query.get_start()
+                                                 : agg.get_start() < query.get_start();
         if (could_pred && state.get_predecessor() != nullptr) {
             could_pred = agg.get_end() > state.get_predecessor()->get_value().get_end();
         }
 
         // Successor improvement requires K with
-        //   K.start > query.end  AND  K.start < current_succ.start.
-        // Necessary: agg.end > query.end (no key ends past query.end ⇒ no key
-        // starts past query.end either). And: agg.start < current_succ.start.
-        bool could_succ = agg.get_end() > query.get_end();
+        //   K > query, not overlapping it  AND  K.start < current_succ.start.
+        // Without a strand that means K.start > query.end, so a key must end
+        // past query.end: agg.end > query.end. A stranded K only needs
+        // K > query, i.e. K.start >= query.start, so K.end >= query.start.
+        // And: agg.start < current_succ.start.
+        bool could_succ = stranded_key<key_type> ? agg.get_end() >= query.get_start()
+                                                 : agg.get_end() > query.get_end();
         if (could_succ && state.get_successor() != nullptr) {
             could_succ = agg.get_start() < state.get_successor()->get_value().get_start();
         }
@@ -310,6 +347,372 @@ void search_flanking(Resolver& res, node<key_type, data_type>* current,
     }
 }
 
+/**
+ * @brief Best-so-far state of a nearest-k descent — one bounded heap per side.
+ *
+ * Each heap holds at most k candidates with the farthest on top, so a new key
+ * is admitted in O(log k) and the k-th best distance (the pruning bound) is the
+ * heap front. Candidates are stamped with their visit order: the descent visits
+ * keys in sort order, so breaking distance ties by that stamp keeps equal-gap
+ * neighbors in sort order and makes k = 1 agree with search_flanking (which
+ * only replaces its candidate on a strict improvement).
+ *
+ * Sides are decided by search_flanking's rules: keys overlapping the query are
+ * skipped, the rest are predecessors if `K < query` and successors if
+ * `K > query`. Predecessors rank by largest end, successors by sort order. For
+ * stranded keys a candidate can spatially overlap the query (another strand);
+ * its gap counts as 0 against max_distance.
+ */
+template<gdt::key_type_base key_type, typename data_type>
+    requires requires { key_type::is_interval; }
+class nearest_state {
+  public:
+    using key_ptr = gdt::key<key_type, data_type>*;
+
+    nearest_state(std::size_t k, const nearest_options& options) : k(k), options(options) {}
+
+    [[nodiscard]] const nearest_options& get_options() const noexcept { return options; }
+
+    // k-th nearest predecessor / successor found so far; nullptr while fewer than k.
+    [[nodiscard]] const key_type* kth_predecessor() const noexcept {
+        return predecessors.size() < k ? nullptr : &predecessors.front().k->get_value();
+    }
+    [[nodiscard]] const key_type* kth_successor() const noexcept {
+        return successors.size() < k ? nullptr : &successors.front().k->get_value();
+    }
+
+    /**
+     * @brief Consider a leaf key. Keys overlapping the query are neither side
+     *        and are skipped, as are keys beyond max_distance.
+     */
+    void offer(key_ptr k_ptr, const key_type& query) {
+        const auto& k_val = k_ptr->get_value();
+        if (key_type::overlaps(k_val, query)) return;
+        if (k_val < query) {
+            const std::size_t gap = k_val.get_end() < query.get_start()
+                ? query.get_start() - k_val.get_end() - 1 : 0;
+            if (options.predecessors && within(gap)) {
+                push_bounded(predecessors, {k_ptr, seq++}, closer_predecessor);
+            }
+        } else if (k_val > query) {
+            const std::size_t gap = k_val.get_start() > query.get_end()
+                ? k_val.get_start() - query.get_end() - 1 : 0;
+            if (options.successors && within(gap)) {
+                push_bounded(successors, {k_ptr, seq++}, closer_successor);
+            }
+        }
+    }
+
+    /// Drain both heaps into a result, nearest first.
+    [[nodiscard]] gdt::nearest_query_result<key_type, data_type> take() {
+        gdt::nearest_query_result<key_type, data_type> result;
+        result.set_predecessors(drain(predecessors, closer_predecessor));
+        result.set_successors(drain(successors, closer_successor));
+        return result;
+    }
+
+  private:
+    struct candidate {
+        key_ptr k;
+        std::size_t seq;
+    };
+
+    // Predecessor gap shrinks as K.end grows; successor gap as K.start shrinks,
+    // which for non-overlapping successors is the sort order (start-first).
+    // Both match search_flanking's choice of a single neighbor.
+    static bool closer_predecessor(const candidate& a, const candidate& b) {
+        const auto a_end = a.k->get_value().get_end();
+        const auto b_end = b.k->get_value().get_end();
+        return a_end != b_end ? a_end > b_end : a.seq < b.seq;
+    }
+    static bool closer_successor(const candidate& a, const candidate& b) {
+        const auto& a_val = a.k->get_value();
+        const auto& b_val = b.k->get_value();
+        if (a_val < b_val) return true;
+        if (b_val < a_val) return false;
+        return a.seq < b.seq;
+    }
+
+    [[nodiscard]] bool within(std::size_t gap) const noexcept {
+        return !options.max_distance.has_value() || gap <= *options.max_distance;
+    }
+
+    template<typename Closer>
+    void push_bounded(std::vector<candidate>& heap, candidate c, Closer closer) {
+        if (heap.size() < k) {
+            heap.push_back(c);
+            std::push_heap(heap.begin(), heap.end(), closer);
+        } else if (closer(c, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), closer);
+            heap.back() = c;
+            std::push_heap(heap.begin(), heap.end(), closer);
+        }
+    }
+
+    template<typename Closer>
+    static std::vector<key_ptr> drain(std::vector<candidate>& heap, Closer closer) {
+        std::sort_heap(heap.begin(), heap.end(), closer);
+        std::vector<key_ptr> keys;
+        keys.reserve(heap.size());
+        for (const auto& c : heap) {
+            keys.push_back(c.k);
+        }
+        heap.clear();
+        return keys;
+    }
+
+    std::size_t k;
+    nearest_options options;
+    std::size_t seq = 0;
+    std::vector<candidate> predecessors;
+    std::vector<candidate> successors;
+};
+
+/**
+ * @brief flanking_could_descend for a nearest-k descent.
+ *
+ * Same [min_start, max_end] reasoning as the single-neighbor overload, with the
+ * k-th best candidate of each side as the bound once k have been found, plus
+ * the max_distance cut-off and the per-side switches of nearest_options. Gap
+ * bounds are taken only when the aggregate lies wholly on that side, so they
+ * never underflow. Stranded keys relax the side conditions as in the
+ * single-neighbor overload.
+ */
+template<gdt::key_type_base key_type, typename data_type>
+bool flanking_could_descend(const key_type& agg, const key_type& query,
+                            const nearest_state<key_type, data_type>& state) {
+    const auto& options = state.get_options();
+
+    // Predecessor: some K < query not overlapping it (K.end < query.start
+    // without a strand), within max_distance, and farther right than the k-th
+    // best end. The subtree's best end is agg.end.
+    bool could_pred = options.predecessors &&
+        (stranded_key<key_type> ? agg.get_start() <= query.get_start()
+                                : agg.get_start() < query.get_start());
+    if (could_pred && options.max_distance.has_value() && agg.get_end() < query.get_start()) {
+        could_pred = query.get_start() - agg.get_end() - 1 <= *options.max_distance;
+    }
+    if (could_pred) {
+        if (const key_type* kth = state.kth_predecessor()) {
+            could_pred = agg.get_end() > kth->get_end();
+        }
+    }
+
+    // Successor: some K > query not overlapping it (K.start > query.end
+    // without a strand), within max_distance, and starting before the k-th
+    // best start. The subtree's best start is agg.start.
+    bool could_succ = options.successors &&
+        (stranded_key<key_type> ? agg.get_end() >= query.get_start()
+                                : agg.get_end() > query.get_end());
+    if (could_succ && options.max_distance.has_value() && agg.get_start() > query.get_end()) {
+        could_succ = agg.get_start() - query.get_end() - 1 <= *options.max_distance;
+    }
+    if (could_succ) {
+        if (const key_type* kth = state.kth_successor()) {
+            could_succ = agg.get_start() < kth->get_start();
+        }
+    }
+
+    return could_pred || could_succ;
+}
+
+/**
+ * @brief The single implementation of grove's nearest-k query.
+ *
+ * The descent of search_flanking — same resolver, same separator/last-child
+ * pruning order — with a nearest_state in place of the single best candidate
+ * per side. Children are visited left to right, i.e. keys in sort order, which
+ * nearest_state relies on for its tie-breaking.
+ *
+ * @tparam Pred Callable `bool(const key_type& candidate, const key_type& query)`,
+ *              applied at leaves only; internal pruning is purely structural.
+ */
+template<gdt::key_type_base key_type, typename data_type, typename Resolver, typename Pred>
+    requires overlap_resolver<Resolver, key_type, data_type> &&
+             flanking_predicate<Pred, key_type>
+void search_nearest(Resolver& res, node<key_type, data_type>* current,
+                    const key_type& query, const Pred& is_compatible,
+                    nearest_state<key_type, data_type>& state) {
+    if (current == nullptr) {
+        return;
+    }
+
+    if (current->get_is_leaf()) {
+        for (auto* k_ptr : current->get_keys()) {
+            if (k_ptr == nullptr) continue;
+            if (!is_compatible(k_ptr->get_value(), query)) continue;
+            state.offer(k_ptr, query);
+        }
+        return;
+    }
+
+    const auto& sep_keys = current->get_keys();
+    const std::size_t num_children = sep_keys.size() + 1;
+    for (std::size_t i = 0; i < num_children; ++i) {
+        if (i < sep_keys.size()) {
+            if (flanking_could_descend<key_type, data_type>(sep_keys[i]->get_value(), query, state)) {
+                node<key_type, data_type>* child = res.child(current, i);
+                if (child != nullptr) {
+                    search_nearest(res, child, query, is_compatible, state);
+                }
+            }
+        } else {
+            node<key_type, data_type>* child = res.child(current, i);
+            if (child == nullptr) continue;
+            key_type agg = subtree_range(res, child);
+            if (flanking_could_descend<key_type, data_type>(agg, query, state)) {
+                search_nearest(res, child, query, is_compatible, state);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Forward cursor over the keys of a leaf chain, in sort order.
+ *
+ * Starts at the leftmost leaf (descending child 0 through the resolver) and
+ * steps with `res.next`, skipping empty leaves. Copyable, so a scan can look
+ * ahead without moving the cursor it was copied from.
+ */
+template<gdt::key_type_base key_type, typename data_type, typename Resolver>
+    requires overlap_resolver<Resolver, key_type, data_type>
+class leaf_chain_cursor {
+  public:
+    leaf_chain_cursor(Resolver& res, node<key_type, data_type>* root) : res(&res), leaf(root) {
+        while (leaf != nullptr && !leaf->get_is_leaf()) {
+            leaf = res.child(leaf, 0);
+        }
+        settle();
+    }
+
+    [[nodiscard]] bool valid() const noexcept { return leaf != nullptr; }
+    [[nodiscard]] gdt::key<key_type, data_type>* get() const { return leaf->get_keys()[pos]; }
+
+    void advance() {
+        ++pos;
+        settle();
+    }
+
+  private:
+    // Move forward to the next non-null key, crossing leaf boundaries.
+    void settle() {
+        while (leaf != nullptr) {
+            const auto& keys = leaf->get_keys();
+            while (pos < keys.size() && keys[pos] == nullptr) {
+                ++pos;
+            }
+            if (pos < keys.size()) {
+                return;
+            }
+            leaf = res->next(leaf);
+            pos = 0;
+        }
+    }
+
+    Resolver* res;
+    node<key_type, data_type>* leaf;
+    std::size_t pos = 0;
+};
+
+/**
+ * @brief Batched flanking over queries sorted in key order — one forward sweep
+ *        of the leaf chain instead of one pruned descent per query.
+ *
+ * Produces, for every query, exactly what search_flanking (with no predicate)
+ * returns. The sweep keeps a cursor at the first key not less than the current
+ * query; keys it passes are the predecessor candidates (`K < query`) of this
+ * and every later query.
+ *
+ * - **Predecessor.** A passed key whose end lies before the query start can
+ *   never overlap a later query either (later queries start no earlier), so it
+ *   is folded into a running best-by-end and forgotten. Passed keys still
+ *   reaching the query start wait in a min-heap by end until a query moves
+ *   past them; they only qualify while they do not overlap the query (never
+ *   for plain intervals; a stranded key on another strand does), and then
+ *   beat the running best.
+ *   Equal ends resolve to the key first in sort order, as in search_flanking.
+ * - **Successor.** Scanned forward from the cursor with a copy of it: the
+ *   first `K > query` that does not overlap it, which for stranded keys may
+ *   start inside the query span.
+ *
+ * Cost is one pass over the chain plus O(log depth) per key and, per query,
+ * the keys overlapping it — linear for point-like queries such as variants,
+ * and independent of how many queries share the pass.
+ *
+ * @pre `queries` is sorted by key_type::operator< (checked by the callers).
+ */
+template<gdt::key_type_base key_type, typename data_type, typename Resolver>
+    requires overlap_resolver<Resolver, key_type, data_type> &&
+             requires { key_type::is_interval; }
+void sweep_flanking(Resolver& res, node<key_type, data_type>* root,
+                    std::span<const key_type> queries,
+                    std::vector<gdt::flanking_query_result<key_type, data_type>>& results) {
+    using key_ptr = gdt::key<key_type, data_type>*;
+    struct passed_key {
+        key_ptr k;
+        std::size_t seq;  // position in the leaf chain, for sort-order ties
+    };
+    // Min-heap on (end, seq): std heaps keep the "largest" under the comparator on top.
+    const auto ends_later = [](const passed_key& a, const passed_key& b) {
+        const auto a_end = a.k->get_value().get_end();
+        const auto b_end = b.k->get_value().get_end();
+        return a_end != b_end ? a_end > b_end : a.seq > b.seq;
+    };
+
+    results.assign(queries.size(), {});
+    if (root == nullptr) {
+        return;
+    }
+
+    leaf_chain_cursor<key_type, data_type, Resolver> cursor(res, root);
+    std::size_t seq = 0;
+    std::vector<passed_key> pending;
+    key_ptr settled_best = nullptr;  // best-by-end among passed keys ending before the query
+
+    for (std::size_t qi = 0; qi < queries.size(); ++qi) {
+        const key_type& query = queries[qi];
+
+        while (cursor.valid() && cursor.get()->get_value() < query) {
+            pending.push_back({cursor.get(), seq++});
+            std::push_heap(pending.begin(), pending.end(), ends_later);
+            cursor.advance();
+        }
+        while (!pending.empty() && pending.front().k->get_value().get_end() < query.get_start()) {
+            std::pop_heap(pending.begin(), pending.end(), ends_later);
+            const key_ptr k = pending.back().k;
+            pending.pop_back();
+            // Popped in (end, seq) order, so strict > keeps the first of equal ends.
+            if (settled_best == nullptr ||
+                k->get_value().get_end() > settled_best->get_value().get_end()) {
+                settled_best = k;
+            }
+        }
+
+        key_ptr pred = settled_best;
+        std::size_t pred_seq = 0;
+        bool pred_pending = false;
+        for (const auto& p : pending) {
+            if (key_type::overlaps(p.k->get_value(), query)) continue;
+            const auto end = p.k->get_value().get_end();
+            if (!pred_pending || end > pred->get_value().get_end() ||
+                (end == pred->get_value().get_end() && p.seq < pred_seq)) {
+                pred = p.k;
+                pred_seq = p.seq;
+                pred_pending = true;
+            }
+        }
+        results[qi].set_predecessor(pred);
+
+        for (auto ahead = cursor; ahead.valid(); ahead.advance()) {
+            const auto& k = ahead.get()->get_value();
+            if (k > query && !key_type::overlaps(k, query)) {
+                results[qi].set_successor(ahead.get());
+                break;
+            }
+        }
+    }
+}
+
 } // namespace genogrove::structure::detail
 
 #endif // GENOGROVE_STRUCTURE_GROVE_QUERY_ENGINE_HPP
\ No newline at end of file
@@ -0,0 +1,238 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_UTILITY_PARALLEL_HPP
+#define GENOGROVE_UTILITY_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace genogrove::utility {
+
+    /**
+     * @brief Resolve a caller-requested worker count
+     * @param requested Requested number of threads; 0 means "one per hardware thread"
+     * @return The number of workers to use, always >= 1
+     */
+    inline std::size_t resolve_thread_count(std::size_t requested) {
+        if (requested != 0) {
+            return requested;
+        }
+        const unsigned hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 1 : static_cast<std::size_t>(hw);
+    }
+
+    /**
+     * @brief Run `fn(state, i)` for every i in [0, count) on a small worker pool
+     * @tparam worker_state Per-worker scratch type, default-constructed once in
+     *         each worker (e.g. a compressor that must not be shared)
+     * @param count Number of work items
+     * @param num_threads Worker count (0 = hardware concurrency); the calling
+     *        thread is one of the workers, so 1 runs everything inline
+     * @param fn Callable invoked as fn(worker_state&, std::size_t index)
+     *
+     * Items are handed out one at a time from a shared atomic counter, so
+     * uneven item costs balance across workers. Each item runs exactly once,
+     * in no particular order; callers write results into per-index slots and
+     * merge afterwards. The first exception thrown by any item stops further
+     * items from being claimed and is rethrown on the calling thread once
+     * every worker has joined.
+     */
+    template<typename worker_state, typename body_fn>
+    void parallel_for(std::size_t count, std::size_t num_threads, body_fn&& fn) {
+        const std::size_t workers = std::min(resolve_thread_count(num_threads), count);
+        if (workers <= 1) {
+            worker_state state{};
+            for (std::size_t i = 0; i < count; ++i) {
+                fn(state, i);
+            }
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr first_error;
+        std::mutex error_mutex;
+
+        auto run = [&]() {
+            try {
+                worker_state state{};
+                while (!failed.load(std::memory_order_relaxed)) {
+                    const std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= count) {
+                        break;
+                    }
+                    fn(state, i);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!first_error) {
+                    first_error = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(workers - 1);
+        try {
+            for (std::size_t w = 1; w < workers; ++w) {
+                pool.emplace_back(run);
+            }
+        } catch (...) {
+            // Thread creation failed: stop the workers already started and
+            // surface the failure rather than silently running short-handed.
+            failed.store(true, std::memory_order_relaxed);
+            for (auto& t : pool) {
+                t.join();
+            }
+            throw;
+        }
+        run();
+        for (auto& t : pool) {
+            t.join();
+        }
+        if (first_error) {
+            std::rethrow_exception(first_error);
+        }
+    }
+
+    /**
+     * @brief Run `fn(i)` for every i in [0, count) on a small worker pool
+     *
+     * Stateless convenience form of parallel_for<worker_state>; same scheduling
+     * and error semantics.
+     */
+    template<typename body_fn>
+    void parallel_for(std::size_t count, std::size_t num_threads, body_fn&& fn) {
+        struct no_state {};
+        parallel_for<no_state>(count, num_threads,
+                               [&fn](no_state&, std::size_t i) { fn(i); });
+    }
+
+    /**
+     * @brief Produce items on a worker pool, consume them in index order
+     * @tparam worker_state Per-worker scratch type, default-constructed once per worker
+     * @param count Number of items
+     * @param num_threads Producer worker count (0 = hardware concurrency); 1
+     *        runs produce/consume alternately on the calling thread
+     * @param window Maximum items produced but not yet consumed (>= 1) — bounds
+     *        peak memory to `window` results regardless of `count`
+     * @param produce Callable `R(worker_state&, std::size_t index)`, run on workers
+     * @param consume Callable `void(std::size_t index, R&&)`, always run on the
+     *        calling thread, strictly in index order 0, 1, ..., count - 1
+     *
+     * A bounded reorder buffer: workers claim indices in order but never more
+     * than `window` ahead of the consumer, park finished results in a ring
+     * slot, and the calling thread drains the slots in order. Suited to
+     * "compress blocks in parallel, write them sequentially". The first
+     * exception from either side stops the pipeline and is rethrown on the
+     * calling thread after every worker has joined.
+     */
+    template<typename worker_state, typename produce_fn, typename consume_fn>
+    void parallel_ordered(std::size_t count, std::size_t num_threads, std::size_t window,
+                          produce_fn&& produce, consume_fn&& consume) {
+        using result_type = std::invoke_result_t<produce_fn&, worker_state&, std::size_t>;
+        const std::size_t workers = std::min(resolve_thread_count(num_threads), count);
+        if (workers <= 1) {
+            worker_state state{};
+            for (std::size_t i = 0; i < count; ++i) {
+                consume(i, produce(state, i));
+            }
+            return;
+        }
+        window = std::max(window, std::size_t{1});
+
+        std::vector<std::optional<result_type>> ring(window);
+        std::mutex m;
+        std::condition_variable space_cv;  // consumer advanced: producers may claim
+        std::condition_variable ready_cv;  // a slot was filled: consumer may drain
+        std::size_t next_claim = 0;
+        std::size_t next_consume = 0;
+        bool failed = false;
+        std::exception_ptr first_error;
+
+        auto fail = [&](std::exception_ptr e) {
+            std::lock_guard<std::mutex> lock(m);
+            if (!first_error) {
+                first_error = e;
+            }
+            failed = true;
+            space_cv.notify_all();
+            ready_cv.notify_all();
+        };
+
+        auto run = [&]() {
+            try {
+                worker_state state{};
+                for (;;) {
+                    std::size_t i;
+                    {
+                        std::unique_lock<std::mutex> lock(m);
+                        space_cv.wait(lock, [&] {
+                            return failed || next_claim >= count || next_claim < next_consume + window;
+                        });
+                        if (failed || next_claim >= count) {
+                            return;
+                        }
+                        i = next_claim++;
+                    }
+                    result_type r = produce(state, i);
+                    std::lock_guard<std::mutex> lock(m);
+                    ring[i % window].emplace(std::move(r));
+                    ready_cv.notify_all();
+                }
+            } catch (...) {
+                fail(std::current_exception());
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(workers);
+        auto join_all = [&]() {
+            for (auto& t : pool) {
+                t.join();
+            }
+        };
+        try {
+            for (std::size_t w = 0; w < workers; ++w) {
+                pool.emplace_back(run);
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                std::optional<result_type> item;
+                {
+                    std::unique_lock<std::mutex> lock(m);
+                    ready_cv.wait(lock, [&] { return failed || ring[i % window].has_value(); });
+                    if (failed) {
+                        break;
+                    }
+                    item = std::move(ring[i % window]);
+                    ring[i % window].reset();
+                    next_consume = i + 1;
+                    space_cv.notify_all();
+                }
+                consume(i, std::move(*item));
+            }
+        } catch (...) {
+            fail(std::current_exception());
+        }
+        join_all();
+        if (first_error) {
+            std::rethrow_exception(first_error);
+        }
+    }
+
+} // namespace genogrove::utility
+
+#endif // GENOGROVE_UTILITY_PARALLEL_HPP
@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#ifndef GENOGROVE_UTILITY_RADIX_SORT_HPP
+#define GENOGROVE_UTILITY_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace genogrove::utility {
+
+    /**
+     * @brief Sort unsigned 64-bit values ascending with an LSD radix sort
+     * @param values Values to sort in place
+     * @param key_bits Number of low bits that can be non-zero (e.g. 2·k for
+     *        k-mer encodings); higher bits are not examined
+     * @throws std::invalid_argument if key_bits exceeds 64
+     *
+     * One counting pass per 8-bit digit of the low key_bits, O(n) each, with
+     * one scratch buffer of n values. Passes whose digit is the same for every
+     * value are skipped, so clustered values sort in fewer passes. For the
+     * hundreds of millions of k-mer encodings of a large genome this replaces
+     * std::sort's O(n log n) comparisons with a few linear sweeps.
+     */
+    inline void radix_sort(std::span<std::uint64_t> values, unsigned key_bits = 64) {
+        if (key_bits > 64) {
+            throw std::invalid_argument("radix_sort: key_bits must be at most 64");
+        }
+        if (values.size() < 2) return;
+
+        std::vector<std::uint64_t> scratch(values.size());
+        std::span<std::uint64_t> src = values;
+        std::span<std::uint64_t> dst = scratch;
+        for (unsigned shift = 0; shift < key_bits; shift += 8) {
+            std::array<std::size_t, 256> counts{};
+            for (const auto v : src) {
+                ++counts[(v >> shift) & 0xFF];
+            }
+            if (counts[(src.front() >> shift) & 0xFF] == src.size()) {
+                continue;  // every value has the same digit here
+            }
+            std::size_t offset = 0;
+            for (auto& c : counts) {
+                const std::size_t n = c;
+                c = offset;
+                offset += n;
+            }
+            for (const auto v : src) {
+                dst[counts[(v >> shift) & 0xFF]++] = v;
+            }
+            std::swap(src, dst);
+        }
+        if (src.data() != values.data()) {
+            std::copy(src.begin(), src.end(), values.begin());
+        }
+    }
+
+    /// @copydoc radix_sort(std::span<std::uint64_t>, unsigned)
+    inline void radix_sort(std::vector<std::uint64_t>& values, unsigned key_bits = 64) {
+        radix_sort(std::span<std::uint64_t>(values), key_bits);
+    }
+
+} // namespace genogrove::utility
+
+#endif // GENOGROVE_UTILITY_RADIX_SORT_HPP
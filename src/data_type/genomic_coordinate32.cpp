@@ -0,0 +1,42 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#include <genogrove/data_type/genomic_coordinate32.hpp>
+#include <format>
+
+namespace genogrove::data_type {
+
+    std::string genomic_coordinate32::to_string() const {
+        return std::format("{}:{}-{}", get_strand(), get_start(), get_end());
+    }
+
+    void genomic_coordinate32::serialize(std::ostream& os) const {
+        const char strand = get_strand();
+        const auto start = static_cast<std::uint32_t>(get_start());
+        const auto end = static_cast<std::uint32_t>(get_end());
+        os.write(&strand, sizeof(strand));
+        os.write(reinterpret_cast<const char*>(&start), sizeof(start));
+        os.write(reinterpret_cast<const char*>(&end), sizeof(end));
+        if (!os) {
+            throw std::runtime_error("Failed to serialize genomic_coordinate32: stream error");
+        }
+    }
+
+    genomic_coordinate32 genomic_coordinate32::deserialize(std::istream& is) {
+        char strand;
+        std::uint32_t start, end;
+        is.read(&strand, sizeof(strand));
+        is.read(reinterpret_cast<char*>(&start), sizeof(start));
+        is.read(reinterpret_cast<char*>(&end), sizeof(end));
+        if(!is) {
+            throw std::runtime_error("Failed to deserialize genomic_coordinate32: stream error");
+        }
+        try {
+            return genomic_coordinate32(strand, start, end);
+        } catch (const std::invalid_argument& e) {
+            throw std::runtime_error(std::string("Failed to deserialize genomic_coordinate32: ") + e.what());
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#include <genogrove/data_type/interval32.hpp>
+
+// standard
+#include <stdexcept>
+#include <string>
+
+namespace genogrove::data_type {
+
+    std::string interval32::to_string() const {
+        return "[" + std::to_string(this->start) + "," + std::to_string(this->end) + "]";
+    }
+
+    void interval32::serialize(std::ostream& os) const {
+        os.write(reinterpret_cast<const char*>(&this->start), sizeof(this->start));
+        os.write(reinterpret_cast<const char*>(&this->end), sizeof(this->end));
+        if (!os) {
+            throw std::runtime_error("Failed to serialize interval32: stream error");
+        }
+    }
+
+    interval32 interval32::deserialize(std::istream& is) {
+        interval32 intvl;
+        is.read(reinterpret_cast<char*>(&intvl.start), sizeof(intvl.start));
+        is.read(reinterpret_cast<char*>(&intvl.end), sizeof(intvl.end));
+        if(!is) {
+            throw std::runtime_error("Failed to deserialize interval32: stream error");
+        }
+        if(intvl.start > intvl.end) {
+            throw std::runtime_error("Failed to deserialize interval32: start exceeds end");
+        }
+        if(intvl.end > max_position && intvl.start != INVALID_POSITION) {
+            throw std::runtime_error("Failed to deserialize interval32: position exceeds max_position");
+        }
+        return intvl;
+    }
+}
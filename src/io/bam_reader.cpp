@@ -186,8 +186,10 @@ namespace genogrove::io {
         // Reference name (RNAME)
         if (c.tid >= 0 && c.tid < header->n_targets) {
             entry.chrom = header->target_name[c.tid];
+            entry.ref_id = c.tid;
         } else {
             entry.chrom = "*";
+            entry.ref_id = -1;
         }
 
         // FLAGS
@@ -424,7 +424,7 @@ namespace genogrove::io {
                 error_message = "Start coordinate is greater than or equal to the end coordinate at line " + std::to_string(line_num);
                 return false;
             }
-            entry.chrom = std::string(*chrom_f);
+            entry.chrom.assign(*chrom_f);
             entry.start = start_num;
             entry.end = end_num;
 
@@ -433,6 +433,8 @@ namespace genogrove::io {
                 return false;  // error_message already set by parse_* helper
             }
 
+            // Only valid records claim a chromosome id.
+            entry.chrom_id = chrom_id_of(*chrom_f);
             return true;
         } catch (const std::runtime_error&) {
             throw;  // propagate infrastructure errors, as before
@@ -455,6 +457,23 @@ namespace genogrove::io {
         return line_num;
     }
 
+    const std::vector<std::string>& bed_reader::get_chromosomes() const {
+        return chromosomes;
+    }
+
+    int32_t bed_reader::chrom_id_of(std::string_view chrom) {
+        if (last_chrom_id >= 0 && chromosomes[last_chrom_id] == chrom) {
+            return last_chrom_id;
+        }
+        auto [it, inserted] = chrom_ids.try_emplace(std::string(chrom),
+                                                    static_cast<int32_t>(chromosomes.size()));
+        if (inserted) {
+            chromosomes.emplace_back(chrom);
+        }
+        last_chrom_id = it->second;
+        return last_chrom_id;
+    }
+
     // ---- serialization ----
 
     namespace {
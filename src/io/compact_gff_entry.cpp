@@ -0,0 +1,193 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#include <genogrove/io/compact_gff_entry.hpp>
+
+// standard
+#include <stdexcept>
+
+// genogrove
+#include <genogrove/data_type/serialization_traits.hpp>
+
+namespace gdt = genogrove::data_type;
+
+namespace genogrove::io {
+
+    namespace {
+        // Same bound as gff_entry deserialization: anything larger is a
+        // corrupt stream, not a GFF row.
+        constexpr uint32_t MAX_ATTRIBUTES_PER_RECORD = 4096;
+
+        // An optional is written as a 1-byte presence flag followed by the
+        // value (only when present). Mirrors the gff_entry encoding.
+        template<typename T>
+        void write_optional(std::ostream& os, const std::optional<T>& opt) {
+            const uint8_t present = opt.has_value() ? 1 : 0;
+            os.write(reinterpret_cast<const char*>(&present), sizeof(present));
+            if (opt.has_value()) {
+                gdt::serializer<T>::write(os, *opt);
+            }
+        }
+
+        template<typename T>
+        std::optional<T> read_optional(std::istream& is) {
+            uint8_t present = 0;
+            is.read(reinterpret_cast<char*>(&present), sizeof(present));
+            if (!is) {
+                throw std::runtime_error("Failed to deserialize compact_gff_entry: stream error reading optional flag");
+            }
+            if (present == 0) {
+                return std::nullopt;
+            }
+            if (present != 1) {
+                throw std::runtime_error("Failed to deserialize compact_gff_entry: invalid optional presence flag");
+            }
+            return gdt::serializer<T>::read(is);
+        }
+
+        void write_id(std::ostream& os, compact_gff_entry::field_id id) {
+            os.write(reinterpret_cast<const char*>(&id), sizeof(id));
+        }
+
+        // Ids are validated against the loaded registry so that a grove read
+        // without (or against the wrong) field dictionary fails here rather
+        // than on a later get_seqid(). null_id is the unset value of a
+        // default-constructed entry (e.g. the payload of an internal-node key).
+        compact_gff_entry::field_id read_id(std::istream& is) {
+            compact_gff_entry::field_id id = 0;
+            is.read(reinterpret_cast<char*>(&id), sizeof(id));
+            if (!is) {
+                throw std::runtime_error("Failed to deserialize compact_gff_entry: stream error reading field id");
+            }
+            if (id != gff_field_registry::null_id && !gff_field_registry::instance().contains(id)) {
+                throw std::runtime_error(
+                    "Failed to deserialize compact_gff_entry: field id " + std::to_string(id) +
+                    " is not in the loaded gff_field_registry");
+            }
+            return id;
+        }
+    } // namespace
+
+    compact_gff_entry::compact_gff_entry(const gff_entry& entry)
+        : format(entry.format), start(entry.start), end(entry.end),
+          score(entry.score), strand(entry.strand), phase(entry.phase) {
+        auto& fields = gff_field_registry::instance();
+        seqid = fields.intern(entry.seqid);
+        source = fields.intern(entry.source);
+        type = fields.intern(entry.type);
+        attributes.reserve(entry.attributes.size());
+        for (const auto& [key, value] : entry.attributes) {
+            attributes.emplace_back(fields.intern(key), value);
+        }
+    }
+
+    gff_entry compact_gff_entry::to_gff_entry() const {
+        gff_entry entry(get_seqid(), start, end, get_type());
+        entry.source = get_source();
+        entry.score = score;
+        entry.strand = strand;
+        entry.phase = phase;
+        entry.format = format;
+        const auto& fields = gff_field_registry::instance();
+        for (const auto& [key, value] : attributes) {
+            entry.attributes.emplace_hint(entry.attributes.end(), fields.get(key), value);
+        }
+        return entry;
+    }
+
+    const std::string& compact_gff_entry::get_seqid() const {
+        return gff_field_registry::instance().get(seqid);
+    }
+
+    const std::string& compact_gff_entry::get_source() const {
+        return gff_field_registry::instance().get(source);
+    }
+
+    const std::string& compact_gff_entry::get_type() const {
+        return gff_field_registry::instance().get(type);
+    }
+
+    const std::string* compact_gff_entry::find_attribute(std::string_view key) const {
+        // Records carry tens of attributes at most: a linear scan comparing
+        // the interned names beats building a lookup structure per record.
+        const auto& fields = gff_field_registry::instance();
+        for (const auto& [key_id, value] : attributes) {
+            if (fields.get(key_id) == key) {
+                return &value;
+            }
+        }
+        return nullptr;
+    }
+
+    std::optional<std::string> compact_gff_entry::get_attribute(std::string_view key) const {
+        if (const auto* value = find_attribute(key)) {
+            return *value;
+        }
+        return std::nullopt;
+    }
+
+    void compact_gff_entry::serialize(std::ostream& os) const {
+        write_id(os, seqid);
+        write_id(os, source);
+        write_id(os, type);
+        os.write(reinterpret_cast<const char*>(&start), sizeof(start));
+        os.write(reinterpret_cast<const char*>(&end), sizeof(end));
+        write_optional(os, score);
+        write_optional(os, strand);
+        write_optional(os, phase);
+        const uint32_t n = static_cast<uint32_t>(attributes.size());
+        os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        for (const auto& [key_id, value] : attributes) {
+            write_id(os, key_id);
+            gdt::serializer<std::string>::write(os, value);
+        }
+        const uint8_t fmt = static_cast<uint8_t>(format);
+        os.write(reinterpret_cast<const char*>(&fmt), sizeof(fmt));
+        if (!os) {
+            throw std::runtime_error("Failed to serialize compact_gff_entry: stream error");
+        }
+    }
+
+    compact_gff_entry compact_gff_entry::deserialize(std::istream& is) {
+        compact_gff_entry entry;
+        entry.seqid = read_id(is);
+        entry.source = read_id(is);
+        entry.type = read_id(is);
+        is.read(reinterpret_cast<char*>(&entry.start), sizeof(entry.start));
+        is.read(reinterpret_cast<char*>(&entry.end), sizeof(entry.end));
+        if (!is) {
+            throw std::runtime_error("Failed to deserialize compact_gff_entry: stream error reading coordinates");
+        }
+        entry.score = read_optional<double>(is);
+        entry.strand = read_optional<char>(is);
+        entry.phase = read_optional<int>(is);
+
+        uint32_t n = 0;
+        is.read(reinterpret_cast<char*>(&n), sizeof(n));
+        if (!is) {
+            throw std::runtime_error("Failed to deserialize compact_gff_entry: stream error reading attributes count");
+        }
+        if (n > MAX_ATTRIBUTES_PER_RECORD) {
+            throw std::runtime_error("Failed to deserialize compact_gff_entry: unreasonable attribute count");
+        }
+        entry.attributes.reserve(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            const field_id key_id = read_id(is);
+            entry.attributes.emplace_back(key_id, gdt::serializer<std::string>::read(is));
+        }
+
+        uint8_t fmt = 0;
+        is.read(reinterpret_cast<char*>(&fmt), sizeof(fmt));
+        if (!is) {
+            throw std::runtime_error("Failed to deserialize compact_gff_entry: stream error reading format");
+        }
+        if (fmt > static_cast<uint8_t>(gff_format::UNKNOWN)) {
+            throw std::runtime_error("Failed to deserialize compact_gff_entry: unknown gff_format value");
+        }
+        entry.format = static_cast<gff_format>(fmt);
+        return entry;
+    }
+
+}
@@ -31,7 +31,7 @@ namespace genogrove::io {
         }
     } // namespace
 
-    gg_header gg_header::current(gg_payload_type payload_type) {
+    gg_header gg_header::current(gg_payload_type payload_type, gg_key_type key_type) {
         gg_header h;
         h.format_major = CURRENT_FORMAT_MAJOR;
         h.format_minor = CURRENT_FORMAT_MINOR;
@@ -39,6 +39,7 @@ namespace genogrove::io {
         h.lib_minor = static_cast<uint8_t>(genogrove_VERSION_MINOR);
         h.lib_patch = static_cast<uint8_t>(genogrove_VERSION_PATCH);
         h.payload_type = payload_type;
+        h.key_type = key_type;
         return h;
     }
 
@@ -51,7 +52,7 @@ namespace genogrove::io {
         buf[7] = static_cast<char>(lib_minor);
         buf[8] = static_cast<char>(lib_patch);
         buf[9] = static_cast<char>(payload_type);
-        buf[10] = 0;
+        buf[10] = static_cast<char>(key_type);
         buf[11] = 0;
 
         os.write(buf.data(), buf.size());
@@ -95,13 +96,23 @@ namespace genogrove::io {
 
         const uint8_t pt = static_cast<uint8_t>(buf[9]);
         if(pt != static_cast<uint8_t>(gg_payload_type::BED) &&
-           pt != static_cast<uint8_t>(gg_payload_type::GFF)) {
+           pt != static_cast<uint8_t>(gg_payload_type::GFF) &&
+           pt != static_cast<uint8_t>(gg_payload_type::GFF_COMPACT)) {
             throw std::runtime_error(
                 "gg_header::read: unknown .gg payload type " +
                 std::to_string(static_cast<unsigned>(pt)));
         }
         h.payload_type = static_cast<gg_payload_type>(pt);
 
+        const uint8_t kt = static_cast<uint8_t>(buf[10]);
+        if(kt != static_cast<uint8_t>(gg_key_type::INTERVAL) &&
+           kt != static_cast<uint8_t>(gg_key_type::INTERVAL32)) {
+            throw std::runtime_error(
+                "gg_header::read: unknown .gg key type " +
+                std::to_string(static_cast<unsigned>(kt)));
+        }
+        h.key_type = static_cast<gg_key_type>(kt);
+
         return h;
     }
 
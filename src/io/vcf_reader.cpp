@@ -305,6 +305,7 @@ namespace genogrove::io {
         // CHROM
         const char* chrom = bcf_hdr_id2name(header, rec->rid);
         entry.chrom = chrom ? chrom : ".";
+        entry.contig_id = chrom ? rec->rid : -1;
 
         // Coordinates: htslib pos is 0-based; rlen is the REF span.
         entry.start = static_cast<size_t>(rec->pos);
@@ -11,6 +11,7 @@
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <string>
 #ifndef _WIN32
 #include <sys/wait.h>
@@ -18,7 +19,9 @@
 
 // genogrove
 #include <genogrove/data_type/interval.hpp>
+#include <genogrove/data_type/interval32.hpp>
 #include <genogrove/io/bed_reader.hpp>
+#include <genogrove/io/compact_gff_entry.hpp>
 #include <genogrove/io/gff_reader.hpp>
 #include <genogrove/io/gg_format.hpp>
 #include <genogrove/structure/grove/grove.hpp>
@@ -213,7 +216,133 @@ TEST_F(CLIIndexE2ETest, IndexFileStartsWithGROVMagic) {
 }
 
 // ==========================================
-// idx accepts a GFF input and stamps gg_payload_type::GFF in the header
+// idx --threads compresses blocks in parallel without changing the output
+// ==========================================
+
+TEST_F(CLIIndexE2ETest, IndexThreadsProducesIdenticalFile) {
+    const fs::path threaded_output = fs::temp_directory_path() / "genogrove_idx_test_threads.gg";
+    auto serial = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() + "\""
+    ));
+    ASSERT_EQ(serial.exit_code, 0) << serial.output;
+    auto threaded = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + threaded_output.string() + "\" --threads 4"
+    ));
+    ASSERT_EQ(threaded.exit_code, 0) << threaded.output;
+
+    auto slurp = [](const fs::path& p) {
+        std::ifstream in(p, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    };
+    EXPECT_TRUE(slurp(tmp_output) == slurp(threaded_output));
+    fs::remove(threaded_output);
+}
+
+TEST_F(CLIIndexE2ETest, IndexRejectsNegativeThreads) {
+    auto result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() + "\" --threads=-1"
+    ));
+    EXPECT_NE(result.exit_code, 0);
+    EXPECT_NE(result.output.find("threads"), std::string::npos);
+    EXPECT_FALSE(fs::exists(tmp_output));
+}
+
+// ==========================================
+// idx --codec selects the block codec recorded in the grove stream
+// ==========================================
+
+TEST_F(CLIIndexE2ETest, IndexCodecRoundTrips) {
+    for (const char* codec : {"stored", "zlib", "zstd", "lz4"}) {
+        if (!ggs::block_codec_available(ggs::parse_block_codec(codec))) {
+            continue;
+        }
+        auto result = run_command(cli(
+            "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() +
+            "\" --codec " + codec
+        ));
+        ASSERT_EQ(result.exit_code, 0) << codec << ": " << result.output;
+
+        std::ifstream in(tmp_output, std::ios::binary);
+        ASSERT_TRUE(in.is_open());
+        (void)gio::gg_header::read(in);
+        auto grove = ggs::grove<gdt::interval, gio::bed_entry, std::string>::deserialize(in);
+        EXPECT_EQ(grove.indexed_vertex_count(), 3u) << codec;
+        EXPECT_EQ(grove.intersect(gdt::interval(150, 150), "chr1").get_keys().size(), 1u) << codec;
+    }
+}
+
+TEST_F(CLIIndexE2ETest, IndexRejectsUnknownCodec) {
+    auto result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() + "\" --codec brotli"
+    ));
+    EXPECT_NE(result.exit_code, 0);
+    EXPECT_NE(result.output.find("unknown block codec"), std::string::npos);
+    EXPECT_FALSE(fs::exists(tmp_output));
+}
+
+TEST_F(CLIIndexE2ETest, IndexBlocksPerFrameRoundTrips) {
+    auto result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() +
+        "\" --blocks-per-frame 16"
+    ));
+    ASSERT_EQ(result.exit_code, 0) << result.output;
+
+    std::ifstream in(tmp_output, std::ios::binary);
+    ASSERT_TRUE(in.is_open());
+    (void)gio::gg_header::read(in);
+    auto grove = ggs::grove<gdt::interval, gio::bed_entry, std::string>::deserialize(in);
+    EXPECT_EQ(grove.indexed_vertex_count(), 3u);
+    EXPECT_EQ(grove.intersect(gdt::interval(150, 150), "chr1").get_keys().size(), 1u);
+}
+
+TEST_F(CLIIndexE2ETest, IndexRejectsZeroBlocksPerFrame) {
+    auto result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() +
+        "\" --blocks-per-frame 0"
+    ));
+    EXPECT_NE(result.exit_code, 0);
+    EXPECT_NE(result.output.find("blocks-per-frame must be between 1 and"), std::string::npos);
+    EXPECT_FALSE(fs::exists(tmp_output));
+}
+
+TEST_F(CLIIndexE2ETest, IndexKeyTypeInterval32RoundTrips) {
+    auto result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() +
+        "\" --key-type interval32"
+    ));
+    ASSERT_EQ(result.exit_code, 0) << result.output;
+
+    std::ifstream in(tmp_output, std::ios::binary);
+    ASSERT_TRUE(in.is_open());
+    const auto header = gio::gg_header::read(in);
+    EXPECT_EQ(header.key_type, gio::gg_key_type::INTERVAL32);
+    auto grove = ggs::grove<gdt::interval32, gio::bed_entry, std::string>::deserialize(in);
+    EXPECT_EQ(grove.indexed_vertex_count(), 3u);
+    auto hits = grove.intersect(gdt::interval32(150, 150), "chr1");
+    ASSERT_EQ(hits.get_keys().size(), 1u);
+    EXPECT_EQ(hits.get_keys()[0]->get_data().end, 500u);
+}
+
+TEST_F(CLIIndexE2ETest, IndexRejectsUnknownKeyType) {
+    auto result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() + "\" --key-type kmer"
+    ));
+    EXPECT_NE(result.exit_code, 0);
+    EXPECT_NE(result.output.find("key-type"), std::string::npos);
+    EXPECT_FALSE(fs::exists(tmp_output));
+}
+
+TEST_F(CLIIndexE2ETest, IndexDictionaryRequiresZstd) {
+    auto result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_output.string() +
+        "\" --codec zlib --zstd-dict-size 1024"
+    ));
+    EXPECT_NE(result.exit_code, 0);
+    EXPECT_NE(result.output.find("--zstd-dict-size requires --codec zstd"), std::string::npos);
+}
+
+// ==========================================
+// idx accepts a GFF input and stamps gg_payload_type::GFF_COMPACT in the header
 // ==========================================
 
 TEST_F(CLIIndexE2ETest, IndexProducesDeserializableGffGrove) {
@@ -226,18 +355,20 @@ TEST_F(CLIIndexE2ETest, IndexProducesDeserializableGffGrove) {
     std::ifstream in(tmp_gff_output, std::ios::binary);
     ASSERT_TRUE(in.is_open());
     const auto header = gio::gg_header::read(in);
-    EXPECT_EQ(header.payload_type, gio::gg_payload_type::GFF);
+    EXPECT_EQ(header.payload_type, gio::gg_payload_type::GFF_COMPACT);
 
-    auto grove = ggs::grove<gdt::interval, gio::gff_entry, std::string>::deserialize(in);
+    // The field dictionary sits between the header and the grove.
+    (void)gio::gff_field_registry::deserialize(in);
+    auto grove = ggs::grove<gdt::interval, gio::compact_gff_entry, std::string>::deserialize(in);
     EXPECT_EQ(grove.indexed_vertex_count(), 3u);
 
     // chr1:101-500 (gene1) is stored as interval [101, 500]; a query at 200
     // must return it with the original GFF payload intact.
     auto hits = grove.intersect(gdt::interval(200, 200), "chr1");
     ASSERT_EQ(hits.get_keys().size(), 1u);
-    EXPECT_EQ(hits.get_keys()[0]->get_data().seqid, "chr1");
-    EXPECT_EQ(hits.get_keys()[0]->get_data().type, "gene");
-    EXPECT_EQ(hits.get_keys()[0]->get_data().attributes.at("ID"), "gene1");
+    EXPECT_EQ(hits.get_keys()[0]->get_data().get_seqid(), "chr1");
+    EXPECT_EQ(hits.get_keys()[0]->get_data().get_type(), "gene");
+    EXPECT_EQ(hits.get_keys()[0]->get_data().get_attribute("ID"), "gene1");
     EXPECT_EQ(hits.get_keys()[0]->get_data().format, gio::gff_format::GFF3);
 }
 
@@ -458,7 +589,8 @@ TEST_F(CLIIndexE2ETest, IndexGffLinksAddsGraphEdges) {
     std::ifstream in(tmp_links_output, std::ios::binary);
     ASSERT_TRUE(in.is_open());
     (void)gio::gg_header::read(in);
-    auto grove = ggs::grove<gdt::interval, gio::gff_entry, std::string>::deserialize(in);
+    (void)gio::gff_field_registry::deserialize(in);
+    auto grove = ggs::grove<gdt::interval, gio::compact_gff_entry, std::string>::deserialize(in);
 
     // gene1: chr1 [101,500]; gene2: chr1 [601,900]; gene3: chr2 [201,400].
     auto g1 = grove.intersect(gdt::interval(300, 300), "chr1");
@@ -304,6 +304,26 @@ TEST_F(CLIIntersectE2ETest, IntersectWithPrebuiltIndexInPlace) {
     EXPECT_EQ(result.output.find("chr2"), std::string::npos);
 }
 
+TEST_F(CLIIntersectE2ETest, IntersectWithInterval32Index) {
+    // An index built with --key-type interval32 records the key type in its
+    // header; both -i paths dispatch on it and return the same hits.
+    auto idx_result = run_command(cli(
+        "idx \"" + target_path.string() + "\" -o \"" + tmp_index.string() +
+        "\" --key-type interval32"
+    ));
+    ASSERT_EQ(idx_result.exit_code, 0) << idx_result.output;
+
+    for (const char* mode : {"", " --in-place"}) {
+        auto result = run_command(cli(
+            "isec -q \"" + query_path.string() + "\" -i \"" + tmp_index.string() + "\"" + mode
+        ));
+        EXPECT_EQ(result.exit_code, 0) << mode << ": " << result.output;
+        EXPECT_NE(result.output.find("chr1\t100\t500"), std::string::npos) << mode;
+        EXPECT_NE(result.output.find("chr1\t600\t900"), std::string::npos) << mode;
+        EXPECT_EQ(result.output.find("chr2"), std::string::npos) << mode;
+    }
+}
+
 TEST_F(CLIIntersectE2ETest, InPlaceRequiresIndex) {
     // --in-place has nothing to read in place without a prebuilt index (-i);
     // a -t target is built in memory.
@@ -31,8 +31,11 @@ namespace {
 // tests can exercise the handler primitives directly.
 template <typename grove_t>
 void bed_intersect(grove_t& grove, const std::string& queryfile, std::ostream& out) {
-    handlers::bed::for_each_bed_query(queryfile, [&](gdt::interval iv, const std::string& index) {
-        auto results = grove.intersect(iv, index);  // bind: get_keys() refs into it
+    ggs::index_handle_map handles;
+    handlers::bed::for_each_bed_query(queryfile, [&](gdt::interval iv, const std::string& index,
+                                                     int32_t chrom_id) {
+        // bind: get_keys() refs into it
+        auto results = grove.intersect(iv, handles.get(grove, chrom_id, index));
         for (auto* result : results.get_keys()) {
             handlers::bed::print_bed_result(out, result->get_data());
         }
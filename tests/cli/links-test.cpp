@@ -7,11 +7,14 @@
 #include <gtest/gtest.h>
 
 // standard
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <vector>
 
 // genogrove cli
 #include <handlers/links.hpp>
@@ -197,4 +200,62 @@ TEST(LinksApply, throwsOnNameNotInMap) {
     }
 
     fs::remove(tsv_path);
-}
\ No newline at end of file
+}
+TEST(LinksApply, parallelResolutionMatchesSequential) {
+    // More rows than one resolution chunk, so several workers take part.
+    std::string content;
+    for (int i = 0; i < 10000; ++i) {
+        content += "gene" + std::to_string(i % 7) + "\tgene" + std::to_string((i * 3 + 1) % 7);
+        content += (i % 2 ? "\tm" + std::to_string(i % 5) + "\n" : std::string("\n"));
+    }
+    fs::path tsv_path = write_tsv("gg_links_parallel.tsv", content);
+
+    auto build = [&](std::size_t num_threads) {
+        apply_grove g(4);
+        handlers::name_to_key_map<std::string> nm;
+        for (std::size_t i = 0; i < 7; ++i) {
+            add_named(g, nm, "gene" + std::to_string(i), 10 * i, 10 * i + 5);
+        }
+        const std::size_t added =
+            handlers::links::apply_to_grove(g, tsv_path.string(), nm, num_threads);
+        std::vector<std::tuple<std::string, std::string, std::string>> edges;
+        for (const auto& [name, key] : nm) {
+            for (const auto& e : g.graph().out_edges_view(key)) {
+                edges.emplace_back(key->get_data(), e.key->get_data(), e.metadata);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        EXPECT_EQ(edges.size(), added);
+        return edges;
+    };
+    const auto sequential = build(1);
+    EXPECT_FALSE(sequential.empty());
+    EXPECT_EQ(build(4), sequential);
+    EXPECT_EQ(build(0), sequential);
+
+    fs::remove(tsv_path);
+}
+
+TEST(LinksApply, parallelResolutionReportsFirstMissingNameAndAddsNothing) {
+    std::string content;
+    for (int i = 0; i < 10000; ++i) {
+        if (i == 6000) content += "geneA\tmissing_early\n";
+        else if (i == 9000) content += "missing_late\tgeneB\n";
+        else content += "geneA\tgeneB\n";
+    }
+    fs::path tsv_path = write_tsv("gg_links_parallel_missing.tsv", content);
+
+    apply_grove g(4);
+    handlers::name_to_key_map<std::string> nm;
+    add_named(g, nm, "geneA", 10, 20);
+    add_named(g, nm, "geneB", 30, 40);
+    try {
+        handlers::links::apply_to_grove(g, tsv_path.string(), nm, 4);
+        FAIL() << "expected apply_to_grove to throw on an unresolved name";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("missing_early"), std::string::npos) << e.what();
+    }
+    EXPECT_EQ(g.graph().edge_count(), 0u);
+
+    fs::remove(tsv_path);
+}
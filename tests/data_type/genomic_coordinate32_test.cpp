@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Standard
+#include <sstream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Genogrove
+#include <genogrove/data_type/genomic_coordinate.hpp>
+#include <genogrove/data_type/genomic_coordinate32.hpp>
+#include <genogrove/data_type/key_type_base.hpp>
+
+namespace gdt = genogrove::data_type;
+
+TEST(genomicCoordinate32Test, keyTypeBaseConcept) {
+    static_assert(gdt::key_type_base<gdt::genomic_coordinate32>,
+        "genomic_coordinate32 must satisfy key_type_base concept");
+    static_assert(sizeof(gdt::genomic_coordinate32) == 8);
+}
+
+TEST(genomicCoordinate32Test, defaultConstructor) {
+    gdt::genomic_coordinate32 coord;
+    EXPECT_EQ(coord.get_start(), 0u);
+    EXPECT_EQ(coord.get_end(), 0u);
+    EXPECT_EQ(coord.get_strand(), '.');
+}
+
+TEST(genomicCoordinate32Test, constructorValidates) {
+    EXPECT_THROW(gdt::genomic_coordinate32('x', 1, 2), std::invalid_argument);
+    EXPECT_THROW(gdt::genomic_coordinate32('+', 2, 1), std::invalid_argument);
+    EXPECT_THROW(gdt::genomic_coordinate32('+', 0, gdt::genomic_coordinate32::max_position + 1),
+                 std::invalid_argument);
+}
+
+TEST(genomicCoordinate32Test, strandPackingKeepsPositions) {
+    constexpr size_t top = gdt::genomic_coordinate32::max_position;
+    for (char strand : {'+', '-', '.', '*'}) {
+        gdt::genomic_coordinate32 coord(strand, top - 5, top);
+        EXPECT_EQ(coord.get_strand(), strand);
+        EXPECT_EQ(coord.get_start(), top - 5);
+        EXPECT_EQ(coord.get_end(), top);
+
+        coord.set_range(7, 9);
+        EXPECT_EQ(coord.get_strand(), strand);
+        EXPECT_EQ(coord.get_start(), 7u);
+        coord.set_strand('-');
+        EXPECT_EQ(coord.get_strand(), '-');
+        EXPECT_EQ(coord.get_end(), 9u);
+    }
+}
+
+TEST(genomicCoordinate32Test, matchesGenomicCoordinateSemantics) {
+    // Ordering, overlap and aggregate agree with the full-width key.
+    std::vector<std::tuple<char, size_t, size_t>> coords;
+    for (char strand : {'+', '-', '.', '*'}) {
+        for (auto [s, e] : std::vector<std::pair<size_t, size_t>>{{10, 20}, {10, 30}, {15, 15}, {31, 40}}) {
+            coords.emplace_back(strand, s, e);
+        }
+    }
+    for (const auto& [as, a0, a1] : coords) {
+        for (const auto& [bs, b0, b1] : coords) {
+            const gdt::genomic_coordinate wa{as, a0, a1}, wb{bs, b0, b1};
+            const gdt::genomic_coordinate32 na{as, a0, a1}, nb{bs, b0, b1};
+            EXPECT_EQ(na < nb, wa < wb);
+            EXPECT_EQ(na == nb, wa == wb);
+            EXPECT_EQ(gdt::genomic_coordinate32::overlaps(na, nb),
+                      gdt::genomic_coordinate::overlaps(wa, wb));
+            EXPECT_EQ(gdt::genomic_coordinate32::aggregate(na, nb).to_string(),
+                      gdt::genomic_coordinate::aggregate(wa, wb).to_string());
+        }
+    }
+}
+
+TEST(genomicCoordinate32Test, serialization) {
+    gdt::genomic_coordinate32 original('-', 100, gdt::genomic_coordinate32::max_position);
+    std::stringstream ss;
+    original.serialize(ss);
+    EXPECT_EQ(ss.str().size(), 9u);
+    EXPECT_EQ(gdt::genomic_coordinate32::deserialize(ss), original);
+}
+
+TEST(genomicCoordinate32Test, deserializeRejectsInvalidInput) {
+    std::stringstream truncated(std::string(4, '\0'));
+    EXPECT_THROW({
+        [[maybe_unused]] auto result = gdt::genomic_coordinate32::deserialize(truncated);
+    }, std::runtime_error);
+
+    std::stringstream bad_strand;
+    gdt::genomic_coordinate32('+', 1, 2).serialize(bad_strand);
+    std::string bytes = bad_strand.str();
+    bytes[0] = 'x';
+    std::stringstream corrupted(bytes);
+    EXPECT_THROW({
+        [[maybe_unused]] auto result = gdt::genomic_coordinate32::deserialize(corrupted);
+    }, std::runtime_error);
+}
@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Standard
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+// Genogrove
+#include <genogrove/data_type/interval.hpp>
+#include <genogrove/data_type/interval32.hpp>
+#include <genogrove/data_type/key_type_base.hpp>
+
+namespace gdt = genogrove::data_type;
+
+TEST(interval32Test, keyTypeBaseConcept) {
+    static_assert(gdt::key_type_base<gdt::interval32>,
+        "interval32 must satisfy key_type_base concept");
+    static_assert(sizeof(gdt::interval32) == 8);
+}
+
+TEST(interval32Test, defaultConstructor) {
+    gdt::interval32 intvl;
+    EXPECT_EQ(intvl.get_start(), gdt::interval32::INVALID_POSITION);
+    EXPECT_EQ(intvl.get_end(), gdt::interval32::INVALID_POSITION);
+}
+
+TEST(interval32Test, constructorValidatesRange) {
+    EXPECT_THROW(gdt::interval32(200, 100), std::invalid_argument);
+    EXPECT_NO_THROW(gdt::interval32(100, 100));
+    EXPECT_NO_THROW(gdt::interval32(0, gdt::interval32::max_position));
+    EXPECT_THROW(gdt::interval32(0, gdt::interval32::max_position + 1), std::invalid_argument);
+    // The sentinel is not a position: the largest real end stays distinguishable.
+    EXPECT_LT(gdt::interval32::max_position, gdt::interval32::INVALID_POSITION);
+    EXPECT_THROW(gdt::interval32(0, gdt::interval32::INVALID_POSITION), std::invalid_argument);
+}
+
+TEST(interval32Test, matchesIntervalSemantics) {
+    // Ordering, overlap and aggregate agree with the full-width key.
+    const std::vector<std::pair<size_t, size_t>> ranges = {
+        {10, 20}, {10, 30}, {15, 15}, {20, 25}, {31, 40}, {4294967000u, 4294967294u}};
+    for (const auto& [as, ae] : ranges) {
+        for (const auto& [bs, be] : ranges) {
+            const gdt::interval wa{as, ae}, wb{bs, be};
+            const gdt::interval32 na{as, ae}, nb{bs, be};
+            EXPECT_EQ(na < nb, wa < wb);
+            EXPECT_EQ(na == nb, wa == wb);
+            EXPECT_EQ(gdt::interval32::overlaps(na, nb), gdt::interval::overlaps(wa, wb));
+            const auto agg = gdt::interval32::aggregate(na, nb);
+            const auto wide_agg = gdt::interval::aggregate(wa, wb);
+            EXPECT_EQ(agg.get_start(), wide_agg.get_start());
+            EXPECT_EQ(agg.get_end(), wide_agg.get_end());
+        }
+    }
+    EXPECT_EQ(gdt::interval32(100, 200).to_string(), gdt::interval(100, 200).to_string());
+}
+
+TEST(interval32Test, serialization) {
+    gdt::interval32 original(100, gdt::interval32::max_position);
+    std::stringstream ss;
+    original.serialize(ss);
+    EXPECT_EQ(ss.str().size(), 8u);
+    EXPECT_EQ(gdt::interval32::deserialize(ss), original);
+}
+
+TEST(interval32Test, deserializeRejectsTruncatedOrInvertedInput) {
+    std::stringstream truncated(std::string(5, '\0'));
+    EXPECT_THROW({
+        [[maybe_unused]] auto result = gdt::interval32::deserialize(truncated);
+    }, std::runtime_error);
+
+    std::stringstream ss;
+    const std::uint32_t start = 20, end = 10;
+    ss.write(reinterpret_cast<const char*>(&start), sizeof(start));
+    ss.write(reinterpret_cast<const char*>(&end), sizeof(end));
+    EXPECT_THROW({
+        [[maybe_unused]] auto result = gdt::interval32::deserialize(ss);
+    }, std::runtime_error);
+}
+
+TEST(interval32Test, deserializeKeepsSentinelDistinctFromPositions) {
+    std::stringstream unset;
+    gdt::interval32().serialize(unset);
+    const auto restored = gdt::interval32::deserialize(unset);
+    EXPECT_EQ(restored.get_start(), gdt::interval32::INVALID_POSITION);
+    EXPECT_EQ(restored.get_end(), gdt::interval32::INVALID_POSITION);
+
+    std::stringstream ss;
+    const std::uint32_t start = 5, end = gdt::interval32::INVALID_POSITION;
+    ss.write(reinterpret_cast<const char*>(&start), sizeof(start));
+    ss.write(reinterpret_cast<const char*>(&end), sizeof(end));
+    EXPECT_THROW({
+        [[maybe_unused]] auto result = gdt::interval32::deserialize(ss);
+    }, std::runtime_error);
+}
@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Standard
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Genogrove
+#include <genogrove/data_type/key_column.hpp>
+#include <genogrove/data_type/kmer.hpp>
+
+namespace gdt = genogrove::data_type;
+
+namespace {
+
+template<typename T>
+std::string write_column(const std::vector<T>& values) {
+    std::ostringstream os(std::ios::binary);
+    gdt::key_column<T>::write(os, values.size(),
+        [&](std::size_t i) -> const T& { return values[i]; });
+    return os.str();
+}
+
+template<typename T>
+std::vector<T> read_column(const std::string& bytes, std::size_t count) {
+    std::istringstream is(bytes, std::ios::binary);
+    std::vector<T> out;
+    gdt::key_column<T>::read(is, count, out);
+    return out;
+}
+
+// A column with a hand-built body: uint32 byte length, then the bytes.
+std::string framed(const std::string& body) {
+    std::string s;
+    const auto length = static_cast<std::uint32_t>(body.size());
+    s.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    return s + body;
+}
+
+} // namespace
+
+TEST(KeyColumnTest, VarintRoundTripsAndRejectsMalformed) {
+    for (std::uint64_t v : {std::uint64_t{0}, std::uint64_t{127}, std::uint64_t{128},
+                            std::uint64_t{300}, std::numeric_limits<std::uint64_t>::max()}) {
+        std::string s;
+        gdt::detail::append_varint(s, v);
+        const char* pos = s.data();
+        EXPECT_EQ(gdt::detail::read_varint(pos, s.data() + s.size()), v);
+        EXPECT_EQ(pos, s.data() + s.size());
+    }
+    for (std::int64_t d : {std::int64_t{0}, std::int64_t{-1}, std::int64_t{1},
+                           std::numeric_limits<std::int64_t>::min()}) {
+        const auto u = static_cast<std::uint64_t>(d);
+        EXPECT_EQ(gdt::detail::zigzag_decode(gdt::detail::zigzag_encode(u)), u);
+    }
+    EXPECT_EQ(gdt::detail::zigzag_encode(static_cast<std::uint64_t>(-1)), 1u);
+
+    const std::string truncated = "\x80\x80";
+    const char* pos = truncated.data();
+    EXPECT_THROW(gdt::detail::read_varint(pos, truncated.data() + truncated.size()),
+                 std::runtime_error);
+
+    const std::string overlong(11, '\xFF');
+    pos = overlong.data();
+    EXPECT_THROW(gdt::detail::read_varint(pos, overlong.data() + overlong.size()),
+                 std::runtime_error);
+}
+
+TEST(KeyColumnTest, IntervalRoundTripsSortedAndUnsortedRuns) {
+    const std::vector<gdt::interval> sorted = {{100, 200}, {150, 150}, {150, 400}, {10000, 10500}};
+    EXPECT_EQ(read_column<gdt::interval>(write_column(sorted), sorted.size()), sorted);
+
+    // Internal nodes hold aggregates and external blocks are unsorted, so a
+    // start may go backwards; extremes must survive the wrapping delta.
+    const std::size_t max = std::numeric_limits<std::size_t>::max();
+    const std::vector<gdt::interval> mixed = {{500, 600}, {0, 0}, {max - 1, max}, gdt::interval{},
+                                              {7, max}, {3, 9}};
+    EXPECT_EQ(read_column<gdt::interval>(write_column(mixed), mixed.size()), mixed);
+
+    EXPECT_TRUE(read_column<gdt::interval>(write_column(std::vector<gdt::interval>{}), 0).empty());
+}
+
+TEST(KeyColumnTest, IntervalColumnIsSmallerThanRawCoordinates) {
+    std::vector<gdt::interval> run;
+    for (std::size_t i = 0; i < 500; ++i) {
+        run.emplace_back(1000000 + i * 250, 1000000 + i * 250 + 99);
+    }
+    const std::string bytes = write_column(run);
+    // Two raw size_t per key before; deltas of 250 and lengths of 99 need 2 + 1 bytes.
+    EXPECT_EQ(bytes.size(), sizeof(std::uint32_t) + 3 + 2 * (run.size() - 1) + run.size());
+    EXPECT_LT(bytes.size(), run.size() * 2 * sizeof(std::size_t) / 4);
+    EXPECT_EQ(read_column<gdt::interval>(bytes, run.size()), run);
+}
+
+TEST(KeyColumnTest, GenomicCoordinateRoundTripsEveryStrand) {
+    // Five keys so the packed strand column ends in a partial byte.
+    const std::vector<gdt::genomic_coordinate> run = {
+        {'+', 10, 20}, {'-', 15, 30}, {'.', 15, 15}, {'*', 2, 90}, {'-', 400, 401}};
+    const auto back = read_column<gdt::genomic_coordinate>(write_column(run), run.size());
+    ASSERT_EQ(back.size(), run.size());
+    for (std::size_t i = 0; i < run.size(); ++i) {
+        EXPECT_EQ(back[i].get_strand(), run[i].get_strand()) << i;
+        EXPECT_EQ(back[i].get_start(), run[i].get_start()) << i;
+        EXPECT_EQ(back[i].get_end(), run[i].get_end()) << i;
+    }
+}
+
+TEST(KeyColumnTest, NumericRoundTripsExtremes) {
+    const std::vector<gdt::numeric> run = {
+        gdt::numeric{std::numeric_limits<int>::min()}, gdt::numeric{std::numeric_limits<int>::max()},
+        gdt::numeric{0}, gdt::numeric{-5}, gdt::numeric{std::numeric_limits<int>::min()}};
+    EXPECT_EQ(read_column<gdt::numeric>(write_column(run), run.size()), run);
+}
+
+TEST(KeyColumnTest, PrimaryTemplateWritesRowWise) {
+    const std::vector<gdt::kmer> run = {gdt::kmer("ACGT"), gdt::kmer("TTGA")};
+    const std::string bytes = write_column(run);
+
+    std::ostringstream rows(std::ios::binary);
+    for (const auto& k : run) {
+        k.serialize(rows);
+    }
+    EXPECT_EQ(bytes, rows.str());
+    EXPECT_EQ(read_column<gdt::kmer>(bytes, run.size()), run);
+    EXPECT_THROW(read_column<gdt::kmer>(bytes, run.size() + 1), std::runtime_error);
+}
+
+TEST(KeyColumnTest, MalformedColumnsRejected) {
+    const std::string good = write_column(std::vector<gdt::interval>{{1, 2}, {3, 4}});
+
+    // Fewer bytes than the declared length.
+    EXPECT_THROW(read_column<gdt::interval>(good.substr(0, good.size() - 1), 2), std::runtime_error);
+    // More bytes than the values need.
+    EXPECT_THROW(read_column<gdt::interval>(framed(good.substr(4) + '\0'), 2), std::runtime_error);
+    // A length no run of this many keys could encode to.
+    EXPECT_THROW(read_column<gdt::interval>(framed(std::string(41, '\0')), 2), std::runtime_error);
+    // start = 1, length = max: the end would wrap past size_t.
+    std::string wrap = "\x02";
+    gdt::detail::append_varint(wrap, std::numeric_limits<std::uint64_t>::max());
+    EXPECT_THROW(read_column<gdt::interval>(framed(wrap), 1), std::runtime_error);
+    // A numeric delta landing outside int.
+    std::string big;
+    gdt::detail::append_varint(big, gdt::detail::zigzag_encode(std::uint64_t{1} << 40));
+    EXPECT_THROW(read_column<gdt::numeric>(framed(big), 1), std::runtime_error);
+    // A genomic_coordinate column too short to hold its strand bits.
+    EXPECT_THROW(read_column<gdt::genomic_coordinate>(framed(""), 1), std::runtime_error);
+}
+
+TEST(KeyColumnTest, CompactKeysMatchFullWidthColumnsAndRejectWidePositions) {
+    // Same coordinates, same encoding: the 32-bit keys only narrow the
+    // in-memory value.
+    const std::vector<gdt::interval> wide = {{100, 200}, {150, 400}, {4294967290u, 4294967294u}};
+    const std::vector<gdt::interval32> narrow = {{100, 200}, {150, 400}, {4294967290u, 4294967294u}};
+    EXPECT_EQ(write_column(narrow), write_column(wide));
+    EXPECT_EQ(read_column<gdt::interval32>(write_column(narrow), narrow.size()), narrow);
+
+    const std::vector<gdt::genomic_coordinate32> stranded = {
+        {'+', 10, 20}, {'-', 15, 30}, {'.', 15, 15}, {'*', 2, 90}, {'-', 400, 2147483647u}};
+    EXPECT_EQ(read_column<gdt::genomic_coordinate32>(write_column(stranded), stranded.size()), stranded);
+
+    // A position past 32 (or 31) bits from a full-width writer is a malformed column.
+    const std::string too_wide = write_column(std::vector<gdt::interval>{{1, std::size_t{1} << 32}});
+    EXPECT_THROW(read_column<gdt::interval32>(too_wide, 1), std::runtime_error);
+    // UINT32_MAX is interval32's unset sentinel, not a position.
+    const std::string sentinel_end = write_column(std::vector<gdt::interval>{{1, 4294967295u}});
+    EXPECT_THROW(read_column<gdt::interval32>(sentinel_end, 1), std::runtime_error);
+    const std::string too_wide_stranded =
+        write_column(std::vector<gdt::genomic_coordinate>{{'+', 1, std::size_t{1} << 31}});
+    EXPECT_THROW(read_column<gdt::genomic_coordinate32>(too_wide_stranded, 1), std::runtime_error);
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Standard
+#include <string>
+#include <vector>
+
+// Genogrove
+#include <genogrove/data_type/kmer_extractor.hpp>
+
+namespace gdt = genogrove::data_type;
+
+namespace {
+    // Reference: build a kmer from every window, skipping windows with non-ACGT
+    std::vector<gdt::kmer_hit> naive_kmers(const std::string& seq, uint8_t k, bool canonical) {
+        std::vector<gdt::kmer_hit> hits;
+        for (size_t i = 0; i + k <= seq.size(); ++i) {
+            const std::string window = seq.substr(i, k);
+            if (!gdt::kmer::is_valid(window)) continue;
+            gdt::kmer value(window);
+            hits.push_back({i, canonical ? value.canonical() : value});
+        }
+        return hits;
+    }
+
+    std::vector<gdt::kmer_hit> extract(const std::string& seq, uint8_t k, bool canonical) {
+        std::vector<gdt::kmer_hit> hits;
+        for (const auto& hit : gdt::kmer_extractor(seq, k, {.canonical = canonical})) {
+            hits.push_back(hit);
+        }
+        return hits;
+    }
+
+    void expect_same(const std::vector<gdt::kmer_hit>& a, const std::vector<gdt::kmer_hit>& b) {
+        ASSERT_EQ(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(a[i].position, b[i].position);
+            EXPECT_EQ(a[i].value, b[i].value) << a[i].value.to_string() << " vs " << b[i].value.to_string();
+        }
+    }
+}
+
+TEST(kmerExtractorTest, matchesPerWindowConstruction) {
+    const std::string seq = "ACGTTGCAAGGCTTAACCGGTTAAGCTAGCTAGGATCCAtgcaTTGACG";
+    for (uint8_t k : {1, 3, 7, 16, 31, 32}) {
+        expect_same(extract(seq, k, false), naive_kmers(seq, k, false));
+        expect_same(extract(seq, k, true), naive_kmers(seq, k, true));
+    }
+}
+
+TEST(kmerExtractorTest, skipsWindowsWithInvalidBases) {
+    const std::string seq = "ACGTNACGTAC-GTACGT";
+    auto hits = extract(seq, 4, false);
+    expect_same(hits, naive_kmers(seq, 4, false));
+    ASSERT_EQ(hits.size(), 7u);
+    EXPECT_EQ(hits.front().position, 0u);
+    EXPECT_EQ(hits[1].position, 5u);
+}
+
+TEST(kmerExtractorTest, shortAndEmptySequences) {
+    EXPECT_TRUE(extract("", 4, false).empty());
+    EXPECT_TRUE(extract("ACG", 4, false).empty());
+    EXPECT_EQ(extract("ACGT", 4, false).size(), 1u);
+}
+
+TEST(kmerExtractorTest, rejectsInvalidK) {
+    EXPECT_THROW(gdt::kmer_extractor("ACGT", 0), std::invalid_argument);
+    EXPECT_THROW(gdt::kmer_extractor("ACGT", 33), std::invalid_argument);
+}
+
+TEST(kmerExtractorTest, collectFromRecordsWithSequenceMember) {
+    struct record { std::string sequence; };
+    std::vector<record> records = {{"ACGTA"}, {"TTN"}, {"GGGG"}};
+    std::vector<uint64_t> out;
+    gdt::collect_kmer_encodings(records, 3, out);
+    std::vector<uint64_t> expected = {
+        gdt::kmer("ACG").get_encoding(), gdt::kmer("CGT").get_encoding(), gdt::kmer("GTA").get_encoding(),
+        gdt::kmer("GGG").get_encoding(), gdt::kmer("GGG").get_encoding()};
+    EXPECT_EQ(out, expected);
+}
@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Standard
+#include <set>
+#include <string>
+
+// Genogrove
+#include <genogrove/data_type/kmer_extractor.hpp>
+#include <genogrove/data_type/kmer_minimizer.hpp>
+
+namespace gdt = genogrove::data_type;
+
+TEST(kmerMinimizerTest, matchesSmallestHashedSubstring) {
+    const std::string seq = "ACGTTGCAAGGCTTAACCGGTTAAGCTAGCTA";
+    for (uint8_t m : {1, 5, 11, 32}) {
+        uint64_t best = ~0ULL;
+        for (size_t i = 0; i + m <= seq.size(); ++i) {
+            best = std::min(best, gdt::minimizer_hash(gdt::kmer(seq.substr(i, m)).get_encoding()));
+        }
+        EXPECT_EQ(gdt::kmer_minimizer(gdt::kmer(seq), m, false), best) << int(m);
+    }
+}
+
+TEST(kmerMinimizerTest, canonicalMinimizerIsStrandIndependent) {
+    const std::string seq = "GATTACAGATTACACCGGTTAAGCTAGCTAGG";
+    for (const auto& hit : gdt::kmer_extractor(seq, 21)) {
+        const auto rc = hit.value.reverse_complement();
+        EXPECT_EQ(gdt::kmer_minimizer(hit.value, 9, true), gdt::kmer_minimizer(rc, 9, true));
+    }
+}
+
+TEST(kmerMinimizerTest, overlappingKmersShareBuckets) {
+    // Consecutive k-mers mostly share their minimizer, so a read's k-mers
+    // land in far fewer buckets than it has k-mers.
+    const std::string read = "ACGTTGCAAGGCTTAACCGGTTAAGCTAGCTAGGATCCATGCATTGACGGATTACAGATTACACCGGTTAAGCTAGC";
+    const gdt::kmer_bucketing bucketing{.k = 21, .m = 11, .buckets = 4096};
+    std::set<uint32_t> buckets;
+    size_t kmers = 0;
+    for (const auto& hit : gdt::kmer_extractor(read, bucketing.k)) {
+        buckets.insert(bucketing.bucket_of(hit.value));
+        ++kmers;
+    }
+    EXPECT_LT(buckets.size() * 3, kmers);
+}
+
+TEST(kmerMinimizerTest, bucketingValidationAndNames) {
+    EXPECT_NO_THROW((gdt::kmer_bucketing{}.validate()));
+    EXPECT_THROW((gdt::kmer_bucketing{.k = 0}.validate()), std::invalid_argument);
+    EXPECT_THROW((gdt::kmer_bucketing{.k = 11, .m = 12}.validate()), std::invalid_argument);
+    EXPECT_THROW((gdt::kmer_bucketing{.buckets = 0}.validate()), std::invalid_argument);
+    EXPECT_THROW((void)gdt::kmer_minimizer(gdt::kmer("ACGT"), 5, false), std::invalid_argument);
+    EXPECT_EQ(gdt::kmer_bucketing::index_name("genome", 17), "genome#17");
+}
@@ -381,4 +381,22 @@ TEST(kmerTest, serializeToFailedStream) {
     std::stringstream ss;
     ss.setstate(std::ios::failbit);
     EXPECT_THROW(k.serialize(ss), std::runtime_error);
-}
\ No newline at end of file
+}
+TEST(kmerTest, reverseComplement) {
+    EXPECT_EQ(gdt::kmer("ACGT").reverse_complement(), gdt::kmer("ACGT"));
+    EXPECT_EQ(gdt::kmer("AACG").reverse_complement(), gdt::kmer("CGTT"));
+    EXPECT_EQ(gdt::kmer("A").reverse_complement(), gdt::kmer("T"));
+    std::string seq32 = "ACGTTGCAAGGCTTAACCGGTTAAGCTAGCTA";
+    std::string rc32(seq32.rbegin(), seq32.rend());
+    for (auto& c : rc32) {
+        c = gdt::kmer::decode_base(3 - gdt::kmer::encode_base(c));
+    }
+    EXPECT_EQ(gdt::kmer(seq32).reverse_complement().to_string(), rc32);
+    EXPECT_EQ(gdt::kmer().reverse_complement(), gdt::kmer());
+}
+
+TEST(kmerTest, canonicalPicksSmallerStrand) {
+    EXPECT_EQ(gdt::kmer("TTTG").canonical(), gdt::kmer("CAAA"));
+    EXPECT_EQ(gdt::kmer("CAAA").canonical(), gdt::kmer("CAAA"));
+    EXPECT_EQ(gdt::kmer("ACGT").canonical(), gdt::kmer("ACGT"));
+}
@@ -15,6 +15,7 @@
 // genogrove
 #include <genogrove/data_type/query_result.hpp>
 #include <genogrove/data_type/flanking_query_result.hpp>
+#include <genogrove/data_type/expansion_result.hpp>
 #include <genogrove/data_type/interval.hpp>
 #include <genogrove/data_type/numeric.hpp>
 #include <genogrove/data_type/genomic_coordinate.hpp>
@@ -180,3 +181,24 @@ TEST(query_result_test, flanking_returns_non_const_pointers) {
     static_assert(std::is_same_v<succ_t, expected_t>,
         "flanking_query_result::get_successor() must return key* (#435).");
 }
+
+TEST(expansion_result_test, seeds_then_reached_keys) {
+    gdt::key<gdt::interval, int> seed0(gdt::interval(10, 20), 0);
+    gdt::key<gdt::interval, int> seed1(gdt::interval(15, 30), 1);
+    gdt::key<gdt::interval, int> reached(gdt::interval(900, 950), 2);
+
+    gdt::expansion_result<gdt::interval, int> result(gdt::interval(12, 18));
+    EXPECT_TRUE(result.empty());
+    result.add_key(&seed0, 0);
+    result.add_key(&seed1, 0);
+    result.add_key(&reached, 1);
+
+    EXPECT_EQ(result.get_query(), gdt::interval(12, 18));
+    EXPECT_EQ(result.size(), 3u);
+    EXPECT_EQ(result.get_seed_count(), 2u);
+    EXPECT_EQ(result.get_keys().back(), &reached);
+    EXPECT_EQ(result.get_depths(), (std::vector<std::size_t>{0, 0, 1}));
+
+    EXPECT_THROW(result.add_key(nullptr, 1), std::invalid_argument);
+    EXPECT_THROW(result.add_key(&seed0, 0), std::invalid_argument);  // depth went backwards
+}
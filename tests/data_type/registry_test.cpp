@@ -630,6 +630,119 @@ TEST_F(RegistryTest, ConcurrentInternIsRaceFree) {
     }
 }
 
+TEST_F(RegistryTest, ConcurrentInternOfDistinctKeysKeepsIdsDense) {
+    auto& reg = gdt::registry<std::string>::instance();
+
+    constexpr int num_threads = 8;
+    constexpr int per_thread = 600;  // crosses the first storage segment (1024)
+    constexpr int shared_values = 16;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < per_thread; ++i) {
+                (void)reg.intern("own_" + std::to_string(t) + "_" + std::to_string(i));
+                (void)reg.intern("shared_" + std::to_string(i % shared_values));
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    const std::size_t expected = num_threads * per_thread + shared_values;
+    ASSERT_EQ(reg.size(), expected);
+
+    // Ids are exactly [0, size): no id was skipped or handed out twice.
+    std::set<uint32_t> ids;
+    for (int t = 0; t < num_threads; ++t) {
+        for (int i = 0; i < per_thread; ++i) {
+            const std::string value = "own_" + std::to_string(t) + "_" + std::to_string(i);
+            auto id = reg.find(value);
+            ASSERT_TRUE(id.has_value());
+            EXPECT_EQ(reg.get(*id), value);
+            ids.insert(*id);
+        }
+    }
+    for (int v = 0; v < shared_values; ++v) {
+        ids.insert(*reg.find("shared_" + std::to_string(v)));
+    }
+    ASSERT_EQ(ids.size(), expected);
+    EXPECT_EQ(*ids.begin(), 0u);
+    EXPECT_EQ(*ids.rbegin(), expected - 1);
+}
+
+TEST_F(RegistryTest, GetIsSafeDuringConcurrentIntern) {
+    auto& reg = gdt::registry<int>::instance();
+    const uint32_t first = reg.intern(-1);
+
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (int i = 0; i < 5000; ++i) {
+            (void)reg.intern(i);
+        }
+        done.store(true);
+    });
+
+    // Readers resolve ids the writer publishes while it keeps appending.
+    bool consistent = true;
+    while (!done.load()) {
+        consistent &= reg.get(first) == -1;
+        const std::size_t n = reg.size();
+        if (n > 1) {
+            consistent &= reg.contains(static_cast<uint32_t>(n - 1));
+            consistent &= reg.get(static_cast<uint32_t>(n - 1)) == static_cast<int>(n - 2);
+        }
+    }
+    writer.join();
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(reg.size(), 5001u);
+}
+
+TEST_F(RegistryTest, ClearInvalidatesThreadLocalCache) {
+    auto& reg = gdt::registry<std::string>::instance();
+    EXPECT_EQ(reg.intern("a"), 0u);
+    EXPECT_EQ(reg.intern("b"), 1u);
+
+    // Clear from another thread: this thread's cached ids must not survive.
+    std::thread([]() { gdt::registry<std::string>::reset(); }).join();
+    EXPECT_FALSE(reg.find("a").has_value());
+    EXPECT_EQ(reg.intern("b"), 0u);
+    EXPECT_EQ(reg.get(0), "b");
+}
+
+TEST_F(RegistryTest, DeserializeInvalidatesThreadLocalCache) {
+    auto& reg = gdt::registry<std::string>::instance();
+    (void)reg.intern("y");
+    (void)reg.intern("x");
+    std::stringstream ss;
+    reg.serialize(ss);
+
+    reg.clear();
+    EXPECT_EQ(reg.intern("x"), 0u);  // cached as 0 in this thread
+    EXPECT_EQ(reg.intern("y"), 1u);
+
+    (void)gdt::registry<std::string>::deserialize(ss);
+    EXPECT_EQ(reg.find("x"), 1u);
+    EXPECT_EQ(reg.intern("y"), 0u);
+}
+
+TEST_F(RegistryTest, LargeRegistryRoundTripsAcrossStorageSegments) {
+    auto& reg = gdt::registry<int>::instance();
+    constexpr int n = 10000;  // spans several storage segments
+    for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(reg.intern(i * 3), static_cast<uint32_t>(i));
+    }
+    std::stringstream ss;
+    reg.serialize(ss);
+    reg.clear();
+    auto& loaded = gdt::registry<int>::deserialize(ss);
+    ASSERT_EQ(loaded.size(), static_cast<std::size_t>(n));
+    for (int i = 0; i < n; i += 997) {
+        EXPECT_EQ(loaded.get(static_cast<uint32_t>(i)), i * 3);
+        EXPECT_EQ(loaded.find(i * 3), static_cast<uint32_t>(i));
+    }
+    EXPECT_EQ(loaded.intern(-5), static_cast<uint32_t>(n));
+}
+
 // --- Combined Registry + Grove Serialization Test ---
 
 namespace gs = genogrove::structure;
@@ -514,6 +514,19 @@ TEST_F(BamReaderTest, GetReferenceNames) {
     EXPECT_EQ(refs[2], "chrX");
 }
 
+TEST_F(BamReaderTest, RefIdsIndexReferenceNames) {
+    gio::bam_reader reader(sam_path);
+
+    for (const auto& entry : reader) {
+        if (entry.chrom == "*") {
+            EXPECT_EQ(entry.ref_id, -1);
+        } else {
+            ASSERT_GE(entry.ref_id, 0);
+            EXPECT_EQ(reader.get_reference_names().at(entry.ref_id), entry.chrom);
+        }
+    }
+}
+
 // ==========================================
 // Iterator Tests
 // ==========================================
@@ -99,6 +99,24 @@ TEST_F(bedfileTest, readBED3Format) {
     EXPECT_EQ(entries[2].end, 500);
 }
 
+TEST_F(bedfileTest, chromosomeIdsFollowFirstAppearance) {
+    fs::path path = fs::temp_directory_path() / "genogrove_bed_chrom_ids.bed";
+    {
+        std::ofstream out(path);
+        out << "chr2\t10\t20\nchr2\t30\t40\nchr1\t5\t6\nchr2\t50\t60\nchrX\t1\t2\n";
+    }
+    gio::bed_reader reader(path);
+
+    std::vector<int32_t> ids;
+    for (const auto& entry : reader) {
+        ids.push_back(entry.chrom_id);
+        EXPECT_EQ(reader.get_chromosomes().at(entry.chrom_id), entry.chrom);
+    }
+    EXPECT_EQ(ids, (std::vector<int32_t>{0, 0, 1, 0, 2}));
+    EXPECT_EQ(reader.get_chromosomes(), (std::vector<std::string>{"chr2", "chr1", "chrX"}));
+    fs::remove(path);
+}
+
 // ==========================================
 // BED6 Format Tests
 // ==========================================
@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Standard
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// Genogrove
+#include <genogrove/data_type/interval.hpp>
+#include <genogrove/io/compact_gff_entry.hpp>
+#include <genogrove/io/gff_reader.hpp>
+#include <genogrove/structure/grove/grove.hpp>
+
+namespace gio = genogrove::io;
+namespace gdt = genogrove::data_type;
+namespace ggs = genogrove::structure;
+
+namespace {
+
+gio::gff_entry make_exon(const std::string& seqid, size_t start, size_t end,
+                         const std::string& transcript, int exon_number) {
+    gio::gff_entry e(seqid, start, end, "exon");
+    e.source = "HAVANA";
+    e.strand = '+';
+    e.score = 0.5;
+    e.format = gio::gff_format::GTF;
+    e.attributes["gene_id"] = "ENSG0001";
+    e.attributes["transcript_id"] = transcript;
+    e.attributes["exon_number"] = std::to_string(exon_number);
+    return e;
+}
+
+void expect_same(const gio::gff_entry& a, const gio::gff_entry& b) {
+    EXPECT_EQ(a.seqid, b.seqid);
+    EXPECT_EQ(a.source, b.source);
+    EXPECT_EQ(a.type, b.type);
+    EXPECT_EQ(a.start, b.start);
+    EXPECT_EQ(a.end, b.end);
+    EXPECT_EQ(a.score, b.score);
+    EXPECT_EQ(a.strand, b.strand);
+    EXPECT_EQ(a.phase, b.phase);
+    EXPECT_EQ(a.attributes, b.attributes);
+    EXPECT_EQ(a.format, b.format);
+}
+
+} // namespace
+
+class CompactGffEntryTest : public ::testing::Test {
+  protected:
+    void SetUp() override { gio::gff_field_registry::reset(); }
+    void TearDown() override { gio::gff_field_registry::reset(); }
+};
+
+TEST_F(CompactGffEntryTest, RoundTripsThroughGffEntry) {
+    auto exon = make_exon("chr1", 100, 200, "ENST0001", 1);
+    exon.phase = 2;
+    const gio::compact_gff_entry compact(exon);
+
+    EXPECT_EQ(compact.get_seqid(), "chr1");
+    EXPECT_EQ(compact.get_source(), "HAVANA");
+    EXPECT_EQ(compact.get_type(), "exon");
+    EXPECT_TRUE(compact.is_gtf());
+    expect_same(compact.to_gff_entry(), exon);
+}
+
+TEST_F(CompactGffEntryTest, RepeatedFieldsShareIds) {
+    const gio::compact_gff_entry a(make_exon("chr1", 100, 200, "ENST0001", 1));
+    const gio::compact_gff_entry b(make_exon("chr1", 300, 400, "ENST0001", 2));
+    const gio::compact_gff_entry c(make_exon("chr2", 100, 200, "ENST0002", 1));
+
+    EXPECT_EQ(a.seqid, b.seqid);
+    EXPECT_NE(a.seqid, c.seqid);
+    EXPECT_EQ(a.source, c.source);
+    EXPECT_EQ(a.type, c.type);
+    ASSERT_EQ(a.attributes.size(), 3u);
+    for (size_t i = 0; i < a.attributes.size(); ++i) {
+        EXPECT_EQ(a.attributes[i].first, c.attributes[i].first);
+    }
+    // chr1, chr2, HAVANA, exon and the three attribute keys; values are not interned.
+    EXPECT_EQ(gio::gff_field_registry::instance().size(), 7u);
+}
+
+TEST_F(CompactGffEntryTest, FindsAttributesByName) {
+    const gio::compact_gff_entry compact(make_exon("chr1", 100, 200, "ENST0001", 3));
+    const std::string* transcript = compact.find_attribute("transcript_id");
+    ASSERT_NE(transcript, nullptr);
+    EXPECT_EQ(*transcript, "ENST0001");
+    EXPECT_EQ(compact.get_attribute("exon_number"), "3");
+    EXPECT_EQ(compact.find_attribute("gene_name"), nullptr);
+    EXPECT_FALSE(compact.get_attribute("gene_name").has_value());
+}
+
+TEST_F(CompactGffEntryTest, SerializesIdsAgainstTheRegistry) {
+    auto exon = make_exon("chr1", 100, 200, "ENST0001", 1);
+    exon.score.reset();
+    const gio::compact_gff_entry compact(exon);
+
+    std::stringstream dictionary;
+    std::stringstream payload;
+    gio::gff_field_registry::instance().serialize(dictionary);
+    compact.serialize(payload);
+
+    // A fresh process: the registry is reloaded before the payload.
+    gio::gff_field_registry::reset();
+    (void)gio::gff_field_registry::deserialize(dictionary);
+    const auto loaded = gio::compact_gff_entry::deserialize(payload);
+    expect_same(loaded.to_gff_entry(), exon);
+}
+
+TEST_F(CompactGffEntryTest, DeserializeRejectsIdsMissingFromTheRegistry) {
+    const gio::compact_gff_entry compact(make_exon("chr1", 100, 200, "ENST0001", 1));
+    std::stringstream payload;
+    compact.serialize(payload);
+
+    gio::gff_field_registry::reset();
+    EXPECT_THROW((void)gio::compact_gff_entry::deserialize(payload), std::runtime_error);
+}
+
+TEST_F(CompactGffEntryTest, GroveRoundTripsWithDictionary) {
+    ggs::grove<gdt::interval, gio::compact_gff_entry> grove(3);
+    for (int i = 0; i < 50; ++i) {
+        const auto exon = make_exon("chr1", 100 + i * 100, 150 + i * 100,
+                                    "ENST000" + std::to_string(i / 5), i % 5 + 1);
+        grove.insert_data("chr1", gdt::interval(exon.start - 1, exon.end - 1),
+                          gio::compact_gff_entry(exon), ggs::sorted);
+    }
+
+    std::stringstream ss;
+    gio::gff_field_registry::instance().serialize(ss);
+    grove.serialize(ss);
+
+    gio::gff_field_registry::reset();
+    (void)gio::gff_field_registry::deserialize(ss);
+    auto loaded = ggs::grove<gdt::interval, gio::compact_gff_entry>::deserialize(ss);
+
+    auto hits = loaded.intersect(gdt::interval(1220, 1230), "chr1");
+    ASSERT_EQ(hits.get_keys().size(), 1u);
+    const auto& hit = hits.get_keys()[0]->get_data();
+    EXPECT_EQ(hit.get_seqid(), "chr1");
+    EXPECT_EQ(hit.start, 1200u);
+    EXPECT_EQ(hit.get_attribute("transcript_id"), "ENST0002");
+    EXPECT_EQ(hit.get_attribute("exon_number"), "2");
+}
@@ -76,6 +76,30 @@ TEST(GgHeader, roundTripGff) {
     EXPECT_EQ(read.payload_type, gio::gg_payload_type::GFF);
 }
 
+TEST(GgHeader, roundTripCompactGff) {
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    gio::gg_header::current(gio::gg_payload_type::GFF_COMPACT).write(ss);
+    EXPECT_EQ(static_cast<unsigned char>(ss.str()[9]), 0x03u);
+
+    const auto read = gio::gg_header::read(ss);
+    EXPECT_EQ(read.payload_type, gio::gg_payload_type::GFF_COMPACT);
+}
+
+TEST(GgHeader, roundTripKeyType) {
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    gio::gg_header::current(gio::gg_payload_type::BED, gio::gg_key_type::INTERVAL32).write(ss);
+    EXPECT_EQ(static_cast<unsigned char>(ss.str()[10]), 0x01u);
+
+    const auto read = gio::gg_header::read(ss);
+    EXPECT_EQ(read.payload_type, gio::gg_payload_type::BED);
+    EXPECT_EQ(read.key_type, gio::gg_key_type::INTERVAL32);
+}
+
+TEST(GgHeader, keyTypeDefaultsToInterval) {
+    const auto h = gio::gg_header::current(gio::gg_payload_type::GFF);
+    EXPECT_EQ(h.key_type, gio::gg_key_type::INTERVAL);
+}
+
 TEST(GgHeader, readPositionsStreamAfterHeader) {
     std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
     gio::gg_header::current(gio::gg_payload_type::BED).write(ss);
@@ -140,6 +164,22 @@ TEST(GgHeader, rejectsUnknownPayloadType) {
     EXPECT_THROW((void)gio::gg_header::read(ss), std::runtime_error);
 }
 
+TEST(GgHeader, rejectsUnknownKeyType) {
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    const char bytes[12] = {
+        'G','R','O','V',
+        static_cast<char>(gio::gg_header::CURRENT_FORMAT_MAJOR),
+        static_cast<char>(gio::gg_header::CURRENT_FORMAT_MINOR),
+        0, 0, 0,
+        static_cast<char>(gio::gg_payload_type::BED),
+        static_cast<char>(0x7F),                           // unknown key type
+        0,
+    };
+    ss.write(bytes, sizeof(bytes));
+
+    EXPECT_THROW((void)gio::gg_header::read(ss), std::runtime_error);
+}
+
 // ==========================================
 // Library-version mismatch is informational, not a hard error
 // ==========================================
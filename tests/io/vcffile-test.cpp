@@ -70,6 +70,18 @@ TEST_F(VcfReaderTest, HeaderSamplesAndContigs) {
     EXPECT_FALSE(reader.get_header().empty());
 }
 
+TEST_F(VcfReaderTest, ContigIdsIndexHeaderContigs) {
+    gio::vcf_reader reader(vcf_path);
+
+    size_t records = 0;
+    for (const auto& entry : reader) {
+        ASSERT_GE(entry.contig_id, 0);
+        EXPECT_EQ(reader.get_contigs().at(entry.contig_id), entry.chrom);
+        ++records;
+    }
+    EXPECT_EQ(records, 3u);
+}
+
 // ==========================================
 // Basic reading / coordinates
 // ==========================================
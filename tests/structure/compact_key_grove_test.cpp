@@ -0,0 +1,179 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Test base
+#include "key_type_grove_test.hpp"
+
+// genogrove
+#include <genogrove/data_type/genomic_coordinate32.hpp>
+#include <genogrove/data_type/interval32.hpp>
+#include <genogrove/structure/grove/grove.hpp>
+#include <genogrove/structure/grove/grove_view.hpp>
+
+// standard
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace gst = genogrove::structure;
+namespace gdt = genogrove::data_type;
+namespace fs = std::filesystem;
+
+// =============================================================================
+// Traits Specializations for the 32-bit keys (define ONCE)
+// =============================================================================
+
+template<>
+struct grove_test_traits<gdt::interval32, int> {
+    static std::vector<std::pair<gdt::interval32, int>> generate_test_data(size_t count) {
+        std::vector<std::pair<gdt::interval32, int>> data;
+        for (size_t i = 0; i < count; ++i) {
+            size_t start = i * 100;
+            data.push_back({{start, start + 50}, static_cast<int>(i)});
+        }
+        return data;
+    }
+
+    static query_overlap_expectation<gdt::interval32>
+    create_overlapping_query(const std::vector<std::pair<gdt::interval32, int>>& test_data) {
+        if (test_data.size() < 2) {
+            return {gdt::interval32{test_data[0].first.get_start() + 10,
+                                    test_data[0].first.get_end() - 10}, {0}};
+        }
+        size_t end_idx = std::min(size_t(3), test_data.size() - 1);
+        gdt::interval32 query{test_data[1].first.get_start() + 20,
+                              test_data[end_idx].first.get_start() + 20};
+        std::vector<size_t> expected_indices;
+        for (size_t i = 0; i < test_data.size(); ++i) {
+            if (gdt::interval32::overlaps(test_data[i].first, query)) {
+                expected_indices.push_back(i);
+            }
+        }
+        return {query, expected_indices};
+    }
+
+    static query_overlap_expectation<gdt::interval32>
+    create_non_overlapping_query(const std::vector<std::pair<gdt::interval32, int>>& test_data) {
+        if (test_data.empty()) {
+            return {gdt::interval32{0, 10}, {}};
+        }
+        size_t start = test_data[0].first.get_end() + 10;
+        size_t end = test_data.size() > 1 ? test_data[1].first.get_start() - 10 : start + 20;
+        return {gdt::interval32{start, end}, {}};
+    }
+};
+
+template<>
+struct grove_test_traits<gdt::genomic_coordinate32, int> {
+    static std::vector<std::pair<gdt::genomic_coordinate32, int>> generate_test_data(size_t count) {
+        std::vector<std::pair<gdt::genomic_coordinate32, int>> data;
+        for (size_t i = 0; i < count; ++i) {
+            size_t start = i * 100;
+            data.push_back({{'+', start, start + 50}, static_cast<int>(i)});
+        }
+        return data;
+    }
+
+    static query_overlap_expectation<gdt::genomic_coordinate32>
+    create_overlapping_query(const std::vector<std::pair<gdt::genomic_coordinate32, int>>& test_data) {
+        if (test_data.size() < 2) {
+            return {gdt::genomic_coordinate32{'+', test_data[0].first.get_start() + 10,
+                                              test_data[0].first.get_end() + 10}, {0}};
+        }
+        size_t end = test_data.size() > 2 ? test_data[2].first.get_end() - 10
+                                          : test_data[1].first.get_end() + 10;
+        gdt::genomic_coordinate32 query{'+', test_data[1].first.get_start() + 10, end};
+        std::vector<size_t> expected_indices;
+        for (size_t i = 0; i < test_data.size(); ++i) {
+            if (gdt::genomic_coordinate32::overlaps(test_data[i].first, query)) {
+                expected_indices.push_back(i);
+            }
+        }
+        return {query, expected_indices};
+    }
+
+    static query_overlap_expectation<gdt::genomic_coordinate32>
+    create_non_overlapping_query(const std::vector<std::pair<gdt::genomic_coordinate32, int>>& test_data) {
+        if (test_data.empty()) {
+            return {gdt::genomic_coordinate32{'+', 0, 10}, {}};
+        }
+        size_t start = test_data[0].first.get_end() + 10;
+        size_t end = test_data.size() > 1 ? test_data[1].first.get_start() - 10 : start + 20;
+        return {gdt::genomic_coordinate32{'+', start, end}, {}};
+    }
+};
+
+// =============================================================================
+// Instantiate Typed Tests for the 32-bit keys
+// =============================================================================
+
+using Interval32TestTypes = ::testing::Types<gdt::interval32>;
+INSTANTIATE_TYPED_TEST_SUITE_P(Interval32, grove_typed_test, Interval32TestTypes);
+
+using GenomicCoordinate32TestTypes = ::testing::Types<gdt::genomic_coordinate32>;
+INSTANTIATE_TYPED_TEST_SUITE_P(GenomicCoordinate32, grove_typed_test, GenomicCoordinate32TestTypes);
+
+// =============================================================================
+// Compact-key specific tests
+// =============================================================================
+
+// Strand filtering survives the packing of the strand into the position words,
+// including for keys near the top of the 31-bit position range.
+TEST(CompactKeyGroveTest, strandedQueriesNearPositionLimit) {
+    constexpr size_t top = gdt::genomic_coordinate32::max_position;
+    gst::grove<gdt::genomic_coordinate32, int> grove(3);
+    grove.insert_data("chr1", gdt::genomic_coordinate32{'+', top - 100, top - 50}, 1);
+    grove.insert_data("chr1", gdt::genomic_coordinate32{'-', top - 80, top - 40}, 2);
+    grove.insert_data("chr1", gdt::genomic_coordinate32{'.', top - 60, top}, 3);
+    grove.insert_data("chr1", gdt::genomic_coordinate32{'+', 10, 20}, 4);
+
+    auto plus = grove.intersect(gdt::genomic_coordinate32{'+', top - 70, top}, "chr1");
+    ASSERT_EQ(plus.get_keys().size(), 1u);
+    EXPECT_EQ(plus.get_keys()[0]->get_data(), 1);
+
+    auto any = grove.intersect(gdt::genomic_coordinate32{'*', top - 70, top}, "chr1");
+    EXPECT_EQ(any.get_keys().size(), 3u);
+}
+
+// Serialized compact groves round-trip eagerly and read back identically in place.
+TEST(CompactKeyGroveTest, serializedGroveMatchesInPlaceView) {
+    using grove_t = gst::grove<gdt::interval32, int>;
+    const fs::path path = fs::temp_directory_path() / "genogrove_compact_key_view.gg";
+    {
+        grove_t g(4);
+        for (size_t i = 0; i < 80; ++i) {
+            g.insert_data("chr1", gdt::interval32{4000000000u + i * 10, 4000000000u + i * 10 + 5},
+                          static_cast<int>(i), gst::sorted);
+        }
+        std::ofstream ofs(path, std::ios::binary);
+        g.serialize(ofs);
+    }
+
+    grove_t eager = [&] {
+        std::ifstream ifs(path, std::ios::binary);
+        return grove_t::deserialize(ifs);
+    }();
+    auto view = gst::grove_view<gdt::interval32, int>::open(path.string());
+
+    for (const gdt::interval32 q : {gdt::interval32{4000000000u, 4000000005u},
+                                    gdt::interval32{4000000095u, 4000000130u},
+                                    gdt::interval32{0, 100}}) {
+        auto eager_hits = eager.intersect(q, "chr1");
+        auto view_hits = view.intersect(q, "chr1");
+        std::vector<int> e, v;
+        for (auto* k : eager_hits.get_keys()) e.push_back(k->get_data());
+        for (auto* k : view_hits.get_keys()) v.push_back(k->get_data());
+        std::sort(e.begin(), e.end());
+        std::sort(v.begin(), v.end());
+        EXPECT_EQ(e, v);
+    }
+    EXPECT_EQ(eager.intersect(gdt::interval32{4000000095u, 4000000130u}, "chr1").get_keys().size(), 5u);
+
+    fs::remove(path);
+}
@@ -0,0 +1,158 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <genogrove/data_type/kmer.hpp>
+#include <genogrove/data_type/numeric.hpp>
+#include <genogrove/structure/grove/flat_index.hpp>
+#include <genogrove/structure/grove/grove.hpp>
+
+namespace gst = genogrove::structure;
+namespace gdt = genogrove::data_type;
+
+namespace {
+
+// A kmer grove over random 12-mers, with the set of encodings it holds.
+std::set<uint64_t> fill_kmer_grove(gst::grove<gdt::kmer, int>& grove, std::size_t count) {
+    std::mt19937_64 rng(7);
+    std::set<uint64_t> present;
+    while (present.size() < count) {
+        present.insert(rng() & ((uint64_t{1} << 24) - 1));
+    }
+    for (auto e : present) {
+        grove.insert_data("genome", gdt::kmer(e, 12), static_cast<int>(e % 1000), gst::sorted);
+    }
+    return present;
+}
+
+}  // namespace
+
+TEST(FlatIndexTest, LookupsMatchTheGrove) {
+    gst::grove<gdt::kmer, int> grove(8);
+    const auto present = fill_kmer_grove(grove, 3000);
+    const auto flat = gst::flat_index<gdt::kmer, int>::from_grove(grove);
+
+    EXPECT_EQ(flat.size(), present.size());
+    EXPECT_EQ(flat.size("genome"), present.size());
+    EXPECT_EQ(flat.index_count(), 1u);
+
+    std::mt19937_64 rng(11);
+    for (int i = 0; i < 5000; ++i) {
+        const uint64_t e = rng() & ((uint64_t{1} << 24) - 1);
+        const gdt::kmer probe(e, 12);
+        const bool expected = present.contains(e);
+        EXPECT_EQ(flat.contains("genome", probe), expected) << e;
+        const int* payload = flat.find("genome", probe);
+        ASSERT_EQ(payload != nullptr, expected);
+        if (expected) {
+            EXPECT_EQ(*payload, static_cast<int>(e % 1000));
+        }
+    }
+    for (auto e : present) {
+        ASSERT_TRUE(flat.contains("genome", gdt::kmer(e, 12))) << e;
+    }
+
+    // Wrong k, unknown index: no match.
+    EXPECT_FALSE(flat.contains("genome", gdt::kmer(*present.begin(), 11)));
+    EXPECT_FALSE(flat.contains("chr1", gdt::kmer(*present.begin(), 12)));
+    EXPECT_EQ(flat.find("chr1", gdt::kmer(*present.begin(), 12)), nullptr);
+
+    // keys() restores ascending order.
+    const auto keys = flat.keys("genome");
+    ASSERT_EQ(keys.size(), present.size());
+    auto it = present.begin();
+    for (const auto& k : keys) {
+        EXPECT_EQ(k, gdt::kmer(*it++, 12));
+    }
+}
+
+TEST(FlatIndexTest, BatchedLookupsMatchSingleLookups) {
+    gst::grove<gdt::kmer, int> grove(8);
+    const auto present = fill_kmer_grove(grove, 2000);
+    const auto flat = gst::flat_index<gdt::kmer, int>::from_grove(grove);
+
+    std::mt19937_64 rng(13);
+    std::vector<gdt::kmer> probes;
+    for (int i = 0; i < 1003; ++i) {  // not a multiple of the batch width
+        probes.emplace_back(rng() & ((uint64_t{1} << 24) - 1), 12);
+        if (i % 3 == 0) probes.emplace_back(*std::next(present.begin(), i % present.size()), 12);
+    }
+    probes.emplace_back(*present.begin(), 11);  // wrong k
+
+    const auto flags = flat.contains("genome", std::span<const gdt::kmer>(probes));
+    const auto payloads = flat.find("genome", std::span<const gdt::kmer>(probes));
+    ASSERT_EQ(flags.size(), probes.size());
+    ASSERT_EQ(payloads.size(), probes.size());
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+        EXPECT_EQ(flags[i] != 0, flat.contains("genome", probes[i])) << i;
+        EXPECT_EQ(payloads[i], flat.find("genome", probes[i])) << i;
+    }
+    EXPECT_EQ(flags.back(), 0);
+
+    const auto none = flat.contains("chr1", std::span<const gdt::kmer>(probes));
+    EXPECT_EQ(std::count(none.begin(), none.end(), 1), 0);
+}
+
+TEST(FlatIndexTest, NumericKeysWithNegativesAndDuplicates) {
+    gst::grove<gdt::numeric> grove(4);
+    for (int v : {-50, -3, 0, 7, 7, 7, 1000, 2147483647, -2147483647 - 1}) {
+        grove.insert("n", gdt::key<gdt::numeric>(gdt::numeric(v)));
+    }
+    const auto flat = gst::flat_index<gdt::numeric>::from_grove(grove);
+    EXPECT_EQ(flat.size("n"), 9u);
+    for (int v : {-50, -3, 0, 7, 1000, 2147483647, -2147483647 - 1}) {
+        EXPECT_TRUE(flat.contains("n", gdt::numeric(v))) << v;
+    }
+    for (int v : {-51, -4, 1, 6, 8, 999}) {
+        EXPECT_FALSE(flat.contains("n", gdt::numeric(v))) << v;
+    }
+    const auto keys = flat.keys("n");
+    ASSERT_EQ(keys.size(), 9u);
+    EXPECT_EQ(keys.front().get_value(), -2147483647 - 1);
+    EXPECT_EQ(keys.back().get_value(), 2147483647);
+}
+
+TEST(FlatIndexTest, SerializationRoundTrip) {
+    gst::grove<gdt::kmer, int> grove(8);
+    const auto present = fill_kmer_grove(grove, 500);
+    grove.insert_data("empty_k", gdt::kmer("ACGT"), 4);
+    const auto flat = gst::flat_index<gdt::kmer, int>::from_grove(grove);
+
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    flat.serialize(ss);
+    const auto restored = gst::flat_index<gdt::kmer, int>::deserialize(ss);
+
+    EXPECT_EQ(restored.index_count(), 2u);
+    EXPECT_EQ(restored.size(), flat.size());
+    for (auto e : present) {
+        const int* payload = restored.find("genome", gdt::kmer(e, 12));
+        ASSERT_NE(payload, nullptr);
+        EXPECT_EQ(*payload, static_cast<int>(e % 1000));
+    }
+    ASSERT_NE(restored.find("empty_k", gdt::kmer("ACGT")), nullptr);
+    EXPECT_EQ(*restored.find("empty_k", gdt::kmer("ACGT")), 4);
+}
+
+TEST(FlatIndexTest, RejectsMixedShapesAndForeignStreams) {
+    gst::grove<gdt::kmer, int> grove(4);
+    grove.insert_data("mixed", gdt::kmer("ACG"), 1);
+    grove.insert_data("mixed", gdt::kmer("ACGT"), 2);
+    EXPECT_THROW((void)(gst::flat_index<gdt::kmer, int>::from_grove(grove)), std::invalid_argument);
+
+    std::stringstream garbage("GGB\x08 not a flat index");
+    EXPECT_THROW((void)(gst::flat_index<gdt::kmer, int>::deserialize(garbage)), std::runtime_error);
+}
@@ -12,7 +12,18 @@
 #include <genogrove/structure/grove/graph_overlay.hpp>
 
 // standard
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <sstream>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace gst = genogrove::structure;
 namespace gdt = genogrove::data_type;
@@ -970,6 +981,865 @@ TEST(GraphOverlayTest, VertexCountWithEdgesCountsSourcesOnly) {
     EXPECT_EQ(grove.graph().in_degree(k2), 1);
 }
 
+// =============================================================================
+// Frozen (CSR) Graph Tests
+// =============================================================================
+
+namespace {
+
+using frozen_grove_t = gst::grove<gdt::interval, int, int>;
+using frozen_key_t = gdt::key<gdt::interval, int>;
+
+// Every per-key read accessor's result, in order, for comparing the list and
+// CSR representations.
+struct graph_snapshot {
+    std::vector<std::vector<frozen_key_t*>> out, in, out_if, in_if;
+    std::vector<std::vector<int>> out_meta, in_meta, edge_list_meta, in_edge_list_meta;
+    std::vector<std::size_t> out_deg, in_deg;
+    std::size_t edges = 0, sources = 0;
+
+    bool operator==(const graph_snapshot&) const = default;
+};
+
+graph_snapshot snapshot(const frozen_grove_t& g, const std::vector<frozen_key_t*>& keys) {
+    graph_snapshot s;
+    auto even = [](int m) { return m % 2 == 0; };
+    for (auto* k : keys) {
+        s.out.push_back(g.get_neighbors(k));
+        s.in.push_back(g.get_in_neighbors(k));
+        s.out_if.push_back(g.get_neighbors_if(k, even));
+        s.in_if.push_back(g.get_in_neighbors_if(k, even));
+        s.out_meta.push_back(g.get_edges(k));
+        s.in_meta.push_back(g.get_in_edges(k));
+        std::vector<int> meta;
+        for (const auto& e : g.get_edge_list(k)) {
+            EXPECT_EQ(e.source, k);
+            meta.push_back(e.metadata);
+        }
+        s.edge_list_meta.push_back(meta);
+        meta.clear();
+        for (const auto& e : g.get_in_edge_list(k)) {
+            EXPECT_EQ(e.target, k);
+            meta.push_back(e.metadata);
+        }
+        s.in_edge_list_meta.push_back(meta);
+        s.out_deg.push_back(g.out_degree(k));
+        s.in_deg.push_back(g.in_degree(k));
+    }
+    s.edges = g.edge_count();
+    s.sources = g.vertex_count_with_edges();
+    return s;
+}
+
+// Pseudo-random wiring over `keys`, in insertion order, that includes
+// self-loops, parallel edges and edge-less keys.
+std::vector<std::tuple<frozen_key_t*, frozen_key_t*, int>> frozen_test_edges(
+    const std::vector<frozen_key_t*>& keys) {
+    std::vector<std::tuple<frozen_key_t*, frozen_key_t*, int>> edges;
+    for (std::size_t i = 0; i < 150; ++i) {
+        const std::size_t src = (i * 37 + 3) % 55;
+        const std::size_t tgt = (i * 11 + 7) % keys.size();
+        edges.emplace_back(keys[src], keys[tgt], static_cast<int>(i));
+        if (i % 13 == 0) {
+            edges.emplace_back(keys[tgt], keys[tgt], -static_cast<int>(i));  // self-loop
+            edges.emplace_back(keys[src], keys[tgt], static_cast<int>(i) + 1000);  // parallel
+        }
+    }
+    return edges;
+}
+
+// Sorted keys plus a couple of external keys, wired by frozen_test_edges.
+std::vector<frozen_key_t*> build_frozen_test_grove(frozen_grove_t& g) {
+    std::vector<frozen_key_t*> keys;
+    for (std::size_t i = 0; i < 60; ++i) {
+        keys.push_back(g.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5},
+                                     static_cast<int>(i), gst::sorted));
+    }
+    keys.push_back(g.add_external_key(gdt::interval{5000, 5001}, -1));
+    keys.push_back(g.add_external_key(gdt::interval{6000, 6001}, -2));
+    for (const auto& [source, target, metadata] : frozen_test_edges(keys)) {
+        g.add_edge(source, target, metadata);
+    }
+    return keys;
+}
+
+} // namespace
+
+TEST(FrozenGraphTest, FreezeKeepsEveryAccessorResult) {
+    frozen_grove_t g(4);
+    const auto keys = build_frozen_test_grove(g);
+    const auto before = snapshot(g, keys);
+
+    EXPECT_FALSE(g.graph_frozen());
+    g.freeze_graph();
+    EXPECT_TRUE(g.graph_frozen());
+    EXPECT_TRUE(snapshot(g, keys) == before);
+    EXPECT_TRUE(g.has_edge(keys[3], keys[7]));
+    EXPECT_FALSE(g.has_edge(keys[7], keys[3]));
+    EXPECT_FALSE(g.graph_empty());
+
+    g.freeze_graph();  // no-op when already frozen
+    g.thaw_graph();
+    EXPECT_FALSE(g.graph_frozen());
+    EXPECT_TRUE(snapshot(g, keys) == before);
+}
+
+TEST(FrozenGraphTest, FrozenLookupHandlesCollidingAndMissingKeyIds) {
+    // Frozen lookups go through each key's grove id. Keys of two groves share
+    // ids, and a standalone key has none; both must still resolve correctly.
+    frozen_grove_t a(4);
+    frozen_grove_t b(4);
+    std::vector<frozen_key_t*> keys;
+    for (std::size_t i = 0; i < 20; ++i) {
+        keys.push_back(a.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5}, static_cast<int>(i), gst::sorted));
+        keys.push_back(b.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5}, 100 + static_cast<int>(i), gst::sorted));
+    }
+    ASSERT_EQ(keys[0]->get_id(), keys[1]->get_id());
+    frozen_key_t standalone(gdt::interval{999, 1000}, -1);
+    keys.push_back(&standalone);
+    frozen_key_t unrelated(gdt::interval{5, 6}, -2);
+
+    gst::graph_overlay<gdt::interval, int, int> graph;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        graph.add_edge(keys[i], keys[(i * 7 + 3) % keys.size()], static_cast<int>(i));
+    }
+    std::vector<std::vector<frozen_key_t*>> out, in;
+    for (auto* k : keys) {
+        out.push_back(graph.get_neighbors(k));
+        in.push_back(graph.get_in_neighbors(k));
+    }
+
+    graph.freeze();
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(graph.get_neighbors(keys[i]), out[i]) << "key " << i;
+        EXPECT_EQ(graph.get_in_neighbors(keys[i]), in[i]) << "key " << i;
+    }
+    EXPECT_EQ(graph.out_degree(&unrelated), 0u);
+    EXPECT_TRUE(graph.get_neighbors(&unrelated).empty());
+}
+
+TEST(FrozenGraphTest, NullKeyQueriesMatchThawedGraph) {
+    frozen_grove_t g(4);
+    const auto keys = build_frozen_test_grove(g);
+    const frozen_key_t* none = nullptr;
+
+    auto expect_no_edges = [&] {
+        EXPECT_FALSE(g.has_edge(none, keys[0]));
+        EXPECT_FALSE(g.has_edge(keys[0], none));
+        EXPECT_EQ(g.out_degree(none), 0u);
+        EXPECT_EQ(g.in_degree(none), 0u);
+        EXPECT_TRUE(g.get_edges(none).empty());
+        EXPECT_TRUE(g.get_in_edges(none).empty());
+    };
+    expect_no_edges();
+    g.freeze_graph();
+    ASSERT_TRUE(g.graph_frozen());
+    expect_no_edges();
+}
+
+TEST(FrozenGraphTest, MutationThawsAndRefreezeMatches) {
+    frozen_grove_t g(4);
+    const auto keys = build_frozen_test_grove(g);
+    frozen_grove_t reference(4);
+    const auto ref_keys = build_frozen_test_grove(reference);
+
+    g.freeze_graph();
+    g.add_edge(keys[0], keys[1], 4242);
+    EXPECT_FALSE(g.graph_frozen());
+    reference.add_edge(ref_keys[0], ref_keys[1], 4242);
+
+    g.freeze_graph();
+    EXPECT_EQ(g.remove_edges_from(keys[3]), reference.remove_edges_from(ref_keys[3]));
+    EXPECT_FALSE(g.graph_frozen());
+
+    g.freeze_graph();
+    reference.freeze_graph();
+    const auto got = snapshot(g, keys);
+    const auto want = snapshot(reference, ref_keys);
+    // Same wiring on distinct key objects: compare shapes, not pointers.
+    EXPECT_EQ(got.out_meta, want.out_meta);
+    EXPECT_EQ(got.in_meta, want.in_meta);
+    EXPECT_EQ(got.in_edge_list_meta, want.in_edge_list_meta);
+    EXPECT_EQ(got.out_deg, want.out_deg);
+    EXPECT_EQ(got.in_deg, want.in_deg);
+    EXPECT_EQ(got.edges, want.edges);
+
+    g.clear_graph();
+    EXPECT_FALSE(g.graph_frozen());
+    EXPECT_TRUE(g.graph_empty());
+}
+
+TEST(FrozenGraphTest, CompactRemapsFrozenGraphInPlace) {
+    frozen_grove_t g(4);
+    auto keys = build_frozen_test_grove(g);
+    const std::vector<frozen_key_t*> external = {keys[60], keys[61]};
+    ASSERT_TRUE(g.remove_key("chr1", keys[58]));
+    ASSERT_TRUE(g.remove_key("chr1", keys[59]));
+
+    g.freeze_graph();
+    g.compact();
+    EXPECT_TRUE(g.graph_frozen());
+
+    // Rediscover the migrated indexed keys; external ones keep their address.
+    keys = g.intersect(gdt::interval{0, 600}, "chr1").get_keys();
+    ASSERT_EQ(keys.size(), 58u);
+    std::vector<frozen_key_t*> live = keys;
+    live.insert(live.end(), external.begin(), external.end());
+    for (auto* k : live) {
+        for (auto* n : g.get_neighbors(k)) {
+            EXPECT_NE(std::find(live.begin(), live.end(), n), live.end());
+        }
+        for (auto* n : g.get_in_neighbors(k)) {
+            EXPECT_NE(std::find(live.begin(), live.end(), n), live.end());
+        }
+    }
+    const auto frozen = snapshot(g, live);
+    g.thaw_graph();
+    EXPECT_TRUE(snapshot(g, live) == frozen);
+}
+
+TEST(FrozenGraphTest, BulkAddEdgesMatchesOneByOne) {
+    frozen_grove_t g(4);
+    const auto keys = build_frozen_test_grove(g);
+    const auto want = snapshot(g, keys);
+    const auto edges = frozen_test_edges(keys);
+
+    // List layout, into an empty and into a non-empty graph.
+    g.clear_graph();
+    EXPECT_EQ(g.add_edges(edges), edges.size());
+    EXPECT_FALSE(g.graph_frozen());
+    EXPECT_TRUE(snapshot(g, keys) == want);
+    g.clear_graph();
+    const std::span<const std::tuple<frozen_key_t*, frozen_key_t*, int>> all(edges);
+    g.add_edges(all.first(40));
+    g.add_edges(all.subspan(40));
+    EXPECT_TRUE(snapshot(g, keys) == want);
+
+    // Frozen layout built straight into CSR form must equal freeze().
+    g.freeze_graph();
+    const auto frozen_want = snapshot(g, keys);
+    const auto hops_want = g.k_hop(keys[3], 3);
+    g.clear_graph();
+    EXPECT_EQ(g.add_edges(edges, gst::edge_layout::frozen), edges.size());
+    EXPECT_TRUE(g.graph_frozen());
+    EXPECT_TRUE(snapshot(g, keys) == frozen_want);
+    EXPECT_EQ(g.k_hop(keys[3], 3), hops_want);
+    g.thaw_graph();
+    EXPECT_TRUE(snapshot(g, keys) == want);
+
+    // Frozen layout onto existing edges appends, then freezes.
+    g.clear_graph();
+    g.add_edges(all.first(40));
+    g.add_edges(all.subspan(40), gst::edge_layout::frozen);
+    EXPECT_TRUE(g.graph_frozen());
+    EXPECT_TRUE(snapshot(g, keys) == frozen_want);
+}
+
+TEST(FrozenGraphTest, BulkAddEdgesRejectsNullBeforeAdding) {
+    frozen_grove_t g(4);
+    auto* a = g.insert_data("chr1", gdt::interval{0, 5}, 0, gst::sorted);
+    auto* b = g.insert_data("chr1", gdt::interval{10, 15}, 1, gst::sorted);
+    const std::vector<std::pair<frozen_key_t*, frozen_key_t*>> edges = {{a, b}, {b, nullptr}};
+    EXPECT_THROW(g.add_edges(edges), std::invalid_argument);
+    EXPECT_THROW(g.add_edges(edges, gst::edge_layout::frozen), std::invalid_argument);
+    EXPECT_TRUE(g.graph_empty());
+    EXPECT_FALSE(g.graph_frozen());
+
+    // Two-element tuples get default metadata, as add_edge(source, target) does.
+    EXPECT_EQ(g.add_edges(std::span(edges).first(1), gst::edge_layout::frozen), 1u);
+    EXPECT_EQ(g.get_edges(a), std::vector<int>{0});
+    EXPECT_EQ(g.add_edges(std::vector<std::pair<frozen_key_t*, frozen_key_t*>>{}), 0u);
+}
+
+TEST(FrozenGraphTest, CachedDegreesTrackEveryMutation) {
+    frozen_grove_t g(4);
+    const auto keys = build_frozen_test_grove(g);
+
+    // Degrees and the source count against a brute-force scan of the edges.
+    auto check = [&](const char* step) {
+        SCOPED_TRACE(step);
+        std::size_t sources = 0;
+        std::size_t total = 0;
+        for (auto* k : keys) {
+            std::size_t in = 0;
+            for (auto* other : keys) {
+                for (auto* t : g.get_neighbors(other)) in += (t == k);
+            }
+            EXPECT_EQ(g.out_degree(k), g.get_neighbors(k).size());
+            EXPECT_EQ(g.in_degree(k), in);
+            sources += g.out_degree(k) != 0;
+            total += g.out_degree(k);
+        }
+        EXPECT_EQ(g.vertex_count_with_edges(), sources);
+        EXPECT_EQ(g.edge_count(), total);
+    };
+    check("built");
+
+    // A hub with self-loops and parallel edges in both directions.
+    auto* hub = keys[10];
+    for (std::size_t i = 0; i < 40; ++i) {
+        g.add_edge(hub, keys[i % keys.size()], 7000 + static_cast<int>(i));
+        g.add_edge(keys[(i * 7) % keys.size()], hub, 8000 + static_cast<int>(i));
+    }
+    check("hub added");
+    g.freeze_graph();
+    check("frozen");
+    const auto frozen = snapshot(g, keys);
+    EXPECT_EQ(g.remove_edges_to(hub), frozen.in_deg[10]);
+    EXPECT_EQ(g.in_degree(hub), 0u);
+    check("hub incoming removed");
+    const std::size_t hub_out = g.out_degree(hub);
+    EXPECT_EQ(g.remove_edges_from(hub), hub_out);
+    EXPECT_EQ(g.out_degree(hub), 0u);
+    check("hub outgoing removed");
+    EXPECT_GT(g.remove_edges_if([](const auto& e) { return e.metadata % 3 == 0; }), 0u);
+    check("filtered");
+    EXPECT_TRUE(g.remove_edge(keys[3], g.get_neighbors(keys[3]).front()));
+    check("single removed");
+    g.freeze_graph();
+    g.thaw_graph();
+    check("thawed");
+    g.clear_graph();
+    check("cleared");
+}
+
+TEST(FrozenGraphTest, FrozenGraphSerializesIdentically) {
+    frozen_grove_t g(4);
+    build_frozen_test_grove(g);
+    std::ostringstream plain(std::ios::binary);
+    g.serialize(plain);
+
+    g.freeze_graph();
+    std::ostringstream frozen(std::ios::binary);
+    g.serialize(frozen);
+    EXPECT_TRUE(frozen.str() == plain.str());
+    EXPECT_TRUE(g.graph_frozen());
+}
+
+TEST(FrozenGraphTest, VoidMetadataGraphFreezes) {
+    gst::grove<gdt::interval, std::string> g(3);
+    auto* a = g.insert_data("chr1", gdt::interval{10, 20}, "a", gst::sorted);
+    auto* b = g.insert_data("chr1", gdt::interval{30, 40}, "b", gst::sorted);
+    auto* c = g.insert_data("chr1", gdt::interval{50, 60}, "c", gst::sorted);
+    g.add_edge(a, b);
+    g.add_edge(a, c);
+    g.add_edge(c, c);
+
+    g.freeze_graph();
+    EXPECT_EQ(g.get_neighbors(a), (std::vector<gdt::key<gdt::interval, std::string>*>{b, c}));
+    EXPECT_EQ(g.get_in_neighbors(c), (std::vector<gdt::key<gdt::interval, std::string>*>{a, c}));
+    EXPECT_EQ(g.get_edge_list(c).size(), 1u);
+    EXPECT_EQ(g.in_degree(b), 1u);
+    EXPECT_EQ(g.out_degree(b), 0u);
+    EXPECT_EQ(g.edge_count(), 3u);
+    EXPECT_EQ(g.vertex_count_with_edges(), 2u);
+    EXPECT_TRUE(g.remove_edge(a, b));
+    EXPECT_FALSE(g.graph_frozen());
+    EXPECT_EQ(g.edge_count(), 2u);
+}
+
+// =============================================================================
+// Lazy Adjacency View Tests
+// =============================================================================
+
+TEST(AdjacencyViewTest, ViewsMatchAccessorsListAndFrozen) {
+    frozen_grove_t g(4);
+    const auto keys = build_frozen_test_grove(g);
+    static_assert(std::ranges::forward_range<decltype(g.neighbors_view(keys[0]))>);
+    static_assert(std::ranges::view<decltype(g.graph().out_edges_view(keys[0]))>);
+
+    auto even = [](int m) { return m % 2 == 0; };
+    auto check = [&](const char* mode) {
+        for (auto* k : keys) {
+            std::vector<frozen_key_t*> out, in, out_if, in_if;
+            std::ranges::copy(g.neighbors_view(k), std::back_inserter(out));
+            std::ranges::copy(g.in_neighbors_view(k), std::back_inserter(in));
+            std::ranges::copy(g.neighbors_if_view(k, even), std::back_inserter(out_if));
+            std::ranges::copy(g.in_neighbors_if_view(k, even), std::back_inserter(in_if));
+            EXPECT_EQ(out, g.get_neighbors(k)) << mode;
+            EXPECT_EQ(in, g.get_in_neighbors(k)) << mode;
+            EXPECT_EQ(out_if, g.get_neighbors_if(k, even)) << mode;
+            EXPECT_EQ(in_if, g.get_in_neighbors_if(k, even)) << mode;
+
+            std::vector<int> out_meta, in_meta;
+            for (const auto& [target, metadata] : g.out_edges_view(k)) {
+                EXPECT_TRUE(g.has_edge(k, target));
+                out_meta.push_back(metadata);
+            }
+            for (const auto& e : g.in_edges_view(k)) {
+                EXPECT_TRUE(g.has_edge(e.key, k));
+                in_meta.push_back(e.metadata);
+            }
+            EXPECT_EQ(out_meta, g.get_edges(k)) << mode;
+            EXPECT_EQ(in_meta, g.get_in_edges(k)) << mode;
+        }
+    };
+    check("list");
+    g.freeze_graph();
+    check("frozen");
+
+    // A key with no edges yields an empty view in either mode.
+    auto* lonely = g.insert_data("chr2", gdt::interval{1, 2}, 0, gst::sorted);
+    EXPECT_TRUE(g.neighbors_view(lonely).empty());
+    g.freeze_graph();
+    EXPECT_TRUE(g.in_edges_view(lonely).empty());
+    EXPECT_THROW((void)g.neighbors_view(nullptr), std::invalid_argument);
+    EXPECT_THROW((void)g.in_edges_view(nullptr), std::invalid_argument);
+}
+
+TEST(AdjacencyViewTest, VoidMetadataViewsSkipOtherDirection) {
+    gst::grove<gdt::interval, std::string> g(3);
+    auto* a = g.insert_data("chr1", gdt::interval{10, 20}, "a", gst::sorted);
+    auto* b = g.insert_data("chr1", gdt::interval{30, 40}, "b", gst::sorted);
+    auto* c = g.insert_data("chr1", gdt::interval{50, 60}, "c", gst::sorted);
+    // b's incidence bucket interleaves incoming and outgoing edges.
+    g.add_edge(a, b);
+    g.add_edge(b, c);
+    g.add_edge(c, b);
+    g.add_edge(b, b);
+
+    using key_ptr = gdt::key<gdt::interval, std::string>*;
+    auto collect = [](auto&& view) {
+        std::vector<key_ptr> v;
+        for (auto* k : view) v.push_back(k);
+        return v;
+    };
+    EXPECT_EQ(collect(g.neighbors_view(b)), (std::vector<key_ptr>{c, b}));
+    EXPECT_EQ(collect(g.in_neighbors_view(b)), (std::vector<key_ptr>{a, c, b}));
+    g.freeze_graph();
+    EXPECT_EQ(collect(g.neighbors_view(b)), (std::vector<key_ptr>{c, b}));
+    EXPECT_EQ(collect(g.in_neighbors_view(b)), (std::vector<key_ptr>{a, c, b}));
+}
+
+// =============================================================================
+// Edge Metadata Column Tests
+// =============================================================================
+
+TEST(EdgeMetadataColumnTest, StringsAreInternedAndSlotsReused) {
+    gst::edge_metadata_column<std::string> column;
+    const auto a = column.add(std::string("ENST00000456328"));
+    const auto b = column.add(std::string("ENST00000450305"));
+    const auto c = column.add(std::string("ENST00000456328"));
+    EXPECT_EQ(column.get(a), "ENST00000456328");
+    EXPECT_EQ(column.get(b), "ENST00000450305");
+    // Equal names share one interned copy.
+    EXPECT_EQ(&column.get(a), &column.get(c));
+
+    column.release(b);
+    const auto d = column.add(std::string("ENST00000488147"));
+    EXPECT_EQ(d, b);
+    EXPECT_EQ(column.get(d), "ENST00000488147");
+
+    gst::edge_metadata_column<std::string> copy;
+    EXPECT_EQ(copy.get(copy.add_copy(column, c)), "ENST00000456328");
+
+    gst::edge_metadata_column<int> ints;
+    const auto x = ints.add(7);
+    ints.release(x);
+    EXPECT_EQ(ints.add(9), x);
+    EXPECT_EQ(ints.get(x), 9);
+}
+
+TEST(EdgeMetadataColumnTest, StringMetadataSurvivesMutationAndFreeze) {
+    gst::grove<gdt::interval, int, std::string> g(4);
+    std::vector<gdt::key<gdt::interval, int>*> k;
+    for (std::size_t i = 0; i < 6; ++i) {
+        k.push_back(g.insert_data("chr1", gdt::interval{i * 100, i * 100 + 50},
+                                  static_cast<int>(i), gst::sorted));
+    }
+    const std::vector<std::string> names = {"tx1", "tx2", "tx1", "tx3", "tx2"};
+    for (std::size_t i = 0; i + 1 < k.size(); ++i) {
+        g.add_edge(k[i], k[i + 1], names[i]);
+    }
+    g.add_edge(k[0], k[2], std::string("skip"));
+    // Freed slots are reused by later edges without disturbing the others.
+    EXPECT_TRUE(g.remove_edge(k[1], k[2]));
+    g.add_edge(k[1], k[3], std::string("tx4"));
+
+    auto is_tx1 = [](const std::string& m) { return m == "tx1"; };
+    auto check = [&](const char* mode) {
+        EXPECT_EQ(g.get_edges(k[0]), (std::vector<std::string>{"tx1", "skip"})) << mode;
+        EXPECT_EQ(g.get_edges(k[1]), (std::vector<std::string>{"tx4"})) << mode;
+        EXPECT_EQ(g.get_in_edges(k[3]), (std::vector<std::string>{"tx1", "tx4"})) << mode;
+        EXPECT_EQ(g.get_neighbors_if(k[0], is_tx1), (std::vector{k[1]})) << mode;
+        std::vector<std::string> listed;
+        for (const auto& e : g.get_edge_list(k[3])) listed.push_back(e.metadata);
+        EXPECT_EQ(listed, (std::vector<std::string>{"tx3"})) << mode;
+    };
+    check("list");
+    g.freeze_graph();
+    check("frozen");
+    g.add_edge(k[5], k[0], std::string("back"));
+    check("thawed");
+    EXPECT_EQ(g.get_in_edges(k[0]), (std::vector<std::string>{"back"}));
+}
+
+// =============================================================================
+// Traversal Tests
+// =============================================================================
+
+namespace {
+
+using splice_grove_t = gst::grove<gdt::interval, std::string>;
+using splice_key_t = gdt::key<gdt::interval, std::string>*;
+
+// A splice graph with two alternative middles and an alternative last exon:
+//
+//   e0 -> e1 -> e3 -> e4
+//    \--> e2 --/  \--> e5
+//          e1 -----------^
+std::vector<splice_key_t> build_splice_graph(splice_grove_t& g) {
+    std::vector<splice_key_t> e;
+    for (int i = 0; i < 6; ++i) {
+        const auto start = static_cast<size_t>(100 * i);
+        e.push_back(g.insert_data("chr1", gdt::interval{start, start + 50},
+                                  "e" + std::to_string(i), gst::sorted));
+    }
+    g.add_edge(e[0], e[1]);
+    g.add_edge(e[0], e[2]);
+    g.add_edge(e[1], e[3]);
+    g.add_edge(e[2], e[3]);
+    g.add_edge(e[3], e[4]);
+    g.add_edge(e[3], e[5]);
+    g.add_edge(e[1], e[5]);
+    return e;
+}
+
+std::vector<std::string> names(const std::vector<splice_key_t>& keys) {
+    std::vector<std::string> out;
+    for (auto* k : keys) out.push_back(k->get_data());
+    return out;
+}
+
+} // namespace
+
+TEST(TraversalTest, BfsAndDfsOrderAndDepths) {
+    splice_grove_t g(3);
+    const auto e = build_splice_graph(g);
+
+    for (bool frozen : {false, true}) {
+        if (frozen) g.freeze_graph();
+        std::vector<std::pair<std::string, size_t>> bfs, dfs;
+        g.bfs(e[0], [&](splice_key_t k, size_t d) { bfs.emplace_back(k->get_data(), d); });
+        g.dfs(e[0], [&](splice_key_t k, size_t d) { dfs.emplace_back(k->get_data(), d); });
+        EXPECT_EQ(bfs, (std::vector<std::pair<std::string, size_t>>{
+            {"e0", 0}, {"e1", 1}, {"e2", 1}, {"e3", 2}, {"e5", 2}, {"e4", 3}}));
+        EXPECT_EQ(dfs, (std::vector<std::pair<std::string, size_t>>{
+            {"e0", 0}, {"e1", 1}, {"e3", 2}, {"e4", 3}, {"e5", 3}, {"e2", 1}}));
+
+        EXPECT_EQ(names(g.k_hop(e[0], 1)), (std::vector<std::string>{"e1", "e2"}));
+        EXPECT_EQ(names(g.k_hop(e[0], 2)), (std::vector<std::string>{"e1", "e2", "e3", "e5"}));
+        EXPECT_TRUE(g.k_hop(e[0], 0).empty());
+        EXPECT_TRUE(g.k_hop(e[4], 5).empty());
+
+        // A bool visitor prunes: e1 is visited but not expanded, so e5 and e3
+        // are only reached through e2.
+        std::vector<std::string> pruned;
+        g.bfs(e[0], [&](splice_key_t k, size_t) {
+            pruned.push_back(k->get_data());
+            return k != e[1];
+        });
+        EXPECT_EQ(pruned, (std::vector<std::string>{"e0", "e1", "e2", "e3", "e4", "e5"}));
+        std::vector<std::string> depth_one;
+        g.dfs(e[0], [&](splice_key_t k, size_t) { depth_one.push_back(k->get_data()); }, 1);
+        EXPECT_EQ(depth_one, (std::vector<std::string>{"e0", "e1", "e2"}));
+    }
+}
+
+TEST(TraversalTest, AllPathsEnumeratesIsoforms) {
+    splice_grove_t g(3);
+    const auto e = build_splice_graph(g);
+
+    auto path_names = [](const std::vector<std::vector<splice_key_t>>& paths) {
+        std::vector<std::vector<std::string>> out;
+        for (const auto& p : paths) out.push_back(names(p));
+        return out;
+    };
+    for (bool frozen : {false, true}) {
+        if (frozen) g.freeze_graph();
+        EXPECT_EQ(path_names(g.all_paths(e[0], e[5], 10)), (std::vector<std::vector<std::string>>{
+            {"e0", "e1", "e3", "e5"}, {"e0", "e1", "e5"}, {"e0", "e2", "e3", "e5"}}));
+        EXPECT_EQ(g.all_paths(e[0], e[5], 2).size(), 2u);
+        EXPECT_EQ(path_names(g.all_paths(e[0], e[5], 10, 2)),
+                  (std::vector<std::vector<std::string>>{{"e0", "e1", "e5"}}));
+        EXPECT_TRUE(g.all_paths(e[4], e[0], 10).empty());
+        EXPECT_TRUE(g.all_paths(e[0], e[5], 0).empty());
+        EXPECT_EQ(g.all_paths(e[2], e[2], 10), (std::vector<std::vector<splice_key_t>>{{e[2]}}));
+    }
+
+    // A cycle cannot make a path revisit a key.
+    g.add_edge(e[3], e[0]);
+    EXPECT_EQ(g.all_paths(e[0], e[4], 10).size(), 2u);
+    EXPECT_THROW((void)g.all_paths(nullptr, e[4], 1), std::invalid_argument);
+}
+
+TEST(TraversalTest, TopologicalOrderRespectsEdgesAndRejectsCycles) {
+    splice_grove_t g(3);
+    const auto e = build_splice_graph(g);
+
+    auto respects_edges = [&](const std::vector<splice_key_t>& order) {
+        for (auto* u : order) {
+            for (auto* v : g.get_neighbors(u)) {
+                if (std::ranges::find(order, u) >= std::ranges::find(order, v)) return false;
+            }
+        }
+        return true;
+    };
+    for (bool frozen : {false, true}) {
+        if (frozen) g.freeze_graph();
+        const auto all = g.topological_order();
+        EXPECT_EQ(all.size(), 6u);
+        EXPECT_TRUE(respects_edges(all));
+        EXPECT_EQ(names(all), (std::vector<std::string>{"e0", "e1", "e2", "e3", "e4", "e5"}));
+
+        const std::vector<splice_key_t> roots{e[2]};
+        EXPECT_EQ(names(g.topological_order(roots)), (std::vector<std::string>{"e2", "e3", "e5", "e4"}));
+    }
+
+    const std::vector<splice_key_t> null_root{nullptr};
+    EXPECT_THROW((void)g.topological_order(null_root), std::invalid_argument);
+    g.add_edge(e[4], e[1]);
+    EXPECT_THROW((void)g.topological_order(), std::runtime_error);
+    g.remove_edge(e[4], e[1]);
+    g.add_edge(e[5], e[5]);
+    EXPECT_THROW((void)g.topological_order(), std::runtime_error);
+}
+
+TEST(TraversalTest, LongChainDoesNotRecurse) {
+    splice_grove_t g(8);
+    std::vector<splice_key_t> chain;
+    for (size_t i = 0; i < 50000; ++i) {
+        chain.push_back(g.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5}, "", gst::sorted));
+        if (i > 0) g.add_edge(chain[i - 1], chain[i]);
+    }
+    size_t deepest = 0;
+    g.dfs(chain.front(), [&](splice_key_t, size_t d) { deepest = std::max(deepest, d); });
+    EXPECT_EQ(deepest, chain.size() - 1);
+    EXPECT_EQ(g.topological_order().size(), chain.size());
+    EXPECT_EQ(g.all_paths(chain.front(), chain.back(), 5).front().size(), chain.size());
+}
+
+// =============================================================================
+// Interval-Constrained Expansion Tests
+// =============================================================================
+
+TEST(IntersectExpandTest, SeedsThenBreadthFirstReachedKeys) {
+    splice_grove_t g(3);
+    const auto e = build_splice_graph(g);
+    auto depths_of = [](const auto& r) {
+        std::vector<std::pair<std::string, size_t>> out;
+        for (size_t i = 0; i < r.size(); ++i) out.emplace_back(r.get_keys()[i]->get_data(), r.get_depths()[i]);
+        return out;
+    };
+
+    for (bool frozen : {false, true}) {
+        if (frozen) g.freeze_graph();
+        // e0 and e1 overlap the query; e1 is a seed, so reaching it from e0 adds nothing.
+        const auto r = g.intersect_expand(gdt::interval{0, 120}, "chr1",
+                                          gst::expansion_spec<gdt::interval>{.max_depth = 2});
+        EXPECT_EQ(r.get_seed_count(), 2u);
+        EXPECT_EQ(depths_of(r), (std::vector<std::pair<std::string, size_t>>{
+            {"e0", 0}, {"e1", 0}, {"e2", 1}, {"e3", 1}, {"e5", 1}, {"e4", 2}}));
+
+        const auto seeds_only = g.intersect_expand(gdt::interval{0, 120}, "chr1",
+                                                   gst::expansion_spec<gdt::interval>{.max_depth = 0});
+        EXPECT_EQ(names(seeds_only.get_keys()), (std::vector<std::string>{"e0", "e1"}));
+
+        // The target region drops e5 (and would stop expansion through it).
+        const auto region = g.intersect_expand(gdt::interval{0, 10}, gst::expansion_spec<gdt::interval>{
+            .max_depth = gst::unbounded_depth, .target_region = gdt::interval{0, 450}});
+        EXPECT_EQ(names(region.get_keys()), (std::vector<std::string>{"e0", "e1", "e2", "e3", "e4"}));
+
+        EXPECT_TRUE(g.intersect_expand(gdt::interval{0, 10}, "chrX").empty());
+    }
+}
+
+TEST(IntersectExpandTest, EdgeFilterMatchesFrozenAndList) {
+    frozen_grove_t g(4);
+    const auto keys = build_frozen_test_grove(g);
+    auto odd = [](int m) { return m % 2 != 0; };
+    const gst::expansion_spec<gdt::interval, decltype(odd)> spec{.max_depth = 3, .edge_filter = odd};
+    const gdt::interval everything{0, std::numeric_limits<size_t>::max()};
+
+    const auto list = g.intersect_expand(everything, spec);
+    g.freeze_graph();
+    const auto frozen = g.intersect_expand(everything, spec);
+    EXPECT_EQ(list.get_keys(), frozen.get_keys());
+    EXPECT_EQ(list.get_depths(), frozen.get_depths());
+
+    // Expanding one seed by hand reaches exactly the odd-edge closure.
+    gdt::expansion_result<gdt::interval, int> by_hand{gdt::interval{}};
+    const std::vector<frozen_key_t*> seed{keys[0]};
+    g.graph().expand(seed, spec, by_hand);
+    for (size_t i = 1; i < by_hand.size(); ++i) {
+        auto* k = by_hand.get_keys()[i];
+        bool via_odd_edge = false;
+        for (size_t j = 0; j < i; ++j) {
+            const auto targets = g.get_neighbors_if(by_hand.get_keys()[j], odd);
+            via_odd_edge |= std::ranges::find(targets, k) != targets.end();
+        }
+        EXPECT_TRUE(via_odd_edge) << i;
+    }
+    const std::vector<frozen_key_t*> null_seed{nullptr};
+    EXPECT_THROW(g.graph().expand(null_seed, spec, by_hand), std::invalid_argument);
+}
+
+// =============================================================================
+// Graph Analytics Tests
+// =============================================================================
+
+namespace {
+
+// Several thousand keys (more than one analytics chunk) in a few dozen
+// weakly connected clusters, wired with chains, hubs, back edges and
+// self-loops.
+std::vector<frozen_key_t*> build_analytics_grove(frozen_grove_t& g) {
+    constexpr std::size_t num_keys = 3000;
+    constexpr std::size_t cluster = 97;
+    std::vector<frozen_key_t*> keys;
+    for (std::size_t i = 0; i < num_keys; ++i) {
+        keys.push_back(g.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5},
+                                     static_cast<int>(i), gst::sorted));
+    }
+    for (std::size_t i = 0; i < num_keys; ++i) {
+        const std::size_t base = i - i % cluster;
+        if (i % cluster != cluster - 1 && i + 1 < num_keys && i % 11 != 0) {
+            g.add_edge(keys[i], keys[i + 1], 1);
+        }
+        if (i % 7 == 0) g.add_edge(keys[base], keys[i], 2);         // hub
+        if (i % 13 == 0) g.add_edge(keys[i], keys[base], 3);        // back edge
+        if (i % 29 == 0) g.add_edge(keys[i], keys[i], 4);           // self-loop
+    }
+    return keys;
+}
+
+// Undirected BFS labels, numbered by first key in vertices() order.
+std::vector<std::uint32_t> reference_components(const frozen_grove_t& g,
+                                                 const std::vector<frozen_key_t*>& keys) {
+    std::unordered_map<const frozen_key_t*, std::uint32_t> label;
+    std::uint32_t next = 0;
+    for (auto* k : keys) {
+        if (label.contains(k)) continue;
+        std::vector<frozen_key_t*> stack{k};
+        label[k] = next;
+        while (!stack.empty()) {
+            auto* v = stack.back();
+            stack.pop_back();
+            for (const auto& side : {g.get_neighbors(v), g.get_in_neighbors(v)}) {
+                for (auto* w : side) {
+                    if (label.emplace(w, next).second) stack.push_back(w);
+                }
+            }
+        }
+        ++next;
+    }
+    std::vector<std::uint32_t> out;
+    for (auto* k : keys) out.push_back(label.at(k));
+    return out;
+}
+
+} // namespace
+
+TEST(GraphAnalyticsTest, ComponentsMatchReferenceForEveryLayoutAndThreadCount) {
+    frozen_grove_t g(8);
+    build_analytics_grove(g);
+    const auto list = g.weakly_connected_components();
+    ASSERT_FALSE(list.keys.empty());
+    EXPECT_EQ(list.labels, reference_components(g, list.keys));
+    EXPECT_EQ(list.count, static_cast<std::size_t>(
+        *std::ranges::max_element(list.labels) + 1));
+    EXPECT_GT(list.count, 1u);
+
+    EXPECT_EQ(g.weakly_connected_components(4).labels, list.labels);
+    g.freeze_graph();
+    for (std::size_t threads : {1u, 3u, 0u}) {
+        const auto frozen = g.weakly_connected_components(threads);
+        EXPECT_EQ(frozen.keys, list.keys);
+        EXPECT_EQ(frozen.labels, list.labels);
+        EXPECT_EQ(frozen.count, list.count);
+    }
+}
+
+TEST(GraphAnalyticsTest, ReachableMatchesBreadthFirstClosure) {
+    frozen_grove_t g(8);
+    const auto keys = build_analytics_grove(g);
+    auto* isolated = g.add_external_key(gdt::interval{1, 2}, -1);
+    const std::vector<frozen_key_t*> sources{keys[500], keys[20], isolated, keys[500]};
+
+    std::unordered_set<const frozen_key_t*> closure{isolated};
+    for (auto* s : {keys[500], keys[20]}) {
+        g.graph().bfs(s, [&](frozen_key_t* k, std::size_t) { closure.insert(k); });
+    }
+
+    const auto list = g.reachable(sources);
+    ASSERT_GE(list.size(), 3u);
+    EXPECT_EQ(list[0], keys[500]);
+    EXPECT_EQ(list[1], keys[20]);
+    EXPECT_EQ(list[2], isolated);
+    EXPECT_EQ(std::unordered_set<const frozen_key_t*>(list.begin(), list.end()), closure);
+    EXPECT_EQ(list.size(), closure.size());  // each key once
+
+    EXPECT_EQ(g.reachable(sources, 4), list);
+    g.freeze_graph();
+    EXPECT_EQ(g.reachable(sources, 4), list);
+    EXPECT_EQ(g.reachable(sources, 1), list);
+
+    const std::vector<frozen_key_t*> null_source{nullptr};
+    EXPECT_THROW((void)g.reachable(null_source), std::invalid_argument);
+}
+
+TEST(GraphAnalyticsTest, RankVerticesIsDeterministicAndNormalized) {
+    frozen_grove_t g(8);
+    build_analytics_grove(g);
+    const auto list = g.rank_vertices();
+    ASSERT_EQ(list.scores.size(), list.keys.size());
+    EXPECT_GT(list.iterations, 1u);
+    double total = 0.0;
+    for (double x : list.scores) {
+        EXPECT_GT(x, 0.0);
+        total += x;
+    }
+    EXPECT_NEAR(total, 1.0, 1e-9);
+
+    // Bit-identical for every thread count and layout.
+    EXPECT_EQ(g.rank_vertices({}, 4).scores, list.scores);
+    g.freeze_graph();
+    EXPECT_EQ(g.rank_vertices({}, 3).scores, list.scores);
+    EXPECT_EQ(g.rank_vertices({}, 1).keys, list.keys);
+
+    EXPECT_THROW((void)g.rank_vertices({.damping = 1.5}), std::invalid_argument);
+    EXPECT_THROW((void)g.rank_vertices({.tolerance = -1.0}), std::invalid_argument);
+}
+
+TEST(GraphAnalyticsTest, SmallGraphsHaveClosedFormAnswers) {
+    frozen_grove_t g(4);
+    std::vector<frozen_key_t*> k;
+    for (std::size_t i = 0; i < 4; ++i) {
+        k.push_back(g.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5},
+                                  static_cast<int>(i), gst::sorted));
+    }
+    EXPECT_EQ(g.weakly_connected_components().count, 0u);
+    EXPECT_TRUE(g.rank_vertices().scores.empty());
+
+    // A 3-cycle: every key scores 1/3. The fourth key only points into it.
+    g.add_edge(k[0], k[1], 0);
+    g.add_edge(k[1], k[2], 0);
+    g.add_edge(k[2], k[0], 0);
+    auto cycle = g.rank_vertices();
+    for (double x : cycle.scores) EXPECT_NEAR(x, 1.0 / 3.0, 1e-9);
+
+    g.add_edge(k[3], k[0], 0);
+    const auto parts = g.weakly_connected_components();
+    EXPECT_EQ(parts.count, 1u);
+    const std::vector<frozen_key_t*> from{k[0]};
+    EXPECT_EQ(g.reachable(from).size(), 3u);  // k[3] is upstream
+
+    // Without damping the uniform start is already the answer; with a zero
+    // tolerance the iteration bound is what stops the loop.
+    EXPECT_EQ(g.rank_vertices({.damping = 0.0, .max_iterations = 5}).iterations, 1u);
+    EXPECT_EQ(g.rank_vertices({.max_iterations = 3, .tolerance = 0.0}).iterations, 3u);
+}
+
 // =============================================================================
 // External Key Tests
 // =============================================================================
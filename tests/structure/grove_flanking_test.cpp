@@ -5,6 +5,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
 #include <genogrove/data_type/genomic_coordinate.hpp>
 #include <genogrove/data_type/interval.hpp>
 #include <genogrove/data_type/numeric.hpp>
@@ -178,3 +183,106 @@ TEST(GroveFlankingTest, NumericQueryNotInTree) {
     EXPECT_EQ(nn.get_predecessor(), k1);
     EXPECT_EQ(nn.get_successor(),   k2);
 }
+
+// =============================================================================
+// flanking_batch — sorted sweep must reproduce per-query flanking exactly
+// =============================================================================
+
+TEST(GroveFlankingTest, BatchMatchesPerQueryOnNestedIntervals) {
+    // Unsorted inserts with long and nested intervals, and a query set that
+    // includes duplicates and queries inside, between and beyond the keys.
+    gst::grove<gdt::interval, int> g(4);
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<size_t> start(100, 40000);
+    std::uniform_int_distribution<size_t> len(0, 2000);
+    for (int i = 0; i < 1200; ++i) {
+        const size_t s = start(rng);
+        g.insert_data("chr1", gdt::interval{s, s + len(rng) * (i % 9 == 0 ? 5 : 1)}, i);
+    }
+    std::vector<gdt::interval> queries;
+    std::uniform_int_distribution<size_t> qstart(0, 52000);
+    std::uniform_int_distribution<size_t> qlen(0, 60);
+    for (int i = 0; i < 800; ++i) {
+        const size_t s = qstart(rng);
+        queries.emplace_back(s, s + qlen(rng));
+    }
+    queries.push_back(queries.front());
+    std::sort(queries.begin(), queries.end());
+
+    const auto batch = g.flanking_batch(queries, "chr1");
+    ASSERT_EQ(batch.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        const auto single = g.flanking(queries[i], "chr1");
+        EXPECT_EQ(batch[i].get_predecessor(), single.get_predecessor()) << "query " << i;
+        EXPECT_EQ(batch[i].get_successor(), single.get_successor()) << "query " << i;
+    }
+}
+
+TEST(GroveFlankingTest, BatchMatchesPerQueryOnStrandedKeys) {
+    // Strand-aware overlap: a key spatially overlapping the query on another
+    // strand is a flanking candidate on whichever side it sorts, even nested
+    // inside the query span. Randomized over all strands and several orders,
+    // checked against a brute-force scan as well as the per-query descent.
+    const char strands[] = {'+', '-', '.', '*'};
+    for (int seed = 0; seed < 8; ++seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<size_t> start(0, 3000);
+        std::uniform_int_distribution<size_t> len(0, 80);
+        std::uniform_int_distribution<size_t> strand(0, 3);
+        gst::grove<gdt::genomic_coordinate, int> g(3 + seed % 4);
+        std::vector<gdt::genomic_coordinate> keys;
+        for (int i = 0; i < 400; ++i) {
+            const size_t s = start(rng);
+            keys.emplace_back(strands[strand(rng)], s, s + len(rng));
+            g.insert_data("chr1", keys.back(), i);
+        }
+        std::sort(keys.begin(), keys.end());
+        std::vector<gdt::genomic_coordinate> queries;
+        for (int i = 0; i < 200; ++i) {
+            const size_t s = start(rng);
+            queries.emplace_back(strands[strand(rng) % 3], s, s + len(rng));
+        }
+        std::sort(queries.begin(), queries.end());
+
+        const auto batch = g.flanking_batch(queries, g.find_index("chr1"));
+        ASSERT_EQ(batch.size(), queries.size());
+        for (size_t i = 0; i < queries.size(); ++i) {
+            const auto& q = queries[i];
+            const auto single = g.flanking(q, "chr1");
+            EXPECT_EQ(batch[i].get_predecessor(), single.get_predecessor()) << "seed " << seed << " query " << i;
+            EXPECT_EQ(batch[i].get_successor(), single.get_successor()) << "seed " << seed << " query " << i;
+
+            // Reference: skip overlapping keys; predecessor = largest end among
+            // K < q (first in sort order on ties), successor = first K > q.
+            const gdt::genomic_coordinate* pred = nullptr;
+            const gdt::genomic_coordinate* succ = nullptr;
+            for (const auto& k : keys) {
+                if (gdt::genomic_coordinate::overlaps(k, q)) continue;
+                if (k < q && (pred == nullptr || k.get_end() > pred->get_end())) pred = &k;
+                if (k > q && succ == nullptr) succ = &k;
+            }
+            ASSERT_EQ(single.get_predecessor() != nullptr, pred != nullptr) << q.to_string();
+            if (pred != nullptr) {
+                EXPECT_EQ(single.get_predecessor()->get_value().get_end(), pred->get_end()) << q.to_string();
+            }
+            ASSERT_EQ(single.get_successor() != nullptr, succ != nullptr) << q.to_string();
+            if (succ != nullptr) {
+                EXPECT_EQ(single.get_successor()->get_value(), *succ) << q.to_string();
+            }
+        }
+    }
+}
+
+TEST(GroveFlankingTest, BatchMissingIndexAndUnsortedInput) {
+    gst::grove<gdt::interval, int> g(4);
+    g.insert_data("chr1", gdt::interval{50, 60}, 1, gst::sorted);
+    const std::vector<gdt::interval> sorted_q = {{10, 20}, {100, 200}};
+    const auto miss = g.flanking_batch(sorted_q, "chr2");
+    ASSERT_EQ(miss.size(), 2u);
+    EXPECT_EQ(miss[0].get_successor(), nullptr);
+    EXPECT_EQ(miss[1].get_predecessor(), nullptr);
+    EXPECT_TRUE(g.flanking_batch(std::vector<gdt::interval>{}, "chr1").empty());
+
+    const std::vector<gdt::interval> unsorted_q = {{100, 200}, {10, 20}};
+    EXPECT_THROW((void)g.flanking_batch(unsorted_q, "chr1"), std::invalid_argument);
+}
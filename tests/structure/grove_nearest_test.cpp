@@ -0,0 +1,244 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <genogrove/data_type/genomic_coordinate.hpp>
+#include <genogrove/data_type/interval.hpp>
+#include <genogrove/structure/grove/grove.hpp>
+
+namespace gst = genogrove::structure;
+namespace gdt = genogrove::data_type;
+
+namespace {
+
+using span = std::pair<size_t, size_t>;
+
+template <typename Keys>
+std::vector<span> spans(const Keys& keys) {
+    std::vector<span> v;
+    for (auto* k : keys) {
+        v.emplace_back(k->get_value().get_start(), k->get_value().get_end());
+    }
+    return v;
+}
+
+// Reference nearest-k: predecessors by largest end, successors by sort order,
+// equal gaps in sort order.
+std::pair<std::vector<span>, std::vector<span>>
+brute_force_nearest(std::vector<span> all, const gdt::interval& q, size_t k,
+                    const gst::nearest_options& options = {}) {
+    std::sort(all.begin(), all.end());
+    std::vector<span> pred;
+    std::vector<span> succ;
+    for (const auto& s : all) {
+        if (s.second < q.get_start()) {
+            const size_t gap = q.get_start() - s.second - 1;
+            if (options.predecessors && (!options.max_distance || gap <= *options.max_distance)) {
+                pred.push_back(s);
+            }
+        } else if (s.first > q.get_end()) {
+            const size_t gap = s.first - q.get_end() - 1;
+            if (options.successors && (!options.max_distance || gap <= *options.max_distance)) {
+                succ.push_back(s);
+            }
+        }
+    }
+    std::stable_sort(pred.begin(), pred.end(),
+                     [](const span& a, const span& b) { return a.second > b.second; });
+    pred.resize(std::min(pred.size(), k));
+    succ.resize(std::min(succ.size(), k));
+    return {pred, succ};
+}
+
+} // namespace
+
+TEST(GroveNearestTest, EmptyGroveAndZeroKReturnNothing) {
+    gst::grove<gdt::interval, int> g(4);
+    auto none = g.nearest(gdt::interval{100, 200}, "chr1", 3);
+    EXPECT_TRUE(none.get_predecessors().empty());
+    EXPECT_TRUE(none.get_successors().empty());
+
+    g.insert_data("chr1", gdt::interval{10, 20}, 1, gst::sorted);
+    auto zero = g.nearest(gdt::interval{100, 200}, "chr1", 0);
+    EXPECT_TRUE(zero.get_predecessors().empty());
+    EXPECT_TRUE(zero.get_successors().empty());
+}
+
+TEST(GroveNearestTest, ReturnsKPerSideNearestFirst) {
+    gst::grove<gdt::interval, int> g(4);
+    for (size_t i = 0; i < 20; ++i) {
+        g.insert_data("chr1", gdt::interval{i * 100, i * 100 + 20}, static_cast<int>(i), gst::sorted);
+    }
+    // Between i=9 ([900,920]) and i=10 ([1000,1020]).
+    auto r = g.nearest(gdt::interval{950, 960}, "chr1", 3);
+    ASSERT_EQ(r.get_predecessors().size(), 3u);
+    ASSERT_EQ(r.get_successors().size(), 3u);
+    EXPECT_EQ(r.get_predecessors()[0]->get_data(), 9);
+    EXPECT_EQ(r.get_predecessors()[1]->get_data(), 8);
+    EXPECT_EQ(r.get_predecessors()[2]->get_data(), 7);
+    EXPECT_EQ(r.get_successors()[0]->get_data(), 10);
+    EXPECT_EQ(r.get_successors()[1]->get_data(), 11);
+    EXPECT_EQ(r.get_successors()[2]->get_data(), 12);
+
+    // Near the edge a side runs out before k.
+    auto edge = g.nearest(gdt::interval{150, 160}, "chr1", 5);
+    EXPECT_EQ(edge.get_predecessors().size(), 2u);
+    EXPECT_EQ(edge.get_successors().size(), 5u);
+}
+
+TEST(GroveNearestTest, KOfOneMatchesFlanking) {
+    gst::grove<gdt::interval, int> g(4);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<size_t> start(0, 20000);
+    std::uniform_int_distribution<size_t> len(0, 400);
+    for (int i = 0; i < 600; ++i) {
+        const size_t s = start(rng);
+        g.insert_data("chr1", gdt::interval{s, s + len(rng)}, i);
+    }
+    for (size_t s = 0; s < 21000; s += 173) {
+        const gdt::interval q{s, s + 25};
+        auto flank = g.flanking(q, "chr1");
+        auto near = g.nearest(q, "chr1", 1);
+        EXPECT_EQ(near.get_predecessors().empty() ? nullptr : near.get_predecessors()[0],
+                  flank.get_predecessor()) << "at " << s;
+        EXPECT_EQ(near.get_successors().empty() ? nullptr : near.get_successors()[0],
+                  flank.get_successor()) << "at " << s;
+    }
+}
+
+TEST(GroveNearestTest, StrandedKOfOneMatchesFlanking) {
+    // A key spatially overlapping the query on another strand does not
+    // overlap() it, so flanking() takes it as the neighbor on its sort side.
+    gst::grove<gdt::genomic_coordinate, int> small(4);
+    auto* other_strand = small.insert_data("chr1", gdt::genomic_coordinate{'-', 90, 150}, 0);
+    small.insert_data("chr1", gdt::genomic_coordinate{'+', 10, 20}, 1);
+    small.insert_data("chr1", gdt::genomic_coordinate{'+', 300, 400}, 2);
+    const gdt::genomic_coordinate repro{'+', 100, 200};
+    EXPECT_EQ(small.flanking(repro, "chr1").get_predecessor(), other_strand);
+    auto near = small.nearest(repro, "chr1", 1);
+    ASSERT_EQ(near.get_predecessors().size(), 1u);
+    EXPECT_EQ(near.get_predecessors()[0], other_strand);
+
+    // Overlapping on another strand counts as distance 0.
+    gst::nearest_options touching;
+    touching.max_distance = 0;
+    auto bounded = small.nearest(repro, "chr1", 3, touching);
+    ASSERT_EQ(bounded.get_predecessors().size(), 1u);
+    EXPECT_EQ(bounded.get_predecessors()[0], other_strand);
+    EXPECT_TRUE(bounded.get_successors().empty());
+
+    const char strands[] = {'+', '-', '.', '*'};
+    gst::grove<gdt::genomic_coordinate, int> g(3);
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<size_t> start(0, 5000);
+    std::uniform_int_distribution<size_t> len(0, 120);
+    std::uniform_int_distribution<size_t> strand(0, 3);
+    for (int i = 0; i < 800; ++i) {
+        const size_t s = start(rng);
+        g.insert_data("chr1", gdt::genomic_coordinate{strands[strand(rng)], s, s + len(rng)}, i);
+    }
+    for (int i = 0; i < 600; ++i) {
+        const size_t s = start(rng);
+        const gdt::genomic_coordinate q{strands[strand(rng) % 3], s, s + len(rng)};
+        auto flank = g.flanking(q, "chr1");
+        auto r = g.nearest(q, "chr1", 1);
+        EXPECT_EQ(r.get_predecessors().empty() ? nullptr : r.get_predecessors()[0],
+                  flank.get_predecessor()) << q.to_string();
+        EXPECT_EQ(r.get_successors().empty() ? nullptr : r.get_successors()[0],
+                  flank.get_successor()) << q.to_string();
+    }
+}
+
+TEST(GroveNearestTest, MatchesBruteForceOnNestedIntervals) {
+    // Unsorted inserts with long and nested intervals: the nearest predecessor
+    // is often not the sort-order predecessor.
+    gst::grove<gdt::interval, int> g(5);
+    std::vector<span> all;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> start(0, 50000);
+    std::uniform_int_distribution<size_t> len(0, 3000);
+    for (int i = 0; i < 1500; ++i) {
+        const size_t s = start(rng);
+        const size_t e = s + len(rng) * (i % 7 == 0 ? 4 : 1);
+        g.insert_data("chr1", gdt::interval{s, e}, i);
+        all.emplace_back(s, e);
+    }
+
+    for (const size_t k : {1u, 4u, 25u}) {
+        for (size_t s = 0; s < 52000; s += 997) {
+            const gdt::interval q{s, s + 40};
+            auto r = g.nearest(q, "chr1", k);
+            auto [pred, succ] = brute_force_nearest(all, q, k);
+            EXPECT_EQ(spans(r.get_predecessors()), pred) << "k=" << k << " at " << s;
+            EXPECT_EQ(spans(r.get_successors()), succ) << "k=" << k << " at " << s;
+        }
+    }
+}
+
+TEST(GroveNearestTest, MaxDistanceAndSideOptions) {
+    gst::grove<gdt::interval, int> g(4);
+    std::vector<span> all;
+    for (size_t i = 0; i < 200; ++i) {
+        g.insert_data("chr1", gdt::interval{i * 50, i * 50 + 9}, static_cast<int>(i), gst::sorted);
+        all.emplace_back(i * 50, i * 50 + 9);
+    }
+    const gdt::interval q{5020, 5030};
+
+    gst::nearest_options bounded;
+    bounded.max_distance = 120;
+    auto r = g.nearest(q, "chr1", 10, bounded);
+    auto [pred, succ] = brute_force_nearest(all, q, 10, bounded);
+    EXPECT_EQ(spans(r.get_predecessors()), pred);
+    EXPECT_EQ(spans(r.get_successors()), succ);
+    EXPECT_LT(r.get_predecessors().size(), 10u);
+
+    // Abutting keys sit at distance 0 and survive max_distance = 0.
+    gst::nearest_options touching;
+    touching.max_distance = 0;
+    auto t = g.nearest(gdt::interval{10, 49}, "chr1", 3, touching);
+    ASSERT_EQ(t.get_predecessors().size(), 1u);
+    ASSERT_EQ(t.get_successors().size(), 1u);
+    EXPECT_EQ(t.get_predecessors()[0]->get_data(), 0);
+    EXPECT_EQ(t.get_successors()[0]->get_data(), 1);
+
+    gst::nearest_options downstream_only;
+    downstream_only.predecessors = false;
+    auto d = g.nearest(q, "chr1", 3, downstream_only);
+    EXPECT_TRUE(d.get_predecessors().empty());
+    EXPECT_EQ(d.get_successors().size(), 3u);
+
+    // The handle overload reaches the same tree.
+    auto h = g.nearest(q, g.find_index("chr1"), 10, bounded);
+    EXPECT_EQ(h.get_predecessors(), r.get_predecessors());
+    EXPECT_EQ(h.get_successors(), r.get_successors());
+}
+
+TEST(GroveNearestTest, StrandPredicateSkipsWithoutConsumingK) {
+    gst::grove<gdt::genomic_coordinate, int> g(4);
+    for (size_t i = 0; i < 40; ++i) {
+        const char strand = (i % 2 == 0) ? '+' : '-';
+        g.insert_data("chr1", gdt::genomic_coordinate{strand, i * 10, i * 10 + 5},
+                      static_cast<int>(i), gst::sorted);
+    }
+    auto same_strand = [](const gdt::genomic_coordinate& c, const gdt::genomic_coordinate& q) {
+        return q.get_strand() == '*' || c.get_strand() == '*' || c.get_strand() == q.get_strand();
+    };
+
+    auto r = g.nearest(gdt::genomic_coordinate{'+', 207, 208}, "chr1", 3, {}, same_strand);
+    ASSERT_EQ(r.get_predecessors().size(), 3u);
+    ASSERT_EQ(r.get_successors().size(), 3u);
+    EXPECT_EQ(r.get_predecessors()[0]->get_data(), 20);
+    EXPECT_EQ(r.get_predecessors()[1]->get_data(), 18);
+    EXPECT_EQ(r.get_predecessors()[2]->get_data(), 16);
+    EXPECT_EQ(r.get_successors()[0]->get_data(), 22);
+    EXPECT_EQ(r.get_successors()[1]->get_data(), 24);
+    EXPECT_EQ(r.get_successors()[2]->get_data(), 26);
+}
@@ -9,6 +9,7 @@
 #include <numeric>
 #include <random>
 #include <sstream>
+#include <stdexcept>
 
 #include <genogrove/structure/grove/grove.hpp>
 #include <genogrove/data_type/interval.hpp>
@@ -960,6 +961,84 @@ TEST(GroveCompactTest, RoundtripSerializationAfterCompact) {
         EXPECT_EQ(result.get_keys()[0]->get_data(), i);
     }
 }
+
+// =============================================================================
+// Key ids
+// =============================================================================
+
+TEST(GroveKeyIdTest, IdsAreDenseAndStableAcrossRemoveAndCompact) {
+    gst::grove<gdt::interval, int> grove(4);
+    auto keys = insert_intervals(grove, "chr1", 20);
+    auto* external = grove.add_external_key(gdt::interval{1000, 1100}, 99);
+
+    // Separators never get ids, so ids are exactly 0 .. vertex_count() - 1.
+    ASSERT_EQ(grove.id_count(), 21u);
+    for (std::uint32_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(grove.id_of(keys[i]), i);
+        EXPECT_EQ(grove.key_at(i), keys[i]);
+    }
+    EXPECT_EQ(grove.id_of(external), 20u);
+
+    ASSERT_TRUE(grove.remove_key("chr1", keys[3]));
+    EXPECT_EQ(grove.key_at(3), nullptr);
+    EXPECT_THROW((void)grove.id_of(keys[3]), std::invalid_argument);
+
+    grove.compact();
+    EXPECT_EQ(grove.id_count(), 21u);
+    for (std::uint32_t i = 0; i < 20; ++i) {
+        if (i == 3) continue;
+        auto* k = grove.key_at(i);
+        ASSERT_NE(k, nullptr);
+        EXPECT_EQ(k->get_data(), static_cast<int>(i));
+        EXPECT_EQ(grove.id_of(k), i);
+    }
+    EXPECT_EQ(grove.key_at(20), external);
+
+    // New keys continue after the highest id; freed ids are not reused.
+    auto* late = grove.insert_data("chr1", gdt::interval{5000, 5005}, 21, gst::sorted);
+    EXPECT_EQ(grove.id_of(late), 21u);
+
+    auto counts = grove.make_key_array<int>(-1);
+    EXPECT_EQ(counts.size(), grove.id_count());
+}
+
+TEST(GroveKeyIdTest, DeserializeRenumbersDensely) {
+    gst::grove<gdt::interval, int> grove(4);
+    auto keys = insert_intervals(grove, "chr1", 12);
+    auto* external = grove.add_external_key(gdt::interval{1000, 1100}, 99);
+    grove.add_edge(keys[0], external);
+    grove.remove_key("chr1", keys[5]);
+
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    grove.serialize(ss);
+    auto restored = gst::grove<gdt::interval, int>::deserialize(ss);
+
+    // Indexed keys in file (leaf) order first, then external keys — no holes.
+    ASSERT_EQ(restored.id_count(), restored.vertex_count());
+    std::vector<int> data;
+    for (std::uint32_t i = 0; i < restored.id_count(); ++i) {
+        auto* k = restored.key_at(i);
+        ASSERT_NE(k, nullptr);
+        EXPECT_EQ(restored.id_of(k), i);
+        data.push_back(k->get_data());
+    }
+    EXPECT_EQ(data, (std::vector<int>{0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 99}));
+}
+
+TEST(GroveKeyIdTest, IdOfRejectsForeignAndNullKeys) {
+    gst::grove<gdt::interval, int> grove(4);
+    gst::grove<gdt::interval, int> other(4);
+    grove.insert_data("chr1", gdt::interval{0, 5}, 0, gst::sorted);
+    auto* foreign = other.insert_data("chr1", gdt::interval{0, 5}, 0, gst::sorted);
+
+    EXPECT_THROW((void)grove.id_of(nullptr), std::invalid_argument);
+    EXPECT_THROW((void)grove.id_of(foreign), std::invalid_argument);
+    gdt::key<gdt::interval, int> standalone(gdt::interval{0, 5}, 0);
+    EXPECT_EQ(standalone.get_id(), gdt::no_key_id);
+    EXPECT_THROW((void)grove.id_of(&standalone), std::invalid_argument);
+    EXPECT_THROW((void)grove.key_at(1), std::out_of_range);
+}
+
 // =============================================================================
 // Removal from an unsorted-built tree
 // =============================================================================
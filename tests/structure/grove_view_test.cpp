@@ -5,16 +5,21 @@
 
 /*
  * Tests for grove_view — the partial (random-access) reader over a serialized
- * format 0.3 grove. The contract: it returns exactly what the eager grove would
+ * format 0.8 grove. The contract: it returns exactly what the eager grove would
  * for the same query, while loading only the blocks the query walks.
  */
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <ranges>
 #include <set>
+#include <span>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -293,7 +298,7 @@ TEST(GroveViewTest, InEdgePayloadsSurfaceThroughView) {
 }
 
 TEST(GroveViewTest, SelfLoopInNeighbors) {
-    // A self-loop is filed once in graph_overlay::incident (not twice), and the
+    // A self-loop is filed once per direction in graph_overlay, and the
     // .gg writer's outgoing/incoming split must reproduce that: get_in_neighbors
     // sees the same key that get_neighbors does.
     using grove_t = gst::grove<gdt::interval, int>;
@@ -414,6 +419,64 @@ TEST(GroveViewTest, EdgePayloadsSurfaceThroughView) {
     fs::remove(path);
 }
 
+TEST(GroveViewTest, LazyAdjacencyViewsMatchAccessors) {
+    // The *_view adjacency ranges walk the recorded edges in place and page a
+    // neighbor's block in only when that element is dereferenced.
+    using grove_t = gst::grove<gdt::interval, std::string, std::string>;
+    fs::path path;
+    {
+        grove_t g(4);
+        auto* a = g.insert_data("chr7", gdt::interval{100, 200}, "geneA", gst::sorted);
+        auto* b = g.insert_data("chr9", gdt::interval{300, 400}, "geneB", gst::sorted);
+        auto* c = g.insert_data("chr9", gdt::interval{500, 600}, "geneC", gst::sorted);
+        g.add_edge(a, b, std::string{"strong"});
+        g.add_edge(a, c, std::string{"weak"});
+        g.add_edge(c, a, std::string{"back"});
+        path = write_grove(g, "lazyviews");
+    }
+
+    auto view = gst::grove_view<gdt::interval, std::string, std::string>::open(path.string());
+    auto ra = view.intersect(gdt::interval{100, 200}, "chr7");
+    ASSERT_EQ(ra.get_keys().size(), 1u);
+    const auto* src = ra.get_keys()[0];
+
+    // Building a view and walking only metadata resolves nothing.
+    const auto loaded = view.blocks_loaded();
+    auto strong = view.neighbors_if_view(src, [](const std::string& m) { return m == "strong"; });
+    EXPECT_EQ(view.blocks_loaded(), loaded);
+    std::vector<std::string> names;
+    for (auto* k : strong) {
+        names.push_back(k->get_data());
+    }
+    EXPECT_EQ(names, std::vector<std::string>{"geneB"});
+
+    std::vector<const gdt::key<gdt::interval, std::string>*> lazy;
+    for (auto* k : view.neighbors_view(src)) {
+        lazy.push_back(k);
+    }
+    const auto eager = view.get_neighbors(src);
+    EXPECT_TRUE(std::equal(lazy.begin(), lazy.end(), eager.begin(), eager.end()));
+
+    std::vector<std::string> metadata;
+    for (const auto& [target, meta] : view.out_edges_view(src)) {
+        metadata.push_back(target->get_data() + ":" + meta);
+    }
+    EXPECT_EQ(metadata, (std::vector<std::string>{"geneB:strong", "geneC:weak"}));
+
+    std::vector<std::string> sources;
+    for (const auto& [source, meta] : view.in_edges_view(src)) {
+        sources.push_back(source->get_data() + ":" + meta);
+    }
+    EXPECT_EQ(sources, std::vector<std::string>{"geneC:back"});
+    EXPECT_EQ(std::ranges::distance(view.in_neighbors_view(src)), 1);
+    EXPECT_TRUE(view.in_neighbors_if_view(src, [](const std::string& m) { return m == "x"; }).empty());
+
+    EXPECT_THROW((void)view.neighbors_view(nullptr), std::invalid_argument);
+    EXPECT_THROW((void)view.in_edges_view(nullptr), std::invalid_argument);
+
+    fs::remove(path);
+}
+
 TEST(GroveViewTest, NeighborResolvesIntoDistributedExternalBlock) {
     // Edge target lives in the 3rd external chunk; get_neighbors must page in that
     // one external block (not all of them) and resolve (block_id, slot) correctly.
@@ -642,4 +705,482 @@ TEST(GroveViewTest, FlankingNumericMatchesEager) {
     }
 
     fs::remove(path);
-}
\ No newline at end of file
+}
+
+TEST(GroveViewTest, FlankingBatchMatchesEager) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    fs::path path;
+    {
+        grove_t g(4);
+        for (size_t i = 0; i < 400; ++i) {
+            g.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5 + (i % 5) * 12},
+                          static_cast<int>(i), gst::sorted);
+        }
+        path = write_grove(g, "flanking_batch");
+    }
+
+    grove_t eager = [&] {
+        std::ifstream ifs(path, std::ios::binary);
+        return grove_t::deserialize(ifs);
+    }();
+    auto view = gst::grove_view<gdt::interval, int>::open(path.string());
+
+    std::vector<gdt::interval> queries;
+    for (size_t s = 0; s < 4200; s += 29) {
+        queries.emplace_back(s, s + 2);
+    }
+    const auto e = eager.flanking_batch(queries, "chr1");
+    const auto l = view.flanking_batch(queries, "chr1");
+    ASSERT_EQ(e.size(), l.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(flank_pair(e[i]), flank_pair(l[i])) << "query " << i;
+        EXPECT_EQ(flank_pair(l[i]), flank_pair(view.flanking(queries[i], "chr1"))) << "query " << i;
+    }
+    EXPECT_EQ(view.flanking_batch(queries, "nope").size(), queries.size());
+
+    fs::remove(path);
+}
+
+TEST(GroveViewTest, MatchesEagerNearest) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    fs::path path;
+    {
+        grove_t g(4);
+        for (size_t i = 0; i < 300; ++i) {
+            g.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5}, static_cast<int>(i), gst::sorted);
+        }
+        g.insert_data("chr1", gdt::interval{1000, 1600}, 999, gst::sorted);  // wide, reaches far right
+        path = write_grove(g, "nearest");
+    }
+
+    grove_t eager = [&] {
+        std::ifstream ifs(path, std::ios::binary);
+        return grove_t::deserialize(ifs);
+    }();
+
+    gst::nearest_options bounded;
+    bounded.max_distance = 35;
+    for (const size_t k : {1u, 3u, 8u}) {
+        for (const gdt::interval q : {gdt::interval{0, 5}, gdt::interval{1606, 1608},
+                                      gdt::interval{2006, 2008}, gdt::interval{5000, 6000}}) {
+            auto view = gst::grove_view<gdt::interval, int>::open(path.string());
+            for (const auto& options : {gst::nearest_options{}, bounded}) {
+                auto e = eager.nearest(q, "chr1", k, options);
+                auto l = view.nearest(q, "chr1", k, options);
+                auto values = [](const auto& keys) {
+                    std::vector<int> v;
+                    for (auto* key : keys) v.push_back(key->get_data());
+                    return v;
+                };
+                EXPECT_EQ(values(e.get_predecessors()), values(l.get_predecessors()))
+                    << "k=" << k << " at " << q.get_start();
+                EXPECT_EQ(values(e.get_successors()), values(l.get_successors()))
+                    << "k=" << k << " at " << q.get_start();
+            }
+        }
+    }
+
+    auto view = gst::grove_view<gdt::interval, int>::open(path.string());
+    EXPECT_TRUE(view.nearest(gdt::interval{10, 20}, "nope", 4).get_successors().empty());
+
+    // A bounded descent pages in only the neighborhood of the query.
+    auto r = view.nearest(gdt::interval{2006, 2008}, "chr1", 2);
+    ASSERT_EQ(r.get_successors().size(), 2u);
+    EXPECT_EQ(r.get_successors()[0]->get_data(), 201);
+    EXPECT_LT(view.blocks_loaded(), view.block_count());
+
+    fs::remove(path);
+}
+// ==========================================
+// Block directory (footer): a view opens from the footer when the header
+// records its offset, falls back to scanning the blocks when it does not
+// (non-seekable sink), and rejects a footer that points outside the blocks.
+// ==========================================
+
+namespace {
+
+// Serialize to bytes, let the caller patch them, and write the result to a
+// temp .gg (caller removes it).
+template <typename Grove, typename Patch>
+fs::path write_patched_grove(const Grove& g, const std::string& name, Patch patch,
+                             const gst::serialize_options& opts = {}) {
+    std::ostringstream os(std::ios::binary);
+    g.serialize(os, opts);
+    std::string bytes = os.str();
+    patch(bytes);
+    fs::path p = fs::temp_directory_path() / ("genogrove_view_" + name + ".gg");
+    std::ofstream ofs(p, std::ios::binary);
+    ofs.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    return p;
+}
+
+// One footer entry: a frame's uint64 offset and uint32 first block id.
+constexpr std::size_t footer_entry_size = sizeof(std::uint64_t) + sizeof(std::uint32_t);
+
+std::uint64_t footer_offset_of(const std::string& bytes) {
+    std::uint64_t v;
+    std::memcpy(&v, bytes.data() + 4, sizeof(v));
+    return v;
+}
+
+} // namespace
+
+TEST(GroveViewTest, FooterAndScanOpenAgree) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    using view_t = gst::grove_view<gdt::interval, int>;
+    grove_t g(4);
+    for (int i = 0; i < 300; ++i) {
+        g.insert_data(i % 2 ? "chr1" : "chr2", gdt::interval{static_cast<size_t>(i * 10),
+                      static_cast<size_t>(i * 10 + 15)}, i, gst::sorted);
+    }
+    fs::path with_footer = write_patched_grove(g, "footer", [](std::string& b) {
+        ASSERT_NE(footer_offset_of(b), 0u);
+    });
+    fs::path scanned = write_patched_grove(g, "scan", [](std::string& b) {
+        std::memset(b.data() + 4, 0, sizeof(std::uint64_t));  // as a pipe would leave it
+    });
+
+    auto fv = view_t::open(with_footer.string());
+    auto sv = view_t::open(scanned.string());
+    EXPECT_EQ(fv.block_count(), sv.block_count());
+    for (const char* chrom : {"chr1", "chr2"}) {
+        for (size_t q : {0u, 155u, 1500u, 2990u}) {
+            gdt::interval iv{q, q + 40};
+            EXPECT_EQ(data_values(fv.intersect(iv, chrom)), data_values(sv.intersect(iv, chrom)));
+            EXPECT_EQ(data_values(fv.intersect(iv, chrom)), data_values(g.intersect(iv, chrom)));
+        }
+    }
+    fs::remove(with_footer);
+    fs::remove(scanned);
+}
+
+TEST(GroveViewTest, CorruptFooterRejected) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    using view_t = gst::grove_view<gdt::interval, int>;
+    grove_t g(3);
+    for (int i = 0; i < 20; ++i) {
+        g.insert_data("chr1", gdt::interval{static_cast<size_t>(i), static_cast<size_t>(i + 1)},
+                      i, gst::sorted);
+    }
+
+    // Footer offset past the end of the file.
+    fs::path past_end = write_patched_grove(g, "footer_past_end", [](std::string& b) {
+        const std::uint64_t bogus = b.size() + 1024;
+        std::memcpy(b.data() + 4, &bogus, sizeof(bogus));
+    });
+    EXPECT_THROW((void)view_t::open(past_end.string()), std::runtime_error);
+    fs::remove(past_end);
+
+    // Second entry aimed back at the first frame: offsets must increase.
+    fs::path reordered = write_patched_grove(g, "footer_reordered", [](std::string& b) {
+        const std::uint64_t footer = footer_offset_of(b);
+        std::memcpy(b.data() + footer + footer_entry_size, b.data() + footer, sizeof(std::uint64_t));
+    });
+    EXPECT_THROW((void)view_t::open(reordered.string()), std::runtime_error);
+    fs::remove(reordered);
+
+    // Entry aimed into the footer itself.
+    fs::path into_footer = write_patched_grove(g, "footer_self", [](std::string& b) {
+        const std::uint64_t footer = footer_offset_of(b);
+        std::memcpy(b.data() + footer, &footer, sizeof(footer));
+    });
+    EXPECT_THROW((void)view_t::open(into_footer.string()), std::runtime_error);
+    fs::remove(into_footer);
+
+    // Second entry's first block id repeats the first entry's: block ids must
+    // increase frame by frame.
+    fs::path repeated_first = write_patched_grove(g, "footer_first_block", [](std::string& b) {
+        const std::uint64_t footer = footer_offset_of(b);
+        const std::uint32_t zero = 0;
+        std::memcpy(b.data() + footer + footer_entry_size + sizeof(std::uint64_t), &zero, sizeof(zero));
+    });
+    EXPECT_THROW((void)view_t::open(repeated_first.string()), std::runtime_error);
+    fs::remove(repeated_first);
+}
+
+// ==========================================
+// Frame packing: leaves are laid out in leaf-chain order and packed several
+// to a frame, so a range scan decodes far fewer frames than it loads blocks.
+// ==========================================
+
+TEST(GroveViewTest, PackedFramesMatchEagerAndCutRangeScanReads) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    using view_t = gst::grove_view<gdt::interval, int, int>;
+    grove_t g(4);
+    std::vector<gdt::key<gdt::interval, int>*> keys;
+    for (int i = 0; i < 600; ++i) {
+        keys.push_back(g.insert_data(i % 3 ? "chr1" : "chr2", gdt::interval{static_cast<size_t>(i * 10),
+                                     static_cast<size_t>(i * 10 + 15)}, i, gst::sorted));
+    }
+    for (size_t i = 0; i + 11 < keys.size(); i += 5) {
+        g.add_edge(keys[i], keys[i + 11], static_cast<int>(i));
+    }
+    const gdt::interval wide{1000, 4000};
+
+    std::size_t single_frames_read = 0;
+    for (std::size_t per_frame : {std::size_t{1}, std::size_t{8}}) {
+        gst::serialize_options opts;
+        opts.blocks_per_frame = per_frame;
+        const std::string tag = std::to_string(per_frame);
+        fs::path with_footer = write_patched_grove(g, "frames_" + tag, [](std::string&) {}, opts);
+        fs::path scanned = write_patched_grove(g, "frames_scan_" + tag, [](std::string& b) {
+            std::memset(b.data() + 4, 0, sizeof(std::uint64_t));
+        }, opts);
+
+        for (const fs::path& p : {with_footer, scanned}) {
+            auto view = view_t::open(p.string());
+            for (const char* chrom : {"chr1", "chr2"}) {
+                for (size_t q : {0u, 155u, 2500u, 5990u}) {
+                    gdt::interval iv{q, q + 40};
+                    EXPECT_EQ(data_values(view.intersect(iv, chrom)), data_values(g.intersect(iv, chrom)))
+                        << per_frame;
+                }
+            }
+            auto hit = view.intersect(gdt::interval{0, 5}, "chr2").get_keys();
+            ASSERT_EQ(hit.size(), 1u);
+            EXPECT_EQ(key_data_values(view.get_neighbors(hit[0])), std::vector<int>{11});
+        }
+
+        auto view = view_t::open(with_footer.string());
+        EXPECT_EQ(data_values(view.intersect(wide, "chr1")), data_values(g.intersect(wide, "chr1")));
+        if (per_frame == 1) {
+            EXPECT_EQ(view.frame_count(), view.block_count());
+            EXPECT_EQ(view.frames_loaded(), view.blocks_loaded());
+            single_frames_read = view.frames_loaded();
+        } else {
+            EXPECT_LT(view.frame_count(), view.block_count());
+            EXPECT_LT(view.frames_loaded(), view.blocks_loaded());
+            EXPECT_LT(view.frames_loaded() * 2, single_frames_read)
+                << view.frames_loaded() << " frames vs " << single_frames_read << " unpacked";
+        }
+        fs::remove(with_footer);
+        fs::remove(scanned);
+    }
+}
+
+TEST(GroveViewTest, TraversalMatchesEagerAndPrefetchesFrontier) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    using view_t = gst::grove_view<gdt::interval, int>;
+    using eager_key = gdt::key<gdt::interval, int>*;
+    using view_key = gdt::key<gdt::interval, int>*;
+    grove_t g(4);
+    std::vector<eager_key> keys;
+    for (int i = 0; i < 300; ++i) {
+        keys.push_back(g.insert_data(i % 2 ? "chr1" : "chr2", gdt::interval{static_cast<size_t>(i * 10),
+                                     static_cast<size_t>(i * 10 + 5)}, i, gst::sorted));
+    }
+    // Forward-only edges, so the graph is a DAG with many paths.
+    for (size_t i = 0; i < keys.size(); ++i) {
+        for (size_t step : {size_t{7}, size_t{13}, size_t{40}}) {
+            if (i % 3 != 2 && i + step < keys.size()) {
+                g.add_edge(keys[i], keys[i + step]);
+            }
+        }
+    }
+    gst::serialize_options opts;
+    opts.blocks_per_frame = 4;
+    fs::path path = write_patched_grove(g, "traversal", [](std::string&) {}, opts);
+
+    auto root_of = [](view_t& view) {
+        auto hit = view.intersect(gdt::interval{0, 5}, "chr2").get_keys();
+        EXPECT_EQ(hit.size(), 1u);
+        return hit[0];
+    };
+    auto data_of = [](const auto& keys) {
+        std::vector<int> v;
+        for (auto* k : keys) v.push_back(k->get_data());
+        return v;
+    };
+
+    {
+        auto view = view_t::open(path.string());
+        view_key root = root_of(view);
+        std::vector<std::pair<int, size_t>> lazy, eager;
+        view.bfs(root, [&](view_key k, size_t d) { lazy.emplace_back(k->get_data(), d); }, 4);
+        g.bfs(keys[0], [&](eager_key k, size_t d) { eager.emplace_back(k->get_data(), d); }, 4);
+        EXPECT_EQ(lazy, eager);
+        lazy.clear();
+        eager.clear();
+        view.dfs(root, [&](view_key k, size_t d) { lazy.emplace_back(k->get_data(), d); });
+        g.dfs(keys[0], [&](eager_key k, size_t d) { eager.emplace_back(k->get_data(), d); });
+        EXPECT_EQ(lazy, eager);
+
+        EXPECT_EQ(data_of(view.k_hop(root, 3)), data_of(g.k_hop(keys[0], 3)));
+        const auto lazy_paths = view.all_paths(root, view.k_hop(root, 3).back(), 25, 6);
+        const auto eager_paths = g.all_paths(keys[0], g.k_hop(keys[0], 3).back(), 25, 6);
+        ASSERT_EQ(lazy_paths.size(), eager_paths.size());
+        ASSERT_FALSE(lazy_paths.empty());
+        for (size_t i = 0; i < lazy_paths.size(); ++i) {
+            EXPECT_EQ(data_of(lazy_paths[i]), data_of(eager_paths[i])) << i;
+        }
+        const std::vector<view_key> view_roots{root};
+        const std::vector<eager_key> eager_roots{keys[0]};
+        EXPECT_EQ(data_of(view.topological_order(view_roots)), data_of(g.topological_order(eager_roots)));
+        EXPECT_THROW(view.bfs(nullptr, [](view_key, size_t) {}), std::invalid_argument);
+    }
+
+    {
+        // After prefetching a key's neighbors, resolving them reads nothing.
+        auto view = view_t::open(path.string());
+        view_key root = root_of(view);
+        const std::vector<view_key> frontier{root};
+        view.prefetch_neighbors(frontier);
+        const auto blocks = view.blocks_loaded();
+        const auto frames = view.frames_loaded();
+        EXPECT_EQ(view.get_neighbors(root).size(), 3u);
+        EXPECT_EQ(view.blocks_loaded(), blocks);
+        EXPECT_EQ(view.frames_loaded(), frames);
+    }
+    fs::remove(path);
+}
+
+TEST(GroveViewTest, BatchedNeighborResolutionCoalescesReads) {
+    // A fusion-style hub on chr2 links to keys spread over every chr1 leaf,
+    // listed in reverse file order. get_neighbors loads all the targets'
+    // frames in one file-order batch, so the reads it issues are far fewer
+    // than the frames it decodes — and the result keeps edge order.
+    using grove_t = gst::grove<gdt::interval, int>;
+    using view_t = gst::grove_view<gdt::interval, int>;
+    using key_ptr = gdt::key<gdt::interval, int>*;
+    grove_t g(4);
+    std::vector<key_ptr> keys;
+    for (int i = 0; i < 400; ++i) {
+        keys.push_back(g.insert_data("chr1", gdt::interval{static_cast<size_t>(i * 10),
+                                     static_cast<size_t>(i * 10 + 5)}, i, gst::sorted));
+    }
+    auto* hub = g.insert_data("chr2", gdt::interval{0, 5}, -1, gst::sorted);
+    for (int i = 399; i >= 0; i -= 9) {
+        g.add_edge(hub, keys[static_cast<size_t>(i)]);
+    }
+    fs::path path = write_grove(g, "coalesced");
+    auto data_of = [](const auto& ks) {
+        std::vector<int> v;
+        for (auto* k : ks) v.push_back(k->get_data());
+        return v;
+    };
+
+    {
+        auto view = view_t::open(path.string());
+        auto hits = view.intersect(gdt::interval{0, 5}, "chr2").get_keys();
+        ASSERT_EQ(hits.size(), 1u);
+        const auto reads = view.reads_issued();
+        const auto frames = view.frames_loaded();
+        EXPECT_EQ(data_of(view.get_neighbors(hits[0])), data_of(g.get_neighbors(hub)));
+        const auto decoded = view.frames_loaded() - frames;
+        EXPECT_GT(decoded, 20u);
+        EXPECT_LT((view.reads_issued() - reads) * 10, decoded)
+            << view.reads_issued() - reads << " reads for " << decoded << " frames";
+    }
+    {
+        // The frontier overload resolves each source like get_neighbors.
+        auto view = view_t::open(path.string());
+        std::vector<key_ptr> sources = view.intersect(gdt::interval{0, 5}, "chr2").get_keys();
+        auto chr1 = view.intersect(gdt::interval{100, 105}, "chr1").get_keys();
+        ASSERT_EQ(chr1.size(), 1u);
+        sources.push_back(chr1[0]);
+        const auto lists = view.get_neighbors(std::span<key_ptr const>(sources));
+        ASSERT_EQ(lists.size(), 2u);
+        EXPECT_EQ(data_of(lists[0]), data_of(g.get_neighbors(hub)));
+        EXPECT_TRUE(lists[1].empty());
+        sources.push_back(nullptr);
+        EXPECT_THROW((void)view.get_neighbors(std::span<key_ptr const>(sources)), std::invalid_argument);
+    }
+    fs::remove(path);
+}
+
+TEST(GroveViewTest, IntersectExpandMatchesEagerAndSkipsFilteredBlocks) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    using view_t = gst::grove_view<gdt::interval, int, int>;
+    grove_t g(4);
+    std::vector<gdt::key<gdt::interval, int>*> keys;
+    for (int i = 0; i < 400; ++i) {
+        keys.push_back(g.insert_data(i % 4 ? "chr1" : "chr3", gdt::interval{static_cast<size_t>(i * 10),
+                                     static_cast<size_t>(i * 10 + 5)}, i, gst::sorted));
+    }
+    keys.push_back(g.add_external_key(gdt::interval{9000, 9005}, -1));
+    for (size_t i = 0; i + 1 < keys.size(); ++i) {
+        g.add_edge(keys[i], keys[(i * 31 + 17) % keys.size()], static_cast<int>(i % 5));
+        g.add_edge(keys[i], keys[(i * 7 + 3) % keys.size()], static_cast<int>(i % 3));
+    }
+    g.add_edge(keys[0], keys.back(), 0);
+    fs::path path = write_grove(g, "expand");
+    g.freeze_graph();
+
+    auto low = [](int m) { return m < 2; };
+    const gst::expansion_spec<gdt::interval, decltype(low)> spec{
+        .max_depth = 3, .edge_filter = low, .target_region = gdt::interval{0, 3500}};
+    const gdt::interval query{0, 400};
+    for (const char* chrom : {"chr1", "chr3"}) {
+        auto view = view_t::open(path.string());
+        const auto lazy = view.intersect_expand(query, chrom, spec);
+        const auto eager = g.intersect_expand(query, chrom, spec);
+        EXPECT_EQ(lazy.get_seed_count(), eager.get_seed_count());
+        EXPECT_EQ(lazy.get_depths(), eager.get_depths());
+        std::vector<int> lazy_data, eager_data;
+        for (auto* k : lazy.get_keys()) lazy_data.push_back(k->get_data());
+        for (auto* k : eager.get_keys()) eager_data.push_back(k->get_data());
+        EXPECT_EQ(lazy_data, eager_data) << chrom;
+        EXPECT_GT(lazy.size(), lazy.get_seed_count());
+    }
+
+    {
+        // An edge the filter rejects never pages in its target's block: the
+        // external block is reachable only through keys[0]'s m == 0 edge.
+        auto view = view_t::open(path.string());
+        auto none = [](int) { return false; };
+        const auto r = view.intersect_expand(gdt::interval{0, 5}, "chr3",
+            gst::expansion_spec<gdt::interval, decltype(none)>{.max_depth = 5, .edge_filter = none});
+        EXPECT_EQ(r.size(), 1u);
+        const auto loaded = view.blocks_loaded();
+        const auto all = view.intersect_expand(gdt::interval{0, 5}, "chr3");
+        EXPECT_EQ(all.size(), 4u);
+        EXPECT_EQ(all.get_keys().back()->get_data(), -1);
+        EXPECT_GT(view.blocks_loaded(), loaded);
+    }
+    fs::remove(path);
+}
+
+// ==========================================
+// Block codecs: the view decodes whatever codec the header records.
+// ==========================================
+
+TEST(GroveViewTest, MatchesEagerForEveryAvailableCodec) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    using view_t = gst::grove_view<gdt::interval, int, int>;
+    grove_t g(4);
+    std::vector<gdt::key<gdt::interval, int>*> keys;
+    for (int i = 0; i < 200; ++i) {
+        keys.push_back(g.insert_data("chr1", gdt::interval{static_cast<size_t>(i * 10),
+                                     static_cast<size_t>(i * 10 + 15)}, i, gst::sorted));
+    }
+    for (size_t i = 0; i + 7 < keys.size(); i += 3) {
+        g.add_edge(keys[i], keys[i + 7], static_cast<int>(i));
+    }
+
+    for (auto codec : {gst::block_codec::stored, gst::block_codec::zlib, gst::block_codec::zstd,
+                       gst::block_codec::lz4}) {
+        if (!gst::block_codec_available(codec)) {
+            continue;
+        }
+        gst::serialize_options opts;
+        opts.codec = codec;
+        opts.dictionary_size = codec == gst::block_codec::zstd ? 2048 : 0;
+        fs::path p = fs::temp_directory_path() /
+                     ("genogrove_view_codec_" + std::string(gst::to_string(codec)) + ".gg");
+        {
+            std::ofstream ofs(p, std::ios::binary);
+            g.serialize(ofs, opts);
+        }
+        auto view = view_t::open(p.string());
+        for (size_t q : {0u, 333u, 1000u, 1990u}) {
+            gdt::interval iv{q, q + 50};
+            EXPECT_EQ(data_values(view.intersect(iv, "chr1")), data_values(g.intersect(iv, "chr1")))
+                << gst::to_string(codec);
+        }
+        auto hit = view.intersect(gdt::interval{0, 5}, "chr1").get_keys();
+        ASSERT_EQ(hit.size(), 1u);
+        EXPECT_EQ(key_data_values(view.get_neighbors(hit[0])), std::vector<int>{7})
+            << gst::to_string(codec);
+        fs::remove(p);
+    }
+}
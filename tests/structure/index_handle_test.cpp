@@ -0,0 +1,242 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+/*
+ * Tests for index handles — index names resolved once to small integers and
+ * passed to insert_data / intersect / flanking in place of the name.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <genogrove/data_type/interval.hpp>
+#include <genogrove/structure/grove/grove.hpp>
+#include <genogrove/structure/grove/grove_view.hpp>
+#include <genogrove/structure/grove/index_handle.hpp>
+
+#include "key_type_grove_test.hpp"
+
+namespace gst = genogrove::structure;
+namespace gdt = genogrove::data_type;
+namespace fs = std::filesystem;
+
+namespace {
+
+template <typename Result>
+std::vector<int> data_values(const Result& r) {
+    std::vector<int> v;
+    for (auto* k : r.get_keys()) {
+        v.push_back(k->get_data());
+    }
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+} // namespace
+
+TEST(IndexHandleTest, ResolveInternsOncePerName) {
+    gst::grove<gdt::interval, int> grove(4);
+    EXPECT_FALSE(grove.find_index("chr1").valid());
+
+    const auto chr1 = grove.resolve_index("chr1");
+    const auto chr2 = grove.resolve_index("chr2");
+    EXPECT_TRUE(chr1.valid());
+    EXPECT_NE(chr1, chr2);
+    EXPECT_EQ(grove.resolve_index("chr1"), chr1);
+    EXPECT_EQ(grove.find_index("chr2"), chr2);
+    EXPECT_EQ(grove.get_index_name(chr2), "chr2");
+
+    // Interning creates no tree.
+    EXPECT_TRUE(grove.get_root_nodes().empty());
+    EXPECT_TRUE(grove.intersect(gdt::interval{0, 100}, chr1).get_keys().empty());
+    EXPECT_THROW((void)grove.get_index_name(gst::index_handle{}), std::out_of_range);
+}
+
+TEST(IndexHandleTest, HandleInsertsMatchNameInserts) {
+    constexpr int order = 3;
+    gst::grove<gdt::interval, int> by_handle(order);
+    gst::grove<gdt::interval, int> by_name(order);
+
+    const auto chr1 = by_handle.resolve_index("chr1");
+    const auto chr2 = by_handle.resolve_index("chr2");
+    for (int i = 0; i < 200; ++i) {
+        // chr1 sorted (exercises rightmost-leaf splits), chr2 unsorted.
+        const gdt::interval sorted_iv(i * 10, i * 10 + 5);
+        by_handle.insert_data(chr1, sorted_iv, i, gst::sorted);
+        by_name.insert_data("chr1", sorted_iv, i, gst::sorted);
+
+        const int p = (i * 37) % 200;
+        const gdt::interval shuffled_iv(p * 10, p * 10 + 5);
+        by_handle.insert_data(chr2, shuffled_iv, 1000 + i);
+        by_name.insert_data("chr2", shuffled_iv, 1000 + i);
+    }
+    validate_grove_index(by_handle, "chr1", order);
+    validate_grove_index(by_handle, "chr2", order);
+
+    // Name and handle lookups reach the same trees.
+    EXPECT_EQ(by_handle.get_rightmost_node(chr1), by_handle.get_rightmost_node("chr1"));
+    EXPECT_EQ(by_handle.get_root_nodes().size(), 2u);
+
+    for (const gdt::interval q : {gdt::interval{0, 5}, gdt::interval{95, 130},
+                                  gdt::interval{1500, 1800}, gdt::interval{5000, 6000}}) {
+        EXPECT_EQ(data_values(by_handle.intersect(q, chr1)),
+                  data_values(by_name.intersect(q, "chr1")));
+        EXPECT_EQ(data_values(by_handle.intersect(q, chr2)),
+                  data_values(by_handle.intersect(q, "chr2")));
+        EXPECT_EQ(data_values(by_handle.intersect(q, chr2)),
+                  data_values(by_name.intersect(q, "chr2")));
+    }
+
+    const auto flank = by_handle.flanking(gdt::interval{1007, 1008}, chr1);
+    ASSERT_NE(flank.get_predecessor(), nullptr);
+    ASSERT_NE(flank.get_successor(), nullptr);
+    EXPECT_EQ(flank.get_predecessor()->get_data(), 100);
+    EXPECT_EQ(flank.get_successor()->get_data(), 101);
+    EXPECT_EQ(by_handle.flanking(gdt::interval{1007, 1008}, chr2).get_predecessor()->get_data(),
+              by_name.flanking(gdt::interval{1007, 1008}, "chr2").get_predecessor()->get_data());
+}
+
+TEST(IndexHandleTest, ForeignHandleIsRejected) {
+    gst::grove<gdt::interval, int> grove(4);
+    const gst::index_handle foreign{7};
+    EXPECT_THROW(grove.insert_data(foreign, gdt::interval{1, 2}, 0), std::out_of_range);
+    EXPECT_TRUE(grove.intersect(gdt::interval{0, 10}, foreign).get_keys().empty());
+    EXPECT_EQ(grove.flanking(gdt::interval{0, 10}, gst::index_handle{}).get_predecessor(), nullptr);
+}
+
+TEST(IndexHandleTest, HandleSurvivesEmptyingTheIndex) {
+    gst::grove<gdt::interval, int> grove(4);
+    const auto chr1 = grove.resolve_index("chr1");
+    auto* key = grove.insert_data(chr1, gdt::interval{10, 20}, 1);
+
+    ASSERT_TRUE(grove.remove_key("chr1", key));
+    EXPECT_TRUE(grove.get_root_nodes().empty());
+    EXPECT_TRUE(grove.intersect(gdt::interval{0, 100}, chr1).get_keys().empty());
+
+    grove.insert_data(chr1, gdt::interval{30, 40}, 2, gst::sorted);
+    EXPECT_EQ(data_values(grove.intersect(gdt::interval{0, 100}, chr1)), std::vector<int>{2});
+    EXPECT_EQ(data_values(grove.intersect(gdt::interval{0, 100}, "chr1")), std::vector<int>{2});
+}
+
+TEST(IndexHandleTest, RootNodesFollowTheIndexSlots) {
+    gst::grove<gdt::interval, int> grove(4);
+    grove.resolve_index("chrM");
+    grove.insert_data("chr2", gdt::interval{10, 20}, 1);
+    auto* key = grove.insert_data("chr1", gdt::interval{10, 20}, 2);
+    grove.insert_data("chr3", gdt::interval{10, 20}, 3);
+
+    // Only indices holding a tree, in first-use order.
+    std::vector<std::string> names;
+    for (const auto& [name, root] : grove.get_root_nodes()) {
+        names.push_back(name);
+        EXPECT_EQ(root, grove.get_root_nodes().at(name));
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{"chr2", "chr1", "chr3"}));
+    EXPECT_EQ(grove.get_root_nodes().size(), 3u);
+    EXPECT_EQ(grove.get_root_nodes().count("chrM"), 0u);
+    EXPECT_EQ(grove.get_root_nodes().find("chrM"), grove.get_root_nodes().end());
+    EXPECT_EQ(grove.get_root_nodes().find("chrX"), grove.get_root_nodes().end());
+    EXPECT_THROW({ [[maybe_unused]] auto* root = grove.get_root_nodes().at("chrM"); }, std::out_of_range);
+
+    // Removing a tree drops it from the view; the handle keeps its slot.
+    const auto roots = grove.get_root_nodes();
+    ASSERT_TRUE(grove.remove_key("chr1", key));
+    EXPECT_FALSE(roots.contains("chr1"));
+    EXPECT_EQ(roots.size(), 2u);
+    EXPECT_TRUE(grove.find_index("chr1").valid());
+
+    // Deserialization interns the indices in file order, so the view keeps it.
+    std::stringstream ss;
+    grove.serialize(ss);
+    auto copy = gst::grove<gdt::interval, int>::deserialize(ss);
+    names.clear();
+    for (const auto& [name, root] : copy.get_root_nodes()) {
+        names.push_back(name);
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{"chr2", "chr3"}));
+}
+
+TEST(IndexHandleTest, BulkAndDeserializedGrovesResolveHandles) {
+    gst::grove<gdt::interval, int> grove(4);
+    std::vector<std::pair<gdt::interval, int>> data;
+    for (int i = 0; i < 50; ++i) {
+        data.emplace_back(gdt::interval(i * 10, i * 10 + 5), i);
+    }
+    grove.insert_data("chr1", data, gst::sorted, gst::bulk);
+    const auto chr1 = grove.find_index("chr1");
+    ASSERT_TRUE(chr1.valid());
+    EXPECT_EQ(data_values(grove.intersect(gdt::interval{95, 120}, chr1)),
+              (std::vector<int>{9, 10, 11, 12}));
+
+    // Appending through the handle continues the bulk-built tree.
+    grove.insert_data(chr1, gdt::interval{1000, 1005}, 99, gst::sorted);
+    validate_grove_index(grove, "chr1", 4);
+
+    std::stringstream ss;
+    grove.serialize(ss);
+    auto copy = gst::grove<gdt::interval, int>::deserialize(ss);
+    const auto copy_chr1 = copy.find_index("chr1");
+    ASSERT_TRUE(copy_chr1.valid());
+    EXPECT_EQ(data_values(copy.intersect(gdt::interval{995, 1010}, copy_chr1)),
+              std::vector<int>{99});
+    copy.insert_data(copy_chr1, gdt::interval{2000, 2005}, 100, gst::sorted);
+    validate_grove_index(copy, "chr1", 4);
+}
+
+TEST(IndexHandleTest, GroveViewResolvesWithoutInterning) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    const fs::path path = fs::temp_directory_path() / "genogrove_index_handle_view.gg";
+    {
+        grove_t g(4);
+        for (size_t i = 0; i < 40; ++i) {
+            g.insert_data("chr1", gdt::interval{i * 10, i * 10 + 5}, static_cast<int>(i), gst::sorted);
+            g.insert_data("chr2", gdt::interval{i * 10, i * 10 + 5}, 100 + static_cast<int>(i),
+                          gst::sorted);
+        }
+        std::ofstream ofs(path, std::ios::binary);
+        g.serialize(ofs);
+    }
+
+    auto view = gst::grove_view<gdt::interval, int>::open(path.string());
+    const auto chr2 = view.resolve_index("chr2");
+    ASSERT_TRUE(chr2.valid());
+    EXPECT_FALSE(view.resolve_index("chr3").valid());
+
+    EXPECT_EQ(data_values(view.intersect(gdt::interval{95, 120}, chr2)),
+              (std::vector<int>{109, 110, 111, 112}));
+    EXPECT_EQ(data_values(view.intersect(gdt::interval{95, 120}, chr2)),
+              data_values(view.intersect(gdt::interval{95, 120}, "chr2")));
+    EXPECT_TRUE(view.intersect(gdt::interval{0, 1000}, view.resolve_index("chr3")).get_keys().empty());
+    EXPECT_EQ(view.flanking(gdt::interval{107, 108}, chr2).get_successor()->get_data(), 111);
+
+    fs::remove(path);
+}
+
+TEST(IndexHandleTest, HandleMapResolvesEachContigOnce) {
+    gst::grove<gdt::interval, int> grove(4);
+    gst::index_handle_map handles;
+
+    const auto a = handles.get(grove, 1, "chrB");
+    const auto b = handles.get(grove, 0, "chrA");
+    EXPECT_EQ(grove.get_index_name(a), "chrB");
+    EXPECT_EQ(grove.get_index_name(b), "chrA");
+
+    // Cached per id: the name is not consulted again.
+    EXPECT_EQ(handles.get(grove, 1, "ignored"), a);
+    EXPECT_FALSE(grove.find_index("ignored").valid());
+
+    // Negative ids resolve by name every time.
+    EXPECT_EQ(handles.get(grove, -1, "chrA"), b);
+
+    handles.clear();
+    EXPECT_EQ(handles.get(grove, 1, "chrA"), b);
+}
@@ -11,8 +11,18 @@
 
 // genogrove
 #include <genogrove/data_type/kmer.hpp>
+#include <genogrove/data_type/kmer_extractor.hpp>
+#include <genogrove/data_type/kmer_minimizer.hpp>
 #include <genogrove/structure/grove/grove.hpp>
 
+// standard
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
 namespace gst = genogrove::structure;
 namespace gdt = genogrove::data_type;
 
@@ -255,4 +265,130 @@ TEST_F(KmerGroveTest, MaxLengthKmer) {
     auto results = grove.intersect(k32, "seq1");
     ASSERT_EQ(results.get_keys().size(), 1);
     EXPECT_EQ(results.get_keys()[0]->get_value().get_k(), 32);
-}
\ No newline at end of file
+}
+// Build an index from raw encodings: sorted, deduplicated, counted
+TEST_F(KmerGroveTest, InsertKmersCountsDistinctKmers) {
+    std::vector<std::string> sequences = {"ACGTACGTTT", "NNACGTACGA", "acgtac"};
+    std::vector<uint64_t> encodings;
+    gdt::collect_kmer_encodings(sequences, 4, encodings);
+
+    std::map<std::string, int> expected;
+    for (const auto& seq : sequences) {
+        for (size_t i = 0; i + 4 <= seq.size(); ++i) {
+            std::string window = seq.substr(i, 4);
+            if (!gdt::kmer::is_valid(window)) continue;
+            ++expected[gdt::kmer(window).to_string()];
+        }
+    }
+
+    auto keys = grove.insert_kmers("seq1", encodings, 4);
+    ASSERT_EQ(keys.size(), expected.size());
+    EXPECT_EQ(grove.indexed_vertex_count(), expected.size());
+    auto want = expected.begin();
+    for (auto* key : keys) {
+        EXPECT_EQ(key->get_value().to_string(), want->first);
+        EXPECT_EQ(key->get_data(), want->second);
+        ++want;
+    }
+
+    auto results = grove.intersect(gdt::kmer("ACGT"), "seq1");
+    ASSERT_EQ(results.get_keys().size(), 1);
+    EXPECT_EQ(results.get_keys()[0]->get_data(), 4);
+
+    EXPECT_THROW(grove.insert_kmers("seq1", encodings, 4), std::invalid_argument);
+    EXPECT_THROW(grove.insert_kmers("seq2", encodings, 0), std::invalid_argument);
+}
+
+// A dataless grove holds just the distinct k-mers; a deep tree stays queryable
+TEST(KmerBulkBuildTest, DatalessIndexOfManyKmers) {
+    gst::grove<gdt::kmer> grove(4);
+    std::vector<uint64_t> encodings;
+    for (uint64_t i = 0; i < 5000; ++i) {
+        encodings.push_back((i * 7919) % 2000);  // every value 0..1999, repeated
+    }
+    auto keys = grove.insert_kmers("genome", encodings, 8);
+    ASSERT_EQ(keys.size(), 2000u);
+    for (uint64_t e = 0; e < 2000; e += 97) {
+        auto results = grove.intersect(gdt::kmer(e, 8), "genome");
+        ASSERT_EQ(results.get_keys().size(), 1u) << e;
+    }
+    EXPECT_TRUE(grove.intersect(gdt::kmer(2000, 8), "genome").get_keys().empty());
+}
+
+// Minimizer bucketing spreads k-mers over indices and keeps them findable
+TEST(KmerBulkBuildTest, BucketedBuildRoutesEveryKmer) {
+    const std::string genome =
+        "ACGTTGCAAGGCTTAACCGGTTAAGCTAGCTAGGATCCATGCATTGACGGATTACAGATTACACCGGTTAAGCTAGC"
+        "TTGACCATGGCAAGTCAGTCAGGCATCGATCGATGCTAGCTAGGCTTACCGATCGTAGCTAGCAAACGTTTGCAGTA";
+    const gdt::kmer_bucketing bucketing{.k = 15, .m = 7, .buckets = 8};
+    std::vector<uint64_t> encodings;
+    gdt::collect_kmer_encodings(std::vector<std::string>{genome, genome}, bucketing.k, encodings);
+    std::set<uint64_t> distinct(encodings.begin(), encodings.end());
+
+    gst::grove<gdt::kmer, int> serial(4);
+    gst::grove<gdt::kmer, int> parallel(4);
+    auto keys = serial.insert_kmers("g", encodings, bucketing);
+    auto keys_mt = parallel.insert_kmers("g", encodings, bucketing, 4);
+    ASSERT_EQ(keys.size(), distinct.size());
+    ASSERT_EQ(keys_mt.size(), distinct.size());
+    EXPECT_GT(serial.get_root_nodes().size(), 1u);
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(keys[i]->get_value(), keys_mt[i]->get_value());
+    }
+    for (const auto e : distinct) {
+        const gdt::kmer value(e, bucketing.k);
+        auto results = serial.intersect(value, bucketing.index_for("g", value));
+        ASSERT_EQ(results.get_keys().size(), 1u) << value.to_string();
+        EXPECT_GE(results.get_keys()[0]->get_data(), 2);
+    }
+
+    EXPECT_THROW(serial.insert_kmers("g", encodings, bucketing), std::invalid_argument);
+    EXPECT_THROW(serial.insert_kmers("h", encodings, gdt::kmer_bucketing{.k = 15, .m = 16}),
+                 std::invalid_argument);
+}
+
+// lookup_kmers resolves a whole read and agrees with one intersect per k-mer
+TEST(KmerLookupTest, ReadLookupMatchesPerKmerIntersect) {
+    std::mt19937_64 rng(5);
+    const char bases[] = "ACGT";
+    std::string genome;
+    for (int i = 0; i < 4000; ++i) genome.push_back(bases[rng() % 4]);
+
+    gst::grove<gdt::kmer, int> grove(5);
+    std::vector<uint64_t> encodings;
+    gdt::collect_kmer_encodings(std::vector<std::string>{genome}, 11, encodings, {.canonical = true});
+    grove.insert_kmers("genome", encodings, 11);
+    // A duplicate key: lookup must report both copies.
+    const auto dup = gdt::kmer(genome.substr(100, 11)).canonical();
+    grove.insert_data("genome", dup, -1);
+
+    for (int r = 0; r < 50; ++r) {
+        std::string read;
+        if (r % 2 == 0) {
+            read = genome.substr(rng() % 3800, 150);  // from the genome
+        } else {
+            for (int i = 0; i < 150; ++i) read.push_back(bases[rng() % 4]);
+        }
+        if (r == 4) read = genome.substr(95, 30) + "N" + genome.substr(95, 30);  // repeats + N
+        const auto matches = grove.lookup_kmers("genome", read, 11, {.canonical = true});
+
+        std::vector<std::pair<size_t, gdt::key<gdt::kmer, int>*>> expected;
+        for (const auto& hit : gdt::kmer_extractor(read, 11, {.canonical = true})) {
+            const auto result = grove.intersect(hit.value, "genome");
+            for (auto* key : result.get_keys()) {
+                expected.emplace_back(hit.position, key);
+            }
+        }
+        std::vector<std::pair<size_t, gdt::key<gdt::kmer, int>*>> actual;
+        for (const auto& m : matches) actual.emplace_back(m.position, m.key);
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        ASSERT_EQ(actual, expected) << "read " << r;
+        ASSERT_TRUE(std::is_sorted(matches.begin(), matches.end(),
+                                   [](const auto& a, const auto& b) { return a.position < b.position; }));
+    }
+
+    EXPECT_TRUE(grove.lookup_kmers("missing", genome.substr(0, 50), 11).empty());
+    EXPECT_THROW((void)grove.lookup_kmers("genome", "ACGT", 0), std::invalid_argument);
+}
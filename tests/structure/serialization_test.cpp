@@ -10,13 +10,17 @@
 
 #include <gtest/gtest.h>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <streambuf>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
+#include <genogrove/data_type/genomic_coordinate.hpp>
 #include <genogrove/data_type/serialization_traits.hpp>
 #include <genogrove/structure/grove/gg_block_format.hpp>
 #include <genogrove/structure/grove/grove.hpp>
@@ -51,11 +55,15 @@ void put_pod(std::string& s, const T& v) {
     s.append(p, sizeof(T));
 }
 
-// Start a grove stream: magic + order + num_indices. Callers append index
-// entries / directory fields to craft a corrupt header for the DoS bounds.
+// Start a grove stream: magic + footer offset (0 = none) + codec (zlib, no
+// dictionary) + order + num_indices. Callers append index entries / directory
+// fields to craft a corrupt header for the DoS bounds.
 std::string start_stream(std::uint32_t num_indices, int order = 3) {
     std::string s;
     s.append(gst::detail::grove_stream_magic.data(), gst::detail::grove_stream_magic.size());
+    put_pod<std::uint64_t>(s, 0);
+    put_pod<std::uint8_t>(s, static_cast<std::uint8_t>(gst::block_codec::zlib));
+    put_pod<std::uint32_t>(s, 0);
     put_pod<int>(s, order);
     put_pod<std::uint32_t>(s, num_indices);
     return s;
@@ -325,7 +333,8 @@ TEST(SerializationDoSTest, HugeBlockCountRejected) {
     put_pod<gst::detail::block_id>(bytes, 0u);           // ext_block_begin
     put_pod<std::uint64_t>(bytes, 0u);                   // leaf key count
     put_pod<std::uint64_t>(bytes, 0u);                   // external key count
-    // No block data follows: 4 billion blocks cannot be backed by 0 bytes.
+    put_pod<std::uint32_t>(bytes, 0xFFFFFFFFu);          // num_frames
+    // No frame data follows: 4 billion frames cannot be backed by 0 bytes.
     std::stringstream ss(bytes, std::ios::in | std::ios::binary);
     EXPECT_THROW((void)grove_t::deserialize(ss), std::runtime_error);
 }
@@ -366,6 +375,8 @@ TEST(SerializationDoSTest, HugeCompressedBlockLengthRejected) {
     put_pod<gst::detail::block_id>(bytes, 1u);           // ext_block_begin (block 0 is a node)
     put_pod<std::uint64_t>(bytes, 0u);                   // leaf key count
     put_pod<std::uint64_t>(bytes, 0u);                   // external key count
+    put_pod<std::uint32_t>(bytes, 1u);                   // num_frames
+    put_pod<std::uint32_t>(bytes, 1u);                   // frame block count
     put_pod<std::uint64_t>(bytes, std::uint64_t{1} << 40);  // clen = 1 TiB, no data follows
     std::stringstream ss(bytes, std::ios::in | std::ios::binary);
     EXPECT_THROW((void)grove_t::deserialize(ss), std::runtime_error);
@@ -374,9 +385,11 @@ TEST(SerializationDoSTest, HugeCompressedBlockLengthRejected) {
 TEST(SerializationDoSTest, HugeExternalKeyCountRejected) {
     // An external block's key count is read from the (decompressed) block; a
     // count above the writer's per-block chunk cap is rejected before parsing.
-    // The count is checked first, so the block body is just the count field.
+    // The count is checked first, so the block body is just the count field,
+    // wrapped in a one-block frame.
     using grove_t = gst::grove<gdt::interval, int>;
     std::string payload;
+    put_pod<std::uint32_t>(payload, sizeof(std::uint32_t));  // the block's length
     put_pod<std::uint32_t>(payload, gst::detail::max_external_keys_per_block + 1);
     std::string comp;
     gst::detail::block_deflater{}.compress(payload, comp);
@@ -386,6 +399,8 @@ TEST(SerializationDoSTest, HugeExternalKeyCountRejected) {
     put_pod<gst::detail::block_id>(bytes, 0u);           // ext_block_begin = 0 -> block 0 is external
     put_pod<std::uint64_t>(bytes, 0u);                   // leaf key count
     put_pod<std::uint64_t>(bytes, 0u);                   // external key count
+    put_pod<std::uint32_t>(bytes, 1u);                   // num_frames
+    put_pod<std::uint32_t>(bytes, 1u);                   // frame block count
     put_pod<std::uint64_t>(bytes, static_cast<std::uint64_t>(comp.size()));  // clen
     bytes += comp;
     std::stringstream ss(bytes, std::ios::in | std::ios::binary);
@@ -614,3 +629,567 @@ TEST(SerializationTest, SelfLoopInterleavedWithAnotherSourceRoundTrips) {
     EXPECT_EQ(in[0].source->get_data(), 2);  // a->target first
     EXPECT_EQ(in[1].source->get_data(), 1);  // then the self-loop
 }
+
+// ===========================================================================
+// Parallel deserialize: block inflation + parsing on a worker pool must give
+// exactly the serial reader's grove — same tree, same key storage order, same
+// overlay edge order — so re-serializing either yields identical bytes.
+// ===========================================================================
+
+namespace {
+
+// Multi-index grove with leaf, cross-index, external and self-loop edges plus
+// parallel edges, spread over many node blocks and several external blocks.
+gst::grove<gdt::interval, int, int> build_parallel_grove() {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    using key_t = gdt::key<gdt::interval, int>;
+    grove_t g(5);
+    std::vector<key_t*> keys;
+    for (const char* chrom : {"chr1", "chr2", "chr3"}) {
+        for (size_t i = 0; i < 700; ++i) {
+            keys.push_back(g.insert_data(chrom, gdt::interval{i * 10, i * 10 + 5},
+                                         static_cast<int>(keys.size()), gst::sorted));
+        }
+    }
+    for (size_t i = 0; i < 1100; ++i) {
+        keys.push_back(g.add_external_key(gdt::interval{i, i + 1}, static_cast<int>(keys.size())));
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+        g.add_edge(keys[i], keys[(i * 7919 + 13) % keys.size()], static_cast<int>(i));
+        if (i % 97 == 0) {
+            g.add_edge(keys[i], keys[i], -1);                     // self-loop
+            g.add_edge(keys[(i + 5) % keys.size()], keys[i], -2);  // parallel edges
+            g.add_edge(keys[(i + 5) % keys.size()], keys[i], -3);
+        }
+    }
+    return g;
+}
+
+std::string build_parallel_fixture() {
+    std::ostringstream os(std::ios::binary);
+    build_parallel_grove().serialize(os);
+    return os.str();
+}
+
+} // namespace
+
+TEST(SerializationTest, ParallelDeserializeMatchesSerial) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    const std::string bytes = build_parallel_fixture();
+
+    std::istringstream serial_in(bytes, std::ios::binary);
+    auto serial = grove_t::deserialize(serial_in);
+    // Re-serialize rather than compare against `bytes`: index order follows
+    // the root map's iteration order, which both readers rebuild identically
+    // but the original grove need not share.
+    std::ostringstream serial_out(std::ios::binary);
+    serial.serialize(serial_out);
+
+    for (std::size_t threads : {std::size_t{2}, std::size_t{4}, std::size_t{0}}) {
+        std::istringstream in(bytes, std::ios::binary);
+        auto parallel = grove_t::deserialize(in, threads);
+        EXPECT_EQ(parallel.edge_count(), serial.edge_count());
+        EXPECT_EQ(parallel.external_vertex_count(), serial.external_vertex_count());
+        EXPECT_EQ(parallel.indexed_vertex_count(), serial.indexed_vertex_count());
+
+        std::ostringstream out(std::ios::binary);
+        parallel.serialize(out);
+        EXPECT_TRUE(out.str() == serial_out.str()) << "threads=" << threads;
+
+        // Spot-check the overlay directly: neighbor order of a key with a
+        // self-loop and parallel incoming edges.
+        auto sk = serial.intersect(gdt::interval{0, 5}, "chr1").get_keys();
+        auto pk = parallel.intersect(gdt::interval{0, 5}, "chr1").get_keys();
+        ASSERT_EQ(sk.size(), 1u);
+        ASSERT_EQ(pk.size(), 1u);
+        auto s_in = serial.graph().get_in_edge_list(sk[0]);
+        auto p_in = parallel.graph().get_in_edge_list(pk[0]);
+        ASSERT_EQ(s_in.size(), p_in.size());
+        for (size_t i = 0; i < s_in.size(); ++i) {
+            EXPECT_EQ(s_in[i].source->get_data(), p_in[i].source->get_data());
+            EXPECT_EQ(s_in[i].metadata, p_in[i].metadata);
+        }
+    }
+}
+
+TEST(SerializationTest, ParallelDeserializeCorruptBlockThrows) {
+    // A corrupt block parsed on a worker must surface as the same
+    // runtime_error the serial reader throws, after the pool has joined and
+    // every already-parsed node has been freed.
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    std::string bytes = build_parallel_fixture();
+    bytes.resize(bytes.size() - 3);  // truncate the final block
+    std::istringstream in(bytes, std::ios::binary);
+    EXPECT_THROW((void)grove_t::deserialize(in, 4), std::runtime_error);
+
+    bytes = build_parallel_fixture();
+    bytes[bytes.size() / 2] ^= 0x5A;  // garble a block body mid-stream
+    std::istringstream in2(bytes, std::ios::binary);
+    EXPECT_THROW((void)grove_t::deserialize(in2, 4), std::runtime_error);
+}
+
+// ===========================================================================
+// Parallel serialize: blocks compressed on a worker pool are written in
+// block-id order, so the stream is byte-identical for every thread count, and
+// the trailing block directory (footer) indexes every block.
+// ===========================================================================
+
+namespace {
+
+// Streambuf sink that accepts writes but inherits the base class's default
+// seekoff, so tellp() reports -1 — a pipe/socket-like output.
+class non_seekable_sink : public std::streambuf {
+public:
+    const std::string& bytes() const { return data_; }
+protected:
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            data_.push_back(traits_type::to_char_type(ch));
+        }
+        return traits_type::not_eof(ch);
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        data_.append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+private:
+    std::string data_;
+};
+
+template <typename T>
+T get_pod(const std::string& s, std::size_t pos) {
+    T v;
+    std::memcpy(&v, s.data() + pos, sizeof(T));
+    return v;
+}
+
+// Offset of the footer-offset field: right after the magic.
+constexpr std::size_t footer_field_pos = 4;
+
+} // namespace
+
+TEST(SerializationTest, ParallelSerializeIsByteIdentical) {
+    const auto g = build_parallel_grove();
+    std::ostringstream serial(std::ios::binary);
+    g.serialize(serial);
+
+    for (std::size_t threads : {std::size_t{2}, std::size_t{4}, std::size_t{0}}) {
+        std::ostringstream parallel(std::ios::binary);
+        g.serialize(parallel, threads);
+        EXPECT_TRUE(parallel.str() == serial.str()) << "threads=" << threads;
+    }
+}
+
+TEST(SerializationTest, SerializeFooterIndexesEveryFrame) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    const auto g = build_parallel_grove();
+    std::ostringstream os(std::ios::binary);
+    g.serialize(os, 4);
+    const std::string bytes = os.str();
+
+    // The footer runs to the end of the stream, one (uint64 offset, uint32
+    // first block) entry per frame. Each offset must point at a frame's block
+    // count, each frame must end exactly where the next begins, the first
+    // block ids must advance by each frame's count, and the last frame must
+    // end at the footer.
+    constexpr std::size_t entry = sizeof(std::uint64_t) + sizeof(std::uint32_t);
+    const auto footer_offset = get_pod<std::uint64_t>(bytes, footer_field_pos);
+    ASSERT_NE(footer_offset, 0u);
+    ASSERT_LT(footer_offset, bytes.size());
+    ASSERT_EQ((bytes.size() - footer_offset) % entry, 0u);
+    const std::size_t num_frames = (bytes.size() - footer_offset) / entry;
+    ASSERT_GT(num_frames, 1u);
+
+    std::uint64_t expected = get_pod<std::uint64_t>(bytes, footer_offset);
+    std::uint32_t first = 0;
+    for (std::size_t f = 0; f < num_frames; ++f) {
+        const auto off = get_pod<std::uint64_t>(bytes, footer_offset + f * entry);
+        EXPECT_EQ(off, expected) << "frame " << f;
+        EXPECT_EQ(get_pod<std::uint32_t>(bytes, footer_offset + f * entry + sizeof(off)), first);
+        const auto count = get_pod<std::uint32_t>(bytes, off);
+        EXPECT_EQ(count, 1u);  // default: one block per frame
+        first += count;
+        expected = off + sizeof(count) + sizeof(std::uint64_t) +
+                   get_pod<std::uint64_t>(bytes, off + sizeof(count));
+    }
+    EXPECT_EQ(expected, footer_offset);
+
+    // The footer is consumed by deserialize: trailing bytes stay readable.
+    std::istringstream in(bytes + "TAIL", std::ios::binary);
+    auto restored = grove_t::deserialize(in);
+    EXPECT_EQ(restored.edge_count(), g.edge_count());
+    std::string tail(4, '\0');
+    in.read(tail.data(), 4);
+    EXPECT_EQ(tail, "TAIL");
+}
+
+TEST(SerializationTest, NonSeekableSinkLeavesFooterOffsetZero) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    const auto g = build_parallel_grove();
+    std::ostringstream seekable(std::ios::binary);
+    g.serialize(seekable);
+
+    non_seekable_sink sink;
+    std::ostream os(&sink);
+    g.serialize(os, 2);
+    ASSERT_TRUE(os.good());
+
+    // Same bytes except the footer-offset field, which could not be patched.
+    std::string expected = seekable.str();
+    ASSERT_EQ(sink.bytes().size(), expected.size());
+    EXPECT_EQ(get_pod<std::uint64_t>(sink.bytes(), footer_field_pos), 0u);
+    std::memset(expected.data() + footer_field_pos, 0, sizeof(std::uint64_t));
+    EXPECT_TRUE(sink.bytes() == expected);
+
+    std::istringstream in(sink.bytes(), std::ios::binary);
+    auto restored = grove_t::deserialize(in);
+    EXPECT_EQ(restored.edge_count(), g.edge_count());
+}
+
+TEST(SerializationTest, ParallelSerializePropagatesSinkFailure) {
+    // A sink that fails mid-stream must surface as runtime_error after the
+    // compression workers have joined, not hang or terminate.
+    const auto g = build_parallel_grove();
+    std::ostringstream os(std::ios::binary);
+    os.setstate(std::ios::badbit);
+    EXPECT_THROW(g.serialize(os, 4), std::runtime_error);
+}
+
+// ===========================================================================
+// Block codecs: the codec (and zstd dictionary) recorded in the header drives
+// every reader; each available codec restores exactly the zlib grove.
+// ===========================================================================
+
+namespace {
+
+// Offset of the codec byte: after the magic and the footer-offset field.
+constexpr std::size_t codec_field_pos = 12;
+
+std::vector<gst::block_codec> available_codecs() {
+    std::vector<gst::block_codec> out;
+    for (auto c : {gst::block_codec::stored, gst::block_codec::zlib, gst::block_codec::zstd,
+                   gst::block_codec::lz4}) {
+        if (gst::block_codec_available(c)) {
+            out.push_back(c);
+        }
+    }
+    return out;
+}
+
+// Deserialize `bytes` and re-serialize with the default (zlib) options, so
+// groves restored from different codecs compare byte-for-byte.
+std::string reserialize_zlib(const std::string& bytes, std::size_t threads = 1) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    std::istringstream in(bytes, std::ios::binary);
+    auto g = grove_t::deserialize(in, threads);
+    std::ostringstream out(std::ios::binary);
+    g.serialize(out);
+    return out.str();
+}
+
+} // namespace
+
+TEST(SerializationTest, BlockCodecNamesRoundTrip) {
+    for (auto c : {gst::block_codec::stored, gst::block_codec::zlib, gst::block_codec::zstd,
+                   gst::block_codec::lz4}) {
+        EXPECT_EQ(gst::parse_block_codec(gst::to_string(c)), c);
+    }
+    EXPECT_THROW((void)gst::parse_block_codec("brotli"), std::invalid_argument);
+    EXPECT_TRUE(gst::block_codec_available(gst::block_codec::stored));
+    EXPECT_TRUE(gst::block_codec_available(gst::block_codec::zlib));
+}
+
+TEST(SerializationTest, EveryAvailableCodecRoundTrips) {
+    const auto g = build_parallel_grove();
+    std::ostringstream zlib_out(std::ios::binary);
+    g.serialize(zlib_out);
+    const std::string expected = reserialize_zlib(zlib_out.str());
+
+    for (auto codec : available_codecs()) {
+        gst::serialize_options opts;
+        opts.codec = codec;
+        opts.num_threads = 2;
+        std::ostringstream os(std::ios::binary);
+        g.serialize(os, opts);
+        const std::string bytes = os.str();
+        EXPECT_EQ(static_cast<gst::block_codec>(bytes[codec_field_pos]), codec);
+
+        EXPECT_TRUE(reserialize_zlib(bytes) == expected) << gst::to_string(codec);
+        EXPECT_TRUE(reserialize_zlib(bytes, 4) == expected) << gst::to_string(codec) << " parallel";
+    }
+}
+
+TEST(SerializationTest, StoredCodecIsLargestAndStillDetectsTruncation) {
+    using grove_t = gst::grove<gdt::interval, int, int>;
+    const auto g = build_parallel_grove();
+    gst::serialize_options opts;
+    opts.codec = gst::block_codec::stored;
+    std::ostringstream stored(std::ios::binary);
+    g.serialize(stored, opts);
+    std::ostringstream zlib(std::ios::binary);
+    g.serialize(zlib);
+    EXPECT_GT(stored.str().size(), zlib.str().size());
+
+    // Stored blocks are parsed straight out of the read buffer; a frame cut
+    // short must still fail the parse rather than read past it.
+    std::string bytes = stored.str();
+    const auto footer = get_pod<std::uint64_t>(bytes, footer_field_pos);
+    const std::size_t last_entry = bytes.size() - sizeof(std::uint64_t) - sizeof(std::uint32_t);
+    const auto last_frame = get_pod<std::uint64_t>(bytes, last_entry);
+    ASSERT_LT(last_frame, footer);
+    const std::size_t clen_pos = last_frame + sizeof(std::uint32_t);
+    auto clen = get_pod<std::uint64_t>(bytes, clen_pos);
+    clen -= 2;  // claim a shorter frame
+    std::memcpy(bytes.data() + clen_pos, &clen, sizeof(clen));
+    std::istringstream in(bytes, std::ios::binary);
+    EXPECT_THROW((void)grove_t::deserialize(in), std::runtime_error);
+}
+
+TEST(SerializationTest, ColumnarKeysRoundTripAndShrinkBlocks) {
+    // Node and external blocks store their keys as a gdt::key_column: start
+    // deltas, lengths and packed strands instead of a strand byte and two raw
+    // size_t per key. Uncompressed, every key still carries its int data and
+    // two edge-list counts, but its coordinates now take well under half of
+    // their raw size.
+    using grove_t = gst::grove<gdt::genomic_coordinate, int>;
+    constexpr std::size_t n = 3000;
+    const char strands[] = {'+', '-', '.'};
+    grove_t g(16);
+    for (std::size_t i = 0; i < n; ++i) {
+        g.insert_data("chr1", gdt::genomic_coordinate{strands[i % 3], 50000 + i * 120, 50000 + i * 120 + 80},
+                      static_cast<int>(i), gst::sorted);
+    }
+    for (std::size_t i = 0; i < 600; ++i) {
+        g.add_external_key(gdt::genomic_coordinate{'+', 900000 - i * 7, 900000 - i * 7 + 3},
+                           static_cast<int>(i));
+    }
+
+    gst::serialize_options opts;
+    opts.codec = gst::block_codec::stored;
+    std::ostringstream os(std::ios::binary);
+    g.serialize(os, opts);
+    const std::string bytes = os.str();
+    const std::size_t per_key_rest = sizeof(int) + 2 * sizeof(std::uint32_t);
+    const std::size_t raw_key = 1 + 2 * sizeof(std::size_t);
+    EXPECT_LT(bytes.size(), (n + 600) * (per_key_rest + raw_key / 2));
+
+    std::istringstream in(bytes, std::ios::binary);
+    auto restored = grove_t::deserialize(in);
+    const auto hits = restored.intersect(gdt::genomic_coordinate{'-', 50000 + 120, 50000 + 130}, "chr1");
+    ASSERT_EQ(hits.get_keys().size(), 1u);
+    EXPECT_EQ(hits.get_keys()[0]->get_data(), 1);
+    EXPECT_EQ(hits.get_keys()[0]->get_value().get_strand(), '-');
+
+    std::ostringstream again(std::ios::binary);
+    restored.serialize(again, opts);
+    EXPECT_TRUE(again.str() == bytes);
+}
+
+TEST(SerializationTest, EdgeMetadataTableRoundTripsAndShrinksBlocks) {
+    // A block writes each distinct edge metadata value once and every edge
+    // ref names it by a 4-byte index, so transcript names repeated across a
+    // chain (and written again under each edge's other endpoint) cost their
+    // full length only once per block.
+    using grove_t = gst::grove<gdt::interval, int, std::string>;
+    constexpr std::size_t n = 2000;
+    grove_t g(16);
+    std::vector<gdt::key<gdt::interval, int>*> keys;
+    for (std::size_t i = 0; i < n; ++i) {
+        keys.push_back(g.insert_data("chr1", gdt::interval{i * 100, i * 100 + 60},
+                                     static_cast<int>(i), gst::sorted));
+    }
+    const std::string prefix = "transcript_with_a_rather_long_identifier_";
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        g.add_edge(keys[i], keys[i + 1], prefix + std::to_string(i % 4));
+    }
+
+    gst::serialize_options opts;
+    opts.codec = gst::block_codec::stored;
+    std::ostringstream os(std::ios::binary);
+    g.serialize(os, opts);
+    const std::string bytes = os.str();
+    // Inline, the two copies of every name alone would exceed this.
+    EXPECT_LT(bytes.size(), 2 * (n - 1) * prefix.size());
+
+    std::istringstream in(bytes, std::ios::binary);
+    auto restored = grove_t::deserialize(in);
+    const auto hits = restored.intersect(gdt::interval{500, 510}, "chr1");
+    ASSERT_EQ(hits.get_keys().size(), 1u);
+    auto* k5 = hits.get_keys()[0];
+    EXPECT_EQ(restored.get_edges(k5), (std::vector<std::string>{prefix + "1"}));
+    EXPECT_EQ(restored.get_in_edges(k5), (std::vector<std::string>{prefix + "0"}));
+    EXPECT_EQ(restored.edge_count(), n - 1);
+
+    const fs::path path = fs::temp_directory_path() / "genogrove_edge_metadata_table.gg";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << bytes;
+    }
+    {
+        auto view = gst::grove_view<gdt::interval, int, std::string>::open(path.string());
+        const auto vhits = view.intersect(gdt::interval{500, 510}, "chr1");
+        ASSERT_EQ(vhits.get_keys().size(), 1u);
+        EXPECT_EQ(view.get_in_edges(vhits.get_keys()[0]), (std::vector<std::string>{prefix + "0"}));
+    }
+    fs::remove(path);
+
+    std::ostringstream again(std::ios::binary);
+    restored.serialize(again, opts);
+    EXPECT_TRUE(again.str() == bytes);
+}
+
+TEST(SerializationTest, ZstdDictionaryRoundTrips) {
+    if (!gst::block_codec_available(gst::block_codec::zstd)) {
+        GTEST_SKIP() << "built without zstd";
+    }
+    const auto g = build_parallel_grove();
+    std::ostringstream zlib_out(std::ios::binary);
+    g.serialize(zlib_out);
+    const std::string expected = reserialize_zlib(zlib_out.str());
+
+    gst::serialize_options opts;
+    opts.codec = gst::block_codec::zstd;
+    opts.dictionary_size = 4096;
+    std::ostringstream with_dict(std::ios::binary);
+    g.serialize(with_dict, opts);
+    const std::string bytes = with_dict.str();
+    const auto dict_len = get_pod<std::uint32_t>(bytes, codec_field_pos + 1);
+    EXPECT_GT(dict_len, 0u);
+    EXPECT_LE(dict_len, 4096u);
+    EXPECT_TRUE(reserialize_zlib(bytes) == expected);
+    EXPECT_TRUE(reserialize_zlib(bytes, 4) == expected);
+
+    // Same output for every worker count, dictionary included.
+    opts.num_threads = 4;
+    std::ostringstream parallel(std::ios::binary);
+    g.serialize(parallel, opts);
+    EXPECT_TRUE(parallel.str() == bytes);
+}
+
+TEST(SerializationTest, CodecOptionsValidated) {
+    const auto g = build_parallel_grove();
+    std::ostringstream os(std::ios::binary);
+
+    gst::serialize_options dict_without_zstd;
+    dict_without_zstd.codec = gst::block_codec::lz4;
+    dict_without_zstd.dictionary_size = 1024;
+    EXPECT_THROW(g.serialize(os, dict_without_zstd), std::invalid_argument);
+
+    for (auto codec : {gst::block_codec::zstd, gst::block_codec::lz4}) {
+        if (!gst::block_codec_available(codec)) {
+            gst::serialize_options opts;
+            opts.codec = codec;
+            EXPECT_THROW(g.serialize(os, opts), std::runtime_error) << gst::to_string(codec);
+        }
+    }
+}
+
+TEST(SerializationDoSTest, UnknownCodecRejected) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    std::string bytes = start_stream(/*num_indices=*/0);
+    bytes[codec_field_pos] = 0x7F;
+    std::istringstream is(bytes, std::ios::binary);
+    EXPECT_THROW((void)grove_t::deserialize(is), std::runtime_error);
+}
+
+TEST(SerializationDoSTest, HugeDictionaryLengthRejected) {
+    using grove_t = gst::grove<gdt::interval, int>;
+    std::string bytes = start_stream(/*num_indices=*/0);
+    const std::uint32_t huge = 0xFFFFFFFFu;
+    std::memcpy(bytes.data() + codec_field_pos + 1, &huge, sizeof(huge));
+    std::istringstream is(bytes, std::ios::binary);
+    EXPECT_THROW((void)grove_t::deserialize(is), std::runtime_error);
+}
+
+// ===========================================================================
+// Frame packing: consecutive blocks compressed as one frame. Packing changes
+// only how blocks are grouped on disk, never what they restore to.
+// ===========================================================================
+
+namespace {
+
+// Frames in a serialized stream, counted from its footer.
+std::size_t frames_in(const std::string& bytes) {
+    const auto footer = get_pod<std::uint64_t>(bytes, footer_field_pos);
+    return (bytes.size() - footer) / (sizeof(std::uint64_t) + sizeof(std::uint32_t));
+}
+
+} // namespace
+
+TEST(SerializationTest, PackedFramesRoundTrip) {
+    const auto g = build_parallel_grove();
+    std::ostringstream single(std::ios::binary);
+    g.serialize(single);
+    const std::string expected = reserialize_zlib(single.str());
+    const std::size_t single_frames = frames_in(single.str());
+
+    for (std::size_t per_frame : {std::size_t{4}, std::size_t{16},
+                                  std::size_t{gst::detail::max_blocks_per_frame}}) {
+        for (auto codec : available_codecs()) {
+            gst::serialize_options opts;
+            opts.codec = codec;
+            opts.blocks_per_frame = per_frame;
+            std::ostringstream os(std::ios::binary);
+            g.serialize(os, opts);
+            const std::string bytes = os.str();
+            EXPECT_LT(frames_in(bytes), single_frames) << per_frame;
+
+            EXPECT_TRUE(reserialize_zlib(bytes) == expected)
+                << per_frame << " " << gst::to_string(codec);
+            EXPECT_TRUE(reserialize_zlib(bytes, 4) == expected)
+                << per_frame << " " << gst::to_string(codec) << " parallel";
+
+            // Worker count never changes the packed output either.
+            opts.num_threads = 4;
+            std::ostringstream parallel(std::ios::binary);
+            g.serialize(parallel, opts);
+            EXPECT_TRUE(parallel.str() == bytes) << per_frame;
+        }
+    }
+}
+
+TEST(SerializationTest, BlocksPerFrameValidated) {
+    const auto g = build_parallel_grove();
+    std::ostringstream os(std::ios::binary);
+    for (std::size_t per_frame : {std::size_t{0}, std::size_t{gst::detail::max_blocks_per_frame} + 1}) {
+        gst::serialize_options opts;
+        opts.blocks_per_frame = per_frame;
+        EXPECT_THROW(g.serialize(os, opts), std::invalid_argument) << per_frame;
+    }
+}
+
+TEST(SerializationDoSTest, FrameBlockCountOutOfRangeRejected) {
+    // A frame's block count is file-controlled: zero, or more blocks than the
+    // directory has left, is rejected before the frame is read.
+    using grove_t = gst::grove<gdt::interval, int>;
+    for (std::uint32_t count : {0u, 2u}) {
+        std::string bytes = start_stream(/*num_indices=*/0);
+        put_pod<gst::detail::block_id>(bytes, 1u);  // num_blocks
+        put_pod<gst::detail::block_id>(bytes, 0u);  // ext_block_begin
+        put_pod<std::uint64_t>(bytes, 0u);          // leaf key count
+        put_pod<std::uint64_t>(bytes, 0u);          // external key count
+        put_pod<std::uint32_t>(bytes, 1u);          // num_frames
+        put_pod<std::uint32_t>(bytes, count);       // frame block count
+        put_pod<std::uint64_t>(bytes, 0u);          // clen
+        for (std::size_t threads : {std::size_t{1}, std::size_t{2}}) {
+            std::istringstream is(bytes, std::ios::binary);
+            EXPECT_THROW((void)grove_t::deserialize(is, threads), std::runtime_error)
+                << count << " threads=" << threads;
+        }
+    }
+}
+
+TEST(SerializationDoSTest, FrameBlockTableMismatchRejected) {
+    // The frame's per-block length table must exactly cover its bytes.
+    std::vector<std::string_view> blocks;
+    std::string frame;
+    put_pod<std::uint32_t>(frame, 3u);
+    frame += "abc";
+    gst::detail::split_frame(frame, 1, blocks);
+    ASSERT_EQ(blocks.size(), 1u);
+    EXPECT_EQ(blocks[0], "abc");
+
+    EXPECT_THROW(gst::detail::split_frame(frame, 2, blocks), std::runtime_error);        // table too short
+    EXPECT_THROW(gst::detail::split_frame(frame + "d", 1, blocks), std::runtime_error);  // trailing bytes
+    EXPECT_THROW(gst::detail::split_frame(frame.substr(0, 6), 1, blocks), std::runtime_error);
+}
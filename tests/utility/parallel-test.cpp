@@ -0,0 +1,123 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#include <gtest/gtest.h>
+#include <genogrove/utility/parallel.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace ggu = genogrove::utility;
+
+TEST(parallel, everyIndexRunsExactlyOnce)
+{
+    for (std::size_t threads : {std::size_t{1}, std::size_t{3}, std::size_t{0}}) {
+        std::vector<std::atomic<int>> hits(1000);
+        ggu::parallel_for(hits.size(), threads, [&](std::size_t i) { hits[i].fetch_add(1); });
+        for (const auto& h : hits) {
+            EXPECT_EQ(h.load(), 1);
+        }
+    }
+}
+
+TEST(parallel, workerStateIsPerWorker)
+{
+    // Each worker gets its own default-constructed state; summing the per-item
+    // contributions through it must still account for every item.
+    struct counter { std::size_t n = 0; };
+    std::atomic<std::size_t> total{0};
+    ggu::parallel_for<counter>(500, 4, [&](counter& c, std::size_t) {
+        ++c.n;
+        total.fetch_add(1);
+    });
+    EXPECT_EQ(total.load(), 500u);
+}
+
+TEST(parallel, firstExceptionIsRethrown)
+{
+    EXPECT_THROW(ggu::parallel_for(100, 4, [](std::size_t i) {
+        if (i == 42) {
+            throw std::runtime_error("boom");
+        }
+    }), std::runtime_error);
+}
+
+TEST(parallel, emptyRangeRunsNothing)
+{
+    bool ran = false;
+    ggu::parallel_for(0, 4, [&](std::size_t) { ran = true; });
+    EXPECT_FALSE(ran);
+}
+
+TEST(parallel, resolveThreadCount)
+{
+    EXPECT_EQ(ggu::resolve_thread_count(3), 3u);
+    EXPECT_GE(ggu::resolve_thread_count(0), 1u);
+}
+
+TEST(parallel, orderedConsumesInIndexOrder)
+{
+    for (std::size_t threads : {std::size_t{1}, std::size_t{4}, std::size_t{0}}) {
+        struct no_state {};
+        std::vector<std::size_t> seen;
+        ggu::parallel_ordered<no_state>(
+            1000, threads, 8,
+            [](no_state&, std::size_t i) { return i * 3; },
+            [&](std::size_t i, std::size_t&& v) {
+                EXPECT_EQ(v, i * 3);
+                seen.push_back(i);
+            });
+        ASSERT_EQ(seen.size(), 1000u);
+        for (std::size_t i = 0; i < seen.size(); ++i) {
+            EXPECT_EQ(seen[i], i);
+        }
+    }
+}
+
+TEST(parallel, orderedWindowBoundsInFlightItems)
+{
+    // Producers may run at most `window` items ahead of the consumer. A slot
+    // frees as soon as its item is handed to consume, so while item c is
+    // being consumed producers may already claim up to c + window.
+    struct no_state {};
+    constexpr std::size_t window = 3;
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<bool> overran{false};
+    ggu::parallel_ordered<no_state>(
+        200, 4, window,
+        [&](no_state&, std::size_t i) {
+            if (i > consumed.load() + window) {
+                overran.store(true);
+            }
+            return i;
+        },
+        [&](std::size_t, std::size_t&&) { consumed.fetch_add(1); });
+    EXPECT_FALSE(overran.load());
+    EXPECT_EQ(consumed.load(), 200u);
+}
+
+TEST(parallel, orderedRethrowsFromEitherSide)
+{
+    struct no_state {};
+    EXPECT_THROW(ggu::parallel_ordered<no_state>(
+        100, 4, 4,
+        [](no_state&, std::size_t i) {
+            if (i == 17) {
+                throw std::runtime_error("produce");
+            }
+            return i;
+        },
+        [](std::size_t, std::size_t&&) {}), std::runtime_error);
+
+    EXPECT_THROW(ggu::parallel_ordered<no_state>(
+        100, 4, 4,
+        [](no_state&, std::size_t i) { return i; },
+        [](std::size_t i, std::size_t&&) {
+            if (i == 50) {
+                throw std::runtime_error("consume");
+            }
+        }), std::runtime_error);
+}
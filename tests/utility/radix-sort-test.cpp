@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * See the LICENSE file in the root of the repository for more information.
+ */
+
+#include <gtest/gtest.h>
+#include <genogrove/utility/radix_sort.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST(radix_sort, matchesStdSort)
+{
+    std::mt19937_64 rng(42);
+    for (unsigned bits : {8u, 20u, 62u, 64u}) {
+        std::vector<std::uint64_t> values(5000);
+        for (auto& v : values) {
+            v = bits == 64 ? rng() : rng() & ((std::uint64_t{1} << bits) - 1);
+        }
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        genogrove::utility::radix_sort(values, bits);
+        EXPECT_EQ(values, expected) << bits;
+    }
+}
+
+TEST(radix_sort, trivialInputs)
+{
+    std::vector<std::uint64_t> empty;
+    genogrove::utility::radix_sort(empty);
+    EXPECT_TRUE(empty.empty());
+
+    std::vector<std::uint64_t> same(10, 7);
+    genogrove::utility::radix_sort(same, 16);
+    EXPECT_EQ(same, std::vector<std::uint64_t>(10, 7));
+
+    EXPECT_THROW(genogrove::utility::radix_sort(same, 65), std::invalid_argument);
+}